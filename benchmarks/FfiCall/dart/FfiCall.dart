@@ -78,6 +78,44 @@ class Int64Mintx01 extends FfiBenchmarkBase {
   }
 }
 
+typedef NativeFunction1Int64Batch = Void Function(Pointer<Int64>, IntPtr);
+typedef Function1Int64Batch = void Function(Pointer<Int64>, int);
+
+// Makes the same N calls as Int64x01 through a single non-leaf call, which
+// applies Function1Int64 to each element of a buffer filled from Dart. This
+// pays for the transition to native code once instead of N times.
+class Int64x01Batched extends FfiBenchmarkBase {
+  final Function1Int64Batch f;
+  late Pointer<Int64> buffer;
+
+  Int64x01Batched()
+      : f = ffiTestFunctions.lookupFunction<NativeFunction1Int64Batch,
+            Function1Int64Batch>('Function1Int64Batch'),
+        super('FfiCall.Int64x01Batched');
+
+  static bool get isSupported =>
+      ffiTestFunctions.providesSymbol('Function1Int64Batch');
+
+  @override
+  void setup() => buffer = calloc(N);
+
+  @override
+  void teardown() => calloc.free(buffer);
+
+  @override
+  void run() {
+    for (int i = 0; i < N; i++) {
+      buffer[i] = i;
+    }
+    f(buffer, N);
+    int x = 0;
+    for (int i = 0; i < N; i++) {
+      x += buffer[i];
+    }
+    expectEquals(x, N * (N - 1) / 2 + N * 42);
+  }
+}
+
 //
 // Main driver.
 //
@@ -116,6 +154,8 @@ void main(List<String> args) {
     Int64x20NativeLeaf.new,
     Int64Mintx01.new,
     () => Int64Mintx01(isLeaf: true),
+    // Older prebuilt native libraries do not have the batched function.
+    if (Int64x01Batched.isSupported) Int64x01Batched.new,
     Floatx01.new,
     Floatx02.new,
     Floatx04.new,
@@ -178,3 +178,9 @@ void* Function20Handle(void* a,
                        void* t) {
   return a;
 }
+
+void Function1Int64Batch(int64_t* xs, intptr_t count) {
+  for (intptr_t i = 0; i < count; i++) {
+    xs[i] = Function1Int64(xs[i]);
+  }
+}
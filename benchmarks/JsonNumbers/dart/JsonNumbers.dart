@@ -0,0 +1,94 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measure encoding and decoding of JSON payloads dominated by numbers, like
+// metrics and coordinates.
+
+import 'dart:convert';
+import 'dart:math';
+
+import 'package:benchmark_harness/benchmark_harness.dart';
+
+int sink = 0;
+
+final Random random = Random(42);
+
+// Doubles with a fractional part, which need the shortest round-trip digits.
+final List<double> fractions =
+    List.generate(1000, (_) => random.nextDouble() * 1000);
+
+// Integral doubles, as produced by computations on whole numbers.
+final List<double> integrals =
+    List.generate(1000, (_) => random.nextInt(1 << 30).toDouble());
+
+final List<Map<String, Object>> points = List.generate(
+    200,
+    (i) => {
+          'id': i,
+          'x': random.nextDouble() * 360 - 180,
+          'y': random.nextDouble() * 180 - 90,
+          'z': random.nextInt(10000).toDouble(),
+        });
+
+final String encodedFractions = jsonEncode(fractions);
+final String encodedPoints = jsonEncode(points);
+
+class EncodeFractions extends BenchmarkBase {
+  EncodeFractions() : super('JsonNumbers.encode.fractions');
+
+  @override
+  void run() {
+    sink += jsonEncode(fractions).length;
+  }
+}
+
+class EncodeIntegrals extends BenchmarkBase {
+  EncodeIntegrals() : super('JsonNumbers.encode.integrals');
+
+  @override
+  void run() {
+    sink += jsonEncode(integrals).length;
+  }
+}
+
+class EncodePoints extends BenchmarkBase {
+  EncodePoints() : super('JsonNumbers.encode.points');
+
+  @override
+  void run() {
+    sink += jsonEncode(points).length;
+  }
+}
+
+class DecodeFractions extends BenchmarkBase {
+  DecodeFractions() : super('JsonNumbers.decode.fractions');
+
+  @override
+  void run() {
+    sink += (jsonDecode(encodedFractions) as List).length;
+  }
+}
+
+class DecodePoints extends BenchmarkBase {
+  DecodePoints() : super('JsonNumbers.decode.points');
+
+  @override
+  void run() {
+    sink += (jsonDecode(encodedPoints) as List).length;
+  }
+}
+
+void main() {
+  final benchmarks = [
+    EncodeFractions(),
+    EncodeIntegrals(),
+    EncodePoints(),
+    DecodeFractions(),
+    DecodePoints(),
+  ];
+  for (final benchmark in benchmarks) {
+    benchmark.report();
+  }
+  if (sink == 0) throw StateError('Unexpected sink: $sink');
+}
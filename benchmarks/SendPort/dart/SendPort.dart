@@ -174,6 +174,70 @@ class SendPortBenchmark {
   }
 }
 
+// Measures throughput of many isolates sending to a single receive port, which
+// contends on the destination's message queue. Time from the first send until
+// the last message is received, divided by the number of messages.
+class FanInBenchmark {
+  final int senders;
+  final int messagesPerSender;
+
+  double usPerMessage = 0.0;
+
+  FanInBenchmark(this.senders, this.messagesPerSender);
+
+  Future report() async {
+    // Warmup.
+    await measure();
+
+    await measure();
+    print('SendPort.FanIn.$senders(RunTimeRaw): $usPerMessage us.');
+  }
+
+  // Sets [usPerMessage] as side-effect.
+  Future measure() async {
+    final total = senders * messagesPerSender;
+    final ready = <SendPort>[];
+    final done = Completer<void>();
+    final sw = Stopwatch();
+    int received = 0;
+
+    final port = ReceivePort();
+    port.listen((message) {
+      if (message is SendPort) {
+        ready.add(message);
+        if (ready.length == senders) {
+          sw.start();
+          for (final sender in ready) {
+            sender.send(messagesPerSender);
+          }
+        }
+      } else if (++received == total) {
+        sw.stop();
+        done.complete();
+      }
+    });
+    for (int i = 0; i < senders; i++) {
+      await Isolate.spawn(fanInSender, port.sendPort);
+    }
+    await done.future;
+    port.close();
+
+    usPerMessage = sw.elapsedMicroseconds / total;
+  }
+}
+
+// Sends the requested number of messages to [receiver] once told to start.
+void fanInSender(SendPort receiver) {
+  final start = RawReceivePort();
+  start.handler = (count) {
+    start.close();
+    for (int i = 0; i < count; i++) {
+      receiver.send(i);
+    }
+  };
+  receiver.send(start.sendPort);
+}
+
 class TreeNode {
   @pragma('vm:entry-point') // Prevent tree shaking of this field.
   final TreeNode? left;
@@ -260,4 +324,8 @@ Future<void> main(args) async {
   for (final config in configs) {
     await SendPortBenchmark(config).report();
   }
+
+  for (final senders in [1, 8, 32]) {
+    await FanInBenchmark(senders, 100000 ~/ senders).report();
+  }
 }
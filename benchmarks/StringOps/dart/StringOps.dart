@@ -0,0 +1,96 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Measure performance of case conversion, searching and trimming of strings
+// like HTTP header names and routes.
+
+import 'package:benchmark_harness/benchmark_harness.dart';
+
+int sink = 0;
+
+final List<String> headers = [
+  'Content-Type',
+  'Accept-Encoding',
+  'X-Forwarded-For',
+  'cache-control',
+  'USER-AGENT',
+  'If-None-Match',
+  'Strict-Transport-Security',
+  'x-request-id',
+];
+
+final List<String> paddedHeaders =
+    headers.map((h) => '   $h \t').toList(growable: false);
+
+final String route = '/api/v1/users/12345/orders/67890/items?expand=details';
+final String document = 'lorem ipsum dolor sit amet ' * 400 + 'needle';
+
+class ToLowerCase extends BenchmarkBase {
+  ToLowerCase() : super('StringOps.toLowerCase');
+
+  @override
+  void run() {
+    for (final h in headers) {
+      sink += h.toLowerCase().length;
+    }
+  }
+}
+
+class ToUpperCase extends BenchmarkBase {
+  ToUpperCase() : super('StringOps.toUpperCase');
+
+  @override
+  void run() {
+    for (final h in headers) {
+      sink += h.toUpperCase().length;
+    }
+  }
+}
+
+class IndexOf extends BenchmarkBase {
+  IndexOf() : super('StringOps.indexOf');
+
+  @override
+  void run() {
+    sink += route.indexOf('/orders/');
+    sink += route.indexOf('?expand');
+    sink += document.indexOf('needle');
+  }
+}
+
+class Contains extends BenchmarkBase {
+  Contains() : super('StringOps.contains');
+
+  @override
+  void run() {
+    if (route.contains('items')) sink++;
+    if (document.contains('sit amet lorem')) sink++;
+    if (document.contains('haystack')) sink++;
+  }
+}
+
+class Trim extends BenchmarkBase {
+  Trim() : super('StringOps.trim');
+
+  @override
+  void run() {
+    for (final h in paddedHeaders) {
+      sink += h.trim().length;
+    }
+  }
+}
+
+void main() {
+  final benchmarks = [
+    ToLowerCase(),
+    ToUpperCase(),
+    IndexOf(),
+    Contains(),
+    Trim(),
+  ];
+  for (final benchmark in benchmarks) {
+    benchmark.report();
+  }
+  if (sink == 0) throw StateError('Unexpected sink: $sink');
+}
@@ -0,0 +1,15 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import '../../common/testing.dart' as helper;
+import 'package:expect/expect.dart';
+
+/// Comparisons in interpreted code give the same results whether they are
+/// followed by a conditional jump, which the interpreter fuses with the
+/// comparison, or their result is stored.
+main() async {
+  final result = await helper.load('entry1.dart');
+  Expect.equals(0, result);
+  helper.done();
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Each comparison is used once as a branch condition and once as a value.
+// The branch and the value must agree for every pair of operands.
+
+int intMismatches(int a, int b) {
+  int mismatches = 0;
+  final bool gt = a > b;
+  if (a > b) {
+    if (!gt) mismatches++;
+  } else {
+    if (gt) mismatches++;
+  }
+  final bool lt = a < b;
+  if (a < b) {
+    if (!lt) mismatches++;
+  } else {
+    if (lt) mismatches++;
+  }
+  final bool ge = a >= b;
+  if (a >= b) {
+    if (!ge) mismatches++;
+  } else {
+    if (ge) mismatches++;
+  }
+  final bool le = a <= b;
+  if (a <= b) {
+    if (!le) mismatches++;
+  } else {
+    if (le) mismatches++;
+  }
+  // Exactly one of < and >= holds, as does one of > and <=.
+  if (lt ? ge : !ge) mismatches++;
+  if (gt ? le : !le) mismatches++;
+  return mismatches;
+}
+
+int doubleMismatches(double a, double b) {
+  int mismatches = 0;
+  final bool gt = a > b;
+  if (a > b) {
+    if (!gt) mismatches++;
+  } else {
+    if (gt) mismatches++;
+  }
+  final bool lt = a < b;
+  if (a < b) {
+    if (!lt) mismatches++;
+  } else {
+    if (lt) mismatches++;
+  }
+  final bool ge = a >= b;
+  if (a >= b) {
+    if (!ge) mismatches++;
+  } else {
+    if (ge) mismatches++;
+  }
+  final bool le = a <= b;
+  if (a <= b) {
+    if (!le) mismatches++;
+  } else {
+    if (le) mismatches++;
+  }
+  return mismatches;
+}
+
+abstract class Shape {
+  int sides();
+}
+
+class Triangle extends Shape {
+  int sides() => 3;
+}
+
+class Square extends Shape {
+  int sides() => 4;
+}
+
+// Calls one instance call site with alternating receiver classes, so that
+// lookups hit and miss the interpreter's lookup cache.
+int callMismatches() {
+  final Shape triangle = Triangle();
+  final Shape square = Square();
+  int total = 0;
+  for (int i = 0; i < 100; i++) {
+    final Shape shape = (i & 1) == 0 ? triangle : square;
+    total += shape.sides();
+  }
+  return total == 50 * 3 + 50 * 4 ? 0 : 1;
+}
+
+@pragma('dyn-module:entry-point')
+Object? dynamicModuleEntrypoint() {
+  int mismatches = 0;
+  for (int a = -2; a <= 2; a++) {
+    for (int b = -2; b <= 2; b++) {
+      mismatches += intMismatches(a, b);
+    }
+  }
+  for (double a = -1.0; a <= 1.0; a += 0.5) {
+    for (double b = -1.0; b <= 1.0; b += 0.5) {
+      mismatches += doubleMismatches(a, b);
+    }
+  }
+  // Every ordered comparison with NaN is false.
+  const double nan = 0.0 / 0.0;
+  mismatches += doubleMismatches(nan, 1.0);
+  mismatches += doubleMismatches(1.0, nan);
+  if (nan < 1.0 || nan > 1.0 || nan <= 1.0 || nan >= 1.0) mismatches++;
+  int loops = 0;
+  for (int i = 0; i < 10; i++) {
+    loops++;
+  }
+  if (loops != 10) mismatches++;
+  mismatches += callMismatches();
+  return mismatches;
+}
@@ -983,26 +983,19 @@ mixin _FfiUseSiteTransformer on FfiTransformer {
     final clazz = (dartType as InterfaceType).classNode;
     final referencedStruct = ReferencedCompoundSubtypeCfe(clazz);
 
-    Expression pointer = NullCheck(node.arguments.positional[0]);
-    if (node.arguments.positional.length == 2) {
-      pointer = InstanceInvocation(
-          InstanceAccessKind.Instance,
-          pointer,
-          offsetByMethod.name,
-          Arguments([
-            multiply(node.arguments.positional[1], inlineSizeOf(dartType)!)
-          ]),
-          interfaceTarget: offsetByMethod,
-          functionType:
-              Substitution.fromPairs(pointerClass.typeParameters, [dartType])
-                  .substituteType(offsetByMethod.getterType) as FunctionType);
-    }
+    final pointer = NullCheck(node.arguments.positional[0]);
+    // For `[]`, address the element through the offset in bytes instead of
+    // allocating a new Pointer for it. The field accessors then load from
+    // the original pointer at a computed stride.
+    final Expression offsetInBytes = node.arguments.positional.length == 2
+        ? multiply(node.arguments.positional[1], inlineSizeOf(dartType)!)
+        : ConstantExpression(IntConstant(0));
 
     return referencedStruct.generateLoad(
       dartType: dartType,
       transformer: this,
       typedDataBase: pointer,
-      offsetInBytes: ConstantExpression(IntConstant(0)),
+      offsetInBytes: offsetInBytes,
       fileOffset: node.fileOffset,
     );
   }
@@ -0,0 +1,63 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'package:test/test.dart';
+import 'package:vm_service/vm_service.dart';
+
+import '../common/test_helper.dart';
+
+@pragma('vm:never-inline')
+num add(num a, num b) => a + b;
+
+void testeeMain() {
+  // Optimize add for integers, then deoptimize it with doubles.
+  for (int i = 0; i < 100; i++) {
+    add(i, 1);
+  }
+  add(1.5, 2.5);
+}
+
+final tests = <IsolateTest>[
+  (VmService service, IsolateRef isolateRef) async {
+    final isolateId = isolateRef.id!;
+    final result = await service.callMethod(
+      '_getDeoptimizedFunctions',
+      isolateId: isolateId,
+    );
+    final json = result.json!;
+    expect(json['type'], '_DeoptimizedFunctions');
+    final functions = (json['functions'] as List).cast<Map>();
+    expect(json['totalCount'], functions.length);
+    final entry = functions.singleWhere(
+      (e) => (e['function'] as Map)['name'] == 'add',
+    );
+    expect(entry['deoptimizations'], greaterThanOrEqualTo(1));
+    expect(entry['codeSize'], greaterThan(0));
+    for (int i = 1; i < functions.length; i++) {
+      expect(
+        functions[i]['deoptimizations'],
+        lessThanOrEqualTo(functions[i - 1]['deoptimizations']),
+      );
+    }
+
+    final limited = await service.callMethod(
+      '_getDeoptimizedFunctions',
+      isolateId: isolateId,
+      args: {'limit': 1},
+    );
+    expect((limited.json!['functions'] as List).length, 1);
+    expect(limited.json!['totalCount'], functions.length);
+  },
+];
+
+void main([args = const <String>[]]) => runIsolateTests(
+      args,
+      tests,
+      'get_deoptimized_functions_rpc_test.dart',
+      testeeBefore: testeeMain,
+      extraArgs: [
+        '--optimization-counter-threshold=10',
+        '--no-background-compilation',
+      ],
+    );
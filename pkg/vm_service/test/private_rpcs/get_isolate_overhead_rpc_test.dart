@@ -0,0 +1,38 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'package:test/test.dart';
+import 'package:vm_service/vm_service.dart';
+
+import '../common/test_helper.dart';
+
+final tests = <IsolateTest>[
+  (VmService service, IsolateRef isolateRef) async {
+    final isolateId = isolateRef.id!;
+    final result =
+        (await service.callMethod('_getIsolateOverhead', isolateId: isolateId))
+            .json!;
+    expect(result['type'], equals('_IsolateOverhead'));
+    for (final property in [
+      'isolate',
+      'isolateObjectStore',
+      'fieldTable',
+      'messageHandler',
+      'mutatorStack',
+      'mutatorZones',
+      'groupNewSpaceCapacity',
+    ]) {
+      expect(result[property], isPositive, reason: property);
+    }
+    expect(result['pendingMessages'], greaterThanOrEqualTo(0));
+    expect(result['pendingMessageBytes'], greaterThanOrEqualTo(0));
+    expect(result['groupIsolateCount'], greaterThanOrEqualTo(1));
+  },
+];
+
+void main([args = const <String>[]]) => runIsolateTests(
+      args,
+      tests,
+      'get_isolate_overhead_rpc_test.dart',
+    );
@@ -0,0 +1,62 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:test/test.dart';
+import 'package:vm_service/vm_service.dart';
+
+import '../common/test_helper.dart';
+
+final tests = <IsolateTest>[
+  (VmService service, IsolateRef isolateRef) async {
+    final isolateId = isolateRef.id!;
+    final result = (await service.callMethod(
+      '_getOpenMetrics',
+      isolateId: isolateId,
+    ))
+        .json!;
+    expect(result['type'], equals('_OpenMetrics'));
+    final lines = (result['text'] as String).trimRight().split('\n');
+    expect(lines.last, equals('# EOF'));
+
+    final groupLabels = 'isolate_group="${isolateRef.isolateGroupId}"';
+    expect(lines, contains('# TYPE dart_heap_old_used_bytes gauge'));
+    expect(lines, contains('# UNIT dart_heap_old_used_bytes bytes'));
+    final heapOldUsed = lines.singleWhere(
+        (line) => line.startsWith('dart_heap_old_used_bytes{$groupLabels}'));
+    expect(int.parse(heapOldUsed.split(' ').last), greaterThan(0));
+
+    final isolateLabels = '$groupLabels,isolate="$isolateId"';
+    final runnableLatency = lines.singleWhere((line) => line
+        .startsWith('dart_isolate_runnable_latency_seconds{$isolateLabels}'));
+    expect(double.parse(runnableLatency.split(' ').last),
+        greaterThanOrEqualTo(0));
+  },
+  // The same exposition is served as plain text on the /metrics path.
+  (VmService service, IsolateRef isolateRef) async {
+    final uri = Uri.parse(serviceHttpAddress)
+        .resolve('metrics')
+        .replace(queryParameters: {'isolateId': isolateRef.id!});
+    final client = HttpClient();
+    final request = await client.getUrl(uri);
+    final response = await request.close();
+    final body = await response.transform(utf8.decoder).join();
+    client.close();
+    expect(response.statusCode, equals(HttpStatus.ok));
+    expect(response.headers.contentType?.mimeType, equals('text/plain'));
+    expect(response.headers.contentType?.parameters['version'],
+        equals('0.0.4'));
+    final lines = body.trimRight().split('\n');
+    expect(lines, contains('# TYPE dart_heap_old_used_bytes gauge'));
+    expect(lines.last, equals('# EOF'));
+  },
+];
+
+void main([args = const <String>[]]) => runIsolateTests(
+      args,
+      tests,
+      'get_open_metrics_rpc_test.dart',
+    );
@@ -0,0 +1,87 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// ignore_for_file: library_private_types_in_public_api
+
+import 'dart:typed_data';
+
+import 'package:test/test.dart';
+import 'package:vm_service/vm_service.dart';
+
+import '../common/test_helper.dart';
+
+const MB = 1 << 20;
+
+class _TestClass {
+  _TestClass(this.x);
+  // Make sure this field is not removed by the tree shaker.
+  @pragma('vm:entry-point')
+  dynamic x;
+}
+
+@pragma('vm:entry-point')
+late _TestClass myVar;
+
+void script() {
+  myVar = _TestClass(Uint8List(16 * MB));
+}
+
+final tests = <IsolateTest>[
+  (VmService service, IsolateRef isolateRef) async {
+    final isolateId = isolateRef.id!;
+    final result = (await service.callMethod(
+      '_getTopRetainers',
+      isolateId: isolateId,
+      args: {'limit': 5},
+    ))
+        .json!;
+    expect(result['type'], equals('_TopRetainers'));
+    final totalSize = result['totalSize'] as int;
+    expect(totalSize, greaterThan(16 * MB));
+
+    final retainers = result['retainers'] as List;
+    expect(retainers.length, 5);
+    int previous = totalSize;
+    for (final retainer in retainers) {
+      final size = retainer['retainedSize'] as int;
+      expect(size, lessThanOrEqualTo(previous));
+      previous = size;
+    }
+
+    // The instance of _TestClass dominates the large list.
+    final testClassRetainer = retainers.firstWhere(
+        (retainer) => retainer['value']['class']['name'] == '_TestClass');
+    expect(testClassRetainer['retainedSize'], greaterThan(16 * MB));
+  },
+  (VmService service, IsolateRef isolateRef) async {
+    final isolateId = isolateRef.id!;
+    try {
+      await service.callMethod(
+        '_getTopRetainers',
+        isolateId: isolateId,
+        args: {'limit': 0},
+      );
+      fail('Expected an error for a zero limit');
+    } on RPCError catch (e) {
+      expect(e.code, RPCErrorKind.kInvalidParams.code);
+    }
+
+    // Large limits are clamped.
+    final result = (await service.callMethod(
+      '_getTopRetainers',
+      isolateId: isolateId,
+      args: {'limit': 1000000},
+    ))
+        .json!;
+    expect(result['type'], equals('_TopRetainers'));
+    expect((result['retainers'] as List).length, lessThanOrEqualTo(1000));
+  },
+];
+
+void main([args = const <String>[]]) => runIsolateTests(
+      args,
+      tests,
+      'get_top_retainers_rpc_test.dart',
+      testeeBefore: script,
+    );
@@ -69,6 +69,7 @@ DFE::DFE()
       application_kernel_buffer_(nullptr),
       application_kernel_buffer_size_(0),
       kernel_blobs_(&SimpleHashMap::SameStringValue, 4),
+      compiled_scripts_(&SimpleHashMap::SameStringValue, 4),
       kernel_blobs_lock_() {}
 
 DFE::~DFE() {
@@ -83,6 +84,8 @@ DFE::~DFE() {
 
   kernel_blobs_.Clear(
       [](void* value) { delete reinterpret_cast<KernelBlob*>(value); });
+  compiled_scripts_.Clear(
+      [](void* value) { delete reinterpret_cast<CompiledScript*>(value); });
 }
 
 void DFE::Init() {
@@ -238,6 +241,146 @@ void DFE::CompileAndReadScript(const char* script_uri,
   }
 }
 
+/// Reads [script_uri] file, returns [true] if successful, [false] otherwise.
+///
+/// If successful, newly allocated buffer with file contents is returned in
+/// [buffer], file contents byte count - in [size].
+static bool TryReadFile(const char* script_uri,
+                        uint8_t** buffer,
+                        intptr_t* size,
+                        bool decode_uri = true) {
+  void* script_file = decode_uri ? DartUtils::OpenFileUri(script_uri, false)
+                                 : DartUtils::OpenFile(script_uri, false);
+  if (script_file == nullptr) {
+    return false;
+  }
+  DartUtils::ReadFile(buffer, size, script_file);
+  DartUtils::CloseFile(script_file);
+  return *buffer != nullptr;
+}
+
+// Hashes the contents of the files in [dependencies], a list of paths in the
+// format returned by Dart_KernelListDependencies: separated by spaces, with
+// spaces and backslashes in a path escaped by a backslash. A missing file
+// hashes like an empty one.
+static uint32_t HashSources(const char* dependencies) {
+  char* path = reinterpret_cast<char*>(malloc(strlen(dependencies) + 1));
+  intptr_t path_length = 0;
+  uint32_t hash = 0;
+  for (const char* p = dependencies;; p++) {
+    if (*p == '\\' && p[1] != '\0') {
+      path[path_length++] = *++p;
+      continue;
+    }
+    if (*p != ' ' && *p != '\0') {
+      path[path_length++] = *p;
+      continue;
+    }
+    if (path_length > 0) {
+      path[path_length] = '\0';
+      uint8_t* contents = nullptr;
+      intptr_t size = 0;
+      uint32_t file_hash = 0;
+      if (TryReadFile(path, &contents, &size, /*decode_uri=*/false)) {
+        file_hash = Utils::StringHash(contents, static_cast<int>(size));
+        free(contents);
+      }
+      hash = 31 * hash + file_hash;
+      path_length = 0;
+    }
+    if (*p == '\0') {
+      break;
+    }
+  }
+  free(path);
+  return hash;
+}
+
+std::shared_ptr<uint8_t> DFE::CompileAndReadScriptShared(
+    const char* script_uri,
+    intptr_t* kernel_buffer_size,
+    char** error,
+    int* exit_code,
+    const char* package_config,
+    bool for_snapshot,
+    bool embed_sources) {
+  char* key = Utils::SCreate("%s;%s;%d;%d", script_uri,
+                             package_config != nullptr ? package_config : "",
+                             for_snapshot, embed_sources);
+  const uint32_t hash = SimpleHashMap::StringHash(key);
+  std::shared_ptr<uint8_t> cached_buffer;
+  intptr_t cached_size = 0;
+  char* cached_dependencies = nullptr;
+  uint32_t cached_sources_hash = 0;
+  {
+    MutexLocker ml(&kernel_blobs_lock_);
+    SimpleHashMap::Entry* entry =
+        compiled_scripts_.Lookup(key, hash, /*insert=*/false);
+    if (entry != nullptr) {
+      CompiledScript* script = reinterpret_cast<CompiledScript*>(entry->value);
+      cached_buffer = script->blob()->buffer();
+      cached_size = script->blob()->size();
+      cached_dependencies = Utils::StrDup(script->dependencies());
+      cached_sources_hash = script->sources_hash();
+    }
+  }
+  if (cached_dependencies != nullptr) {
+    // Reading the sources is much cheaper than compiling them, so check that
+    // none of them changed since the cached kernel was compiled.
+    const bool unchanged =
+        HashSources(cached_dependencies) == cached_sources_hash;
+    free(cached_dependencies);
+    if (unchanged) {
+      free(key);
+      *kernel_buffer_size = cached_size;
+      *error = nullptr;
+      *exit_code = 0;
+      return cached_buffer;
+    }
+  }
+
+  // Compile without holding the lock. If the same script is compiled
+  // concurrently, the last result to be registered is kept.
+  uint8_t* kernel_buffer = nullptr;
+  CompileAndReadScript(script_uri, &kernel_buffer, kernel_buffer_size, error,
+                       exit_code, package_config, for_snapshot, embed_sources);
+  if (kernel_buffer == nullptr) {
+    free(key);
+    return nullptr;
+  }
+
+  // The kernel service records the files a compilation read for the isolate
+  // group that requested it, which is the current one.
+  Dart_KernelCompilationResult result = Dart_KernelListDependencies();
+  if (result.status != Dart_KernelCompilationStatus_Ok ||
+      result.kernel_size == 0) {
+    // Without the list of sources the kernel cannot be validated later, so
+    // it is not cached.
+    free(result.error);
+    free(result.kernel);
+    free(key);
+    return std::shared_ptr<uint8_t>(kernel_buffer, std::free);
+  }
+  char* dependencies = Utils::StrNDup(reinterpret_cast<char*>(result.kernel),
+                                      result.kernel_size);
+  free(result.kernel);
+  KernelBlob* blob = new KernelBlob(key, kernel_buffer, *kernel_buffer_size);
+  CompiledScript* script =
+      new CompiledScript(blob, dependencies, HashSources(dependencies));
+
+  MutexLocker ml(&kernel_blobs_lock_);
+  SimpleHashMap::Entry* entry =
+      compiled_scripts_.Lookup(key, hash, /*insert=*/true);
+  ASSERT(entry != nullptr);
+  // Groups still using a replaced kernel keep its buffer alive through their
+  // references to it.
+  delete reinterpret_cast<CompiledScript*>(entry->value);
+  // The blob owns the key, so the entry must point at the new one.
+  entry->key = key;
+  entry->value = script;
+  return script->blob()->buffer();
+}
+
 void DFE::ReadScript(const char* script_uri,
                      const AppSnapshot* app_snapshot,
                      uint8_t** kernel_buffer,
@@ -288,24 +431,6 @@ static bool TryReadSimpleKernelBuffer(uint8_t* buffer,
   return false;
 }
 
-/// Reads [script_uri] file, returns [true] if successful, [false] otherwise.
-///
-/// If successful, newly allocated buffer with file contents is returned in
-/// [buffer], file contents byte count - in [size].
-static bool TryReadFile(const char* script_uri,
-                        uint8_t** buffer,
-                        intptr_t* size,
-                        bool decode_uri = true) {
-  void* script_file = decode_uri ? DartUtils::OpenFileUri(script_uri, false)
-                                 : DartUtils::OpenFile(script_uri, false);
-  if (script_file == nullptr) {
-    return false;
-  }
-  DartUtils::ReadFile(buffer, size, script_file);
-  DartUtils::CloseFile(script_file);
-  return *buffer != nullptr;
-}
-
 class KernelIRNode {
  public:
   KernelIRNode(uint8_t* kernel_ir, intptr_t kernel_size)
@@ -93,6 +93,22 @@ class DFE {
                             bool for_snapshot,
                             bool embed_sources);
 
+  // Like CompileAndReadScript, but reuses the kernel of an earlier successful
+  // compilation of 'script_uri' with the same 'package_config' and options,
+  // so isolate groups spawned from the same script share one kernel buffer.
+  // The kernel is compiled again if any of the files it was compiled from,
+  // including imported libraries, parts and the package config, changed.
+  // Must be called with the isolate the script is compiled for as the
+  // current isolate. Returns nullptr if compilation failed.
+  std::shared_ptr<uint8_t> CompileAndReadScriptShared(
+      const char* script_uri,
+      intptr_t* kernel_buffer_size,
+      char** error,
+      int* exit_code,
+      const char* package_config,
+      bool for_snapshot,
+      bool embed_sources);
+
   // Reads the script kernel file if specified 'script_uri' is a kernel file.
   // Returns an in memory kernel representation of the specified script is a
   // valid kernel file, sets 'kernel_buffer' to nullptr otherwise.
@@ -167,6 +183,12 @@ class DFE {
   // Registry of kernel blobs. Maps URI (char *) to KernelBlob.
   SimpleHashMap kernel_blobs_;
   intptr_t kernel_blob_counter_ = 0;
+
+  // Kernel compiled by CompileAndReadScriptShared. Maps a key made of the
+  // script URI, package config and compilation options to CompiledScript.
+  SimpleHashMap compiled_scripts_;
+
+  // Guards kernel_blobs_ and compiled_scripts_.
   Mutex kernel_blobs_lock_;
 
   void InitKernelServiceAndPlatformDills();
@@ -191,6 +213,30 @@ class KernelBlob {
   DISALLOW_COPY_AND_ASSIGN(KernelBlob);
 };
 
+// Kernel compiled by DFE::CompileAndReadScriptShared, with the files it was
+// compiled from and a hash of their contents at the time.
+class CompiledScript {
+ public:
+  // Takes ownership over [blob] and [dependencies].
+  CompiledScript(KernelBlob* blob, char* dependencies, uint32_t sources_hash)
+      : blob_(blob), dependencies_(dependencies), sources_hash_(sources_hash) {}
+  ~CompiledScript() {
+    delete blob_;
+    free(dependencies_);
+  }
+
+  KernelBlob* blob() const { return blob_; }
+  const char* dependencies() const { return dependencies_; }
+  uint32_t sources_hash() const { return sources_hash_; }
+
+ private:
+  KernelBlob* blob_;
+  char* dependencies_;
+  const uint32_t sources_hash_;
+
+  DISALLOW_COPY_AND_ASSIGN(CompiledScript);
+};
+
 class PathSanitizer {
  public:
   explicit PathSanitizer(const char* path);
@@ -5,7 +5,8 @@
 #include "bin/elf_loader.h"
 
 #include "platform/globals.h"
-#if defined(DART_HOST_OS_FUCHSIA)
+#if defined(DART_HOST_OS_FUCHSIA) || defined(DART_HOST_OS_LINUX) ||           \
+    defined(DART_HOST_OS_ANDROID)
 #include <sys/mman.h>
 #endif
 
@@ -465,6 +466,14 @@ bool LoadedElf::LoadSegments() {
     CHECK_ERROR(memory != nullptr, "Could not map segment.");
     CHECK_ERROR(memory->address() == memory_start,
                 "Mapping not at requested address.");
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+    // The read-only segment holds the snapshot data, which is deserialized in
+    // its entirety right after loading. Have it read ahead instead of faulting
+    // it in one page at a time.
+    if (map_type == File::kReadOnly) {
+      madvise(memory_start, length, MADV_WILLNEED);
+    }
+#endif
 #if defined(DART_HOST_OS_WINDOWS) &&                                           \
     (defined(HOST_ARCH_X64) || defined(HOST_ARCH_ARM64))
     // For executable pages register unwinding information that should be
@@ -636,9 +636,20 @@ class EventHandler {
 
   static void SendFromNative(intptr_t id, Dart_Port port, int64_t data);
 
+  // The number of threads polling for events, which must be set before
+  // Start. Values larger than one are only supported on Linux and Android;
+  // other platforms always use a single thread.
+  static constexpr intptr_t kMaxThreadCount = 64;
+  static intptr_t thread_count() { return thread_count_; }
+  static void set_thread_count(intptr_t thread_count) {
+    ASSERT((thread_count >= 1) && (thread_count <= kMaxThreadCount));
+    thread_count_ = thread_count;
+  }
+
  private:
   friend class EventHandlerImplementation;
   EventHandlerImplementation delegate_;
+  static intptr_t thread_count_;
 
   DISALLOW_COPY_AND_ASSIGN(EventHandler);
 };
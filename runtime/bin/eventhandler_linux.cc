@@ -128,6 +128,12 @@ static void DeleteDescriptorInfo(void* info) {
 }
 
 EventHandlerImplementation::~EventHandlerImplementation() {
+  if (shards_ != nullptr) {
+    for (intptr_t i = 1; i < num_shards_; i++) {
+      delete shards_[i];
+    }
+    delete[] shards_;
+  }
   socket_map_.Clear(DeleteDescriptorInfo);
   close(epoll_fd_);
   close(timer_fd_);
@@ -390,10 +396,13 @@ void EventHandlerImplementation::HandleEvents(struct epoll_event* events,
 
 void EventHandlerImplementation::Poll(uword args) {
   ThreadSignalBlocker signal_blocker(SIGPROF);
-  const intptr_t kMaxEvents = 16;
+  // With many active descriptors a larger batch means fewer epoll_wait
+  // calls. Interrupts are handled after each batch, so it should still be
+  // small enough not to delay commands from Dart noticeably.
+  const intptr_t kMaxEvents = 256;
   struct epoll_event events[kMaxEvents];
-  EventHandler* handler = reinterpret_cast<EventHandler*>(args);
-  EventHandlerImplementation* handler_impl = &handler->delegate_;
+  EventHandlerImplementation* handler_impl =
+      reinterpret_cast<EventHandlerImplementation*>(args);
   ASSERT(handler_impl != nullptr);
 
   while (!handler_impl->shutdown_) {
@@ -408,27 +417,66 @@ void EventHandlerImplementation::Poll(uword args) {
       handler_impl->HandleEvents(events, result);
     }
   }
-  DEBUG_ASSERT(ReferenceCounted<Socket>::instances() == 0);
-  handler->NotifyShutdownDone();
+  handler_impl->primary_->ShardDone();
+}
+
+void EventHandlerImplementation::ShardDone() {
+  ASSERT(primary_ == this);
+  if (running_shards_.fetch_sub(1) == 1) {
+    // The other polling threads may have released sockets after this one
+    // stopped, so this is only checked when all of them have.
+    DEBUG_ASSERT(ReferenceCounted<Socket>::instances() == 0);
+    handler_->NotifyShutdownDone();
+  }
 }
 
 void EventHandlerImplementation::Start(EventHandler* handler) {
-  int result =
-      Thread::Start("dart:io EventHandler", &EventHandlerImplementation::Poll,
-                    reinterpret_cast<uword>(handler));
-  if (result != 0) {
-    FATAL("Failed to start event handler thread %d", result);
+  handler_ = handler;
+  primary_ = this;
+  num_shards_ = EventHandler::thread_count();
+  shards_ = new EventHandlerImplementation*[num_shards_];
+  shards_[0] = this;
+  for (intptr_t i = 1; i < num_shards_; i++) {
+    shards_[i] = new EventHandlerImplementation();
+    shards_[i]->primary_ = this;
+  }
+  running_shards_ = num_shards_;
+  for (intptr_t i = 0; i < num_shards_; i++) {
+    int result =
+        Thread::Start("dart:io EventHandler", &EventHandlerImplementation::Poll,
+                      reinterpret_cast<uword>(shards_[i]));
+    if (result != 0) {
+      FATAL("Failed to start event handler thread %d", result);
+    }
   }
 }
 
 void EventHandlerImplementation::Shutdown() {
-  SendData(kShutdownId, 0, 0);
+  for (intptr_t i = 0; i < num_shards_; i++) {
+    shards_[i]->WakeupHandler(kShutdownId, 0, 0);
+  }
+}
+
+EventHandlerImplementation* EventHandlerImplementation::ShardFor(
+    intptr_t id,
+    Dart_Port dart_port) {
+  if (num_shards_ == 1) {
+    return this;
+  }
+  uint32_t hash;
+  if (id == kTimerId) {
+    hash = dart::Utils::WordHash(static_cast<intptr_t>(dart_port));
+  } else {
+    // A closed socket has fd -1; its messages are ignored by any handler.
+    hash = GetHashmapHashFromFd(reinterpret_cast<Socket*>(id)->fd());
+  }
+  return shards_[hash % num_shards_];
 }
 
 void EventHandlerImplementation::SendData(intptr_t id,
                                           Dart_Port dart_port,
                                           int64_t data) {
-  WakeupHandler(id, dart_port, data);
+  ShardFor(id, dart_port)->WakeupHandler(id, dart_port, data);
 }
 
 void* EventHandlerImplementation::GetHashmapKeyFromFd(intptr_t fd) {
@@ -14,6 +14,8 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <atomic>
+
 #include "platform/hashmap.h"
 #include "platform/signal_blocker.h"
 
@@ -72,6 +74,12 @@ class EventHandlerImplementation {
   void Shutdown();
 
  private:
+  // Returns the handler which polls the descriptor of the socket 'id', or
+  // the timers of 'dart_port' if 'id' is kTimerId.
+  EventHandlerImplementation* ShardFor(intptr_t id, Dart_Port dart_port);
+  // Called by each polling thread when it has stopped.
+  void ShardDone();
+
   void HandleEvents(struct epoll_event* events, int size);
   static void Poll(uword args);
   void WakeupHandler(intptr_t id, Dart_Port dart_port, int64_t data);
@@ -89,6 +97,17 @@ class EventHandlerImplementation {
   int epoll_fd_;
   int timer_fd_;
 
+  // With EventHandler::thread_count() > 1, the handler owned by EventHandler
+  // starts additional handlers, each with its own epoll instance and thread.
+  // Descriptors are assigned to them by file descriptor, so all Dart sockets
+  // sharing a listening socket use the same one, and timers by port.
+  // shards_[0] is the owning handler itself.
+  EventHandler* handler_ = nullptr;
+  EventHandlerImplementation* primary_ = nullptr;
+  EventHandlerImplementation** shards_ = nullptr;
+  intptr_t num_shards_ = 1;
+  std::atomic<intptr_t> running_shards_ = {0};
+
   DISALLOW_COPY_AND_ASSIGN(EventHandlerImplementation);
 };
 
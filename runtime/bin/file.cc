@@ -470,6 +470,61 @@ void FUNCTION_NAME(File_Lock)(Dart_NativeArguments args) {
   Dart_SetReturnValue(args, DartUtils::NewDartOSError(&os_error));
 }
 
+// File::Map needs a page-aligned position. 64KB is a multiple of the page
+// size on all supported platforms.
+static constexpr int64_t kMapAlignment = 64 * KB;
+
+static void MappedMemoryFinalizer(void* isolate_callback_data, void* peer) {
+  delete reinterpret_cast<MappedMemory*>(peer);
+}
+
+void FUNCTION_NAME(File_Map)(Dart_NativeArguments args) {
+  File* file = GetFile(args);
+  ASSERT(file != nullptr);
+  int64_t start;
+  int64_t length;
+  if (!DartUtils::GetInt64Value(Dart_GetNativeArgument(args, 1), &start) ||
+      !DartUtils::GetInt64Value(Dart_GetNativeArgument(args, 2), &length) ||
+      (start < 0) || (length <= 0) || (length > kMaxInt32)) {
+    OSError os_error(-1, "Invalid argument", OSError::kUnknown);
+    Dart_SetReturnValue(args, DartUtils::NewDartOSError(&os_error));
+    return;
+  }
+  // Touching the pages of a mapping beyond the end of the file faults.
+  const int64_t file_length = file->Length();
+  if (file_length < 0) {
+    Dart_SetReturnValue(args, DartUtils::NewDartOSError());
+    return;
+  }
+  if (start > file_length - length) {
+    OSError os_error(-1, "Range exceeds the length of the file",
+                     OSError::kUnknown);
+    Dart_SetReturnValue(args, DartUtils::NewDartOSError(&os_error));
+    return;
+  }
+  const int64_t adjustment = start % kMapAlignment;
+  // Some implementations of File::Map read the file, restore the position.
+  const int64_t position = file->Position();
+  MappedMemory* mapping =
+      file->Map(File::kReadOnly, start - adjustment, length + adjustment);
+  if (position >= 0) {
+    file->SetPosition(position);
+  }
+  if (mapping == nullptr) {
+    Dart_SetReturnValue(args, DartUtils::NewDartOSError());
+    return;
+  }
+  Dart_Handle result = Dart_NewUnmodifiableExternalTypedDataWithFinalizer(
+      Dart_TypedData_kUint8,
+      reinterpret_cast<uint8_t*>(mapping->address()) + adjustment, length,
+      mapping, length, MappedMemoryFinalizer);
+  if (Dart_IsError(result)) {
+    delete mapping;
+    Dart_PropagateError(result);
+  }
+  Dart_SetReturnValue(args, result);
+}
+
 void FUNCTION_NAME(File_Create)(Dart_NativeArguments args) {
   Namespace* namespc = Namespace::GetNamespace(args, 0);
   Dart_Handle exclusive_handle = Dart_GetNativeArgument(args, 2);
@@ -10,9 +10,11 @@
 #include <errno.h>         // NOLINT
 #include <fcntl.h>         // NOLINT
 #include <libgen.h>        // NOLINT
+#include <sys/ioctl.h>     // NOLINT
 #include <sys/mman.h>      // NOLINT
 #include <sys/sendfile.h>  // NOLINT
 #include <sys/stat.h>      // NOLINT
+#include <sys/syscall.h>   // NOLINT
 #include <sys/types.h>     // NOLINT
 #include <unistd.h>        // NOLINT
 #include <utime.h>         // NOLINT
@@ -453,6 +455,45 @@ bool File::RenameLink(Namespace* namespc,
                                      newns.path())) == 0);
 }
 
+// From linux/fs.h, which conflicts with the glibc headers included above.
+#if !defined(FICLONE)
+#define FICLONE _IOW(0x94, 9, int)
+#endif
+
+// Copies the contents of the regular file 'old_fd' to 'new_fd' without
+// passing the data through user space. The destination first shares the
+// extents of the source if the file system supports reflinks (btrfs, XFS).
+// Otherwise copy_file_range lets the kernel, or a network file system's
+// server, copy the data. Returns false, with nothing written, if neither is
+// supported for these files.
+static bool CopyFileInKernel(int old_fd, int new_fd, intptr_t* result) {
+  if (NO_RETRY_EXPECTED(ioctl(new_fd, FICLONE, old_fd)) == 0) {
+    *result = 0;
+    return true;
+  }
+#if defined(__NR_copy_file_range)
+  // Chunked, like the sendfile loop in File::Copy, to copy everything and
+  // not only up to 2GB.
+  const size_t kChunkSize = 1 * GB;
+  int64_t copied = 0;
+  do {
+    *result = TEMP_FAILURE_RETRY(syscall(__NR_copy_file_range, old_fd,
+                                         nullptr, new_fd, nullptr, kChunkSize,
+                                         0));
+    if (copied == 0 && *result <= 0) {
+      // Not supported by the kernel or the file systems (e.g. ENOSYS, EXDEV
+      // before Linux 5.3, EOPNOTSUPP), or a file like those in /proc whose
+      // size is not known up front, for which copy_file_range copies nothing.
+      return false;
+    }
+    copied += *result;
+  } while (*result > 0);
+  return true;
+#else
+  return false;
+#endif
+}
+
 bool File::Copy(Namespace* namespc,
                 const char* old_path,
                 const char* new_path) {
@@ -479,11 +520,15 @@ bool File::Copy(Namespace* namespc,
     close(old_fd);
     return false;
   }
-  int64_t offset = 0;
-  intptr_t result = 1;
-  while (result > 0) {
-    // Loop to ensure we copy everything, and not only up to 2GB.
-    result = NO_RETRY_EXPECTED(sendfile64(new_fd, old_fd, &offset, kMaxUint32));
+  intptr_t result = 0;
+  if (!S_ISREG(st.st_mode) || !CopyFileInKernel(old_fd, new_fd, &result)) {
+    int64_t offset = 0;
+    result = 1;
+    while (result > 0) {
+      // Loop to ensure we copy everything, and not only up to 2GB.
+      result =
+          NO_RETRY_EXPECTED(sendfile64(new_fd, old_fd, &offset, kMaxUint32));
+    }
   }
   // From sendfile man pages:
   //   Applications may wish to fall back to read(2)/write(2) in the case
@@ -103,15 +103,27 @@ static int InotifyEventToMask(struct inotify_event* e) {
 Dart_Handle FileSystemWatcher::ReadEvents(intptr_t id, intptr_t path_id) {
   USE(path_id);
   const intptr_t kEventSize = sizeof(struct inotify_event);
-  const intptr_t kBufferSize = kEventSize + NAME_MAX + 1;
+  // Read as many events as are available, up to the buffer size, so that a
+  // burst of events (e.g. from a checkout) does not take one read and one
+  // call from Dart for every event. The buffer must fit the largest event.
+  const intptr_t kBufferSize = 16 * KB;
+  COMPILE_ASSERT(kBufferSize >= kEventSize + NAME_MAX + 1);
   uint8_t buffer[kBufferSize];
   intptr_t bytes =
       SocketBase::Read(id, buffer, kBufferSize, SocketBase::kAsync);
   if (bytes < 0) {
     return DartUtils::NewDartOSError();
   }
-  const intptr_t kMaxCount = bytes / kEventSize;
-  Dart_Handle events = Dart_NewList(kMaxCount);
+  intptr_t count = 0;
+  for (intptr_t offset = 0; offset < bytes;) {
+    struct inotify_event* e =
+        reinterpret_cast<struct inotify_event*>(buffer + offset);
+    if ((e->mask & IN_IGNORED) == 0) {
+      count++;
+    }
+    offset += kEventSize + e->len;
+  }
+  Dart_Handle events = Dart_NewList(count);
   intptr_t offset = 0;
   intptr_t i = 0;
   while (offset < bytes) {
@@ -140,6 +152,7 @@ Dart_Handle FileSystemWatcher::ReadEvents(intptr_t id, intptr_t path_id) {
     offset += kEventSize + e->len;
   }
   ASSERT(offset == bytes);
+  ASSERT(i == count);
   return events;
 }
 
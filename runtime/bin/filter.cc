@@ -219,6 +219,9 @@ void FUNCTION_NAME(Filter_Process)(Dart_NativeArguments args) {
   }
 }
 
+// Processed outputs of up to this many bytes are copied into the Dart heap.
+static constexpr intptr_t kSmallProcessedSize = 16 * KB;
+
 void FUNCTION_NAME(Filter_Processed)(Dart_NativeArguments args) {
   Dart_Handle filter_obj = Dart_GetNativeArgument(args, 0);
   Dart_Handle flush_obj = Dart_GetNativeArgument(args, 1);
@@ -239,6 +242,19 @@ void FUNCTION_NAME(Filter_Processed)(Dart_NativeArguments args) {
         DartUtils::NewDartFormatException("Filter error, bad data"));
   } else if (read == 0) {
     Dart_SetReturnValue(args, Dart_Null());
+  } else if (read <= kSmallProcessedSize) {
+    // Copy small outputs into a Uint8List on the Dart heap. This avoids
+    // allocating an external buffer and a finalizer for every chunk.
+    Dart_Handle data = Dart_NewTypedData(Dart_TypedData_kUint8, read);
+    if (Dart_IsError(data)) {
+      Dart_PropagateError(data);
+    }
+    Dart_Handle status =
+        Dart_ListSetAsBytes(data, 0, filter->processed_buffer(), read);
+    if (Dart_IsError(status)) {
+      Dart_PropagateError(status);
+    }
+    Dart_SetReturnValue(args, data);
   } else {
     uint8_t* io_buffer;
     Dart_Handle result = IOBuffer::Allocate(read, &io_buffer);
@@ -23,14 +23,22 @@ void Decompress(const uint8_t* input,
 
   const intptr_t kChunkSize = 256 * 1024;
 
-  // Initialize output.
+  // The gzip trailer ends with the uncompressed size modulo 2^32. One extra
+  // byte lets inflate consume the trailer without growing the buffer.
   intptr_t output_capacity = input_len * 2;
+  if (input_len >= 4) {
+    const uint8_t* isize = &input[input_len - 4];
+    const uint32_t size = isize[0] | (isize[1] << 8) | (isize[2] << 16) |
+                          (static_cast<uint32_t>(isize[3]) << 24);
+    if (size >= static_cast<uint64_t>(input_len)) {
+      output_capacity = static_cast<intptr_t>(size) + 1;
+    }
+  }
   if (output_capacity < kChunkSize) {
     output_capacity = kChunkSize;
   }
   *output = reinterpret_cast<uint8_t*>(malloc(output_capacity));
 
-  uint8_t* chunk_out = reinterpret_cast<uint8_t*>(malloc(kChunkSize));
   z_stream strm;
   strm.zalloc = Z_NULL;
   strm.zfree = Z_NULL;
@@ -40,40 +48,39 @@ void Decompress(const uint8_t* input,
   int ret = inflateInit2(&strm, 32 + MAX_WBITS);
   ASSERT(ret == Z_OK);
 
+  // Inflate directly into the output buffer.
   intptr_t input_cursor = 0;
   intptr_t output_cursor = 0;
   do {
     // Setup input.
-    intptr_t size_in = input_len - input_cursor;
-    if (size_in > kChunkSize) {
-      size_in = kChunkSize;
+    if (strm.avail_in == 0) {
+      intptr_t size_in = input_len - input_cursor;
+      if (size_in > kChunkSize) {
+        size_in = kChunkSize;
+      }
+      strm.avail_in = size_in;
+      strm.next_in = const_cast<uint8_t*>(&input[input_cursor]);
+      input_cursor += size_in;
     }
-    strm.avail_in = size_in;
-    strm.next_in = const_cast<uint8_t*>(&input[input_cursor]);
 
-    // Inflate until we've exhausted the current input chunk.
-    do {
-      // Setup output.
-      strm.avail_out = kChunkSize;
-      strm.next_out = &chunk_out[0];
-      // Inflate.
-      ret = inflate(&strm, Z_SYNC_FLUSH);
-      // We either hit the end of the stream or made forward progress.
-      ASSERT((ret == Z_STREAM_END) || (ret == Z_OK));
-      // Grow output buffer size.
-      intptr_t size_out = kChunkSize - strm.avail_out;
-      if (size_out > (output_capacity - output_cursor)) {
-        output_capacity *= 2;
-        ASSERT(size_out <= (output_capacity - output_cursor));
-        *output = reinterpret_cast<uint8_t*>(realloc(*output, output_capacity));
-      }
-      // Copy output.
-      memmove(&((*output)[output_cursor]), &chunk_out[0], size_out);
-      output_cursor += size_out;
-    } while (strm.avail_out == 0);
+    // Grow output buffer size.
+    if (output_cursor == output_capacity) {
+      output_capacity *= 2;
+      *output = reinterpret_cast<uint8_t*>(realloc(*output, output_capacity));
+    }
 
-    // We've processed size_in bytes.
-    input_cursor += size_in;
+    // Setup output.
+    intptr_t size_out = output_capacity - output_cursor;
+    if (size_out > kChunkSize) {
+      size_out = kChunkSize;
+    }
+    strm.avail_out = size_out;
+    strm.next_out = &((*output)[output_cursor]);
+    // Inflate.
+    ret = inflate(&strm, Z_NO_FLUSH);
+    // We either hit the end of the stream or made forward progress.
+    ASSERT((ret == Z_STREAM_END) || (ret == Z_OK));
+    output_cursor += size_out - strm.avail_out;
 
     // We're finished decompressing when zlib tells us.
   } while (ret != Z_STREAM_END);
@@ -81,7 +88,6 @@ void Decompress(const uint8_t* input,
   inflateEnd(&strm);
 
   *output_length = output_cursor;
-  free(chunk_out);
 }
 
 }  // namespace bin
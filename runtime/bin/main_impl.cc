@@ -308,17 +308,31 @@ static Dart_Isolate IsolateSetupHelper(Dart_Isolate isolate,
     // If we compile for AppJIT the sources will not be included across app-jit
     // snapshotting, so there's no reason CFE should embed them in the kernel.
     const bool embed_sources = Options::gen_snapshot_kind() != kAppJIT;
-    dfe.CompileAndReadScript(script_uri, &application_kernel_buffer,
-                             &application_kernel_buffer_size, error, exit_code,
-                             resolved_packages_config, for_snapshot,
-                             embed_sources);
+    if (Options::share_compiled_kernel()) {
+      std::shared_ptr<uint8_t> shared_kernel_buffer =
+          dfe.CompileAndReadScriptShared(
+              script_uri, &application_kernel_buffer_size, error, exit_code,
+              resolved_packages_config, for_snapshot, embed_sources);
+      application_kernel_buffer = shared_kernel_buffer.get();
+      if (application_kernel_buffer != nullptr) {
+        isolate_group_data->SetKernelBufferAlreadyOwned(
+            std::move(shared_kernel_buffer), application_kernel_buffer_size);
+      }
+    } else {
+      dfe.CompileAndReadScript(script_uri, &application_kernel_buffer,
+                               &application_kernel_buffer_size, error,
+                               exit_code, resolved_packages_config,
+                               for_snapshot, embed_sources);
+      if (application_kernel_buffer != nullptr) {
+        isolate_group_data->SetKernelBufferNewlyOwned(
+            application_kernel_buffer, application_kernel_buffer_size);
+      }
+    }
     if (application_kernel_buffer == nullptr) {
       Dart_ExitScope();
       Dart_ShutdownIsolate();
       return nullptr;
     }
-    isolate_group_data->SetKernelBufferNewlyOwned(
-        application_kernel_buffer, application_kernel_buffer_size);
     kernel_buffer = application_kernel_buffer;
     kernel_buffer_size = application_kernel_buffer_size;
   }
@@ -10,6 +10,7 @@
 
 #include "bin/dartdev_isolate.h"
 #include "bin/error_exit.h"
+#include "bin/eventhandler.h"
 #include "bin/file_system_watcher.h"
 #include "bin/options.h"
 #include "bin/platform.h"
@@ -126,6 +127,15 @@ static void hot_reload_rollback_test_mode_callback(
 DEFINE_BOOL_OPTION_CB(hot_reload_rollback_test_mode,
                       hot_reload_rollback_test_mode_callback);
 
+DEFINE_STRING_OPTION_CB(event_handler_threads, {
+  const intptr_t threads = atoi(value);
+  if ((threads < 1) || (threads > EventHandler::kMaxThreadCount)) {
+    Syslog::PrintErr("Invalid value for event_handler_threads: '%s'\n", value);
+  } else {
+    EventHandler::set_thread_count(threads);
+  }
+});
+
 void Options::PrintVersion() {
   Syslog::Print("Dart SDK version: %s\n", Dart_VersionString());
 }
@@ -215,6 +225,11 @@ void Options::PrintUsage() {
 "--trace-loading\n"
 "  enables tracing of library and script loading\n"
 "\n"
+"--share-compiled-kernel\n"
+"  Compile a script to kernel only once and share the kernel between all\n"
+"  isolate groups spawned from it with the same package config. The script\n"
+"  is compiled again when it or any of its dependencies changes.\n"
+"\n"
 #if !defined(PRODUCT)
 "--enable-vm-service[=<port>[/<bind-address>]]\n"
 "  Enables the VM service and listens on specified port for connections\n"
@@ -244,6 +259,11 @@ void Options::PrintUsage() {
 "  The path to a directory that dart:io calls will treat as the root of the\n"
 "  filesystem.\n"
 #endif  // defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+"--event-handler-threads=<count>\n"
+"  The number of threads polling sockets and timers for dart:io (default 1).\n"
+"  Sockets are assigned to the threads by file descriptor.\n"
+#endif  // defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
 "\n"
 "The following options are only used for VM development and may\n"
 "be changed in any future version:\n");
@@ -53,7 +53,8 @@ namespace bin {
   V(serve_devtools, enable_devtools)                                           \
   V(no_serve_observatory, disable_observatory)                                 \
   V(serve_observatory, enable_observatory)                                     \
-  V(print_dtd, print_dtd)
+  V(print_dtd, print_dtd)                                                      \
+  V(share_compiled_kernel, share_compiled_kernel)
 
 // Boolean flags that have a short form.
 #define SHORT_BOOL_OPTIONS_LIST(V)                                             \
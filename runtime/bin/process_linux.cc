@@ -10,6 +10,7 @@
 #include <errno.h>         // NOLINT
 #include <fcntl.h>         // NOLINT
 #include <poll.h>          // NOLINT
+#include <spawn.h>         // NOLINT
 #include <stdio.h>         // NOLINT
 #include <stdlib.h>        // NOLINT
 #include <string.h>        // NOLINT
@@ -31,6 +32,14 @@
 
 extern char** environ;
 
+// glibc implements posix_spawn with clone(CLONE_VM | CLONE_VFORK) and reports
+// exec failures to the caller since 2.24.
+#if defined(DART_HOST_OS_LINUX) && defined(__GLIBC__)
+#if __GLIBC_PREREQ(2, 24)
+#define DART_USE_POSIX_SPAWN 1
+#endif
+#endif
+
 namespace dart {
 namespace bin {
 
@@ -73,6 +82,15 @@ class ProcessInfoList {
 
   static void AddProcess(pid_t pid, intptr_t fd) {
     MutexLocker locker(mutex_);
+    AddProcessLocked(pid, fd);
+  }
+
+  // A process may be started while holding the mutex and then added, so that
+  // the exit code handler cannot look up its pid before it is added.
+  static Mutex* mutex() { return mutex_; }
+
+  static void AddProcessLocked(pid_t pid, intptr_t fd) {
+    ASSERT(mutex_->IsOwnedByCurrentThread());
     ProcessInfo* info = new ProcessInfo(pid, fd);
     info->set_next(active_processes_);
     active_processes_ = info;
@@ -311,6 +329,15 @@ class ProcessStarter {
       return err;
     }
 
+#if defined(DART_USE_POSIX_SPAWN)
+    if (CanSpawn()) {
+      err = Spawn();
+      if (err != kSpawnNotSupported) {
+        return err;
+      }
+    }
+#endif  // defined(DART_USE_POSIX_SPAWN)
+
     // Fork to create the new process.
     pid_t pid = TEMP_FAILURE_RETRY(fork());
     if (pid < 0) {
@@ -370,6 +397,14 @@ class ProcessStarter {
       return err;
     }
 
+    ConnectStdio(pid);
+    return 0;
+  }
+
+ private:
+  static constexpr int kErrorBufferSize = 1024;
+
+  void ConnectStdio(pid_t pid) {
     if (Process::ModeHasStdio(mode_)) {
       // Connect stdio, stdout and stderr.
       FDUtils::SetNonBlocking(read_in_[0]);
@@ -394,11 +429,120 @@ class ProcessStarter {
     ASSERT(exec_control_[1] == -1);
 
     *id_ = pid;
-    return 0;
   }
 
- private:
-  static constexpr int kErrorBufferSize = 1024;
+#if defined(DART_USE_POSIX_SPAWN)
+  static constexpr int kSpawnNotSupported = -1;
+
+  // Returns true if starting the process with posix_spawnp gives the same
+  // result as ExecProcess in a forked child. posix_spawnp does not copy the
+  // page tables of this process, which is expensive for a large heap.
+  bool CanSpawn() {
+    if (!Process::ModeIsAttached(mode_) || !Namespace::IsDefault(namespc_)) {
+      return false;
+    }
+#if !__GLIBC_PREREQ(2, 29)
+    // No posix_spawn_file_actions_addchdir_np.
+    if (working_directory_ != nullptr) {
+      return false;
+    }
+#endif
+    // A pipe which already is the stdio descriptor it is duplicated onto
+    // would stay close-on-exec.
+    if ((mode_ == kNormal) &&
+        ((write_out_[0] <= STDERR_FILENO) || (read_in_[1] <= STDERR_FILENO) ||
+         (read_err_[1] <= STDERR_FILENO))) {
+      return false;
+    }
+    // execvp searches the PATH of the new environment, posix_spawnp the one
+    // of this process.
+    if ((strchr(path_, '/') == nullptr) && (program_environment_ != nullptr)) {
+      const char* path = getenv("PATH");
+      const char* new_path = nullptr;
+      for (char** entry = program_environment_; *entry != nullptr; entry++) {
+        if (strncmp(*entry, "PATH=", 5) == 0) {
+          new_path = *entry + 5;
+          break;
+        }
+      }
+      if ((path == nullptr) || (new_path == nullptr)) {
+        return path == new_path;
+      }
+      return strcmp(path, new_path) == 0;
+    }
+    return true;
+  }
+
+  // Starts an attached process with posix_spawnp. Returns kSpawnNotSupported
+  // if it should be started with fork instead.
+  int Spawn() {
+    posix_spawn_file_actions_t actions;
+    int result = posix_spawn_file_actions_init(&actions);
+    if (result != 0) {
+      return kSpawnNotSupported;
+    }
+    if (mode_ == kNormal) {
+      result = posix_spawn_file_actions_adddup2(&actions, write_out_[0],
+                                                STDIN_FILENO);
+      if (result == 0) {
+        result = posix_spawn_file_actions_adddup2(&actions, read_in_[1],
+                                                  STDOUT_FILENO);
+      }
+      if (result == 0) {
+        result = posix_spawn_file_actions_adddup2(&actions, read_err_[1],
+                                                  STDERR_FILENO);
+      }
+    }
+#if __GLIBC_PREREQ(2, 29)
+    if ((result == 0) && (working_directory_ != nullptr)) {
+      result =
+          posix_spawn_file_actions_addchdir_np(&actions, working_directory_);
+    }
+#endif
+    if (result != 0) {
+      posix_spawn_file_actions_destroy(&actions);
+      return kSpawnNotSupported;
+    }
+
+    int event_fds[2];
+    result = TEMP_FAILURE_RETRY(pipe2(event_fds, O_CLOEXEC));
+    if (result < 0) {
+      posix_spawn_file_actions_destroy(&actions);
+      return CleanupAndReturnError();
+    }
+
+    pid_t pid;
+    {
+      MutexLocker locker(ProcessInfoList::mutex());
+      char** environment =
+          program_environment_ != nullptr ? program_environment_ : environ;
+      result = posix_spawnp(&pid, path_, &actions, nullptr, program_arguments_,
+                            environment);
+      if (result == 0) {
+        ExitCodeHandler::ProcessStarted();
+        ProcessInfoList::AddProcessLocked(pid, event_fds[1]);
+      }
+    }
+    posix_spawn_file_actions_destroy(&actions);
+
+    if (result != 0) {
+      close(event_fds[0]);
+      close(event_fds[1]);
+      if (result == ENOEXEC) {
+        // execvp runs the file with /bin/sh, posix_spawnp does not.
+        return kSpawnNotSupported;
+      }
+      errno = result;
+      return CleanupAndReturnError();
+    }
+
+    *exit_event_ = event_fds[0];
+    FDUtils::SetNonBlocking(event_fds[0]);
+    ClosePipe(exec_control_);
+    ConnectStdio(pid);
+    return 0;
+  }
+#endif  // defined(DART_USE_POSIX_SPAWN)
 
   int CreatePipes() {
     int result;
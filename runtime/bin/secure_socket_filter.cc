@@ -46,7 +46,9 @@ void SSLFilter::Cleanup() {
   SSLFilter::mutex_ = nullptr;
 }
 
-const intptr_t SSLFilter::kInternalBIOSize = 10 * KB;
+// Large enough to hold a full TLS record (16KB of plaintext plus overhead),
+// matching _SecureFilterImpl.ENCRYPTED_SIZE.
+const intptr_t SSLFilter::kInternalBIOSize = 18 * KB;
 const intptr_t SSLFilter::kApproximateSize =
     sizeof(SSLFilter) + (2 * SSLFilter::kInternalBIOSize);
 
@@ -4,6 +4,8 @@
 
 #include "bin/socket.h"
 
+#include <memory>
+
 #include "bin/dartutils.h"
 #include "bin/eventhandler.h"
 #include "bin/file.h"
@@ -529,6 +531,30 @@ void FUNCTION_NAME(Socket_Available)(Dart_NativeArguments args) {
   }
 }
 
+// Reads of up to this many bytes are copied into the Dart heap.
+static constexpr intptr_t kSmallReadSize = 16 * KB;
+
+// Returns the current thread's buffer for small reads. It is allocated on
+// first use, so threads that never read from sockets do not pay for it.
+static uint8_t* SmallReadBuffer() {
+  static thread_local std::unique_ptr<uint8_t[]> buffer;
+  if (buffer == nullptr) {
+    buffer.reset(new uint8_t[kSmallReadSize]);
+  }
+  return buffer.get();
+}
+
+// Copies the first [length] bytes of the small read buffer into a new
+// Uint8List on the Dart heap. This avoids allocating an external buffer and
+// a finalizer for every small read, and a second buffer for short reads.
+static Dart_Handle CopySmallRead(intptr_t length) {
+  ASSERT(length <= kSmallReadSize);
+  Dart_Handle data =
+      ThrowIfError(Dart_NewTypedData(Dart_TypedData_kUint8, length));
+  ThrowIfError(Dart_ListSetAsBytes(data, 0, SmallReadBuffer(), length));
+  return data;
+}
+
 void FUNCTION_NAME(Socket_Read)(Dart_NativeArguments args) {
   Socket* socket =
       Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
@@ -538,6 +564,21 @@ void FUNCTION_NAME(Socket_Read)(Dart_NativeArguments args) {
     if (Socket::short_socket_read()) {
       length = (length + 1) / 2;
     }
+    if (length <= kSmallReadSize) {
+      intptr_t bytes_read = SocketBase::Read(socket->fd(), SmallReadBuffer(),
+                                             length, SocketBase::kAsync);
+      if (bytes_read > 0) {
+        Dart_SetReturnValue(args, CopySmallRead(bytes_read));
+      } else if (bytes_read == 0) {
+        // On MacOS when reading from a tty Ctrl-D will result in reading one
+        // less byte then reported as available.
+        Dart_SetReturnValue(args, Dart_Null());
+      } else {
+        ASSERT(bytes_read == -1);
+        Dart_ThrowException(DartUtils::NewDartOSError());
+      }
+      return;
+    }
     uint8_t* buffer = nullptr;
     Dart_Handle result = IOBuffer::Allocate(length, &buffer);
     if (Dart_IsNull(result)) {
@@ -675,9 +716,17 @@ void FUNCTION_NAME(Socket_ReceiveMessage)(Dart_NativeArguments args) {
                            &buffer_num_bytes);
   int64_t buffer_num_bytes_allocated = buffer_num_bytes;
   uint8_t* buffer = nullptr;
-  Dart_Handle data = IOBuffer::Allocate(buffer_num_bytes, &buffer);
-  if (Dart_IsNull(data)) {
-    Dart_ThrowException(DartUtils::NewDartOSError());
+  Dart_Handle data = Dart_Null();
+  // As in Socket_Read, small messages are received into the small read
+  // buffer and copied into the Dart heap.
+  const bool is_small_read = buffer_num_bytes <= kSmallReadSize;
+  if (is_small_read) {
+    buffer = SmallReadBuffer();
+  } else {
+    data = IOBuffer::Allocate(buffer_num_bytes, &buffer);
+    if (Dart_IsNull(data)) {
+      Dart_ThrowException(DartUtils::NewDartOSError());
+    }
   }
   ASSERT(buffer != nullptr);
 
@@ -694,7 +743,10 @@ void FUNCTION_NAME(Socket_ReceiveMessage)(Dart_NativeArguments args) {
     Dart_ThrowException(error);
   }
   delete os_error;
-  if (buffer_num_bytes > 0 && buffer_num_bytes != buffer_num_bytes_allocated) {
+  if (is_small_read) {
+    data = CopySmallRead(buffer_num_bytes);
+  } else if (buffer_num_bytes > 0 &&
+             buffer_num_bytes != buffer_num_bytes_allocated) {
     // If received fewer than allocated buffer size, truncate buffer.
     uint8_t* new_buffer = nullptr;
     Dart_Handle new_data = IOBuffer::Allocate(buffer_num_bytes, &new_buffer);
@@ -1279,6 +1279,27 @@ DART_EXPORT void Dart_KillIsolate(Dart_Isolate isolate);
  */
 DART_EXPORT void Dart_NotifyIdle(int64_t deadline);
 
+/**
+ * Performs a bounded slice of the old-space collection in progress, if any,
+ * stopping at |deadline|. Depending on the state of the collection, a slice
+ * runs incremental marking, finishes marking (which includes the evacuation
+ * step of incremental compaction) if that can be done before |deadline|, or
+ * sweeps pages not yet reached by the concurrent sweeper.
+ *
+ * Unlike Dart_NotifyIdle, this never starts a new collection, so an embedder
+ * that knows exactly how much time each event loop turn has free can call it
+ * repeatedly with short deadlines.
+ *
+ * |deadline| is measured in microseconds against the system's monotonic time.
+ * This clock can be accessed via Dart_TimelineGetMicros().
+ *
+ * Requires there to be a current isolate.
+ *
+ * \return An estimate, in bytes of heap to be processed, of the work left in
+ *   the current collection. Returns 0 if there is no work left.
+ */
+DART_EXPORT int64_t Dart_PerformIdleGCSlice(int64_t deadline);
+
 typedef void (*Dart_HeapSamplingReportCallback)(void* context, void* data);
 
 typedef void* (*Dart_HeapSamplingCreateCallback)(
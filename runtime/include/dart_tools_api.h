@@ -526,6 +526,17 @@ DART_EXPORT int64_t
 Dart_IsolateGroupHeapNewCapacityMetric(Dart_IsolateGroup group);  // Byte
 DART_EXPORT int64_t
 Dart_IsolateGroupHeapNewExternalMetric(Dart_IsolateGroup group);  // Byte
+DART_EXPORT int64_t
+Dart_IsolateGroupHeapNewPauseMaxMetric(Dart_IsolateGroup group);  // Microsecond
+DART_EXPORT int64_t
+Dart_IsolateGroupHeapOldPauseMaxMetric(Dart_IsolateGroup group);  // Microsecond
+DART_EXPORT int64_t Dart_IsolateGroupHeapCompactPauseMaxMetric(
+    Dart_IsolateGroup group);  // Microsecond
+DART_EXPORT int64_t Dart_IsolateGroupHeapSafepointLatencyMaxMetric(
+    Dart_IsolateGroup group);  // Microsecond
+// Percent, or -1 if the group has not collected garbage yet.
+DART_EXPORT int64_t Dart_IsolateGroupHeapMutatorUtilizationMinMetric(
+    Dart_IsolateGroup group);
 
 /*
  * ========
@@ -98,4 +98,17 @@ DEFINE_FFI_NATIVE_ENTRY(ConditionVariable_Notify,
   condvar->Notify();
 }
 
+DEFINE_FFI_NATIVE_ENTRY(ConditionVariable_NotifyAll,
+                        void,
+                        (Dart_Handle condvar_handle)) {
+  ConditionVariable* condvar;
+  Dart_Handle result_condvar =
+      Dart_GetNativeInstanceField(condvar_handle, kCondVarNativeField,
+                                  reinterpret_cast<intptr_t*>(&condvar));
+  if (Dart_IsError(result_condvar)) {
+    Dart_PropagateError(result_condvar);
+  }
+  condvar->NotifyAll();
+}
+
 }  // namespace dart
@@ -126,12 +126,13 @@ DEFINE_FFI_NATIVE_ENTRY(FinalizerEntry_SetExternalSize,
   }
   // The next call cannot be in safepoint.
   if (external_size_diff > 0) {
-    if (!thread->isolate_group()->heap()->AllocatedExternal(external_size_diff,
-                                                            space)) {
+    if (!thread->isolate_group()->heap()->AllocatedExternal(
+            external_size_diff, space, Heap::ExternalKind::kFfi)) {
       Exceptions::ThrowOOM();
     }
   } else {
-    thread->isolate_group()->heap()->FreedExternal(-external_size_diff, space);
+    thread->isolate_group()->heap()->FreedExternal(
+        -external_size_diff, space, Heap::ExternalKind::kFfi);
   }
 };
 
@@ -335,10 +335,26 @@ static char* AvailableAssetsToCString(Thread* const thread) {
 // ['<path_type>', '<path (optional)>']
 // The |asset_location| is conform to: pkg/vm/lib/native_assets/validator.dart
 static void* FfiResolveAsset(Thread* const thread,
+                             const String& asset,
                              const Array& asset_location,
                              const String& symbol,
                              char** error) {
   Zone* const zone = thread->zone();
+  IsolateGroup* const isolate_group = thread->isolate_group();
+  NativeAssetsApi* native_assets_api = isolate_group->native_assets_api();
+  if (native_assets_api->dlsym == nullptr) {
+    *error =
+        OS::SCreate(/*use malloc*/ nullptr, "NativeAssetsApi::dlsym not set.");
+    return nullptr;
+  }
+
+  // The library stays loaded once opened, so reuse its handle for all the
+  // symbols resolved in it.
+  const char* const asset_cstr = asset.ToCString();
+  void* handle = isolate_group->LookupNativeAssetHandle(asset_cstr);
+  if (handle != nullptr) {
+    return native_assets_api->dlsym(handle, symbol.ToCString(), error);
+  }
 
   const auto& asset_type =
       String::Cast(Object::Handle(zone, asset_location.At(0)));
@@ -351,9 +367,6 @@ static void* FfiResolveAsset(Thread* const thread,
     path_cstr = path.ToCString();
   }
 
-  NativeAssetsApi* native_assets_api =
-      thread->isolate_group()->native_assets_api();
-  void* handle;
   if (asset_type.Equals(Symbols::absolute())) {
     if (native_assets_api->dlopen_absolute == nullptr) {
       *error = OS::SCreate(/*use malloc*/ nullptr,
@@ -400,10 +413,8 @@ static void* FfiResolveAsset(Thread* const thread,
   if (*error != nullptr) {
     return nullptr;
   }
-  if (native_assets_api->dlsym == nullptr) {
-    *error =
-        OS::SCreate(/*use malloc*/ nullptr, "NativeAssetsApi::dlsym not set.");
-    return nullptr;
+  if (handle != nullptr) {
+    isolate_group->AddNativeAssetHandle(asset_cstr, handle);
   }
   void* const result =
       native_assets_api->dlsym(handle, symbol.ToCString(), error);
@@ -440,7 +451,8 @@ intptr_t FfiResolveInternal(const String& asset,
   const auto& asset_location =
       Array::Handle(zone, GetAssetLocation(thread, asset));
   if (!asset_location.IsNull()) {
-    void* asset_result = FfiResolveAsset(thread, asset_location, symbol, error);
+    void* asset_result =
+        FfiResolveAsset(thread, asset, asset_location, symbol, error);
     return reinterpret_cast<intptr_t>(asset_result);
   }
 
@@ -28,6 +28,7 @@
 #include "vm/service.h"
 #include "vm/snapshot.h"
 #include "vm/symbols.h"
+#include "vm/timeline.h"
 
 namespace dart {
 
@@ -779,6 +780,9 @@ class SpawnIsolateTask : public ThreadPool::Task {
   }
 
   void Run() override {
+#if defined(SUPPORT_TIMELINE)
+    TimelineBeginEndScope tbes(Timeline::GetIsolateStream(), "SpawnIsolate");
+#endif
     const char* name = state_->debug_name();
     ASSERT(name != nullptr);
 
@@ -850,7 +854,14 @@ class SpawnIsolateTask : public ThreadPool::Task {
     char* error = nullptr;
 
     auto group = state_->isolate_group();
-    Isolate* isolate = CreateWithinExistingIsolateGroup(group, name, &error);
+    Isolate* isolate = nullptr;
+    {
+#if defined(SUPPORT_TIMELINE)
+      TimelineBeginEndScope tbes(Timeline::GetIsolateStream(),
+                                 "CreateIsolateWithinGroup");
+#endif
+      isolate = CreateWithinExistingIsolateGroup(group, name, &error);
+    }
     parent_isolate_->DecrementSpawnCount();
     parent_isolate_ = nullptr;
 
@@ -861,7 +872,14 @@ class SpawnIsolateTask : public ThreadPool::Task {
     }
 
     void* child_isolate_data = nullptr;
-    const bool success = initialize_callback(&child_isolate_data, &error);
+    bool success = false;
+    {
+#if defined(SUPPORT_TIMELINE)
+      TimelineBeginEndScope tbes(Timeline::GetIsolateStream(),
+                                 "InitializeIsolateCallback");
+#endif
+      success = initialize_callback(&child_isolate_data, &error);
+    }
     if (!success) {
       FailedSpawn(error);
       Dart_ShutdownIsolate();
@@ -4,6 +4,13 @@
 
 #include <ctype.h>  // isspace.
 
+#include "platform/globals.h"
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID) ||            \
+    defined(DART_HOST_OS_MACOS)
+#include <pthread.h>  // pthread_atfork.
+#endif
+
+#include "platform/atomic.h"
 #include "vm/bootstrap_natives.h"
 
 #include "vm/exceptions.h"
@@ -20,22 +27,64 @@ DEFINE_NATIVE_ENTRY(Random_initialSeed, 0, 0) {
   return Integer::New(seed);
 }
 
+// Entropy is fetched from the embedder a buffer at a time rather than a few
+// bytes per call. The buffer is kept per thread outside of the Dart heap, so
+// it is neither copied along with a Random.secure() instance nor visible in
+// heap snapshots. Bytes are cleared from the buffer once used.
+//
+// A forked child inherits the buffer of the thread that called fork, so the
+// parent and the child would hand out the same bytes. The child bumps
+// fork_generation and a buffer filled in an older generation is discarded.
+struct EntropyBuffer {
+  static constexpr intptr_t kSize = 256;
+  uint8_t bytes[kSize];
+  intptr_t position = kSize;
+  intptr_t generation = 0;
+};
+static thread_local EntropyBuffer entropy_buffer;
+static RelaxedAtomic<intptr_t> fork_generation = {0};
+
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID) ||            \
+    defined(DART_HOST_OS_MACOS)
+static void EntropyBufferAfterForkInChild() {
+  fork_generation.fetch_add(1);
+}
+
+static bool RegisterEntropyBufferForkHandler() {
+  return pthread_atfork(nullptr, nullptr, EntropyBufferAfterForkInChild) == 0;
+}
+#else
+static bool RegisterEntropyBufferForkHandler() {
+  return true;
+}
+#endif
+
 DEFINE_NATIVE_ENTRY(SecureRandom_getBytes, 0, 1) {
   GET_NON_NULL_NATIVE_ARGUMENT(Smi, count, arguments->NativeArgAt(0));
   const intptr_t n = count.Value();
   ASSERT((n > 0) && (n <= 8));
-  uint8_t buffer[8];
-  Dart_EntropySource entropy_source = Dart::entropy_source_callback();
-  if ((entropy_source == nullptr) || !entropy_source(buffer, n)) {
-    const String& error = String::Handle(String::New(
-        "No source of cryptographically secure random numbers available."));
-    const Array& args = Array::Handle(Array::New(1));
-    args.SetAt(0, error);
-    Exceptions::ThrowByType(Exceptions::kUnsupported, args);
+  static const bool fork_handler_registered =
+      RegisterEntropyBufferForkHandler();
+  EntropyBuffer* buffer = &entropy_buffer;
+  const intptr_t generation = fork_generation.load();
+  if (!fork_handler_registered || (buffer->generation != generation) ||
+      (buffer->position + n > EntropyBuffer::kSize)) {
+    Dart_EntropySource entropy_source = Dart::entropy_source_callback();
+    if ((entropy_source == nullptr) ||
+        !entropy_source(buffer->bytes, EntropyBuffer::kSize)) {
+      const String& error = String::Handle(String::New(
+          "No source of cryptographically secure random numbers available."));
+      const Array& args = Array::Handle(Array::New(1));
+      args.SetAt(0, error);
+      Exceptions::ThrowByType(Exceptions::kUnsupported, args);
+    }
+    buffer->position = 0;
+    buffer->generation = generation;
   }
   uint64_t result = 0;
   for (intptr_t i = 0; i < n; i++) {
-    result = (result << 8) | buffer[i];
+    result = (result << 8) | buffer->bytes[buffer->position];
+    buffer->bytes[buffer->position++] = 0;
   }
   return Integer::New(result);
 }
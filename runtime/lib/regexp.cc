@@ -139,14 +139,7 @@ DEFINE_NATIVE_ENTRY(RegExp_getGroupNameMap, 0, 1) {
   return Object::null();
 }
 
-static ObjectPtr ExecuteMatch(Zone* zone,
-                              NativeArguments* arguments,
-                              bool sticky) {
-  const RegExp& regexp = RegExp::CheckedHandle(zone, arguments->NativeArgAt(0));
-  ASSERT(!regexp.IsNull());
-  GET_NON_NULL_NATIVE_ARGUMENT(String, subject, arguments->NativeArgAt(1));
-  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start_index, arguments->NativeArgAt(2));
-
+static void ValidateSubject(const String& subject, const Smi& start_index) {
   // Both generated code and the interpreter are using 32-bit registers and
   // 32-bit backtracking stack so they can't work with strings which are
   // larger than that. Validate these assumptions before running the regexp.
@@ -159,7 +152,13 @@ static ObjectPtr ExecuteMatch(Zone* zone,
     Exceptions::ThrowRangeError("start_index", Integer::Cast(start_index),
                                 kMinInt32, kMaxInt32);
   }
+}
 
+static ObjectPtr Execute(const RegExp& regexp,
+                         const String& subject,
+                         const Smi& start_index,
+                         bool sticky,
+                         Zone* zone) {
 #if !defined(DART_PRECOMPILED_RUNTIME)
   if (!FLAG_interpret_irregexp) {
     return IRRegExpMacroAssembler::Execute(regexp, subject, start_index,
@@ -170,6 +169,17 @@ static ObjectPtr ExecuteMatch(Zone* zone,
                                                  /*sticky=*/sticky, zone);
 }
 
+static ObjectPtr ExecuteMatch(Zone* zone,
+                              NativeArguments* arguments,
+                              bool sticky) {
+  const RegExp& regexp = RegExp::CheckedHandle(zone, arguments->NativeArgAt(0));
+  ASSERT(!regexp.IsNull());
+  GET_NON_NULL_NATIVE_ARGUMENT(String, subject, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start_index, arguments->NativeArgAt(2));
+  ValidateSubject(subject, start_index);
+  return Execute(regexp, subject, start_index, sticky, zone);
+}
+
 DEFINE_NATIVE_ENTRY(RegExp_ExecuteMatch, 0, 3) {
   // This function is intrinsified. See Intrinsifier::RegExp_ExecuteMatch.
   return ExecuteMatch(zone, arguments, /*sticky=*/false);
@@ -180,4 +190,61 @@ DEFINE_NATIVE_ENTRY(RegExp_ExecuteMatchSticky, 0, 3) {
   return ExecuteMatch(zone, arguments, /*sticky=*/true);
 }
 
+// The compiled matcher returns an Array of Smis, the interpreter an Int32List.
+static int32_t CaptureAt(const Object& match, intptr_t i) {
+  if (match.IsTypedData()) {
+    return TypedData::Cast(match).GetInt32(i * sizeof(int32_t));
+  }
+  return static_cast<int32_t>(
+      Smi::Value(Smi::RawCast(Array::Cast(match).At(i))));
+}
+
+// Returns the start and end of each match from 'start_index' on, in the
+// order allMatches would find them, or null if there is none.
+DEFINE_NATIVE_ENTRY(RegExp_ExecuteMatchAll, 0, 3) {
+  const RegExp& regexp = RegExp::CheckedHandle(zone, arguments->NativeArgAt(0));
+  ASSERT(!regexp.IsNull());
+  GET_NON_NULL_NATIVE_ARGUMENT(String, subject, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, start_index, arguments->NativeArgAt(2));
+  ValidateSubject(subject, start_index);
+
+  const intptr_t length = subject.Length();
+  const bool is_unicode = regexp.flags().IsUnicode();
+  GrowableArray<int32_t> offsets;
+  intptr_t index = start_index.Value();
+  while (index <= length) {
+    // Executing the regexp allocates handles for every match.
+    HANDLESCOPE(thread);
+    const Object& result = Object::Handle(
+        zone, Execute(regexp, subject, Smi::Handle(zone, Smi::New(index)),
+                      /*sticky=*/false, zone));
+    if (result.IsNull()) break;
+    const int32_t start = CaptureAt(result, 0);
+    intptr_t end = CaptureAt(result, 1);
+    offsets.Add(start);
+    offsets.Add(static_cast<int32_t>(end));
+    if (end == start) {
+      // Zero-width match. Advance by one more, past the whole code point if
+      // the regexp is in unicode mode and it would end up within a surrogate
+      // pair.
+      if (is_unicode && end + 1 < length &&
+          Utf16::IsLeadSurrogate(subject.CharAt(end)) &&
+          Utf16::IsTrailSurrogate(subject.CharAt(end + 1))) {
+        end++;
+      }
+      end++;
+    }
+    index = end;
+  }
+  if (offsets.is_empty()) {
+    return TypedData::null();
+  }
+  const TypedData& matches = TypedData::Handle(
+      zone, TypedData::New(kTypedDataInt32ArrayCid, offsets.length()));
+  for (intptr_t i = 0; i < offsets.length(); i++) {
+    matches.SetInt32(i * sizeof(int32_t), offsets[i]);
+  }
+  return matches.ptr();
+}
+
 }  // namespace dart
@@ -452,6 +452,15 @@ DEFINE_NATIVE_ENTRY(String_concat, 0, 2) {
   const String& receiver =
       String::CheckedHandle(zone, arguments->NativeArgAt(0));
   GET_NON_NULL_NATIVE_ARGUMENT(String, b, arguments->NativeArgAt(1));
+  // Strings are immutable, so there is no need to copy when appending to or
+  // prepending an empty string, as in the first step of building a string
+  // with += in a loop.
+  if (b.Length() == 0) {
+    return receiver.ptr();
+  }
+  if (receiver.Length() == 0) {
+    return b.ptr();
+  }
   return String::Concat(receiver, b);
 }
 
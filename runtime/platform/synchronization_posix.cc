@@ -26,6 +26,12 @@ Mutex::Mutex() {
 #if defined(DEBUG)
   result = pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_ERRORCHECK);
   VALIDATE_PTHREAD_RESULT(result);
+#elif defined(DART_HOST_OS_LINUX) && defined(__GLIBC__)
+  // Most VM locks are held for a few instructions (port map, thread registry,
+  // free lists). Spin briefly before sleeping in the kernel, because the owner
+  // is likely to release the lock before a futex wait would even start.
+  result = pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_ADAPTIVE_NP);
+  VALIDATE_PTHREAD_RESULT(result);
 #endif  // defined(DEBUG)
 
   result = pthread_mutex_init(&mutex_, &attr);
@@ -7,6 +7,8 @@
 #include "platform/allocation.h"
 #include "platform/globals.h"
 #include "platform/syslog.h"
+#include "platform/unaligned.h"
+#include "platform/utils.h"
 
 namespace dart {
 
@@ -40,6 +42,23 @@ const uint32_t Utf8::kOverlongMinimum[7] = {0,  // Padding.
                                             0x0,     0x80,       0x800,
                                             0x10000, 0xFFFFFFFF, 0xFFFFFFFF};
 
+// Returns the number of ASCII characters at the start of 'utf8_array',
+// checking a word at a time.
+static intptr_t AsciiPrefixLength(const uint8_t* utf8_array,
+                                  intptr_t array_len) {
+  constexpr uword kHighBits = static_cast<uword>(0x8080808080808080ULL);
+  intptr_t i = 0;
+  for (; i + kWordSize <= array_len; i += kWordSize) {
+    const uword word =
+        LoadUnaligned(reinterpret_cast<const uword*>(&utf8_array[i]));
+    if ((word & kHighBits) != 0) break;
+  }
+  while (i < array_len && utf8_array[i] <= Utf8::kMaxOneByteChar) {
+    i++;
+  }
+  return i;
+}
+
 // Returns the most restricted coding form in which the sequence of utf8
 // characters in 'utf8_array' can be represented in, and the number of
 // code units needed in that form.
@@ -50,6 +69,12 @@ intptr_t Utf8::CodeUnitCount(const uint8_t* utf8_array,
   Type char_type = kLatin1;
   for (intptr_t i = 0; i < array_len; i++) {
     uint8_t code_unit = utf8_array[i];
+    if (code_unit <= kMaxOneByteChar) {
+      const intptr_t ascii = AsciiPrefixLength(&utf8_array[i], array_len - i);
+      len += ascii;
+      i += ascii - 1;
+      continue;
+    }
     if (!IsTrailByte(code_unit)) {
       ++len;
       if (!IsLatin1SequenceStart(code_unit)) {          // > U+00FF
@@ -70,6 +95,8 @@ intptr_t Utf8::CodeUnitCount(const uint8_t* utf8_array,
 bool Utf8::IsValid(const uint8_t* utf8_array, intptr_t array_len) {
   intptr_t i = 0;
   while (i < array_len) {
+    i += AsciiPrefixLength(&utf8_array[i], array_len - i);
+    if (i == array_len) break;
     uint32_t ch = utf8_array[i] & 0xFF;
     intptr_t j = 1;
     if (ch >= 0x80) {
@@ -199,6 +226,14 @@ bool Utf8::DecodeToLatin1(const uint8_t* utf8_array,
   intptr_t j = 0;
   intptr_t num_bytes;
   for (; (i < array_len) && (j < len); i += num_bytes, ++j) {
+    if (utf8_array[i] <= kMaxOneByteChar) {
+      const intptr_t ascii = Utils::Minimum(
+          AsciiPrefixLength(&utf8_array[i], array_len - i), len - j);
+      memmove(&dst[j], &utf8_array[i], ascii);
+      num_bytes = ascii;
+      j += ascii - 1;
+      continue;
+    }
     int32_t ch;
     ASSERT(IsLatin1SequenceStart(utf8_array[i]));
     num_bytes = Utf8::Decode(&utf8_array[i], (array_len - i), &ch);
@@ -222,6 +257,16 @@ bool Utf8::DecodeToUTF16(const uint8_t* utf8_array,
   intptr_t j = 0;
   intptr_t num_bytes;
   for (; (i < array_len) && (j < len); i += num_bytes, ++j) {
+    if (utf8_array[i] <= kMaxOneByteChar) {
+      const intptr_t ascii = Utils::Minimum(
+          AsciiPrefixLength(&utf8_array[i], array_len - i), len - j);
+      for (intptr_t k = 0; k < ascii; k++) {
+        dst[j + k] = utf8_array[i + k];
+      }
+      num_bytes = ascii;
+      j += ascii - 1;
+      continue;
+    }
     int32_t ch;
     bool is_supplementary = IsSupplementarySequenceStart(utf8_array[i]);
     num_bytes = Utf8::Decode(&utf8_array[i], (array_len - i), &ch);
@@ -0,0 +1,21 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// OtherResources=appjit_message_class_test_body.dart
+
+// Verify that classes received from other isolate groups during training are
+// not resolved from stale state in the app-jit snapshot.
+
+import 'dart:async';
+import 'dart:io' show Platform;
+
+import 'snapshot_test_helper.dart';
+
+Future<void> main() {
+  final testScriptUri =
+      Platform.script.resolve('appjit_message_class_test_body.dart');
+  return runAppJitTest(testScriptUri,
+      runSnapshot: (snapshotPath) => runDart('RUN FROM SNAPSHOT',
+          [snapshotPath, testScriptUri.toFilePath()]));
+}
@@ -0,0 +1,41 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Verify that classes received from other isolate groups during training are
+// not resolved from stale state in the app-jit snapshot.
+
+import 'dart:io';
+import 'dart:isolate';
+
+import "package:expect/expect.dart";
+
+class A {}
+
+class B {}
+
+// The child sends the classes in a different order when training than when
+// running from the snapshot, so they are registered with different ids.
+List<Type> classesToSend(bool isTraining) => isTraining ? [A, B] : [B, A];
+
+main(List<String> args, [SendPort? sendPort]) async {
+  final isTraining = args.contains("--train");
+  if (args.contains("--child")) {
+    sendPort!.send(classesToSend(isTraining));
+    return;
+  }
+
+  // When running from the snapshot the script to spawn is passed explicitly.
+  final childUri = isTraining ? Platform.script : Uri.file(args.first);
+  final port = ReceivePort();
+  await Isolate.spawnUri(
+      childUri, ["--child", if (isTraining) "--train"], port.sendPort);
+  final received = await port.first as List;
+  Expect.listEquals(classesToSend(isTraining), received);
+
+  if (isTraining) {
+    print("OK(Trained)");
+  } else {
+    print("OK(Run)");
+  }
+}
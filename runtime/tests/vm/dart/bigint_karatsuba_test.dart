@@ -0,0 +1,78 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Tests that products of large BigInts, which are computed with Karatsuba
+// multiplication, agree with sums of products of small chunks, which are
+// computed with the schoolbook method.
+
+import 'dart:math';
+
+import 'package:expect/expect.dart';
+
+const int chunkBits = 32 * 16;
+
+BigInt randomBigInt(Random random, int bits) {
+  var result = BigInt.zero;
+  for (var i = 0; i < bits; i += 32) {
+    result = (result << 32) | BigInt.from(random.nextInt(1 << 32));
+  }
+  return result;
+}
+
+List<BigInt> chunks(BigInt value) {
+  final mask = (BigInt.one << chunkBits) - BigInt.one;
+  final result = <BigInt>[];
+  while (value != BigInt.zero) {
+    result.add(value & mask);
+    value >>= chunkBits;
+  }
+  return result;
+}
+
+BigInt chunkedProduct(BigInt a, BigInt b) {
+  final aChunks = chunks(a.abs());
+  final bChunks = chunks(b.abs());
+  var result = BigInt.zero;
+  for (var i = 0; i < aChunks.length; i++) {
+    for (var j = 0; j < bChunks.length; j++) {
+      result += (aChunks[i] * bChunks[j]) << ((i + j) * chunkBits);
+    }
+  }
+  return a.isNegative != b.isNegative ? -result : result;
+}
+
+void check(BigInt a, BigInt b) {
+  final product = a * b;
+  Expect.equals(chunkedProduct(a, b), product);
+  Expect.equals(product, b * a);
+  if (b != BigInt.zero) {
+    Expect.equals(a, product ~/ b);
+    Expect.equals(BigInt.zero, product.remainder(b));
+  }
+}
+
+void main() {
+  final random = Random(42);
+  for (final bits in [2000, 2048, 2080, 4096, 5000, 10000, 33333]) {
+    final a = randomBigInt(random, bits);
+    final b = randomBigInt(random, bits);
+    check(a, b);
+    check(-a, b);
+    check(a, -b);
+    check(-a, -b);
+    check(a, a);
+    check(a, randomBigInt(random, bits ~/ 2 + 64));
+    check(a, randomBigInt(random, bits - 32));
+  }
+
+  // Operands with runs of zero and all-ones digits.
+  final powerOfTwo = BigInt.one << 8000;
+  final allOnes = powerOfTwo - BigInt.one;
+  check(powerOfTwo, powerOfTwo);
+  check(allOnes, allOnes);
+  check(allOnes, powerOfTwo + BigInt.one);
+  check(powerOfTwo - (BigInt.one << 4000), allOnes);
+  Expect.equals((BigInt.one << 16000) - (BigInt.one << 8001) + BigInt.one,
+      allOnes * allOnes);
+}
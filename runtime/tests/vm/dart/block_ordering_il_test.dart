@@ -45,6 +45,20 @@ int bodyAlwaysThrows(Uint8List list) {
   }
 }
 
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph', 'ReorderBlocks')
+int handlerAfterLoop(Uint8List list) {
+  try {
+    var sum = 0;
+    for (var i = 0; i < list.length; i++) {
+      sum += list[i];
+    }
+    return sum;
+  } catch (e) {
+    return -1;
+  }
+}
+
 @pragma('vm:never-inline')
 @pragma('vm:testing:print-flow-graph', 'ReorderBlocks')
 int throwInALoop(Uint8List list) {
@@ -67,6 +81,7 @@ void main(List<String> args) {
   Expect.equals(50, loop(input));
   Expect.equals(0, loop2(input));
   Expect.equals(100, bodyAlwaysThrows(input));
+  Expect.equals(1, handlerAfterLoop(input));
   Expect.equals(50, throwInALoop(input));
 }
 
@@ -143,6 +158,20 @@ void matchIL$bodyAlwaysThrows(FlowGraph graph) {
   ], inCodegenBlockOrder: true);
 }
 
+void matchIL$handlerAfterLoop(FlowGraph graph) {
+  // The exception handler is cold, so it is placed after the hot loop.
+  final blocks = graph.blocks(inCodegenBlockOrder: true);
+  bool hasBranch(dynamic block) =>
+      [...?block['is']].any((instr) => instr['o'] == 'Branch');
+  final catchIndex = blocks.indexWhere((b) => b['o'] == 'CatchBlockEntry');
+  Expect.isTrue(catchIndex > 0);
+  Expect.isTrue(blocks.take(catchIndex).any(hasBranch));
+  if (blocks.skip(catchIndex).any(hasBranch)) {
+    graph.dump(inCodegenBlockOrder: true);
+    Expect.fail('Loop blocks are placed after the exception handler');
+  }
+}
+
 void matchIL$throwInALoop(FlowGraph graph) {
   graph.match(inCodegenBlockOrder: true, [
     match.block('Graph'),
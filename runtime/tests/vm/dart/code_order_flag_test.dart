@@ -0,0 +1,83 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Tests that gen_snapshot --code_order places the instructions of the listed
+// functions first and in the listed order.
+
+import "dart:convert";
+import "dart:io";
+
+import 'package:expect/config.dart';
+import 'package:expect/expect.dart';
+import 'package:path/path.dart' as path;
+
+import 'use_flag_test_helper.dart';
+
+const script = '''
+library code_order;
+
+class C {
+  @pragma('vm:never-inline')
+  static int first(int x) => x + 1;
+
+  @pragma('vm:never-inline')
+  static int second(int x) => x * 2;
+
+  @pragma('vm:never-inline')
+  static int third(int x) => x - 3;
+}
+
+void main(List<String> args) {
+  print(C.first(args.length) + C.second(args.length) + C.third(args.length));
+}
+''';
+
+main(List<String> args) async {
+  if (!isVmAotConfiguration) {
+    return; // Running in JIT: AOT binaries not available.
+  }
+
+  if (Platform.isAndroid) {
+    return; // SDK tree and gen_snapshot not available on the test device.
+  }
+
+  await withTempDir('code_order_flag', (String tempDir) async {
+    final scriptPath = path.join(tempDir, 'code_order.dart');
+    final scriptDill = path.join(tempDir, 'code_order.dill');
+    final codeOrder = path.join(tempDir, 'code_order.txt');
+    final sizesJson = path.join(tempDir, 'sizes.json');
+    await File(scriptPath).writeAsString(script);
+    // Windows line endings, and no newline after the last line.
+    await File(codeOrder).writeAsString('code_order_C_third\r\n'
+        'code_order_C_unknown\r\n'
+        'code_order_C_first');
+
+    await run(genKernel, <String>[
+      '--aot',
+      '--platform=$platformDill',
+      '-o',
+      scriptDill,
+      scriptPath,
+    ]);
+    await run(genSnapshot, <String>[
+      '--snapshot-kind=app-aot-elf',
+      '--code-order=$codeOrder',
+      '--print-instructions-sizes-to=$sizesJson',
+      '--elf=${path.join(tempDir, 'aot.snapshot')}',
+      scriptDill,
+    ]);
+
+    final sizes = json.decode(await File(sizesJson).readAsString()) as List;
+    int indexOf(String name) => sizes.indexWhere((entry) =>
+        entry['c'] == 'C' && (entry['n'] as String).endsWith(name));
+    final first = indexOf('first');
+    final second = indexOf('second');
+    final third = indexOf('third');
+    Expect.notEquals(-1, first);
+    Expect.notEquals(-1, second);
+    Expect.notEquals(-1, third);
+    Expect.isTrue(third < first, 'third is listed before first');
+    Expect.isTrue(first < second, 'second is not listed');
+  });
+}
@@ -0,0 +1,37 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Tests that integral doubles, which are formatted without calling into the
+// runtime, print the same as other doubles.
+
+import 'package:expect/expect.dart';
+
+void main() {
+  Expect.equals('0.0', 0.0.toString());
+  Expect.equals('-0.0', (-0.0).toString());
+  Expect.equals('1.0', 1.0.toString());
+  Expect.equals('-1.0', (-1.0).toString());
+  Expect.equals('0.5', 0.5.toString());
+  Expect.equals('1.5', 1.5.toString());
+  Expect.equals('-2.5', (-2.5).toString());
+  Expect.equals('123456789.0', 123456789.0.toString());
+  Expect.equals('9007199254740991.0', 9007199254740991.0.toString());
+  Expect.equals('-9007199254740991.0', (-9007199254740991.0).toString());
+  Expect.equals('9007199254740992.0', 9007199254740992.0.toString());
+  Expect.equals('100000000000000000000.0', 1e20.toString());
+  Expect.equals('1e+21', 1e21.toString());
+  Expect.equals('Infinity', double.infinity.toString());
+  Expect.equals('NaN', double.nan.toString());
+
+  for (int i = -100000; i <= 100000; i += 7) {
+    final d = i.toDouble();
+    Expect.equals('$i.0', d.toString());
+    Expect.equals(d, double.parse(d.toString()));
+  }
+  for (int i = 0; i < 53; i++) {
+    final d = (1 << i).toDouble();
+    Expect.equals('${1 << i}.0', d.toString());
+    Expect.equals(d + 0.5, double.parse((d + 0.5).toString()));
+  }
+}
@@ -186,15 +186,24 @@ main() {
     "Dart_IsolateData",
     "Dart_IsolateFlagsInitialize",
     "Dart_IsolateGroupData",
+    "Dart_IsolateGroupHeapCompactPauseMaxMetric",
+    "Dart_IsolateGroupHeapMutatorUtilizationMinMetric",
     "Dart_IsolateGroupHeapNewCapacityMetric",
     "Dart_IsolateGroupHeapNewExternalMetric",
+    "Dart_IsolateGroupHeapNewPauseMaxMetric",
     "Dart_IsolateGroupHeapNewUsedMetric",
     "Dart_IsolateGroupHeapOldCapacityMetric",
     "Dart_IsolateGroupHeapOldExternalMetric",
+    "Dart_IsolateGroupHeapOldPauseMaxMetric",
     "Dart_IsolateGroupHeapOldUsedMetric",
+    "Dart_IsolateGroupHeapSafepointLatencyMaxMetric",
     "Dart_IsolateMakeRunnable",
+    "Dart_IsolateMessageQueueLatencyMaxMetric",
+    "Dart_IsolateMessageQueueLatencyMetric",
     "Dart_IsolateRunnableHeapSizeMetric",
     "Dart_IsolateRunnableLatencyMetric",
+    "Dart_IsolateScheduleLatencyMaxMetric",
+    "Dart_IsolateScheduleLatencyMetric",
     "Dart_IsolateServiceId",
     "Dart_IsPausedOnExit",
     "Dart_IsPausedOnStart",
@@ -0,0 +1,30 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Tests that growable lists copied from fixed-length and immutable lists have
+// the requested element type, whether the elements are copied in Dart or in
+// bulk by the VM.
+
+import 'package:expect/expect.dart';
+
+void check(List<int> source) {
+  final copy = List<num>.of(source);
+  Expect.isTrue(copy is List<num>);
+  Expect.isFalse(copy is List<int>);
+  Expect.listEquals(source, copy);
+  copy.add(1.5);
+  Expect.equals(source.length + 1, copy.length);
+  Expect.equals(1.5, copy.last);
+  for (int i = 0; i < source.length; i++) {
+    copy[i] = 0.5;
+  }
+  Expect.listEquals(List<int>.generate(source.length, (i) => i), source);
+}
+
+void main() {
+  for (final length in [0, 1, 63, 64, 65, 1000, 100000]) {
+    check(List<int>.generate(length, (i) => i, growable: false));
+    check(List<int>.unmodifiable(List<int>.generate(length, (i) => i)));
+  }
+}
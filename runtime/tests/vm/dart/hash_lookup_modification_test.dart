@@ -0,0 +1,71 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Tests that map and set lookups, which probe without bounds checks, stay
+// safe when hashCode or == shrink or grow the collection being searched.
+
+import 'package:expect/expect.dart';
+
+class Key {
+  final int id;
+  final void Function() onEquals;
+  final void Function() onHashCode;
+
+  Key(this.id, {this.onEquals = _nothing, this.onHashCode = _nothing});
+
+  static void _nothing() {}
+
+  @override
+  int get hashCode {
+    onHashCode();
+    return id;
+  }
+
+  @override
+  bool operator ==(Object other) {
+    onEquals();
+    return other is Key && other.id == id;
+  }
+}
+
+void main() {
+  for (final shrink in [true, false]) {
+    final map = <Object, int>{};
+    final set = <Object>{};
+    void modify() {
+      if (shrink) {
+        map.clear();
+        set.clear();
+      } else {
+        for (int i = 0; i < 1000; i++) {
+          map[i] = i;
+          set.add(i);
+        }
+      }
+    }
+
+    for (int i = 0; i < 100; i++) {
+      map[Key(i)] = i;
+      set.add(Key(i));
+    }
+    final onEquals = Key(42, onEquals: modify);
+    map[onEquals];
+    map.containsKey(onEquals);
+    set.lookup(onEquals);
+    set.contains(onEquals);
+
+    for (int i = 0; i < 100; i++) {
+      map[Key(i)] = i;
+      set.add(Key(i));
+    }
+    final onHashCode = Key(42, onHashCode: modify);
+    map[onHashCode];
+    map.putIfAbsent(onHashCode, () => 0);
+    if (shrink) {
+      Expect.identical(onHashCode, map.keys.single);
+    }
+    set.lookup(onHashCode);
+    set.contains(onHashCode);
+  }
+}
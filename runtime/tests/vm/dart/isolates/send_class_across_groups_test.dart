@@ -0,0 +1,45 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Tests that messages between isolate groups refer to user classes the
+// receiving group resolves to its own classes, also when the same classes are
+// sent repeatedly.
+
+import 'dart:io';
+import 'dart:isolate';
+
+import 'package:expect/expect.dart';
+
+class Marker {}
+
+class Other<T> {}
+
+const int rounds = 10;
+
+void child(SendPort sendPort) {
+  for (int i = 0; i < rounds; i++) {
+    sendPort.send([i, Marker, Other<Marker>, <Marker>[], <Other<int>>[]]);
+  }
+}
+
+main(List<String> args, [SendPort? sendPort]) async {
+  if (args.contains('child')) {
+    child(sendPort!);
+    return;
+  }
+
+  final port = ReceivePort();
+  await Isolate.spawnUri(Platform.script, ['child'], port.sendPort);
+  int received = 0;
+  await for (final List message in port) {
+    Expect.equals(received, message[0]);
+    Expect.equals(Marker, message[1]);
+    Expect.equals(Other<Marker>, message[2]);
+    Expect.isTrue(message[3] is List<Marker>);
+    Expect.isFalse(message[3] is List<Other>);
+    Expect.isTrue(message[4] is List<Other<int>>);
+    if (++received == rounds) break;
+  }
+  port.close();
+}
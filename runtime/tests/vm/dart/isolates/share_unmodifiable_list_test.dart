@@ -0,0 +1,46 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// VMOptions=--no-enable-fast-object-copy
+// VMOptions=--enable-fast-object-copy
+
+// Unmodifiable lists of deeply immutable objects are sent within an isolate
+// group without copying them.
+
+import 'dart:isolate';
+
+import 'package:expect/expect.dart';
+
+main() async {
+  final shared = List<Object?>.unmodifiable(['a', 1, 2.5, null, true, #sym]);
+  Expect.identical(shared, await sendReceive(shared));
+
+  // Sharing is decided for each list, the outer list is still copied.
+  final nested = List<Object>.unmodifiable([shared]);
+  final nestedCopy = await sendReceive(nested);
+  Expect.notIdentical(nested, nestedCopy);
+  Expect.identical(shared, nestedCopy[0]);
+
+  // A list referenced many times is shared at every reference. The large
+  // list also goes through the copier's path for large arrays.
+  for (final length in [10, 100000]) {
+    final references = List<Object>.filled(length, shared);
+    final referencesCopy = await sendReceive(references);
+    Expect.equals(length, referencesCopy.length);
+    for (final element in referencesCopy) {
+      Expect.identical(shared, element);
+    }
+  }
+
+  final withMutable = List<Object>.unmodifiable([<int>[1]]);
+  final copy = await sendReceive(withMutable);
+  Expect.notIdentical(withMutable, copy);
+  Expect.notIdentical(withMutable[0], copy[0]);
+}
+
+Future<T> sendReceive<T>(T arg) async {
+  final rp = ReceivePort();
+  rp.sendPort.send(arg);
+  return (await rp.first) as T;
+}
@@ -116,5 +116,52 @@ void main() {
         expect(await helperResult, equals('success'));
       });
     });
+
+    Future<String> spawnWaitingIsolate(int ptrAddress) {
+      return Isolate.run(() {
+        final ptr = Pointer<Uint8>.fromAddress(ptrAddress);
+
+        return mutexCondvar.runLocked(() {
+          ptr[0]++;
+          while (ptr[1] == 0) {
+            condVar.wait(mutexCondvar);
+          }
+          return 'success';
+        });
+      });
+    }
+
+    test('notifyAll', () async {
+      await using((arena) async {
+        final ptr = arena.allocate<Uint8>(2);
+        ptr[0] = 0;
+        ptr[1] = 0;
+        mutexCondvar = Mutex();
+        condVar = ConditionVariable();
+
+        final helperResults = [
+          spawnWaitingIsolate(ptr.address),
+          spawnWaitingIsolate(ptr.address),
+        ];
+
+        while (true) {
+          final success = mutexCondvar.runLocked(() {
+            if (ptr[0] == helperResults.length) {
+              ptr[1] = 1;
+              condVar.notifyAll();
+              return true;
+            }
+            return false;
+          });
+          if (success) {
+            break;
+          }
+          await Future.delayed(const Duration(milliseconds: 20));
+        }
+
+        expect(await Future.wait(helperResults),
+            equals(['success', 'success']));
+      });
+    });
   });
 }
@@ -0,0 +1,76 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Verifies that loads are forwarded across a static call to a function which
+// does not write memory, and are not forwarded across a call to a function
+// which does.
+
+import 'package:expect/expect.dart';
+import 'package:vm/testing/il_matchers.dart';
+
+class Box {
+  int value;
+  Box(this.value);
+}
+
+@pragma('vm:never-inline')
+int read(Box box) => box.value + 1;
+
+@pragma('vm:never-inline')
+void bump(Box box) {
+  box.value++;
+}
+
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph')
+int loadAroundRead(Box box) {
+  final before = box.value;
+  final result = read(box);
+  return before + result + box.value;
+}
+
+@pragma('vm:never-inline')
+@pragma('vm:testing:print-flow-graph')
+int loadAroundBump(Box box) {
+  final before = box.value;
+  bump(box);
+  return before + box.value;
+}
+
+void main() {
+  // The callers are referenced before the callees, so the precompiler
+  // compiles the callees first and knows their effects when compiling the
+  // callers.
+  Expect.equals(1 + 2 + 1, loadAroundRead(Box(1)));
+  Expect.equals(1 + 2, loadAroundBump(Box(1)));
+  Expect.equals(2, read(Box(1)));
+  final box = Box(1);
+  bump(box);
+  Expect.equals(2, box.value);
+}
+
+int _countLoadsOfValue(FlowGraph graph) {
+  int count = 0;
+  for (var block in graph.blocks()) {
+    for (var instr in [...?block['is']]) {
+      if (instr['o'] == 'LoadField' &&
+          graph.attributesFor(instr)?['slot'] == 'value') {
+        count++;
+      }
+    }
+  }
+  return count;
+}
+
+void matchIL$loadAroundRead(FlowGraph graph) {
+  graph.dump();
+  // The second load of box.value is replaced with the first one.
+  Expect.equals(1, _countLoadsOfValue(graph));
+}
+
+void matchIL$loadAroundBump(FlowGraph graph) {
+  graph.dump();
+  // bump writes box.value, so it is loaded again after the call.
+  Expect.equals(2, _countLoadsOfValue(graph));
+}
@@ -0,0 +1,97 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Tests that loads are forwarded across calls only when the callee cannot
+// write the loaded value, directly or through the functions it calls.
+
+import 'package:expect/expect.dart';
+
+class Box {
+  int value;
+  Box(this.value);
+}
+
+int counter = 0;
+
+@pragma('vm:never-inline')
+int read(Box box) => box.value + 1;
+
+@pragma('vm:never-inline')
+void bump(Box box) {
+  box.value++;
+}
+
+@pragma('vm:never-inline')
+void bumpIndirectly(Box box) {
+  bump(box);
+}
+
+@pragma('vm:never-inline')
+void bumpList(List<int> list) {
+  list[0]++;
+}
+
+@pragma('vm:never-inline')
+void bumpCounter() {
+  counter++;
+}
+
+@pragma('vm:never-inline')
+void callBack(void Function() f) {
+  f();
+}
+
+@pragma('vm:never-inline')
+int sumAroundCalls(Box box, List<int> list, int n) {
+  int sum = 0;
+  for (int i = 0; i < n; i++) {
+    sum += box.value;
+    sum += read(box);
+    sum += box.value;
+    bump(box);
+    sum += box.value;
+    bumpIndirectly(box);
+    sum += box.value;
+    sum += list[0];
+    bumpList(list);
+    sum += list[0];
+    sum += counter;
+    bumpCounter();
+    sum += counter;
+    callBack(() => box.value = 0);
+    sum += box.value;
+  }
+  return sum;
+}
+
+int expectedSum(int n, int list0, int counter0) {
+  int sum = 0;
+  int value = 0;
+  for (int i = 0; i < n; i++) {
+    sum += value + (value + 1) + value;
+    value++;
+    sum += value;
+    value++;
+    sum += value;
+    sum += list0 + i;
+    sum += list0 + i + 1;
+    sum += counter0 + i;
+    sum += counter0 + i + 1;
+    value = 0;
+    sum += value;
+  }
+  return sum;
+}
+
+void main() {
+  for (int i = 0; i < 20; i++) {
+    final box = Box(0);
+    final list = [10];
+    final counter0 = counter;
+    Expect.equals(
+        expectedSum(100, 10, counter0), sumAroundCalls(box, list, 100));
+    Expect.equals(110, list[0]);
+    Expect.equals(counter0 + 100, counter);
+  }
+}
@@ -0,0 +1,66 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Tests the output of gen_snapshot --print-code-duplication-to.
+
+import "dart:convert";
+import "dart:io";
+
+import 'package:expect/config.dart';
+import 'package:expect/expect.dart';
+import 'package:path/path.dart' as path;
+
+import 'use_flag_test_helper.dart';
+
+main(List<String> args) async {
+  if (!isVmAotConfiguration) {
+    return; // Running in JIT: AOT binaries not available.
+  }
+
+  if (Platform.isAndroid) {
+    return; // SDK tree and gen_snapshot not available on the test device.
+  }
+
+  await withTempDir('print_code_duplication_flag', (String tempDir) async {
+    final script = path.join(sdkDir, 'pkg/kernel/bin/dump.dart');
+    final scriptDill = path.join(tempDir, 'kernel_dump.dill');
+    final duplicationJson = path.join(tempDir, 'duplication.json');
+
+    await run('pkg/vm/tool/gen_kernel', <String>[
+      '--aot',
+      '--platform=$platformDill',
+      '-o',
+      scriptDill,
+      script,
+    ]);
+
+    final elfFile = path.join(tempDir, 'aot.snapshot');
+    await run(genSnapshot, <String>[
+      '--snapshot-kind=app-aot-elf',
+      '--print-code-duplication-to=$duplicationJson',
+      '--elf=$elfFile',
+      scriptDill,
+    ]);
+
+    final report = json.decode(await File(duplicationJson).readAsString());
+    Expect.isTrue(report is Map);
+    final inlined = report['inlined'] as List;
+    final identical = report['identical'] as List;
+
+    // Any program of this size inlines some functions more than once.
+    Expect.isTrue(inlined.isNotEmpty);
+    for (final entry in inlined) {
+      Expect.isTrue(entry['inlinings'] >= 2);
+      Expect.isTrue(entry['callers'] >= 1);
+      Expect.isTrue(entry['s'] >= 0);
+    }
+    for (int i = 1; i < inlined.length; i++) {
+      Expect.isTrue(inlined[i - 1]['s'] >= inlined[i]['s']);
+    }
+    for (final group in identical) {
+      Expect.isTrue((group['codes'] as List).length >= 2);
+      Expect.isTrue(group['s'] > 0);
+    }
+  });
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// VMOptions=--interpret_irregexp --regexp_backtrack_limit=1000
+
+// Tests that patterns which backtrack too much are matched by the linear time
+// engine with the same results, and that patterns it does not support still
+// match.
+
+import 'package:expect/expect.dart';
+
+void main() {
+  // Would take exponential time with backtracking.
+  final subject = 'a' * 40;
+  Expect.isFalse(RegExp(r'(a+)+b').hasMatch(subject));
+  Expect.isFalse(RegExp(r'^(a|aa)*$').hasMatch(subject + 'b'));
+
+  final match = RegExp(r'(a+)+c').firstMatch('x${subject}c')!;
+  Expect.equals(1, match.start);
+  Expect.equals(subject + 'c', match[0]);
+  Expect.equals(subject, match[1]);
+
+  // Leftmost, greedy and lazy choices are the ones backtracking makes.
+  final words = RegExp(r'(\w+?)(\d*)\b').firstMatch('${'w' * 2000}12 ')!;
+  Expect.equals('w' * 2000, words[1]);
+  Expect.equals('12', words[2]);
+
+  final alternatives =
+      RegExp(r'(a|ab)(c|bcd)(d*)').firstMatch('${'ab' * 1000}cd')!;
+  Expect.equals(1998, alternatives.start);
+  Expect.equals('a', alternatives[1]);
+  Expect.equals('bcd', alternatives[2]);
+  Expect.equals('', alternatives[3]);
+
+  // Captures in a quantified group are reset for each iteration.
+  final iterations =
+      RegExp(r'(?:(a)|(b)|ab)+y').firstMatch('${'ab' * 20}xaby')!;
+  Expect.equals('aby', iterations[0]);
+  Expect.isNull(iterations[1]);
+  Expect.equals('b', iterations[2]);
+
+  // Multi-line anchors.
+  final lines = RegExp(r'^(a+)+$', multiLine: true);
+  Expect.equals(subject, lines.firstMatch('${subject}b\n$subject')![0]);
+
+  // Back references are not supported by the linear engine.
+  final backReference = RegExp(r'(a+)+\1b');
+  Expect.isFalse(backReference.hasMatch('a' * 20));
+  Expect.isTrue(backReference.hasMatch('a' * 20 + 'b'));
+}
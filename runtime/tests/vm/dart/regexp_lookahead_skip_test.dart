@@ -0,0 +1,48 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// VMOptions=--interpret_irregexp
+// VMOptions=--no-interpret_irregexp
+
+// Tests the loops that skip ahead to the first position where a pattern can
+// match, both for a single required character and for a character class.
+
+import 'package:expect/expect.dart';
+
+void main() {
+  final padding = 'x' * 1000;
+  final twoBytePadding = 'ሴ' * 1000;
+
+  for (final pad in [padding, twoBytePadding]) {
+    // Single character lookahead.
+    final literal = RegExp(r'error: (\d+)');
+    Expect.isNull(literal.firstMatch(pad));
+    var match = literal.firstMatch('${pad}error: 42$pad')!;
+    Expect.equals(pad.length, match.start);
+    Expect.equals('42', match[1]);
+    Expect.equals(2, literal.allMatches('error: 1 ${pad}error: 2$pad').length);
+    // A near miss before the match.
+    match = literal.firstMatch('${pad}error ${pad}error: 7')!;
+    Expect.equals(2 * pad.length + 6, match.start);
+
+    // Character class lookahead.
+    final klass = RegExp(r'[qz]uu[qz]');
+    Expect.isNull(klass.firstMatch(pad));
+    match = klass.firstMatch('${pad}quuz$pad')!;
+    Expect.equals(pad.length, match.start);
+    Expect.equals('zuuq', klass.firstMatch('${pad}zuuq')![0]);
+
+    // Non-ASCII characters that collide with ASCII ones in the lookahead
+    // table.
+    final latin1 = RegExp('été');
+    Expect.isNull(latin1.firstMatch('${pad}iti'));
+    Expect.equals(pad.length, latin1.firstMatch('${pad}été')!.start);
+
+    // Starting from an index.
+    final input = 'error: 1${pad}error: 2';
+    match = literal.allMatches(input, 1).first;
+    Expect.equals(pad.length + 8, match.start);
+    Expect.equals('2', match[1]);
+  }
+}
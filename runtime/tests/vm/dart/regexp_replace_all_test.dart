@@ -0,0 +1,62 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// VMOptions=--interpret_irregexp
+// VMOptions=--no-interpret_irregexp
+
+// Tests that String.replaceAll with a RegExp, which finds all matches in one
+// native call, agrees with replacing what allMatches finds.
+
+import 'package:expect/expect.dart';
+
+String replaceAllMatches(String subject, RegExp re, String replacement) {
+  final buffer = StringBuffer();
+  int start = 0;
+  for (final match in re.allMatches(subject)) {
+    buffer.write(subject.substring(start, match.start));
+    buffer.write(replacement);
+    start = match.end;
+  }
+  buffer.write(subject.substring(start));
+  return buffer.toString();
+}
+
+void check(String subject, RegExp re, String replacement) {
+  Expect.equals(replaceAllMatches(subject, re, replacement),
+      subject.replaceAll(re, replacement), '$re on "$subject"');
+}
+
+void main() {
+  final subjects = [
+    '',
+    'abc',
+    'a1b22c333',
+    'x' * 1000 + '1',
+    'ሴ1ሴ22',
+    '\u{1F600}a\u{1F600}',
+  ];
+  final patterns = [
+    RegExp(r'\d+'),
+    RegExp(r'\d*'),
+    RegExp(r'^|$'),
+    RegExp(r'(?:)'),
+    RegExp(r'(?:)', unicode: true),
+    RegExp(r'\b'),
+    RegExp(r'[a-c]', caseSensitive: false),
+    RegExp(r'nomatch'),
+  ];
+  for (final subject in subjects) {
+    for (final re in patterns) {
+      check(subject, re, '');
+      check(subject, re, '-');
+      check(subject, re, 'ሴ');
+    }
+  }
+
+  // Many matches.
+  final words = List.filled(100000, 'word').join(' ');
+  Expect.equals(words.replaceAll(' ', ''), words.replaceAll(RegExp(r'\s'), ''));
+  final replaced = words.replaceAll(RegExp(r'(w)ord'), 'w');
+  Expect.equals('w' * 100000, replaced.replaceAll(' ', ''));
+}
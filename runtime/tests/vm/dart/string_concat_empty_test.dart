@@ -0,0 +1,30 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Concatenating with an empty string returns the other string.
+
+import "package:expect/expect.dart";
+
+@pragma("vm:never-inline")
+String genString(int i) => "abc-${i}-xyz";
+
+@pragma("vm:never-inline")
+String concat(String a, String b) => a + b;
+
+main() {
+  final s = genString(Object().hashCode);
+  final twoByte = genString(Object().hashCode) + "ሴ";
+  Expect.identical(s, concat(s, ""));
+  Expect.identical(s, concat("", s));
+  Expect.identical(twoByte, concat(twoByte, ""));
+  Expect.identical(twoByte, concat("", twoByte));
+  Expect.equals("", concat("", ""));
+  Expect.equals(s + twoByte, concat(s, twoByte));
+
+  var built = "";
+  for (int i = 0; i < 3; i++) {
+    built += "$i";
+  }
+  Expect.equals("012", built);
+}
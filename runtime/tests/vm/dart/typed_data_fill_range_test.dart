@@ -0,0 +1,49 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Tests fillRange on typed data lists and views for ranges both shorter and
+// longer than those filled by copying chunks of the list onto itself.
+
+import 'dart:typed_data';
+
+import 'package:expect/expect.dart';
+
+void checkFill<T>(List<T> list, T fill, T expected, T initial) {
+  for (final (start, end) in [(0, 0), (3, 10), (1, 33), (5, 100), (0, 200)]) {
+    for (int i = 0; i < list.length; i++) {
+      list[i] = initial;
+    }
+    list.fillRange(start, end, fill);
+    for (int i = 0; i < list.length; i++) {
+      final inRange = start <= i && i < end;
+      Expect.equals(inRange ? expected : initial, list[i], '$start-$end at $i');
+    }
+  }
+}
+
+void main() {
+  checkFill<int>(Uint8List(200), 0x1ff, 0xff, 7);
+  checkFill<int>(Int8List(200), -2, -2, 7);
+  checkFill<int>(Uint8ClampedList(200), 300, 255, 7);
+  checkFill<int>(Uint8ClampedList(200), -5, 0, 7);
+  checkFill<int>(Int16List(200), -300, -300, 7);
+  checkFill<int>(Uint32List(200), 0xdeadbeef, 0xdeadbeef, 7);
+  checkFill<int>(Int64List(200), -1 << 40, -1 << 40, 7);
+  checkFill<double>(Float32List(200), 1.5, 1.5, 0.0);
+  checkFill<double>(Float64List(200), -2.25, -2.25, 0.0);
+
+  // Views share the underlying buffer with other lists.
+  final bytes = Uint8List(1000);
+  final view = Uint16List.view(bytes.buffer, 100, 200);
+  checkFill<int>(view, 0xabcd, 0xabcd, 7);
+  Expect.equals(0, bytes[99]);
+  Expect.equals(0, bytes[500]);
+
+  final simd = Float32x4List(100);
+  simd.fillRange(10, 90, Float32x4(1, 2, 3, 4));
+  Expect.equals(0, simd[9].x);
+  Expect.equals(4, simd[10].w);
+  Expect.equals(3, simd[89].z);
+  Expect.equals(0, simd[90].y);
+}
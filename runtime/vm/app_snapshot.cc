@@ -49,6 +49,11 @@ DEFINE_FLAG(bool,
             "Print information about clusters written to snapshot");
 #endif
 
+DEFINE_FLAG(bool,
+            print_cluster_deserialization_times,
+            false,
+            "Print the time spent deserializing each cluster of a snapshot.");
+
 #if defined(DART_PRECOMPILER)
 DEFINE_FLAG(charp,
             write_v8_snapshot_profile_to,
@@ -59,6 +64,12 @@ DEFINE_FLAG(bool,
             false,
             "Print information about how many array are candidates for Smi and "
             "ROData optimizations.");
+DEFINE_FLAG(charp,
+            code_order,
+            nullptr,
+            "Place the instructions of the functions listed in this file, one "
+            "library-prefixed qualified name per line, first and in the given "
+            "order, e.g. the functions run at startup.");
 #endif  // defined(DART_PRECOMPILER)
 
 // Forward declarations.
@@ -248,6 +259,7 @@ class DeserializationCluster : public ZoneAllocated {
 
   const char* name() const { return name_; }
   bool is_canonical() const { return is_canonical_; }
+  intptr_t num_objects() const { return stop_index_ - start_index_; }
 
  protected:
   void ReadAllocFixedSize(Deserializer* deserializer, intptr_t instance_size);
@@ -541,6 +553,9 @@ class Serializer : public ThreadStackResource {
   bool CreateArtificialNodeIfNeeded(ObjectPtr obj);
 
   bool InCurrentLoadingUnitOrRoot(ObjectPtr obj);
+  // Returns true if 'obj' is a string or canonical type arguments literal of
+  // code in several loading units, which is written in the root unit.
+  bool IsSharedLiteral(ObjectPtr obj);
   void RecordDeferredCode(CodePtr ptr);
   GrowableArray<LoadingUnitSerializationData*>* loading_units() const {
     return loading_units_;
@@ -585,7 +600,7 @@ class Serializer : public ThreadStackResource {
   }
 
  private:
-  const char* ReadOnlyObjectType(intptr_t cid);
+  const char* ReadOnlyObjectType(intptr_t cid, bool is_canonical);
   void FlushProfile();
 
   Heap* heap_;
@@ -2600,6 +2615,62 @@ class KernelProgramInfoDeserializationCluster : public DeserializationCluster {
   }
 };
 
+using CodeOrderMap = MallocDirectChainedHashMap<CStringIntMapKeyValueTrait>;
+
+#if defined(DART_PRECOMPILER)
+// Maps the names listed in the --code_order file to their line numbers, or
+// returns nullptr if the file cannot be read. The file is only read once, as
+// the code of every loading unit is sorted by it.
+static CodeOrderMap* ReadCodeOrderFile() {
+  static bool has_read = false;
+  static CodeOrderMap* order = nullptr;
+  if (has_read) return order;
+  has_read = true;
+
+  Dart_FileOpenCallback file_open = Dart::file_open_callback();
+  Dart_FileReadCallback file_read = Dart::file_read_callback();
+  Dart_FileCloseCallback file_close = Dart::file_close_callback();
+  if ((file_open == nullptr) || (file_read == nullptr) ||
+      (file_close == nullptr)) {
+    OS::PrintErr("warning: Could not access file callbacks to read %s.\n",
+                 FLAG_code_order);
+    return nullptr;
+  }
+  void* file = (*file_open)(FLAG_code_order, /*write=*/false);
+  if (file == nullptr) {
+    OS::PrintErr("warning: Failed to read code order from %s.\n",
+                 FLAG_code_order);
+    return nullptr;
+  }
+  uint8_t* data = nullptr;
+  intptr_t length = -1;
+  (*file_read)(&data, &length, file);
+  (*file_close)(file);
+  order = new CodeOrderMap();
+  intptr_t start = 0;
+  // The last line need not end with a newline.
+  for (intptr_t i = 0; i <= length; i++) {
+    if ((i < length) && (data[i] != '\n')) continue;
+    intptr_t end = i;
+    if ((end > start) && (data[end - 1] == '\r')) {
+      end--;
+    }
+    if (end > start) {
+      char* name = Utils::StrNDup(reinterpret_cast<const char*>(&data[start]),
+                                  end - start);
+      if (order->LookupValue(name) == CStringIntMapKeyValueTrait::kNoValue) {
+        order->Insert({name, order->Length()});
+      } else {
+        free(name);
+      }
+    }
+    start = i + 1;
+  }
+  free(data);
+  return order;
+}
+#endif  // defined(DART_PRECOMPILER)
+
 class CodeSerializationCluster : public SerializationCluster {
  public:
   explicit CodeSerializationCluster(Heap* heap)
@@ -2711,7 +2782,8 @@ class CodeSerializationCluster : public SerializationCluster {
         // via a closure call.
         intptr_t cid = target->GetClassId();
         if (!only_call_targets || (cid == kCodeCid) || (cid == kFunctionCid) ||
-            (cid == kFieldCid) || (cid == kClosureCid)) {
+            (cid == kFieldCid) || (cid == kClosureCid) ||
+            s->IsSharedLiteral(target)) {
           s->Push(target);
         } else if (cid >= kNumPredefinedCids) {
           s->Push(s->isolate_group()->class_table()->At(cid));
@@ -2724,6 +2796,8 @@ class CodeSerializationCluster : public SerializationCluster {
     CodePtr code;
     intptr_t not_discarded;  // 1 if this code was not discarded and
                              // 0 otherwise.
+    intptr_t order;          // Position of the owner in --code_order, or
+                             // kIntptrMax if it is not listed.
     intptr_t instructions_id;
   };
 
@@ -2738,10 +2812,15 @@ class CodeSerializationCluster : public SerializationCluster {
   // there is no way to identify which specific Code object (out of those
   // which point to the specific instructions range) actually corresponds
   // to a particular frame.
+  //
+  // Within each of those groups, instructions of the functions listed in
+  // --code_order come first so that they share as few pages as possible.
   static int CompareCodeOrderInfo(CodeOrderInfo const* a,
                                   CodeOrderInfo const* b) {
     if (a->not_discarded < b->not_discarded) return -1;
     if (a->not_discarded > b->not_discarded) return 1;
+    if (a->order < b->order) return -1;
+    if (a->order > b->order) return 1;
     if (a->instructions_id < b->instructions_id) return -1;
     if (a->instructions_id > b->instructions_id) return 1;
     return 0;
@@ -2750,6 +2829,7 @@ class CodeSerializationCluster : public SerializationCluster {
   static void Insert(Serializer* s,
                      GrowableArray<CodeOrderInfo>* order_list,
                      IntMap<intptr_t>* order_map,
+                     CodeOrderMap* code_order,
                      CodePtr code) {
     InstructionsPtr instr = code->untag()->instructions_;
     intptr_t key = static_cast<intptr_t>(instr);
@@ -2768,14 +2848,37 @@ class CodeSerializationCluster : public SerializationCluster {
     info.code = code;
     info.instructions_id = instructions_id;
     info.not_discarded = Code::IsDiscarded(code) ? 0 : 1;
+    info.order = kIntptrMax;
+    if (code_order != nullptr) {
+      const Object& owner = Object::Handle(s->zone(), code->untag()->owner());
+      if (owner.IsFunction()) {
+        const intptr_t order = code_order->LookupValue(
+            Function::Cast(owner).ToLibNamePrefixedQualifiedCString());
+        if (order != CStringIntMapKeyValueTrait::kNoValue) {
+          info.order = order;
+        }
+      }
+    }
     order_list->Add(info);
   }
 
+  static CodeOrderMap* ReadCodeOrder() {
+#if defined(DART_PRECOMPILER)
+    // Only in AOT code objects never share instructions, which must stay
+    // adjacent.
+    if (FLAG_code_order != nullptr && FLAG_precompiled_mode) {
+      return ReadCodeOrderFile();
+    }
+#endif  // defined(DART_PRECOMPILER)
+    return nullptr;
+  }
+
   static void Sort(Serializer* s, GrowableArray<CodePtr>* codes) {
     GrowableArray<CodeOrderInfo> order_list;
     IntMap<intptr_t> order_map;
+    CodeOrderMap* code_order = ReadCodeOrder();
     for (intptr_t i = 0; i < codes->length(); i++) {
-      Insert(s, &order_list, &order_map, (*codes)[i]);
+      Insert(s, &order_list, &order_map, code_order, (*codes)[i]);
     }
     order_list.Sort(CompareCodeOrderInfo);
     ASSERT(order_list.length() == codes->length());
@@ -2787,8 +2890,9 @@ class CodeSerializationCluster : public SerializationCluster {
   static void Sort(Serializer* s, GrowableArray<Code*>* codes) {
     GrowableArray<CodeOrderInfo> order_list;
     IntMap<intptr_t> order_map;
+    CodeOrderMap* code_order = ReadCodeOrder();
     for (intptr_t i = 0; i < codes->length(); i++) {
-      Insert(s, &order_list, &order_map, (*codes)[i]->ptr());
+      Insert(s, &order_list, &order_map, code_order, (*codes)[i]->ptr());
     }
     order_list.Sort(CompareCodeOrderInfo);
     ASSERT(order_list.length() == codes->length());
@@ -3637,6 +3741,11 @@ class RODataSerializationCluster
         s->heap()->old_space()->IsObjectFromImagePages(object)) {
       // This object is already read-only.
     } else {
+      if (cid_ == kDoubleCid) {
+        // Cache the identity hash in the header while it is still writable.
+        Double::Handle(s->zone(), Double::RawCast(object))
+            .IdentityHashCode(s->thread());
+      }
       Object::FinalizeReadOnlyObject(object);
     }
 
@@ -7801,7 +7910,7 @@ intptr_t Serializer::UnsafeRefId(ObjectPtr object) const {
   FATAL("Reference for object %s is unallocated", handle.ToCString());
 }
 
-const char* Serializer::ReadOnlyObjectType(intptr_t cid) {
+const char* Serializer::ReadOnlyObjectType(intptr_t cid, bool is_canonical) {
   switch (cid) {
     case kPcDescriptorsCid:
       return "PcDescriptors";
@@ -7821,6 +7930,12 @@ const char* Serializer::ReadOnlyObjectType(intptr_t cid) {
       return current_loading_unit_id_ <= LoadingUnit::kRootId
                  ? "TwoByteStringCid"
                  : nullptr;
+    case kDoubleCid:
+      // Non-canonical doubles get their canonical bit set when they are
+      // canonicalized, and doubles of other units are canonicalized on load.
+      return is_canonical && current_loading_unit_id_ <= LoadingUnit::kRootId
+                 ? "CanonicalDouble"
+                 : nullptr;
     default:
       return nullptr;
   }
@@ -7857,7 +7972,7 @@ SerializationCluster* Serializer::NewClusterForClass(intptr_t cid,
   // the memory image, and it might be outside the 4GB region addressable by
   // compressed pointers.
   if (Snapshot::IncludesCode(kind_)) {
-    if (auto const type = ReadOnlyObjectType(cid)) {
+    if (auto const type = ReadOnlyObjectType(cid, is_canonical)) {
       return new (Z) RODataSerializationCluster(Z, type, cid, is_canonical);
     }
   }
@@ -8008,6 +8123,13 @@ bool Serializer::InCurrentLoadingUnitOrRoot(ObjectPtr obj) {
   return unit_id == LoadingUnit::kRootId || unit_id == current_loading_unit_id_;
 }
 
+bool Serializer::IsSharedLiteral(ObjectPtr obj) {
+  if (loading_units_ == nullptr || !obj->IsHeapObject()) return false;
+  const intptr_t cid = obj->GetClassIdOfHeapObject();
+  if (!IsStringClassId(cid) && cid != kTypeArgumentsCid) return false;
+  return heap_->GetLoadingUnit(obj) == LoadingUnit::kRootId;
+}
+
 void Serializer::RecordDeferredCode(CodePtr code) {
   const intptr_t unit_id = heap_->GetLoadingUnit(code);
   ASSERT(unit_id != WeakTable::kNoValue && unit_id != LoadingUnit::kRootId);
@@ -9019,6 +9141,12 @@ DeserializationCluster* Deserializer::ReadCluster() {
                                                       !is_non_root_unit_);
         }
         break;
+      case kDoubleCid:
+        if (is_canonical && !is_non_root_unit_) {
+          return new (Z) RODataDeserializationCluster(cid, is_canonical,
+                                                      !is_non_root_unit_);
+        }
+        break;
     }
   }
 #endif
@@ -9527,6 +9655,13 @@ void Deserializer::Deserialize(DeserializationRoots* roots) {
   clusters_ = new DeserializationCluster*[num_clusters_];
   refs = Array::New(num_objects_ + kFirstReference, Heap::kOld);
 
+  // Microseconds spent in ReadAlloc, ReadFill and PostLoad of each cluster.
+  int64_t* cluster_times = nullptr;
+  if (FLAG_print_cluster_deserialization_times) {
+    cluster_times = zone()->Alloc<int64_t>(3 * num_clusters_);
+    memset(cluster_times, 0, 3 * num_clusters_ * sizeof(int64_t));
+  }
+
 #if defined(DART_PRECOMPILED_RUNTIME)
   if (instructions_table_len > 0) {
     ASSERT(FLAG_precompiled_mode);
@@ -9577,8 +9712,14 @@ void Deserializer::Deserialize(DeserializationRoots* roots) {
     {
       TIMELINE_DURATION(thread(), Isolate, "ReadAlloc");
       for (intptr_t i = 0; i < num_clusters_; i++) {
+        const int64_t start = cluster_times != nullptr
+                                  ? OS::GetCurrentMonotonicMicros()
+                                  : 0;
         clusters_[i] = ReadCluster();
         clusters_[i]->ReadAlloc(this);
+        if (cluster_times != nullptr) {
+          cluster_times[3 * i] = OS::GetCurrentMonotonicMicros() - start;
+        }
 #if defined(DEBUG)
         intptr_t serializers_next_ref_index_ = Read<int32_t>();
         ASSERT_EQUAL(serializers_next_ref_index_, next_ref_index_);
@@ -9592,7 +9733,13 @@ void Deserializer::Deserialize(DeserializationRoots* roots) {
     {
       TIMELINE_DURATION(thread(), Isolate, "ReadFill");
       for (intptr_t i = 0; i < num_clusters_; i++) {
+        const int64_t start = cluster_times != nullptr
+                                  ? OS::GetCurrentMonotonicMicros()
+                                  : 0;
         clusters_[i]->ReadFill(this);
+        if (cluster_times != nullptr) {
+          cluster_times[3 * i + 1] = OS::GetCurrentMonotonicMicros() - start;
+        }
 #if defined(DEBUG)
         int32_t section_marker = Read<int32_t>();
         ASSERT(section_marker == kSectionMarker);
@@ -9623,7 +9770,23 @@ void Deserializer::Deserialize(DeserializationRoots* roots) {
   {
     TIMELINE_DURATION(thread(), Isolate, "PostLoad");
     for (intptr_t i = 0; i < num_clusters_; i++) {
+      const int64_t start =
+          cluster_times != nullptr ? OS::GetCurrentMonotonicMicros() : 0;
       clusters_[i]->PostLoad(this, refs);
+      if (cluster_times != nullptr) {
+        cluster_times[3 * i + 2] = OS::GetCurrentMonotonicMicros() - start;
+      }
+    }
+  }
+
+  if (cluster_times != nullptr) {
+    OS::PrintErr("%-24s %10s %10s %10s %10s\n", "Cluster", "Objects",
+                 "Alloc(us)", "Fill(us)", "PostLoad(us)");
+    for (intptr_t i = 0; i < num_clusters_; i++) {
+      OS::PrintErr("%-24s %10" Pd " %10" Pd64 " %10" Pd64 " %10" Pd64 "\n",
+                   clusters_[i]->name(), clusters_[i]->num_objects(),
+                   cluster_times[3 * i], cluster_times[3 * i + 1],
+                   cluster_times[3 * i + 2]);
     }
   }
 
@@ -18,10 +18,16 @@
 #include "vm/app_snapshot.h"
 #include "vm/dart_api_impl.h"
 #include "vm/datastream.h"
+#include "vm/heap/heap.h"
+#include "vm/json_writer.h"
 #include "vm/message_snapshot.h"
 #include "vm/stack_frame.h"
 #include "vm/timer.h"
 
+#if !defined(DART_PRECOMPILED_RUNTIME)
+#include "vm/compiler/compiler_timings.h"
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+
 using dart::bin::File;
 
 namespace dart {
@@ -61,6 +67,38 @@ BENCHMARK(CorelibCompileAll) {
   benchmark->set_score(elapsed_time);
 }
 
+#if !defined(DART_PRECOMPILED_RUNTIME)
+//
+// Measure compile of all functions in dart core lib classes, broken down by
+// compiler pass. The breakdown is printed as JSON so that regressions in
+// individual passes can be tracked.
+//
+BENCHMARK(CorelibCompileAllPerPass) {
+  bin::Builtin::SetNativeResolver(bin::Builtin::kBuiltinLibrary);
+  bin::Builtin::SetNativeResolver(bin::Builtin::kIOLibrary);
+  bin::Builtin::SetNativeResolver(bin::Builtin::kCLILibrary);
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  CompilerTimings* timings = new CompilerTimings();
+  thread->set_compiler_timings(timings);
+  Timer timer;
+  timer.Start();
+  const Error& error =
+      Error::Handle(Library::CompileAll(/*ignore_error=*/true));
+  if (!error.IsNull()) {
+    OS::PrintErr("Unexpected error in CorelibCompileAllPerPass benchmark:\n%s",
+                 error.ToErrorCString());
+  }
+  timer.Stop();
+  thread->set_compiler_timings(nullptr);
+  JSONWriter writer;
+  timings->PrintJSON(&writer);
+  OS::Print("CorelibCompileAllPerPass(JSON): %s\n", writer.ToCString());
+  delete timings;
+  benchmark->set_score(timer.TotalElapsedTime());
+}
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+
 // This file is created by the target //runtime/bin:dart_kernel_platform_cc
 // which is depended on by run_vm_tests.
 static char* ComputeKernelServicePath(const char* arg) {
@@ -564,6 +602,166 @@ BENCHMARK(LargeMap) {
   benchmark->set_score(elapsed_time);
 }
 
+//
+// Measure garbage collection of reproducible heap shapes. The scores are the
+// total time spent in the collections, not including building the heap.
+//
+static constexpr intptr_t kGCBenchmarkIterations = 10;
+
+// Returns the head of a singly linked list of two element arrays, each
+// holding the next node and its index.
+static ArrayPtr MakeLinkedList(intptr_t length, Heap::Space space) {
+  Array& head = Array::Handle();
+  Array& node = Array::Handle();
+  Smi& index = Smi::Handle();
+  for (intptr_t i = 0; i < length; i++) {
+    node = Array::New(2, space);
+    index = Smi::New(i);
+    node.SetAt(0, head);
+    node.SetAt(1, index);
+    head = node.ptr();
+  }
+  return head.ptr();
+}
+
+BENCHMARK(GCScavengeLinkedList) {
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  Array& list = Array::Handle();
+  Timer timer;
+  for (intptr_t i = 0; i < kGCBenchmarkIterations; i++) {
+    // Small enough to be allocated without a scavenge in between, so all of
+    // it is copied by the measured one.
+    list = MakeLinkedList(10000, Heap::kNew);
+    timer.Start();
+    GCTestHelper::CollectNewSpace();
+    timer.Stop();
+  }
+  EXPECT(!list.IsNull());
+  benchmark->set_score(timer.TotalElapsedTime());
+}
+
+BENCHMARK(GCMarkSweepLinkedList) {
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  // A long chain cannot be marked in parallel, so this measures the latency
+  // of a single marker following pointers.
+  const Array& list = Array::Handle(MakeLinkedList(1 * MB, Heap::kOld));
+  Timer timer;
+  for (intptr_t i = 0; i < kGCBenchmarkIterations; i++) {
+    timer.Start();
+    GCTestHelper::CollectOldSpace();
+    timer.Stop();
+  }
+  EXPECT(!list.IsNull());
+  benchmark->set_score(timer.TotalElapsedTime());
+}
+
+BENCHMARK(GCScavengeCardMarking) {
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  // A large old array is remembered by cards, so a scavenge only visits the
+  // cards that had young pointers stored into them.
+  const intptr_t kLength = 1 * MB;
+  const intptr_t kStride = 1 * KB;
+  const Array& wide = Array::Handle(Array::New(kLength, Heap::kOld));
+  Array& young = Array::Handle();
+  Timer timer;
+  for (intptr_t i = 0; i < kGCBenchmarkIterations; i++) {
+    for (intptr_t j = i; j < kLength; j += kStride) {
+      young = Array::New(1, Heap::kNew);
+      wide.SetAt(j, young);
+    }
+    timer.Start();
+    GCTestHelper::CollectNewSpace();
+    timer.Stop();
+  }
+  benchmark->set_score(timer.TotalElapsedTime());
+}
+
+BENCHMARK(GCWeakProperties) {
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  // Half of the keys are only reachable through the weak properties, so
+  // those entries are cleared by every collection.
+  const intptr_t kCount = 100 * KB;
+  const Array& properties = Array::Handle(Array::New(kCount, Heap::kOld));
+  const Array& live_keys = Array::Handle(Array::New(kCount / 2, Heap::kOld));
+  WeakProperty& property = WeakProperty::Handle();
+  Array& key = Array::Handle();
+  Array& value = Array::Handle();
+  Timer timer;
+  for (intptr_t i = 0; i < kGCBenchmarkIterations; i++) {
+    for (intptr_t j = 0; j < kCount; j++) {
+      key = Array::New(1, Heap::kOld);
+      value = Array::New(1, Heap::kOld);
+      property = WeakProperty::New(Heap::kOld);
+      property.set_key(key);
+      property.set_value(value);
+      properties.SetAt(j, property);
+      if ((j & 1) == 0) {
+        live_keys.SetAt(j / 2, key);
+      }
+    }
+    timer.Start();
+    GCTestHelper::CollectOldSpace();
+    timer.Stop();
+  }
+  benchmark->set_score(timer.TotalElapsedTime());
+}
+
+static void NoopFinalizer(void* isolate_callback_data, void* peer) {}
+
+BENCHMARK(GCFinalizableHandles) {
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  // Half of the objects with a finalizer die in each collection, so their
+  // finalizers run and their handles are freed.
+  const intptr_t kCount = 100 * KB;
+  const Array& live_objects = Array::Handle(Array::New(kCount / 2, Heap::kOld));
+  Array& object = Array::Handle();
+  IsolateGroup* isolate_group = thread->isolate_group();
+  Timer timer;
+  for (intptr_t i = 0; i < kGCBenchmarkIterations; i++) {
+    for (intptr_t j = 0; j < kCount; j++) {
+      object = Array::New(1, Heap::kOld);
+      FinalizablePersistentHandle::New(isolate_group, object, nullptr,
+                                       NoopFinalizer, /*external_size=*/0,
+                                       /*auto_delete=*/true);
+      if ((j & 1) == 0) {
+        live_objects.SetAt(j / 2, object);
+      }
+    }
+    timer.Start();
+    GCTestHelper::CollectOldSpace();
+    timer.Stop();
+  }
+  benchmark->set_score(timer.TotalElapsedTime());
+}
+
+BENCHMARK(GCCompactFragmented) {
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  // Every other object dies, leaving holes of varying size on every page.
+  const intptr_t kCount = 200 * KB;
+  const Array& objects = Array::Handle(Array::New(kCount, Heap::kOld));
+  Array& element = Array::Handle();
+  Timer timer;
+  for (intptr_t i = 0; i < kGCBenchmarkIterations; i++) {
+    for (intptr_t j = 0; j < kCount; j++) {
+      element = Array::New(1 + (j % 16), Heap::kOld);
+      objects.SetAt(j, element);
+    }
+    for (intptr_t j = 0; j < kCount; j += 2) {
+      objects.SetAt(j, Object::null_object());
+    }
+    timer.Start();
+    GCTestHelper::CollectAllGarbage(/*compact=*/true);
+    timer.Stop();
+  }
+  benchmark->set_score(timer.TotalElapsedTime());
+}
+
 BENCHMARK_MEMORY(InitialRSS) {
   benchmark->set_score(bin::Process::MaxRSS());
 }
@@ -111,6 +111,7 @@ namespace dart {
   V(RegExp_getGroupNameMap, 1)                                                 \
   V(RegExp_ExecuteMatch, 3)                                                    \
   V(RegExp_ExecuteMatchSticky, 3)                                              \
+  V(RegExp_ExecuteMatchAll, 3)                                                 \
   V(List_allocate, 2)                                                          \
   V(List_setIndexed, 3)                                                        \
   V(List_getLength, 1)                                                         \
@@ -370,6 +371,7 @@ namespace dart {
 #define BOOTSTRAP_FFI_NATIVE_LIST(V)                                           \
   V(ConditionVariable_Initialize, void, (Dart_Handle))                         \
   V(ConditionVariable_Notify, void, (Dart_Handle))                             \
+  V(ConditionVariable_NotifyAll, void, (Dart_Handle))                          \
   V(ConditionVariable_Wait, void, (Dart_Handle, Dart_Handle))                  \
   V(FinalizerEntry_SetExternalSize, void, (Dart_Handle, intptr_t))             \
   V(Mutex_Initialize, void, (Dart_Handle))                                     \
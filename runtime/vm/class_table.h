@@ -398,12 +398,25 @@ class ClassTable : public MallocAllocated {
 #if !defined(PRODUCT)
   bool ShouldTraceAllocationFor(intptr_t cid) {
     return !IsTopLevelCid(cid) &&
-           (classes_.At<kAllocationTracingStateIndex>(cid) != kTracingDisabled);
+           ((classes_.At<kAllocationTracingStateIndex>(cid) & ~kPretenureBit) !=
+            kTracingDisabled);
   }
 
   void SetTraceAllocationFor(intptr_t cid, bool trace) {
-    classes_.At<kAllocationTracingStateIndex>(cid) =
-        trace ? kTraceAllocationBit : kTracingDisabled;
+    auto& slot = classes_.At<kAllocationTracingStateIndex>(cid);
+    slot = (slot & kPretenureBit) |
+           (trace ? kTraceAllocationBit : kTracingDisabled);
+  }
+
+  // Any non-zero state makes inline allocation take the slow path, which lets
+  // the runtime place pretenured classes in old space.
+  void SetPretenureFor(intptr_t cid, bool pretenure) {
+    auto& slot = classes_.At<kAllocationTracingStateIndex>(cid);
+    if (pretenure) {
+      slot |= kPretenureBit;
+    } else {
+      slot &= ~kPretenureBit;
+    }
   }
 
   void SetCollectInstancesFor(intptr_t cid, bool trace) {
@@ -592,6 +605,7 @@ class ClassTable : public MallocAllocated {
     kTracingDisabled = 0,
     kTraceAllocationBit = (1 << 0),
     kCollectInstancesBit = (1 << 1),
+    kPretenureBit = (1 << 2),
   };
 #endif  // !PRODUCT
 
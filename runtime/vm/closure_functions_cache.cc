@@ -21,12 +21,60 @@ class FunctionHashMapTraits {
   static uword Hash(const Object& key) { return Function::Cast(key).Hash(); }
 };
 
-using FunctionHashMap = UnorderedHashMap<FunctionHashMapTraits>;
+// Both maps are accessed via store-release/load-acquire barriers to allow
+// lock-free lookups, see [LookupClosureFunction].
+using FunctionHashMap =
+    UnorderedHashMap<FunctionHashMapTraits, AcqRelStorageTraits>;
+using KernelOffsetHashMap = UnorderedHashMap<SmiTraits, AcqRelStorageTraits>;
+
+// A concurrent writer can make a key visible before its payload, so
+// lock-free lookups check the type of what they find and miss otherwise.
+static FunctionPtr LookupClosureFunctionInTable(Zone* zone,
+                                                ObjectStore* object_store,
+                                                const Function& member_function,
+                                                intptr_t kernel_offset) {
+  auto& map_array =
+      Array::Handle(zone, object_store->closure_functions_table());
+  if (map_array.IsNull()) {
+    return Function::null();
+  }
+
+  auto& entry = Object::Handle(zone);
+  FunctionHashMap map(zone, map_array.ptr());
+  entry = map.GetOrNull(member_function);
+  map.Release();
+
+  if (!entry.IsArray()) {
+    return Function::null();
+  }
+
+  map_array ^= entry.ptr();
+  KernelOffsetHashMap map2(zone, map_array.ptr());
+  entry = map2.GetOrNull(Smi::Handle(zone, Smi::New(kernel_offset)));
+  map2.Release();
+
+  if (!entry.IsFunction()) {
+    return Function::null();
+  }
+  return Function::Cast(entry).ptr();
+}
 
 FunctionPtr ClosureFunctionsCache::LookupClosureFunction(
     const Function& member_function,
     intptr_t kernel_offset) {
   auto thread = Thread::Current();
+  auto zone = thread->zone();
+  auto object_store = thread->isolate_group()->object_store();
+
+  // Closure functions are never removed from the cache, so a function found
+  // without holding the program lock is the one a locked lookup would find.
+  const auto& result = Function::Handle(
+      zone, LookupClosureFunctionInTable(zone, object_store, member_function,
+                                         kernel_offset));
+  if (!result.IsNull()) {
+    return result.ptr();
+  }
+
   SafepointReadRwLocker ml(thread, thread->isolate_group()->program_lock());
   return LookupClosureFunctionLocked(member_function, kernel_offset);
 }
@@ -41,26 +89,8 @@ FunctionPtr ClosureFunctionsCache::LookupClosureFunctionLocked(
   DEBUG_ASSERT(
       thread->isolate_group()->program_lock()->IsCurrentThreadReader());
 
-  auto& map_array =
-      Array::Handle(zone, object_store->closure_functions_table());
-  if (map_array.IsNull()) {
-    return Function::null();
-  }
-
-  FunctionHashMap map(zone, map_array.ptr());
-  map_array ^= map.GetOrNull(member_function);
-  map.Release();
-
-  if (map_array.IsNull()) {
-    return Function::null();
-  }
-
-  auto& result = Function::Handle(zone);
-  IntHashMap map2(zone, map_array.ptr());
-  result ^= map2.GetOrNull(Smi::Handle(zone, Smi::New(kernel_offset)));
-  map2.Release();
-
-  return result.ptr();
+  return LookupClosureFunctionInTable(zone, object_store, member_function,
+                                      kernel_offset);
 }
 
 void ClosureFunctionsCache::AddClosureFunctionLocked(
@@ -102,9 +132,9 @@ void ClosureFunctionsCache::AddClosureFunctionLocked(
   FunctionHashMap map(zone, map_array.ptr());
   map_array ^= map.GetOrNull(member_function);
   if (map_array.IsNull()) {
-    map_array = HashTables::New<IntHashMap>(4, Heap::kOld);
+    map_array = HashTables::New<KernelOffsetHashMap>(4, Heap::kOld);
   }
-  IntHashMap map2(zone, map_array.ptr());
+  KernelOffsetHashMap map2(zone, map_array.ptr());
   map2.UpdateOrInsert(Smi::Handle(zone, Smi::New(function.kernel_offset())),
                       function);
   map.UpdateOrInsert(member_function, map2.Release());
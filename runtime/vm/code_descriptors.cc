@@ -629,6 +629,50 @@ void CodeSourceMapReader::GetInlinedFunctionsAt(
   }
 }
 
+void CodeSourceMapReader::GetInlinedSizes(GrowableArray<intptr_t>* sizes,
+                                          GrowableArray<intptr_t>* counts) {
+  ASSERT(sizes->length() >= functions_.Length());
+  ASSERT(counts->length() >= functions_.Length());
+  GrowableArray<int32_t> function_stack;
+  NoSafepointScope no_safepoint;
+  ReadStream stream(map_.Data(), map_.Length());
+
+  function_stack.Add(0);
+
+  while (stream.PendingBytes() > 0) {
+    int32_t arg;
+    const uint8_t opcode = CodeSourceMapOps::Read(&stream, &arg);
+    switch (opcode) {
+      case CodeSourceMapOps::kChangePosition: {
+        break;
+      }
+      case CodeSourceMapOps::kAdvancePC: {
+        // The root function is not inlined.
+        for (intptr_t i = 1; i < function_stack.length(); i++) {
+          (*sizes)[function_stack[i]] += arg;
+        }
+        break;
+      }
+      case CodeSourceMapOps::kPushFunction: {
+        function_stack.Add(arg);
+        (*counts)[arg]++;
+        break;
+      }
+      case CodeSourceMapOps::kPopFunction: {
+        // We never pop the root function.
+        ASSERT(function_stack.length() > 1);
+        function_stack.RemoveLast();
+        break;
+      }
+      case CodeSourceMapOps::kNullCheck: {
+        break;
+      }
+      default:
+        UNREACHABLE();
+    }
+  }
+}
+
 #ifndef PRODUCT
 void CodeSourceMapReader::PrintJSONInlineIntervals(JSONObject* jsobj) {
   {
@@ -344,6 +344,13 @@ class CodeSourceMapReader : public ValueObject {
   void DumpInlineIntervals(uword start);
   void DumpSourcePositions(uword start);
 
+  // For each inlined id, adds to 'sizes' the number of instruction bytes
+  // generated for the function inlined with that id, including what it
+  // inlined itself, and to 'counts' the number of times it was inlined.
+  // Both arrays must be as long as the inlined id to function array.
+  void GetInlinedSizes(GrowableArray<intptr_t>* sizes,
+                       GrowableArray<intptr_t>* counts);
+
   intptr_t GetNullCheckNameIndexAt(int32_t pc_offset);
 
  private:
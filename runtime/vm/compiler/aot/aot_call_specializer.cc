@@ -38,6 +38,11 @@ DEFINE_FLAG(int,
             5,
             "If a call receiver is known to be of at most this many classes, "
             "generate exhaustive class tests instead of a megamorphic call");
+DEFINE_FLAG(bool,
+            print_polymorphic_dynamic_calls,
+            false,
+            "Print the dynamic calls that check for their few possible "
+            "receiver classes before falling back to a megamorphic call");
 
 // Quick access to the current isolate and zone.
 #define IG (isolate_group())
@@ -982,6 +987,10 @@ void AotCallSpecializer::VisitInstanceCall(InstanceCallInstr* instr) {
     }
   }
 
+  if (targets.is_empty() && TryReplaceWithPolymorphicDynamicCall(instr)) {
+    return;
+  }
+
   // More than one target. Generate generic polymorphic call without
   // deoptimization.
   if (targets.length() > 0) {
@@ -996,6 +1005,93 @@ void AotCallSpecializer::VisitInstanceCall(InstanceCallInstr* instr) {
   }
 }
 
+// Upper bound on the number of receiver classes collected for a dynamic call
+// before the classes are merged into cid ranges.
+static constexpr intptr_t kMaxPolymorphicDynamicClasses = 32;
+
+bool AotCallSpecializer::TryReplaceWithPolymorphicDynamicCall(
+    InstanceCallInstr* call) {
+  // Calls with an interface target use the dispatch table instead.
+  if (!call->interface_target().IsNull() ||
+      IG->object_store()->polymorphic_dynamic_targets() == Array::null()) {
+    return false;
+  }
+  Array& functions = Array::Handle(Z);
+  {
+    UniqueFunctionsMap functions_map(
+        IG->object_store()->polymorphic_dynamic_targets());
+    functions ^= functions_map.GetOrNull(call->function_name());
+    functions_map.Release();
+  }
+  if (functions.IsNull()) {
+    return false;
+  }
+
+  const intptr_t named_count =
+      call->argument_names().IsNull() ? 0 : call->argument_names().Length();
+  const ICData& ic_data = ICData::Handle(
+      Z, ICData::New(flow_graph()->function(), call->function_name(),
+                     Array::Handle(Z, call->GetArgumentsDescriptor()),
+                     DeoptId::kNone, /* args_tested = */ 1,
+                     ICData::kOptimized));
+  GrowableArray<intptr_t> class_ids(8);
+  Function& function = Function::Handle(Z);
+  Function& target = Function::Handle(Z);
+  Class& cls = Class::Handle(Z);
+  intptr_t num_classes = 0;
+  for (intptr_t i = 0; i < functions.Length(); i++) {
+    function ^= functions.At(i);
+    // Same restrictions as for unique targets, see
+    // TryCreateICDataForUniqueTarget.
+    if (function.HasOptionalNamedParameters() || function.IsGeneric() ||
+        !function.AreValidArgumentCounts(
+            call->type_args_len(), call->ArgumentCountWithoutTypeArgs(),
+            named_count, /* error_message = */ nullptr)) {
+      return false;
+    }
+    cls = function.Owner();
+    class_ids.Clear();
+    if (!thread()->compiler_state().cha().ConcreteSubclasses(cls,
+                                                             &class_ids)) {
+      return false;
+    }
+    for (intptr_t j = 0; j < class_ids.length(); j++) {
+      cls = IG->class_table()->At(class_ids[j]);
+      target = call->ResolveForReceiverClass(cls);
+      // Subclasses which override the function are covered by the entry of
+      // the override.
+      if (target.ptr() != function.ptr()) continue;
+      if (ic_data.HasReceiverClassId(class_ids[j])) continue;
+      if (++num_classes > kMaxPolymorphicDynamicClasses) {
+        return false;
+      }
+      ic_data.AddReceiverCheck(class_ids[j], function);
+    }
+  }
+  if (ic_data.NumberOfChecksIs(0)) {
+    return false;
+  }
+
+  // Classes with the same target and adjacent cids are checked as one range.
+  const CallTargets* targets = CallTargets::Create(Z, ic_data);
+  if (targets->length() > FLAG_max_polymorphic_checks) {
+    return false;
+  }
+  if (FLAG_print_polymorphic_dynamic_calls) {
+    THR_Print("Dynamic call %s in %s: %" Pd " targets, %" Pd
+              " cid ranges\n",
+              call->function_name().ToCString(),
+              flow_graph()->function().ToQualifiedCString(),
+              functions.Length(), targets->length());
+  }
+  // Receivers of other classes, e.g. null, take the megamorphic call.
+  PolymorphicInstanceCallInstr* replacement =
+      PolymorphicInstanceCallInstr::FromCall(Z, call, *targets,
+                                             /* complete = */ false);
+  call->ReplaceWith(replacement, current_iterator());
+  return true;
+}
+
 void AotCallSpecializer::VisitStaticCall(StaticCallInstr* instr) {
   if (TryInlineFieldAccess(instr)) {
     return;
@@ -38,6 +38,10 @@ class AotCallSpecializer : public CallSpecializer {
 
   bool TryCreateICDataForUniqueTarget(InstanceCallInstr* call);
 
+  // Replaces a dynamic call whose selector has only a few implementations
+  // with class checks for their receivers, followed by the generic call.
+  bool TryReplaceWithPolymorphicDynamicCall(InstanceCallInstr* call);
+
   bool RecognizeRuntimeTypeGetter(InstanceCallInstr* call);
   bool TryReplaceWithHaveSameRuntimeType(TemplateDartCall<0>* call);
 
@@ -10,12 +10,20 @@
 
 #include "vm/compiler/frontend/kernel_translation_helper.h"
 #include "vm/dispatch_table.h"
+#include "vm/flags.h"
 #include "vm/stub_code.h"
 #include "vm/thread.h"
 
 #define Z zone_
 
 namespace dart {
+
+DEFINE_FLAG(bool,
+            print_dispatch_table_stats,
+            false,
+            "Print the size of the dispatch table and how densely its rows "
+            "are packed");
+
 namespace compiler {
 
 class Interval {
@@ -664,6 +672,39 @@ void DispatchTableGenerator::ComputeSelectorOffsets() {
   }
 
   table_size_ = fitter.TableSize();
+
+  if (FLAG_print_dispatch_table_stats) {
+    PrintStats();
+  }
+}
+
+void DispatchTableGenerator::PrintStats() const {
+  intptr_t used_entries = 0;
+  intptr_t optimal_rows = 0;
+  intptr_t small_offset_rows = 0;
+  intptr_t small_offset_calls = 0;
+  intptr_t total_calls = 0;
+  for (intptr_t i = 0; i < table_rows_.length(); i++) {
+    const SelectorRow* row = table_rows_[i];
+    const int32_t offset = row->selector()->offset;
+    used_entries += row->total_size();
+    total_calls += row->CallCount();
+    if (offset == DispatchTable::kOriginElement) {
+      optimal_rows++;
+    }
+    if (offset <= DispatchTable::kLargestSmallOffset) {
+      small_offset_rows++;
+      small_offset_calls += row->CallCount();
+    }
+  }
+  THR_Print("Dispatch table: %" Pd " rows, %" Pd32 " entries, %" Pd
+            " used (%.1f%%)\n",
+            table_rows_.length(), table_size_, used_entries,
+            table_size_ > 0 ? 100.0 * used_entries / table_size_ : 0.0);
+  THR_Print("  %" Pd " rows at the optimal offset, %" Pd
+            " rows at small offsets covering %" Pd " of %" Pd
+            " call sites\n",
+            optimal_rows, small_offset_rows, small_offset_calls, total_calls);
 }
 
 ArrayPtr DispatchTableGenerator::BuildCodeArray() {
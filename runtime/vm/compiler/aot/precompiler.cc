@@ -70,7 +70,16 @@ DEFINE_FLAG(bool,
             print_precompiler_timings,
             false,
             "Print per-phase breakdown of time spent precompiling");
+DEFINE_FLAG(bool,
+            print_precompiler_timings_json,
+            false,
+            "Print per-phase breakdown of time spent precompiling as JSON");
 DEFINE_FLAG(bool, print_unique_targets, false, "Print unique dynamic targets");
+DEFINE_FLAG(charp,
+            print_code_duplication_to,
+            nullptr,
+            "Print functions inlined more than once and code with identical "
+            "instructions to the given file");
 DEFINE_FLAG(charp,
             print_object_layout_to,
             nullptr,
@@ -81,6 +90,11 @@ DEFINE_FLAG(
     max_speculative_inlining_attempts,
     1,
     "Max number of attempts with speculative inlining (precompilation only)");
+DEFINE_FLAG(bool,
+            forward_loads_across_calls,
+            true,
+            "Forward loads across static calls to functions which are known "
+            "not to write memory (precompilation only)");
 DEFINE_FLAG(charp,
             write_retained_reasons_to,
             nullptr,
@@ -380,11 +394,14 @@ ErrorPtr Precompiler::CompileAll() {
 }
 
 void Precompiler::ReportStats() {
-  if (!FLAG_print_precompiler_timings) {
-    return;
+  if (FLAG_print_precompiler_timings) {
+    thread()->compiler_timings()->Print();
+  }
+  if (FLAG_print_precompiler_timings_json) {
+    JSONWriter writer;
+    thread()->compiler_timings()->PrintJSON(&writer);
+    OS::PrintErr("%s\n", writer.ToCString());
   }
-
-  thread()->compiler_timings()->Print();
 }
 
 Precompiler::Precompiler(Thread* thread)
@@ -416,6 +433,8 @@ Precompiler::Precompiler(Thread* thread)
       seen_functions_(HashTables::New<FunctionSet>(/*initial_capacity=*/1024)),
       possibly_retained_functions_(
           HashTables::New<FunctionSet>(/*initial_capacity=*/1024)),
+      functions_without_memory_writes_(
+          HashTables::New<FunctionSet>(/*initial_capacity=*/1024)),
       fields_to_retain_(),
       functions_to_retain_(
           HashTables::New<FunctionSet>(/*initial_capacity=*/1024)),
@@ -432,7 +451,7 @@ Precompiler::Precompiler(Thread* thread)
   ASSERT(Precompiler::singleton_ == nullptr);
   Precompiler::singleton_ = this;
 
-  if (FLAG_print_precompiler_timings) {
+  if (FLAG_print_precompiler_timings || FLAG_print_precompiler_timings_json) {
     thread->set_compiler_timings(new CompilerTimings());
   }
 }
@@ -443,6 +462,7 @@ Precompiler::~Precompiler() {
   functions_with_entry_point_pragmas_.Release();
   seen_functions_.Release();
   possibly_retained_functions_.Release();
+  functions_without_memory_writes_.Release();
   functions_to_retain_.Release();
 
   ASSERT(Precompiler::singleton_ == this);
@@ -607,6 +627,8 @@ void Precompiler::DoCompileAll() {
         // Clear these before dropping classes as they may hold onto otherwise
         // dead instances of classes we will remove or otherwise unused symbols.
         IG->object_store()->set_unique_dynamic_targets(Array::null_array());
+        IG->object_store()->set_polymorphic_dynamic_targets(
+            Array::null_array());
         Library& null_library = Library::Handle(Z);
         Class& null_class = Class::Handle(Z);
         Function& null_function = Function::Handle(Z);
@@ -655,6 +677,10 @@ void Precompiler::DoCompileAll() {
       ProgramVisitor::Dedup(T);
     }
 
+    if (FLAG_print_code_duplication_to != nullptr) {
+      ProgramVisitor::PrintCodeDuplication(T, FLAG_print_code_duplication_to);
+    }
+
     PruneDictionaries();
 
     if (retained_reasons_writer_ != nullptr) {
@@ -771,6 +797,12 @@ void Precompiler::Iterate() {
   Function& function = Function::Handle(Z);
 
   phase_ = Phase::kFixpointCodeGeneration;
+  // Functions are compiled one at a time, on this thread. Compilation appends
+  // to the global object pool, and AddCalleesOf finds the callees of each
+  // function by scanning the entries appended since it started, so the pool
+  // order (and with it the snapshot) follows the compilation order. Compiling
+  // also updates shared state, such as field guards and canonical tables,
+  // without the locks the background JIT compiler relies on.
   while (changed_) {
     changed_ = false;
 
@@ -1340,6 +1372,40 @@ void Precompiler::AddClosureCall(const String& call_selector,
   AddFunction(dispatcher, RetainReasons::kInvokeFieldDispatcher);
 }
 
+void Precompiler::RecordMemoryEffects(FlowGraph* flow_graph) {
+  if (!FLAG_forward_loads_across_calls) return;
+  const Function& function = flow_graph->function();
+  // Intrinsified and recognized functions may run code which is not part of
+  // their flow graph.
+  if (function.is_intrinsic() || function.IsRecognized()) return;
+  for (auto block : flow_graph->reverse_postorder()) {
+    for (ForwardInstructionIterator it(block); !it.Done(); it.Advance()) {
+      Instruction* current = it.Current();
+      if (MayWriteMemory(current) || current->IsStoreField() ||
+          current->IsStoreIndexed() || current->IsStoreIndexedUnsafe() ||
+          current->IsStoreStaticField() || current->IsStoreLocal() ||
+          current->IsMemoryCopy() || current->IsRecordCoverage() ||
+          current->IsNativeCall() || current->IsFfiCall() ||
+          current->IsLeafRuntimeCall() || current->IsCall1ArgStub() ||
+          current->IsTailCall()) {
+        return;
+      }
+    }
+  }
+  functions_without_memory_writes_.Insert(function);
+}
+
+bool Precompiler::MayWriteMemory(Instruction* instr) {
+  if (instr->IsBranch()) {
+    instr = instr->AsBranch()->comparison();
+  }
+  if (!instr->HasUnknownSideEffects()) return false;
+  if (auto* const call = instr->AsStaticCall()) {
+    return !functions_without_memory_writes_.ContainsKey(call->function());
+  }
+  return true;
+}
+
 void Precompiler::AddField(const Field& field) {
   if (is_tracing()) {
     tracer_->WriteFieldRef(field);
@@ -1895,38 +1961,53 @@ void Precompiler::CollectDynamicFunctionNames() {
     }
   }
 
-  // Locate all entries with one function only
+  // Locate all entries with one function only, and those with only a few
+  // which AotCallSpecializer can check for inline.
   Table::Iterator iter(&table);
   String& key = String::Handle(Z);
   String& key_demangled = String::Handle(Z);
   UniqueFunctionsMap functions_map(HashTables::New<UniqueFunctionsMap>(20));
+  UniqueFunctionsMap polymorphic_map(HashTables::New<UniqueFunctionsMap>(20));
   while (iter.MoveNext()) {
     intptr_t curr_key = iter.Current();
     key ^= table.GetKey(curr_key);
     farray ^= table.GetOrNull(key);
     ASSERT(!farray.IsNull());
-    if (farray.Length() == 1) {
-      function ^= farray.At(0);
-      if (function.IsDynamicallyOverridden()) continue;
+    // The limit only applies to polymorphic selectors, unique targets are
+    // recorded regardless of --max_polymorphic_checks.
+    if (farray.Length() > 1 && farray.Length() > FLAG_max_polymorphic_checks) {
+      continue;
+    }
 
-      // It looks like there is exactly one target for the given name. Though we
-      // have to be careful: e.g. A name like `dyn:get:foo` might have a target
-      // `foo()`. Though the actual target would be a lazily created method
-      // extractor `get:foo` for the `foo` function.
-      //
-      // We'd like to prevent eager creation of functions which we normally
-      // create lazily.
-      // => We disable unique target optimization if the target belongs to the
-      //    lazily created functions.
-      key_demangled = key.ptr();
-      if (Function::IsDynamicInvocationForwarderName(key)) {
-        key_demangled = Function::DemangleDynamicInvocationForwarderName(key);
-      }
-      if (function.name() != key.ptr() &&
-          function.name() != key_demangled.ptr()) {
-        continue;
+    // It looks like there are only a few targets for the given name. Though we
+    // have to be careful: e.g. A name like `dyn:get:foo` might have a target
+    // `foo()`. Though the actual target would be a lazily created method
+    // extractor `get:foo` for the `foo` function.
+    //
+    // We'd like to prevent eager creation of functions which we normally
+    // create lazily.
+    // => We disable unique target optimization if the target belongs to the
+    //    lazily created functions.
+    key_demangled = key.ptr();
+    if (Function::IsDynamicInvocationForwarderName(key)) {
+      key_demangled = Function::DemangleDynamicInvocationForwarderName(key);
+    }
+    bool all_direct = true;
+    for (intptr_t i = 0; i < farray.Length(); i++) {
+      function ^= farray.At(i);
+      if (function.IsDynamicallyOverridden() ||
+          (function.name() != key.ptr() &&
+           function.name() != key_demangled.ptr())) {
+        all_direct = false;
+        break;
       }
+    }
+    if (!all_direct) continue;
+    if (farray.Length() == 1) {
+      function ^= farray.At(0);
       functions_map.UpdateOrInsert(key, function);
+    } else {
+      polymorphic_map.UpdateOrInsert(key, farray);
     }
   }
 
@@ -1942,9 +2023,14 @@ void Precompiler::CollectDynamicFunctionNames() {
     }
     THR_Print("%" Pd " of %" Pd " dynamic selectors are unique\n",
               functions_map.NumOccupied(), table.NumOccupied());
+    THR_Print("%" Pd " of %" Pd " dynamic selectors have at most %d targets\n",
+              polymorphic_map.NumOccupied(), table.NumOccupied(),
+              FLAG_max_polymorphic_checks);
   }
 
   IG->object_store()->set_unique_dynamic_targets(functions_map.Release());
+  IG->object_store()->set_polymorphic_dynamic_targets(
+      polymorphic_map.Release());
   table.Release();
 }
 
@@ -3651,6 +3737,10 @@ bool PrecompileParsedFunctionHelper::Compile(CompilationPipeline* pipeline) {
         done = false;
         continue;
       }
+      // Only record the effects of the code which is actually used: a bailout
+      // above discards this graph, and the retry may compile it differently
+      // (e.g. without speculative inlining).
+      precompiler_->RecordMemoryEffects(flow_graph);
       // Exit the loop and the function with the correct result value.
       is_compiled = true;
       done = true;
@@ -29,6 +29,7 @@ class GrowableObjectArray;
 class String;
 class Precompiler;
 class FlowGraph;
+class Instruction;
 class PrecompilerTracer;
 class RetainedReasonsWriter;
 
@@ -263,6 +264,17 @@ class Precompiler : public ValueObject {
 
   static Precompiler* Instance() { return singleton_; }
 
+  // Records the function of [flow_graph] as not writing memory if its
+  // optimized code contains no stores and no calls which may write memory.
+  void RecordMemoryEffects(FlowGraph* flow_graph);
+
+  // Returns true if [instr] has unknown side effects which may include
+  // writes to fields, arrays or static fields. Unlike
+  // Instruction::HasUnknownSideEffects(), static calls to functions recorded
+  // by [RecordMemoryEffects] are not counted, so loads can be forwarded
+  // across them.
+  bool MayWriteMemory(Instruction* instr);
+
   void AddField(const Field& field);
   void AddTableSelector(const compiler::TableSelector* selector);
 
@@ -394,6 +406,7 @@ class Precompiler : public ValueObject {
   FunctionSet functions_with_entry_point_pragmas_;
   FunctionSet seen_functions_;
   FunctionSet possibly_retained_functions_;
+  FunctionSet functions_without_memory_writes_;
   FieldSet fields_to_retain_;
   FunctionSet functions_to_retain_;
   ClassSet classes_to_retain_;
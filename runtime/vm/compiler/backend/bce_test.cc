@@ -294,4 +294,54 @@ ISOLATE_UNIT_TEST_CASE(BCEListNamedAndPlainLength) {
   TestScriptJIT(kScriptChars, 2, 0);
 }
 
+ISOLATE_UNIT_TEST_CASE(BCEGeneralizeSymbolicRange) {
+  const char* kScriptChars =
+      R"(
+      import 'dart:typed_data';
+      foo(Float64List l, int start, int end) {
+        for (int i = start; i < end; i++) {
+          l[i] = 0;
+        }
+      }
+      main() {
+        foo(new Float64List(100), 10, 90);
+      }
+    )";
+  const auto& root_library = Library::Handle(LoadTestScript(kScriptChars));
+  Invoke(root_library, "main");
+  std::initializer_list<CompilerPass::Id> passes = {
+      CompilerPass::kComputeSSA,
+      CompilerPass::kTypePropagation,
+      CompilerPass::kApplyICData,
+      CompilerPass::kInlining,
+      CompilerPass::kTypePropagation,
+      CompilerPass::kApplyICData,
+      CompilerPass::kSelectRepresentations,
+      CompilerPass::kCanonicalize,
+      CompilerPass::kConstantPropagation,
+      CompilerPass::kOptimisticallySpecializeSmiPhis,
+      CompilerPass::kTypePropagation,
+      CompilerPass::kCSE,
+      CompilerPass::kLICM,
+      CompilerPass::kRangeAnalysis,
+  };
+  const auto& function = Function::Handle(GetFunction(root_library, "foo"));
+  TestPipeline pipeline(function, CompilerPass::kJIT);
+  FlowGraph* flow_graph = pipeline.RunPasses(passes);
+  // Neither bound is known, so the check can't be removed, but checks on
+  // start, end and the length hoisted out of the loop replace it.
+  intptr_t checks_in_loops = 0;
+  for (BlockIterator block_it = flow_graph->reverse_postorder_iterator();
+       !block_it.Done(); block_it.Advance()) {
+    if (block_it.Current()->loop_info() == nullptr) continue;
+    for (ForwardInstructionIterator it(block_it.Current()); !it.Done();
+         it.Advance()) {
+      if (it.Current()->IsCheckBoundBase()) {
+        checks_in_loops++;
+      }
+    }
+  }
+  EXPECT_EQ(0, checks_in_loops);
+}
+
 }  // namespace dart
@@ -244,6 +244,8 @@ void BlockScheduler::ReorderBlocksJIT(FlowGraph* flow_graph) {
 //
 // - Blocks which always throw and their direct predecessors are considered
 // *cold* and moved to the end of the order.
+// - Exception handlers, i.e. blocks dominated by a catch entry, are cold as
+// well: without an edge profile they are the code least likely to run.
 // - Blocks which belong to the same loop are kept together (where possible)
 // and not interspersed with other blocks.
 //
@@ -257,6 +259,7 @@ class AOTBlockScheduler {
         postorder_(block_count_),
         cold_postorder_(10) {
     marks_.FillWith(0, 0, block_count_);
+    MarkExceptionHandlers();
   }
 
   void ComputeOrder() {
@@ -346,11 +349,25 @@ class AOTBlockScheduler {
     }
   }
 
+  // Marks catch entries and the blocks they dominate as cold. Dominators
+  // precede the blocks they dominate in reverse postorder.
+  void MarkExceptionHandlers() {
+    for (BlockEntryInstr* block : flow_graph_->reverse_postorder()) {
+      BlockEntryInstr* dominator = block->dominator();
+      if (block->IsCatchBlockEntry() ||
+          (dominator != nullptr && !dominator->IsGraphEntry() &&
+           (MarksOf(dominator) & kColdMark) != 0)) {
+        MarksOf(block) |= kColdMark;
+      }
+    }
+  }
+
   // The block was added to the stack.
   static constexpr uint8_t kSeenMark = 1 << 0;
   // The block was visited and all of its successors were added to the stack.
   static constexpr uint8_t kVisitedMark = 1 << 1;
-  // The block terminates with unconditional throw or rethrow.
+  // The block terminates with unconditional throw or rethrow, only leads to
+  // such blocks, or is part of an exception handler.
   static constexpr uint8_t kColdMark = 1 << 2;
   // The block should not move to cold section.
   static constexpr uint8_t kPinnedMark = 1 << 3;
@@ -12,6 +12,11 @@ CombinedCodeStatistics::CombinedCodeStatistics() {
   object_header_bytes_ = 0;
   return_const_count_ = 0;
   return_const_with_load_field_count_ = 0;
+  spill_count_ = 0;
+  reload_count_ = 0;
+  spills_in_loops_count_ = 0;
+  reloads_in_loops_count_ = 0;
+  functions_with_reloads_in_loops_count_ = 0;
   intptr_t i = 0;
 
 #define DO(type, attrs)                                                        \
@@ -105,6 +110,13 @@ void CombinedCodeStatistics::DumpStatistics() {
   OS::PrintErr("% 8" Pd " return-constant-with-load-field functions\n",
                return_const_with_load_field_count_);
   OS::PrintErr("--------------------\n");
+  OS::PrintErr("% 8" Pd " spills (% 8" Pd " in loops)\n", spill_count_,
+               spills_in_loops_count_);
+  OS::PrintErr("% 8" Pd " reloads (% 8" Pd " in loops)\n", reload_count_,
+               reloads_in_loops_count_);
+  OS::PrintErr("% 8" Pd " functions with reloads in loops\n",
+               functions_with_reloads_in_loops_count_);
+  OS::PrintErr("--------------------\n");
 }
 
 int CombinedCodeStatistics::CompareEntries(const void* a, const void* b) {
@@ -125,6 +137,10 @@ CodeStatistics::CodeStatistics(compiler::Assembler* assembler)
   instruction_bytes_ = 0;
   unaccounted_bytes_ = 0;
   alignment_bytes_ = 0;
+  spill_count_ = 0;
+  reload_count_ = 0;
+  spills_in_loops_count_ = 0;
+  reloads_in_loops_count_ = 0;
 
   stack_index_ = -1;
   for (intptr_t i = 0; i < kStackSize; i++)
@@ -163,6 +179,22 @@ void CodeStatistics::SpecialEnd(intptr_t tag) {
   stack_index_--;
 }
 
+void CodeStatistics::RecordMoves(ParallelMoveInstr* move, bool in_loop) {
+  for (intptr_t i = 0; i < move->NumMoves(); i++) {
+    const MoveOperands* operands = move->MoveOperandsAt(i);
+    if (operands->IsRedundant()) continue;
+    const Location src = operands->src();
+    const Location dest = operands->dest();
+    if (src.IsMachineRegister() && dest.HasStackIndex()) {
+      spill_count_++;
+      if (in_loop) spills_in_loops_count_++;
+    } else if (src.HasStackIndex() && dest.IsMachineRegister()) {
+      reload_count_++;
+      if (in_loop) reloads_in_loops_count_++;
+    }
+  }
+}
+
 void CodeStatistics::Finalize() {
   intptr_t function_size = assembler_->CodeSize();
   unaccounted_bytes_ = function_size - instruction_bytes_;
@@ -201,6 +233,14 @@ void CodeStatistics::AppendTo(CombinedCodeStatistics* stat) {
   stat->alignment_bytes_ += alignment_bytes_;
   stat->object_header_bytes_ += Instructions::HeaderSize();
 
+  stat->spill_count_ += spill_count_;
+  stat->reload_count_ += reload_count_;
+  stat->spills_in_loops_count_ += spills_in_loops_count_;
+  stat->reloads_in_loops_count_ += reloads_in_loops_count_;
+  if (reloads_in_loops_count_ > 0) {
+    stat->functions_with_reloads_in_loops_count_++;
+  }
+
   if (returns_constant) stat->return_const_count_++;
   if (returns_const_with_load_field_) {
     stat->return_const_with_load_field_count_++;
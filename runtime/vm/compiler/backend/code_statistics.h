@@ -67,6 +67,11 @@ class CombinedCodeStatistics {
   intptr_t object_header_bytes_;
   intptr_t return_const_count_;
   intptr_t return_const_with_load_field_count_;
+  intptr_t spill_count_;
+  intptr_t reload_count_;
+  intptr_t spills_in_loops_count_;
+  intptr_t reloads_in_loops_count_;
+  intptr_t functions_with_reloads_in_loops_count_;
 };
 
 class CodeStatistics {
@@ -79,6 +84,10 @@ class CodeStatistics {
   void SpecialBegin(intptr_t tag);
   void SpecialEnd(intptr_t tag);
 
+  // Counts the moves in 'move' from registers to stack slots (spills) and
+  // back (reloads) that the register allocator inserted.
+  void RecordMoves(ParallelMoveInstr* move, bool in_loop);
+
   void AppendTo(CombinedCodeStatistics* stat);
 
   void Finalize();
@@ -97,6 +106,10 @@ class CodeStatistics {
   intptr_t instruction_bytes_;
   intptr_t unaccounted_bytes_;
   intptr_t alignment_bytes_;
+  intptr_t spill_count_;
+  intptr_t reload_count_;
+  intptr_t spills_in_loops_count_;
+  intptr_t reloads_in_loops_count_;
 
   intptr_t stack_[kStackSize];
   intptr_t stack_index_;
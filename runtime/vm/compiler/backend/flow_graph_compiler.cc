@@ -67,6 +67,7 @@ DECLARE_FLAG(charp, deoptimize_filter);
 DECLARE_FLAG(bool, intrinsify);
 DECLARE_FLAG(int, regexp_optimization_counter_threshold);
 DECLARE_FLAG(int, reoptimization_counter_threshold);
+DECLARE_FLAG(int, baseline_promotion_threshold);
 DECLARE_FLAG(int, stacktrace_every);
 DECLARE_FLAG(charp, stacktrace_filter);
 DECLARE_FLAG(int, gc_every);
@@ -160,8 +161,9 @@ FlowGraphCompiler::FlowGraphCompiler(
       static_calls_target_table_(),
       indirect_gotos_(),
       is_optimizing_(is_optimizing),
+      is_baseline_(is_optimizing && CompilerState::Current().is_baseline()),
       speculative_policy_(speculative_policy),
-      may_reoptimize_(false),
+      may_reoptimize_(is_baseline_),
       intrinsic_mode_(false),
       stats_(stats),
       double_class_(
@@ -756,6 +758,10 @@ void FlowGraphCompiler::VisitBlocks() {
       Instruction* instr = it.Current();
       set_current_instruction(instr);
       StatsBegin(instr);
+      if (stats_ != nullptr && instr->IsParallelMove()) {
+        stats_->RecordMoves(instr->AsParallelMove(),
+                            entry->loop_info() != nullptr);
+      }
       // Unoptimized code always stores boxed values on the expression stack.
       // However, unboxed representation is allowed for instruction inputs and
       // outputs of certain types (e.g. for doubles).
@@ -1938,7 +1944,9 @@ const ICData* FlowGraphCompiler::GetOrAddStaticCallICData(
 
 intptr_t FlowGraphCompiler::GetOptimizationThreshold() const {
   intptr_t threshold;
-  if (is_optimizing()) {
+  if (is_baseline()) {
+    threshold = FLAG_baseline_promotion_threshold;
+  } else if (is_optimizing()) {
     threshold = FLAG_reoptimization_counter_threshold;
   } else if (parsed_function_.function().IsIrregexpFunction()) {
     threshold = FLAG_regexp_optimization_counter_threshold;
@@ -426,6 +426,10 @@ class FlowGraphCompiler : public ValueObject {
   bool CanOSRFunction() const;
   bool is_optimizing() const { return is_optimizing_; }
 
+  // Optimized code from the baseline tier counts its invocations like
+  // unoptimized code, so that it is fully optimized once it stays hot.
+  bool is_baseline() const { return is_baseline_; }
+
   void InsertBSSRelocation(BSS::Relocation reloc);
   void LoadBSSEntry(BSS::Relocation relocation, Register dst, Register tmp);
 
@@ -1212,6 +1216,7 @@ class FlowGraphCompiler : public ValueObject {
   GrowableArray<const compiler::TableSelector*> dispatch_table_call_targets_;
   GrowableArray<IndirectGotoInstr*> indirect_gotos_;
   bool is_optimizing_;
+  bool is_baseline_;
   SpeculativeInliningPolicy* speculative_policy_;
   // Set to true if optimized code has IC calls.
   bool may_reoptimize_;
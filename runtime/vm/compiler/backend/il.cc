@@ -379,12 +379,13 @@ bool HierarchyInfo::CanUseGenericSubtypeRangeCheckFor(
       TypeArguments::Handle(zone, Type::Cast(type).arguments());
   ASSERT(ta.Length() == num_type_parameters);
 
-  // Ensure we can handle all type arguments
-  // via [CidRange]-based checks or that it is a type parameter.
+  // Ensure we can handle all type arguments via [CidRange]-based checks or
+  // identity checks or that it is a type parameter.
   AbstractType& type_arg = AbstractType::Handle(zone);
   for (intptr_t i = 0; i < num_type_parameters; ++i) {
     type_arg = ta.TypeAt(i);
-    if (!CanUseSubtypeRangeCheckFor(type_arg) && !type_arg.IsTypeParameter()) {
+    if (!CanUseSubtypeRangeCheckFor(type_arg) && !type_arg.IsTypeParameter() &&
+        !CanUseTypeArgumentIdentityCheckFor(type_arg)) {
       return false;
     }
   }
@@ -392,6 +393,12 @@ bool HierarchyInfo::CanUseGenericSubtypeRangeCheckFor(
   return true;
 }
 
+bool HierarchyInfo::CanUseTypeArgumentIdentityCheckFor(
+    const AbstractType& type_arg) {
+  ASSERT(type_arg.IsFinalized());
+  return type_arg.IsInstantiated() && type_arg.IsCanonical();
+}
+
 bool HierarchyInfo::CanUseRecordSubtypeRangeCheckFor(const AbstractType& type) {
   ASSERT(type.IsFinalized());
   if (!type.IsRecordType()) {
@@ -301,12 +301,23 @@ class HierarchyInfo : public ThreadStackResource {
   //
   // This is the case for [type]s with type arguments where we are able to do a
   // [CidRange]-based subclass-check against the class and [CidRange]-based
-  // subtype-checks against the type arguments.
+  // subtype-checks against the type arguments, or an identity check against
+  // a type argument (see [CanUseTypeArgumentIdentityCheckFor]).
   //
   // This method should only be called if [CanUseSubtypeRangecheckFor] returned
   // false.
   bool CanUseGenericSubtypeRangeCheckFor(const AbstractType& type);
 
+  // Returns `true` if a type argument of an instance can be compared by
+  // pointer with [type_arg] to determine if it is a subtype of [type_arg].
+  //
+  // This is the case for canonical instantiated types like `Map<String, int>`:
+  // the type arguments of instances are canonical, so an instance whose type
+  // argument is exactly [type_arg] is found by pointer comparison. Any other
+  // type argument may still be a subtype, so a failed comparison is only a
+  // false negative.
+  bool CanUseTypeArgumentIdentityCheckFor(const AbstractType& type_arg);
+
   // Returns `true` if [type] is a record type which fields can be tested using
   // simple [CidRange]-based subtype-check.
   bool CanUseRecordSubtypeRangeCheckFor(const AbstractType& type);
@@ -1612,11 +1612,26 @@ void FlowGraphSerializer::WriteObjectImpl(const Object& x,
       if (icdata.rebind_rule() == ICData::kStatic) {
         ASSERT(icdata.NumberOfChecks() == 1);
         Write<const Function&>(Function::Handle(Z, icdata.GetTargetAt(0)));
+        Write<intptr_t>(icdata.GetCountAt(0));
       } else if (icdata.rebind_rule() == ICData::kInstance) {
-        if (icdata.NumberOfChecks() != 0) {
+        Write<const String&>(String::Handle(Z, icdata.target_name()));
+        // Type feedback collected by unoptimized code. Class ids are only
+        // meaningful to a reader with the same class table.
+        const intptr_t num_checks = icdata.NumberOfChecks();
+        if (num_checks != 0 && icdata.is_tracking_exactness()) {
           UNIMPLEMENTED();
         }
-        Write<const String&>(String::Handle(Z, icdata.target_name()));
+        Write<intptr_t>(num_checks);
+        GrowableArray<intptr_t> class_ids;
+        auto& target = Function::Handle(Z);
+        for (intptr_t i = 0; i < num_checks; ++i) {
+          icdata.GetCheckAt(i, &class_ids, &target);
+          for (intptr_t j = 0, n = icdata.NumArgsTested(); j < n; ++j) {
+            Write<intptr_t>(class_ids[j]);
+          }
+          Write<const Function&>(target);
+          Write<intptr_t>(icdata.GetCountAt(i));
+        }
       } else {
         UNIMPLEMENTED();
       }
@@ -1884,15 +1899,34 @@ const Object& FlowGraphDeserializer::ReadObjectImpl(intptr_t cid,
 
       if (rebind_rule == ICData::kStatic) {
         const auto& target = Read<const Function&>();
-        return ICData::ZoneHandle(
+        const intptr_t count = Read<intptr_t>();
+        const auto& result = ICData::ZoneHandle(
             Z,
             ICData::NewForStaticCall(owner, target, arguments_descriptor,
                                      deopt_id, num_args_tested, rebind_rule));
+        result.SetCountAt(0, count);
+        return result;
       } else if (rebind_rule == ICData::kInstance) {
         const auto& target_name = Read<const String&>();
-        return ICData::ZoneHandle(
+        const auto& result = ICData::ZoneHandle(
             Z, ICData::New(owner, target_name, arguments_descriptor, deopt_id,
                            num_args_tested, rebind_rule));
+        const intptr_t num_checks = Read<intptr_t>();
+        GrowableArray<intptr_t> class_ids(num_args_tested);
+        for (intptr_t i = 0; i < num_checks; ++i) {
+          class_ids.Clear();
+          for (intptr_t j = 0; j < num_args_tested; ++j) {
+            class_ids.Add(Read<intptr_t>());
+          }
+          const auto& target = Read<const Function&>();
+          const intptr_t count = Read<intptr_t>();
+          if (num_args_tested == 1) {
+            result.AddReceiverCheck(class_ids[0], target, count);
+          } else {
+            result.AddCheck(class_ids, target, count);
+          }
+        }
+        return result;
       } else {
         UNIMPLEMENTED();
       }
@@ -14,9 +14,11 @@
 #include "vm/compiler/backend/block_builder.h"
 #include "vm/compiler/backend/flow_graph_compiler.h"
 #include "vm/compiler/backend/il_printer.h"
+#include "vm/compiler/backend/il_serializer.h"
 #include "vm/compiler/backend/il_test_helper.h"
 #include "vm/compiler/backend/range_analysis.h"
 #include "vm/compiler/backend/type_propagator.h"
+#include "vm/datastream.h"
 #include "vm/unit_test.h"
 
 namespace dart {
@@ -2028,4 +2030,64 @@ ISOLATE_UNIT_TEST_CASE(IRTest_Regress_56588) {
   pipeline.CompileGraphAndAttachFunction();
 }
 
+// Check that type feedback of instance calls survives IL serialization.
+ISOLATE_UNIT_TEST_CASE(IL_Serialization_ICDataFeedback) {
+  const char* kScript = R"(
+    class A {
+      foo(x) => x;
+    }
+    class B {
+      foo(x) => x;
+    }
+    main() => [A().foo(1), B().foo(2)];
+  )";
+  const auto& lib = Library::Handle(LoadTestScript(kScript));
+  const auto& owner = Function::Handle(GetFunction(lib, "main"));
+  const auto& name = String::Handle(Symbols::New(thread, "foo"));
+  const auto lookup_foo = [&](const char* class_name) -> const Function& {
+    const auto& cls = Class::Handle(GetClass(lib, class_name));
+    const auto& err = Error::Handle(cls.EnsureIsFinalized(thread));
+    EXPECT(err.IsNull());
+    const auto& function =
+        Function::Handle(cls.LookupDynamicFunctionAllowPrivate(name));
+    EXPECT(!function.IsNull());
+    return function;
+  };
+  const auto& a_foo = lookup_foo("A");
+  const auto& b_foo = lookup_foo("B");
+  const intptr_t a_cid = Class::Handle(a_foo.Owner()).id();
+  const intptr_t b_cid = Class::Handle(b_foo.Owner()).id();
+
+  const auto& args_descriptor = Array::Handle(
+      ArgumentsDescriptor::NewBoxed(/*type_args_len=*/0, /*num_arguments=*/2));
+  const auto& icdata = ICData::Handle(
+      ICData::New(owner, name, args_descriptor, /*deopt_id=*/1,
+                  /*num_args_tested=*/1, ICData::kInstance));
+  icdata.AddReceiverCheck(a_cid, a_foo, /*count=*/3);
+  icdata.AddReceiverCheck(b_cid, b_foo, /*count=*/5);
+
+  ZoneWriteStream write_stream(thread->zone(), 1024);
+  {
+    FlowGraphSerializer serializer(&write_stream);
+    serializer.Write<const Object&>(icdata);
+  }
+  ReadStream read_stream(write_stream.buffer(), write_stream.bytes_written());
+  auto* parsed_function = new ParsedFunction(thread, owner);
+  FlowGraphDeserializer deserializer(*parsed_function, &read_stream);
+  const auto& result = ICData::Cast(deserializer.Read<const Object&>());
+
+  EXPECT_NE(icdata.ptr(), result.ptr());
+  EXPECT_EQ(owner.ptr(), result.Owner());
+  EXPECT(result.target_name() == name.ptr());
+  EXPECT_EQ(1, result.deopt_id());
+  EXPECT_EQ(1, result.NumArgsTested());
+  EXPECT_EQ(2, result.NumberOfChecks());
+  EXPECT_EQ(a_cid, result.GetReceiverClassIdAt(0));
+  EXPECT_EQ(a_foo.ptr(), result.GetTargetAt(0));
+  EXPECT_EQ(3, result.GetCountAt(0));
+  EXPECT_EQ(b_cid, result.GetReceiverClassIdAt(1));
+  EXPECT_EQ(b_foo.ptr(), result.GetTargetAt(1));
+  EXPECT_EQ(5, result.GetCountAt(1));
+}
+
 }  // namespace dart
@@ -17,6 +17,7 @@
 #include "vm/compiler/frontend/flow_graph_builder.h"
 #include "vm/compiler/frontend/kernel_to_il.h"
 #include "vm/compiler/jit/compiler.h"
+#include "vm/compiler/jit/hot_function_cache.h"
 #include "vm/compiler/jit/jit_call_specializer.h"
 #include "vm/compiler/method_recognizer.h"
 #include "vm/flags.h"
@@ -257,6 +258,31 @@ static intptr_t AotCallCountApproximation(intptr_t nesting_depth) {
   }
 }
 
+// With --load_hot_functions, the AOT compiler treats calls to functions that
+// a JIT training run optimized as if they were nested one loop deeper.
+static bool IsHotInTraining(StaticCallInstr* call) {
+  return HotFunctionCache::IsHotInTraining(call->function());
+}
+
+static bool IsHotInTraining(InstanceCallInstr* call) {
+  return !call->interface_target().IsNull() &&
+         HotFunctionCache::IsHotInTraining(call->interface_target());
+}
+
+static bool IsHotInTraining(PolymorphicInstanceCallInstr* call) {
+  const CallTargets& targets = call->targets();
+  for (intptr_t i = 0; i < targets.length(); i++) {
+    if (HotFunctionCache::IsHotInTraining(*targets.TargetAt(i)->target)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool IsHotInTraining(ClosureCallInstr* call) {
+  return false;
+}
+
 // A collection of call sites to consider for inlining.
 class CallSites : public ValueObject {
  public:
@@ -278,7 +304,8 @@ class CallSites : public ValueObject {
           call_depth(call_depth),
           nesting_depth(nesting_depth) {
       if (CompilerState::Current().is_aot()) {
-        call_count = AotCallCountApproximation(nesting_depth);
+        call_count = AotCallCountApproximation(
+            IsHotInTraining(call) ? nesting_depth + 1 : nesting_depth);
       } else {
         call_count = call->CallCount();
       }
@@ -11,6 +11,7 @@
 #include "vm/compiler/backend/il_printer.h"
 #include "vm/compiler/backend/loops.h"
 #include "vm/compiler/backend/parallel_move_resolver.h"
+#include "vm/compiler/compiler_timings.h"
 #include "vm/log.h"
 #include "vm/parser.h"
 #include "vm/stack_frame.h"
@@ -2962,12 +2963,34 @@ bool FlowGraphAllocator::TargetLocationIsSpillSlot(LiveRange* range,
   return GetLiveRange(range->vreg())->spill_slot().Equals(target);
 }
 
-static LiveRange* FindCover(LiveRange* parent, intptr_t pos) {
-  for (LiveRange* range = parent; range != nullptr;
-       range = range->next_sibling()) {
+static LiveRange* FindCover(LiveRange* parent,
+                            const ZoneGrowableArray<LiveRange*>* siblings,
+                            intptr_t pos) {
+  if (siblings != nullptr) {
+    // Siblings do not overlap and are sorted by start position, so the only
+    // candidate is the last sibling starting at or before [pos].
+    intptr_t lo = 0;
+    intptr_t hi = siblings->length() - 1;
+    while (lo < hi) {
+      const intptr_t mid = lo + (hi - lo + 1) / 2;
+      if (siblings->At(mid)->Start() <= pos) {
+        lo = mid;
+      } else {
+        hi = mid - 1;
+      }
+    }
+    LiveRange* range = siblings->At(lo);
     if (range->CanCover(pos)) {
+      DEBUG_ASSERT(range == FindCover(parent, nullptr, pos));
       return range;
     }
+  } else {
+    for (LiveRange* range = parent; range != nullptr;
+         range = range->next_sibling()) {
+      if (range->CanCover(pos)) {
+        return range;
+      }
+    }
   }
   TRACE_ALLOC(THR_Print("Range v%" Pd " is not covered at pos %" Pd "\n",
                         parent->vreg(), pos));
@@ -2998,12 +3021,31 @@ static void EmitMoveOnEdge(BlockEntryInstr* succ,
 }
 
 void FlowGraphAllocator::ResolveControlFlow() {
+  Zone* zone = flow_graph_.zone();
+  GrowableArray<ZoneGrowableArray<LiveRange*>*> sibling_index(
+      zone, live_ranges_.length());
+
   // Resolve linear control flow between touching split siblings
   // inside basic blocks.
   for (intptr_t vreg = 0; vreg < live_ranges_.length(); vreg++) {
     LiveRange* range = live_ranges_[vreg];
+    sibling_index.Add(nullptr);
     if (range == nullptr) continue;
 
+    intptr_t num_siblings = 1;
+    for (LiveRange* sibling = range->next_sibling(); sibling != nullptr;
+         sibling = sibling->next_sibling()) {
+      num_siblings++;
+    }
+    if (num_siblings >= kMinSiblingsToIndex) {
+      auto* siblings = new (zone) ZoneGrowableArray<LiveRange*>(num_siblings);
+      for (LiveRange* sibling = range; sibling != nullptr;
+           sibling = sibling->next_sibling()) {
+        siblings->Add(sibling);
+      }
+      sibling_index[vreg] = siblings;
+    }
+
     while (range->next_sibling() != nullptr) {
       LiveRange* sibling = range->next_sibling();
       TRACE_ALLOC(THR_Print("connecting [%" Pd ", %" Pd ") [", range->Start(),
@@ -3046,7 +3088,8 @@ void FlowGraphAllocator::ResolveControlFlow() {
         continue;
       }
 
-      LiveRange* dst_cover = FindCover(range, block->start_pos());
+      const auto* siblings = sibling_index[range->vreg()];
+      LiveRange* dst_cover = FindCover(range, siblings, block->start_pos());
       Location dst = dst_cover->assigned_location();
 
       TRACE_ALLOC(THR_Print("range v%" Pd
@@ -3066,7 +3109,8 @@ void FlowGraphAllocator::ResolveControlFlow() {
       src_locs.Clear();
       for (intptr_t j = 0; j < block->PredecessorCount(); j++) {
         BlockEntryInstr* pred = block->PredecessorAt(j);
-        LiveRange* src_cover = FindCover(range, pred->end_pos() - 1);
+        LiveRange* src_cover =
+            FindCover(range, siblings, pred->end_pos() - 1);
         Location src = src_cover->assigned_location();
         src_locs.Add(src);
 
@@ -3443,9 +3487,17 @@ void FlowGraphAllocator::ScheduleParallelMoves() {
 }
 
 void FlowGraphAllocator::AllocateRegisters() {
+  // The phase timers accumulate over every function the compiler allocates
+  // registers for. They show the total cost of each phase, not the cost for
+  // a single function.
+  Thread* thread = flow_graph_.thread();
+
   CollectRepresentations();
 
-  liveness_.Analyze();
+  {
+    COMPILER_TIMINGS_TIMER_SCOPE(thread, ComputeLiveness);
+    liveness_.Analyze();
+  }
 
   NumberInstructions();
 
@@ -3453,7 +3505,10 @@ void FlowGraphAllocator::AllocateRegisters() {
   // reserving spill slots for parameter variables.
   AllocateSpillSlotForSuspendState();
 
-  BuildLiveRanges();
+  {
+    COMPILER_TIMINGS_TIMER_SCOPE(thread, BuildLiveRanges);
+    BuildLiveRanges();
+  }
 
   // Update stackmaps after all safepoints are collected.
   UpdateStackmapsForSuspendState();
@@ -3476,9 +3531,12 @@ void FlowGraphAllocator::AllocateRegisters() {
     THR_Print("----------------------------------------------\n");
   }
 
-  PrepareForAllocation(Location::kRegister, kNumberOfCpuRegisters,
-                       unallocated_cpu_, cpu_regs_, blocked_cpu_registers_);
-  AllocateUnallocatedRanges();
+  {
+    COMPILER_TIMINGS_TIMER_SCOPE(thread, AllocateCpuRegisters);
+    PrepareForAllocation(Location::kRegister, kNumberOfCpuRegisters,
+                         unallocated_cpu_, cpu_regs_, blocked_cpu_registers_);
+    AllocateUnallocatedRanges();
+  }
   // GraphEntryInstr::fixed_slot_count() stack slots are reserved for catch
   // entries. When allocating a spill slot, AllocateSpillSlotFor() accounts for
   // these reserved slots and allocates spill slots on top of them.
@@ -3490,9 +3548,12 @@ void FlowGraphAllocator::AllocateRegisters() {
   quad_spill_slots_.Clear();
   untagged_spill_slots_.Clear();
 
-  PrepareForAllocation(Location::kFpuRegister, kNumberOfFpuRegisters,
-                       unallocated_fpu_, fpu_regs_, blocked_fpu_registers_);
-  AllocateUnallocatedRanges();
+  {
+    COMPILER_TIMINGS_TIMER_SCOPE(thread, AllocateFpuRegisters);
+    PrepareForAllocation(Location::kFpuRegister, kNumberOfFpuRegisters,
+                         unallocated_fpu_, fpu_regs_, blocked_fpu_registers_);
+    AllocateUnallocatedRanges();
+  }
 
   GraphEntryInstr* entry = block_order_[0]->AsGraphEntry();
   ASSERT(entry != nullptr);
@@ -3504,9 +3565,15 @@ void FlowGraphAllocator::AllocateRegisters() {
 
   AllocateOutgoingArguments();
 
-  ResolveControlFlow();
+  {
+    COMPILER_TIMINGS_TIMER_SCOPE(thread, ResolveControlFlow);
+    ResolveControlFlow();
+  }
 
-  ScheduleParallelMoves();
+  {
+    COMPILER_TIMINGS_TIMER_SCOPE(thread, ScheduleParallelMoves);
+    ScheduleParallelMoves();
+  }
 
   if (FLAG_print_ssa_liveranges && CompilerState::ShouldTrace()) {
     const Function& function = flow_graph_.function();
@@ -58,6 +58,11 @@ class FlowGraphAllocator : public ValueObject {
   static constexpr intptr_t kDoubleSpillFactor =
       kDoubleSize / compiler::target::kWordSize;
 
+  // Ranges split into at least this many siblings get a sorted index of their
+  // siblings for control flow resolution. Walking the sibling chain for every
+  // edge is quadratic for long ranges in huge functions.
+  static constexpr intptr_t kMinSiblingsToIndex = 16;
+
   explicit FlowGraphAllocator(const FlowGraph& flow_graph,
                               bool intrinsic_mode = false);
 
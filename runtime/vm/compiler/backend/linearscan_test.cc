@@ -0,0 +1,104 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/compiler/backend/linearscan.h"
+
+#include "platform/text_buffer.h"
+#include "vm/compiler/backend/il_test_helper.h"
+#include "vm/compiler/compiler_pass.h"
+#include "vm/object.h"
+#include "vm/unit_test.h"
+
+namespace dart {
+
+// A parameter used in a register after each of many calls is split into a
+// long chain of siblings. Control flow resolution then looks up the covering
+// sibling through the sorted sibling index instead of walking the chain.
+ISOLATE_UNIT_TEST_CASE(FlowGraphAllocator_LongSiblingChain) {
+  const intptr_t kNumCalls = 2 * FlowGraphAllocator::kMinSiblingsToIndex;
+
+  TextBuffer script(1024);
+  script.AddString(R"(
+    @pragma('vm:never-inline')
+    bool check(int i) => i >= 0;
+
+    int manyCalls(int x) {
+      int r = 0;
+)");
+  for (intptr_t i = 0; i < kNumCalls; i++) {
+    script.Printf("      if (check(%" Pd ")) r += x;\n", i);
+  }
+  script.AddString(R"(
+      return r;
+    }
+
+    int run() => manyCalls(3);
+)");
+
+  const auto& root_library = Library::Handle(LoadTestScript(script.buffer()));
+  const auto& first_result = Object::Handle(Invoke(root_library, "run"));
+  EXPECT(first_result.IsSmi());
+  if (first_result.IsSmi()) {
+    EXPECT_EQ(3 * kNumCalls, Smi::Cast(first_result).Value());
+  }
+
+  const auto& function =
+      Function::Handle(GetFunction(root_library, "manyCalls"));
+  TestPipeline pipeline(function, CompilerPass::kJIT);
+  FlowGraph* flow_graph = pipeline.RunPasses({
+      CompilerPass::kComputeSSA,
+      CompilerPass::kApplyICData,
+      CompilerPass::kTryOptimizePatterns,
+      CompilerPass::kSetOuterInliningId,
+      CompilerPass::kTypePropagation,
+      CompilerPass::kApplyClassIds,
+      CompilerPass::kCanonicalize,
+      CompilerPass::kConstantPropagation,
+      CompilerPass::kTypePropagation,
+      CompilerPass::kSelectRepresentations,
+      CompilerPass::kCanonicalize,
+      CompilerPass::kEliminateDeadPhis,
+      CompilerPass::kTypePropagation,
+      CompilerPass::kSelectRepresentations_Final,
+      CompilerPass::kCanonicalize,
+      CompilerPass::kEliminateWriteBarriers,
+      CompilerPass::kLoweringAfterCodeMotionDisabled,
+      CompilerPass::kFinalizeGraph,
+      CompilerPass::kCanonicalize,
+      CompilerPass::kReorderBlocks,
+  });
+
+  // Allocate registers here rather than in the pipeline, so that the live
+  // ranges can be inspected afterwards.
+  flow_graph->InsertMoveArguments();
+  flow_graph->GetLoopHierarchy();
+  FlowGraphAllocator allocator(*flow_graph);
+  allocator.AllocateRegisters();
+
+  ParameterInstr* x = nullptr;
+  for (auto* defn :
+       *flow_graph->graph_entry()->normal_entry()->initial_definitions()) {
+    if (defn->IsParameter() && defn->AsParameter()->param_index() == 0) {
+      x = defn->AsParameter();
+    }
+  }
+  RELEASE_ASSERT(x != nullptr);
+
+  intptr_t num_siblings = 0;
+  for (LiveRange* range = allocator.GetLiveRange(x->vreg(0)); range != nullptr;
+       range = range->next_sibling()) {
+    num_siblings++;
+  }
+  EXPECT(num_siblings >= FlowGraphAllocator::kMinSiblingsToIndex);
+
+  // The moves inserted on edges must keep x intact.
+  pipeline.CompileGraphAndAttachFunction();
+  const auto& second_result = Object::Handle(Invoke(root_library, "run"));
+  EXPECT(second_result.IsSmi());
+  if (second_result.IsSmi()) {
+    EXPECT_EQ(3 * kNumCalls, Smi::Cast(second_result).Value());
+  }
+}
+
+}  // namespace dart
@@ -807,6 +807,25 @@ class BoundsCheckGeneralizer {
         ConstructLowerBound(check->index()->definition(), check);
     // No need to simplify lower bound before applying constraints as
     // we are not going to emit it.
+    lower_bound = ApplyConstraints(lower_bound, check);
+    range_analysis_->AssignRangesRecursively(lower_bound);
+
+    // The lower bound may itself depend on symbols of unknown sign, e.g. the
+    // start of 'for (i = start; i < end; i++)'. Constrain them as well, so
+    // that they are checked once before the loop instead of checking the
+    // index on every iteration.
+    if (!RangeUtils::IsPositive(lower_bound->range())) {
+      GrowableArray<Definition*> lower_bound_symbols;
+      if (FindNonPositiveSymbols(&lower_bound_symbols, lower_bound)) {
+        for (Definition* symbol : lower_bound_symbols) {
+          if (!non_positive_symbols.Contains(symbol)) {
+            non_positive_symbols.Add(symbol);
+            positive_constraints.Add(
+                new ConstraintInstr(new Value(symbol), positive_range));
+          }
+        }
+      }
+    }
     lower_bound = ApplyConstraints(lower_bound, check, &positive_constraints);
     range_analysis_->AssignRangesRecursively(lower_bound);
 
@@ -1256,8 +1275,17 @@ class BoundsCheckGeneralizer {
       if (binary_op->op_kind() == Token::kSUB) {
         // For addition and multiplication it's enough to ensure that
         // lhs and rhs are positive to guarantee that defn as whole is
-        // positive. This does not work for substraction so just give up.
-        return false;
+        // positive. This does not work for substraction, but subtracting
+        // a non-negative constant, as in the bound 'end - 1' of
+        // 'i < end', keeps the expression monotone in lhs: the emitted
+        // check itself verifies that the result is not negative.
+        Definition* right = binary_op->right()->definition();
+        if (!right->IsConstant() ||
+            !compiler::target::IsSmi(right->AsConstant()->value()) ||
+            Smi::Cast(right->AsConstant()->value()).Value() < 0) {
+          return false;
+        }
+        return FindNonPositiveSymbols(symbols, binary_op->left()->definition());
       }
 
       return FindNonPositiveSymbols(symbols, binary_op->left()->definition()) &&
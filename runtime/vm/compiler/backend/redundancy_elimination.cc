@@ -8,6 +8,9 @@
 
 #include "vm/bit_vector.h"
 #include "vm/class_id.h"
+#if defined(DART_PRECOMPILER)
+#include "vm/compiler/aot/precompiler.h"
+#endif
 #include "vm/compiler/backend/flow_graph.h"
 #include "vm/compiler/backend/il.h"
 #include "vm/compiler/backend/il_printer.h"
@@ -2019,6 +2022,18 @@ class LoadOptimizer : public ValueObject {
     return !RepresentationUtils::IsUnboxedInteger(rep) && rep != kUnboxedFloat;
   }
 
+  // Returns true if [instr] may write to places other than the one it
+  // explicitly stores to. When precompiling, static calls to functions which
+  // are known not to write memory don't kill any loads.
+  static bool MayWriteMemory(Instruction* instr) {
+#if defined(DART_PRECOMPILER)
+    if (Precompiler* precompiler = Precompiler::Instance()) {
+      return precompiler->MayWriteMemory(instr);
+    }
+#endif
+    return instr->HasUnknownSideEffects();
+  }
+
   static bool AlreadyPinnedByRedefinition(Definition* replacement,
                                           Definition* redefinition) {
     Definition* defn = replacement;
@@ -2193,7 +2208,7 @@ class LoadOptimizer : public ValueObject {
         }
 
         // If instruction has effects then kill all loads affected.
-        if (instr->HasUnknownSideEffects()) {
+        if (MayWriteMemory(instr)) {
           kill->AddAll(aliased_set_->aliased_by_effects());
           // There is no need to clear out_values when removing values from GEN
           // set because only those values that are in the GEN set
@@ -3520,6 +3535,30 @@ void AllocationSinking::EliminateAllocation(Definition* alloc) {
   alloc->RemoveFromGraph();
 }
 
+// Replace uses of redefinitions of the given allocation with the allocation
+// itself. The inliner redefines arguments, e.g. a closure passed to an inlined
+// forEach, to keep the callee's code from being hoisted above the call. The
+// allocation's own type is already exact and non-nullable, and code motion is
+// over by the time allocations are sunk, so such redefinitions only prevent
+// the allocation from being sunk.
+static void ForwardRedefinitions(Definition* alloc) {
+  bool changed;
+  do {
+    changed = false;
+    for (Value* use = alloc->input_use_list(); use != nullptr;
+         use = use->next_use()) {
+      if (auto* const redef = use->instruction()->AsRedefinition()) {
+        redef->ReplaceUsesWith(alloc);
+        redef->RemoveFromGraph();
+        // Uses of the redefinition were appended to the use list, and the
+        // list was modified by the removal, so start over.
+        changed = true;
+        break;
+      }
+    }
+  } while (changed);
+}
+
 // Find allocation instructions that can be potentially eliminated and
 // rematerialized at deoptimization exits if needed. See IsSafeUse
 // for the description of algorithm used below.
@@ -3535,6 +3574,7 @@ void AllocationSinking::CollectCandidates() {
       }
 
       Definition* alloc = current->Cast<Definition>();
+      ForwardRedefinitions(alloc);
       if (IsAllocationSinkingCandidate(alloc, kOptimisticCheck)) {
         alloc->SetIdentity(AliasIdentity::AllocationSinkingCandidate());
         candidates_.Add(alloc);
@@ -1466,6 +1466,69 @@ main() {
                "9223372036854775807, field2: hey), sum: -2");
 }
 
+// Verifies that a redefinition of an allocation, as created by the inliner
+// for arguments of inlined calls, does not prevent allocation sinking.
+ISOLATE_UNIT_TEST_CASE(AllocationSinking_Redefinition) {
+  const char* script_chars = R"(
+    class K {
+      var field;
+    }
+  )";
+  const Library& lib = Library::Handle(LoadTestScript(script_chars));
+
+  const Class& cls = Class::ZoneHandle(
+      lib.LookupClass(String::Handle(Symbols::New(thread, "K"))));
+  const Error& err = Error::Handle(cls.EnsureIsFinalized(thread));
+  EXPECT(err.IsNull());
+
+  const Field& original_field = Field::Handle(
+      cls.LookupField(String::Handle(Symbols::New(thread, "field"))));
+  EXPECT(!original_field.IsNull());
+  const Field& field = Field::Handle(original_field.CloneFromOriginal());
+
+  using compiler::BlockBuilder;
+  CompilerState S(thread, /*is_aot=*/false, /*is_optimizing=*/true);
+  FlowGraphBuilderHelper H;
+
+  // We are going to build the following graph:
+  //
+  // B0[graph_entry]
+  // B1[function_entry]:
+  //   v0 <- AllocateObject(class K)
+  //   v1 <- Redefinition(v0)
+  //   StoreField(v1 . K.field = 42)
+  //   v2 <- LoadField(v0, K.field)
+  //   Return v2
+
+  auto b1 = H.flow_graph()->graph_entry()->normal_entry();
+  AllocateObjectInstr* v0;
+  DartReturnInstr* ret;
+
+  {
+    BlockBuilder builder(H.flow_graph(), b1);
+    auto& slot = Slot::Get(field, &H.flow_graph()->parsed_function());
+    v0 = builder.AddDefinition(
+        new AllocateObjectInstr(InstructionSource(), cls, S.GetNextDeoptId()));
+    auto v1 = builder.AddDefinition(new RedefinitionInstr(new Value(v0)));
+    builder.AddInstruction(new StoreFieldInstr(
+        slot, new Value(v1), new Value(H.IntConstant(42)),
+        kEmitStoreBarrier, InstructionSource()));
+    auto v2 = builder.AddDefinition(
+        new LoadFieldInstr(new Value(v0), slot, InstructionSource()));
+    ret = builder.AddInstruction(new DartReturnInstr(
+        InstructionSource(), new Value(v2), S.GetNextDeoptId()));
+  }
+  H.FinishGraph();
+  DominatorBasedCSE::Optimize(H.flow_graph());
+  EXPECT_PROPERTY(ret, it.value()->BindsToConstant());
+
+  AllocationSinking sinking(H.flow_graph());
+  sinking.Optimize();
+
+  // v0 should have been removed from the graph.
+  EXPECT_PROPERTY(v0, it.next() == nullptr && it.previous() == nullptr);
+}
+
 #if !defined(TARGET_ARCH_IA32)
 
 ISOLATE_UNIT_TEST_CASE(DelayAllocations_DelayAcrossCalls) {
@@ -372,6 +372,31 @@ FlowGraph* CompilerPass::RunPipeline(PipelineMode mode,
   return pass_state->flow_graph();
 }
 
+FlowGraph* CompilerPass::RunBaselinePipeline(CompilerPassState* pass_state) {
+  INVOKE_PASS(ComputeSSA);
+  INVOKE_PASS(ApplyICData);
+  INVOKE_PASS(TryOptimizePatterns);
+  INVOKE_PASS(SetOuterInliningId);
+  INVOKE_PASS(TypePropagation);
+  INVOKE_PASS(ApplyClassIds);
+  INVOKE_PASS(Canonicalize);
+  INVOKE_PASS(ConstantPropagation);
+  INVOKE_PASS(TypePropagation);
+  INVOKE_PASS(SelectRepresentations);
+  INVOKE_PASS(Canonicalize);
+  INVOKE_PASS(EliminateDeadPhis);
+  INVOKE_PASS(TypePropagation);
+  INVOKE_PASS(SelectRepresentations_Final);
+  INVOKE_PASS(Canonicalize);
+  INVOKE_PASS(EliminateWriteBarriers);
+  INVOKE_PASS(LoweringAfterCodeMotionDisabled);
+  INVOKE_PASS(FinalizeGraph);
+  INVOKE_PASS(Canonicalize);
+  INVOKE_PASS(ReorderBlocks);
+  INVOKE_PASS(AllocateRegisters);
+  return pass_state->flow_graph();
+}
+
 FlowGraph* CompilerPass::RunPipelineWithPasses(
     CompilerPassState* state,
     std::initializer_list<CompilerPass::Id> passes) {
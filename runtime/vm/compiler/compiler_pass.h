@@ -177,6 +177,12 @@ class CompilerPass {
   static FlowGraph* RunPipeline(PipelineMode mode,
                                 CompilerPassState* state,
                                 bool compute_ssa = true);
+
+  // The JIT's baseline tier: specializes calls using the type feedback but
+  // skips inlining and the global optimizations, which dominate compile time.
+  DART_WARN_UNUSED_RESULT
+  static FlowGraph* RunBaselinePipeline(CompilerPassState* state);
+
   DART_WARN_UNUSED_RESULT
   static FlowGraph* RunPipelineWithPasses(
       CompilerPassState* state,
@@ -96,6 +96,11 @@ class CompilerState : public ThreadStackResource {
   bool is_aot() const { return is_aot_; }
 
   bool is_optimizing() const { return is_optimizing_; }
+
+  // Whether the function is optimized by the cheaper baseline tier of the
+  // JIT (see --baseline_optimization).
+  bool is_baseline() const { return is_baseline_; }
+  void set_is_baseline(bool value) { is_baseline_ = value; }
   bool should_clone_fields() {
     return !is_aot() && (is_optimizing() || FLAG_force_clone_compiler_objects);
   }
@@ -166,6 +171,7 @@ class CompilerState : public ThreadStackResource {
 
   const bool is_aot_;
   const bool is_optimizing_;
+  bool is_baseline_ = false;
 
   const CompilerTracing tracing_;
 
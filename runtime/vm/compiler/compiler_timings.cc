@@ -4,6 +4,8 @@
 
 #include "vm/compiler/compiler_timings.h"
 
+#include "vm/json_writer.h"
+
 namespace dart {
 
 namespace {
@@ -103,4 +105,36 @@ void CompilerTimings::Print() {
                try_inlining_failure_.FormatElapsedHumanReadable(zone));
 }
 
+void CompilerTimings::PrintTimersJSON(
+    JSONWriter* writer,
+    const std::unique_ptr<CompilerTimings::Timers>& timers) {
+  writer->OpenArray("timers");
+  for (intptr_t i = 0; i < kNumTimers; i++) {
+    const auto& timer = timers->timers_[i];
+    if (timer.TotalElapsedTime() > 0) {
+      writer->OpenObject();
+      writer->PrintProperty("name", timer_names[i]);
+      writer->PrintProperty64("micros", timer.TotalElapsedTime());
+      writer->PrintProperty64("cpuMicros", timer.TotalElapsedTimeCpu());
+      if (timers->nested_[i] != nullptr) {
+        PrintTimersJSON(writer, timers->nested_[i]);
+      }
+      writer->CloseObject();
+    }
+  }
+  writer->CloseArray();
+}
+
+void CompilerTimings::PrintJSON(JSONWriter* writer) {
+  writer->OpenObject();
+  writer->PrintProperty64("micros", total_.TotalElapsedTime());
+  writer->PrintProperty64("cpuMicros", total_.TotalElapsedTimeCpu());
+  PrintTimersJSON(writer, root_);
+  writer->PrintProperty64("inliningSuccessMicros",
+                          try_inlining_success_.TotalElapsedTime());
+  writer->PrintProperty64("inliningFailureMicros",
+                          try_inlining_failure_.TotalElapsedTime());
+  writer->CloseObject();
+}
+
 }  // namespace dart
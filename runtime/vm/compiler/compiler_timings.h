@@ -46,18 +46,29 @@
   V(BuildDecisionGraph)                                                        \
   V(PrepareGraphs)
 
+#define REGISTER_ALLOCATOR_TIMERS_LIST(V)                                      \
+  V(ComputeLiveness)                                                           \
+  V(BuildLiveRanges)                                                           \
+  V(AllocateCpuRegisters)                                                      \
+  V(AllocateFpuRegisters)                                                      \
+  V(ResolveControlFlow)                                                        \
+  V(ScheduleParallelMoves)
+
 // Note: COMPILER_PASS_LIST must be the first element of the list below because
 // we expect that pass ids are the same as ids of corresponding timers.
 #define COMPILER_TIMERS_LIST(V)                                                \
   COMPILER_PASS_LIST(V)                                                        \
   PRECOMPILER_TIMERS_LIST(V)                                                   \
   INLINING_TIMERS_LIST(V)                                                      \
+  REGISTER_ALLOCATOR_TIMERS_LIST(V)                                            \
   V(BuildGraph)                                                                \
   V(EmitCode)                                                                  \
   V(FinalizeCode)
 
 namespace dart {
 
+class JSONWriter;
+
 // |CompilerTimings| provides a way to track time taken by various compiler
 // passes via a fixed number of timers (specified in |COMPILER_TIMERS_LIST|).
 //
@@ -127,11 +138,17 @@ class CompilerTimings : public MallocAllocated {
 
   void Print();
 
+  // Writes the same breakdown as |Print| as a JSON object, with all times in
+  // microseconds, so that it can be compared between runs.
+  void PrintJSON(JSONWriter* writer);
+
  private:
   void PrintTimers(Zone* zone,
                    const std::unique_ptr<CompilerTimings::Timers>& timers,
                    const Timer& total,
                    intptr_t level);
+  void PrintTimersJSON(JSONWriter* writer,
+                       const std::unique_ptr<CompilerTimings::Timers>& timers);
 
   Timer total_;
   std::unique_ptr<Timers> root_ = std::make_unique<Timers>();
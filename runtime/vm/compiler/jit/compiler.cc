@@ -22,9 +22,11 @@
 #include "vm/compiler/cha.h"
 #include "vm/compiler/compiler_pass.h"
 #include "vm/compiler/compiler_state.h"
+#include "vm/compiler/compiler_timings.h"
 #include "vm/compiler/ffi/callback.h"
 #include "vm/compiler/frontend/flow_graph_builder.h"
 #include "vm/compiler/frontend/kernel_to_il.h"
+#include "vm/compiler/jit/hot_function_cache.h"
 #include "vm/compiler/jit/jit_call_specializer.h"
 #include "vm/dart_entry.h"
 #include "vm/debugger.h"
@@ -48,6 +50,16 @@
 
 namespace dart {
 
+DEFINE_FLAG(bool,
+            baseline_optimization,
+            false,
+            "Optimize functions without inlining and global optimizations "
+            "first, and fully only if they stay hot.");
+DEFINE_FLAG(int,
+            baseline_promotion_threshold,
+            30000,
+            "Invocations of a function's baseline optimized code before it is "
+            "fully optimized.");
 DEFINE_FLAG(
     int,
     max_deoptimization_counter_threshold,
@@ -88,6 +100,20 @@ DEFINE_FLAG(bool, trace_bailout, false, "Print bailout from ssa compiler.");
 
 DECLARE_FLAG(bool, trace_failed_optimization_attempts);
 
+// With --baseline_optimization, a function that reaches the optimization
+// threshold for the first time is compiled with the baseline pipeline. Its
+// code keeps counting invocations and, once it reaches
+// --baseline_promotion_threshold, the function is optimized again, now with
+// optimized code installed, which selects the full pipeline. Functions that
+// were deoptimized before go straight to the full pipeline, as do OSR
+// compilations and functions that have no unoptimized code to fall back to.
+static bool UseBaselineTier(const Function& function, intptr_t osr_id) {
+  return FLAG_baseline_optimization && (osr_id == Compiler::kNoOSRDeoptId) &&
+         !function.HasOptimizedCode() &&
+         (function.deoptimization_counter() == 0) &&
+         !function.ForceOptimize() && !function.IsIrregexpFunction();
+}
+
 static void PrecompilationModeHandler(bool value) {
   if (value) {
 #if defined(TARGET_ARCH_IA32)
@@ -254,6 +280,27 @@ bool Compiler::CanOptimizeFunction(Thread* thread, const Function& function) {
         FATAL("Stop on excessive deoptimization");
       }
     }
+#if defined(SUPPORT_TIMELINE)
+    // Make deoptimization loops visible next to the "Deoptimize" events that
+    // led to them.
+    TimelineStream* compiler_stream = Timeline::GetCompilerStream();
+    ASSERT(compiler_stream != nullptr);
+    if (compiler_stream->enabled()) {
+      // Allocate all Dart objects needed before calling StartEvent,
+      // which blocks safe points until Complete is called.
+      const String& function_name =
+          String::Handle(function.QualifiedScrubbedName());
+      TimelineEvent* timeline_event = compiler_stream->StartEvent();
+      if (timeline_event != nullptr) {
+        timeline_event->Instant("DisableOptimization");
+        timeline_event->SetNumArguments(2);
+        timeline_event->CopyArgument(0, "function", function_name.ToCString());
+        timeline_event->FormatArgument(1, "deoptimizationCount", "%d",
+                                       function.deoptimization_counter());
+        timeline_event->Complete();
+      }
+    }
+#endif  // defined(SUPPORT_TIMELINE)
     // The function will not be optimized any longer. This situation can occur
     // mostly with small optimization counter thresholds.
     function.SetIsOptimizable(false);
@@ -518,6 +565,8 @@ CodePtr CompileParsedFunctionHelper::Compile(CompilationPipeline* pipeline) {
       CompilerState compiler_state(thread(), /*is_aot=*/false, optimized(),
                                    CompilerState::ShouldTrace(function));
       compiler_state.set_function(function);
+      compiler_state.set_is_baseline(optimized() &&
+                                     UseBaselineTier(function, osr_id()));
 
       {
         // Extract type feedback before the graph is built, as the graph
@@ -544,6 +593,7 @@ CodePtr CompileParsedFunctionHelper::Compile(CompilationPipeline* pipeline) {
         }
 
         TIMELINE_DURATION(thread(), CompilerVerbose, "BuildFlowGraph");
+        COMPILER_TIMINGS_TIMER_SCOPE(thread(), BuildGraph);
         flow_graph = pipeline->BuildFlowGraph(
             zone, parsed_function(), ic_data_array, osr_id(), optimized());
       }
@@ -565,7 +615,14 @@ CodePtr CompileParsedFunctionHelper::Compile(CompilationPipeline* pipeline) {
 
       CompilerPassState pass_state(thread(), flow_graph, &speculative_policy);
 
-      if (optimized()) {
+      if (optimized() && compiler_state.is_baseline()) {
+        TIMELINE_DURATION(thread(), CompilerVerbose, "BaselinePasses");
+
+        JitCallSpecializer call_specializer(flow_graph, &speculative_policy);
+        pass_state.call_specializer = &call_specializer;
+
+        flow_graph = CompilerPass::RunBaselinePipeline(&pass_state);
+      } else if (optimized()) {
         TIMELINE_DURATION(thread(), CompilerVerbose, "OptimizationPasses");
 
         JitCallSpecializer call_specializer(flow_graph, &speculative_policy);
@@ -587,6 +644,7 @@ CodePtr CompileParsedFunctionHelper::Compile(CompilationPipeline* pipeline) {
       CompilerPass::GenerateCode(&pass_state);
 
       {
+        COMPILER_TIMINGS_TIMER_SCOPE(thread(), FinalizeCode);
         TIMELINE_DURATION(thread(), CompilerVerbose, "FinalizeCompilation");
 
         auto install_code_fun = [&]() {
@@ -791,6 +849,12 @@ static ObjectPtr CompileFunctionHelper(CompilationPipeline* pipeline,
 
     per_compile_timer.Stop();
 
+    if (!optimized) {
+      HotFunctionCache::ApplyHint(thread, function);
+    } else if (!function.ForceOptimize()) {
+      HotFunctionCache::RecordOptimized(thread, function);
+    }
+
     if (trace_compiler) {
       const auto& code = Code::Handle(function.CurrentCode());
       THR_Print("--> '%s' entry: %#" Px " size: %" Pd " time: %" Pd64 " us\n",
@@ -892,6 +956,10 @@ ObjectPtr Compiler::CompileOptimizedFunction(Thread* thread,
   const char* event_name;
   if (osr_id != kNoOSRDeoptId) {
     event_name = "CompileFunctionOptimizedOSR";
+  } else if (UseBaselineTier(function, osr_id)) {
+    event_name = IsBackgroundCompilation()
+                     ? "CompileFunctionBaselineBackground"
+                     : "CompileFunctionBaseline";
   } else if (IsBackgroundCompilation()) {
     event_name = "CompileFunctionOptimizedBackground";
   } else {
@@ -1017,7 +1085,8 @@ class QueueElement {
 };
 
 // Allocated in C-heap. Handles both input and output of background compilation.
-// It implements a FIFO queue, using Peek, Add, Remove operations.
+// It implements a FIFO queue, using Peek, Add, Remove operations, and also
+// allows removing the hottest function first with RemoveHottest.
 class BackgroundCompilationQueue {
  public:
   BackgroundCompilationQueue() : first_(nullptr), last_(nullptr) {}
@@ -1069,6 +1138,38 @@ class BackgroundCompilationQueue {
     return result;
   }
 
+  // Removes the function with the highest usage counter, the first one of
+  // several. The usage counter of an enqueued function is reset to INT32_MIN
+  // (see OptimizeInvokedFunction) and keeps counting while the function runs
+  // unoptimized, so this is the function invoked most often while waiting.
+  QueueElement* RemoveHottest(Function* scratch) {
+    ASSERT(first_ != nullptr);
+    QueueElement* hottest_prev = nullptr;
+    QueueElement* hottest = first_;
+    *scratch = hottest->Function();
+    intptr_t hottest_count = scratch->usage_counter();
+    QueueElement* prev = first_;
+    for (QueueElement* p = first_->next(); p != nullptr; p = p->next()) {
+      *scratch = p->Function();
+      const intptr_t count = scratch->usage_counter();
+      if (count > hottest_count) {
+        hottest_prev = prev;
+        hottest = p;
+        hottest_count = count;
+      }
+      prev = p;
+    }
+    if (hottest_prev == nullptr) {
+      return Remove();
+    }
+    hottest_prev->set_next(hottest->next());
+    if (last_ == hottest) {
+      last_ = hottest_prev;
+    }
+    hottest->set_next(nullptr);
+    return hottest;
+  }
+
   bool ContainsObj(const Object& obj) const {
     QueueElement* p = first_;
     while (p != nullptr) {
@@ -1101,6 +1202,8 @@ class BackgroundCompilerTask : public ThreadPool::Task {
       : background_compiler_(background_compiler) {}
   virtual ~BackgroundCompilerTask() {}
 
+  virtual Kind kind() const { return kCompiler; }
+
  private:
   virtual void Run() { background_compiler_->Run(); }
 
@@ -1136,7 +1239,7 @@ void BackgroundCompiler::Run() {
     {
       SafepointMonitorLocker ml(&monitor_);
       if (running_ && !function_queue()->IsEmpty()) {
-        element = function_queue()->Remove();
+        element = function_queue()->RemoveHottest(&function);
         function ^= element->function();
       }
     }
@@ -1152,8 +1255,7 @@ void BackgroundCompiler::Run() {
         if (Compiler::CanOptimizeFunction(thread, function)) {
           SafepointMonitorLocker ml(&monitor_);
           if (running_) {
-            QueueElement* repeat_qelem = new QueueElement(function);
-            function_queue()->Add(repeat_qelem);
+            RequeueLocked(function);
           }
         }
       }
@@ -1207,6 +1309,34 @@ bool BackgroundCompiler::EnqueueCompilation(const Function& function) {
   return true;
 }
 
+void BackgroundCompiler::RequeueLocked(const Function& function) {
+  // A failed compilation leaves the usage counter just below the optimization
+  // threshold (see CompileParsedFunctionHelper::FinalizeCompilation), far
+  // above the counters of the other queued functions, so RemoveHottest would
+  // pick it again before any of them. Restart its count as if it had just
+  // been enqueued, behind the functions already waiting.
+  function.SetUsageCounter(INT32_MIN);
+  function_queue()->Add(new QueueElement(function));
+}
+
+#if defined(TESTING)
+void BackgroundCompiler::AddForTesting(const Function& function) {
+  function_queue()->Add(new QueueElement(function));
+}
+
+void BackgroundCompiler::RequeueForTesting(const Function& function) {
+  RequeueLocked(function);
+}
+
+FunctionPtr BackgroundCompiler::RemoveHottestForTesting() {
+  Function& function = Function::Handle();
+  QueueElement* element = function_queue()->RemoveHottest(&function);
+  function ^= element->function();
+  delete element;
+  return function.ptr();
+}
+#endif  // defined(TESTING)
+
 void BackgroundCompiler::VisitPointers(ObjectPointerVisitor* visitor) {
   function_queue_->VisitObjectPointers(visitor);
 }
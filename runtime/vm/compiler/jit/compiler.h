@@ -138,9 +138,20 @@ class BackgroundCompiler {
 
   void Run();
 
+#if defined(TESTING)
+  // Queue operations of the background compiler task, without starting it.
+  void AddForTesting(const Function& function);
+  void RequeueForTesting(const Function& function);
+  FunctionPtr RemoveHottestForTesting();
+#endif  // defined(TESTING)
+
  private:
   friend class NoBackgroundCompilerScope;
 
+  // Puts [function] back on the queue after its compilation did not install
+  // optimized code.
+  void RequeueLocked(const Function& function);
+
   void Stop();
   void StopLocked(Thread* thread, SafepointMonitorLocker* done_locker);
   void Enable();
@@ -0,0 +1,254 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/compiler/jit/hot_function_cache.h"
+
+#include "platform/utils.h"
+#include "vm/dart.h"
+#include "vm/flags.h"
+#include "vm/growable_array.h"
+#include "vm/hash.h"
+#include "vm/hash_map.h"
+#include "vm/isolate.h"
+#include "vm/lockers.h"
+#include "vm/object.h"
+#include "vm/os.h"
+#include "vm/thread.h"
+
+namespace dart {
+
+DEFINE_FLAG(charp,
+            save_hot_functions,
+            nullptr,
+            "Write the functions optimized by the JIT to this file at exit.");
+DEFINE_FLAG(charp,
+            load_hot_functions,
+            nullptr,
+            "Optimize the functions listed in this file, written by "
+            "--save_hot_functions, after a shortened warm-up.");
+
+// A hinted function is optimized after this fraction of the usual
+// invocations, so its first optimized code is still based on some type
+// feedback from this run.
+static constexpr intptr_t kHintedWarmupDivisor = 10;
+
+using CStringSet = MallocDirectChainedHashMap<CStringSetKeyValueTrait>;
+
+// Guards the tables below. The loaded table is only written by Init, but
+// recording happens on mutator and background compiler threads.
+static Mutex* cache_lock_ = new Mutex();
+static CStringSet* loaded_ = nullptr;
+static MallocGrowableArray<char*>* loaded_keys_ = nullptr;
+// The loaded keys without their program hash.
+static CStringSet* loaded_names_ = nullptr;
+static CStringSet* recorded_ = nullptr;
+static MallocGrowableArray<char*>* recorded_keys_ = nullptr;
+
+static void AddKeyLocked(CStringSet* set,
+                         MallocGrowableArray<char*>* keys,
+                         const char* key) {
+  if (set->HasKey(key)) return;
+  char* copy = Utils::StrDup(key);
+  keys->Add(copy);
+  set->Insert(copy);
+}
+
+static void FreeKeys(MallocGrowableArray<char*>* keys) {
+  for (intptr_t i = 0; i < keys->length(); i++) {
+    free(keys->At(i));
+  }
+}
+
+static void AddLoadedKeyLocked(const char* line, intptr_t length) {
+  // Tolerate lists edited on Windows.
+  if (length > 0 && line[length - 1] == '\r') {
+    length--;
+  }
+  if (length == 0) return;
+  char* key = Utils::StrNDup(line, length);
+  AddKeyLocked(loaded_, loaded_keys_, key);
+  // Keys are "%08x %s", see KeyFor.
+  if (length > 9 && key[8] == ' ') {
+    AddKeyLocked(loaded_names_, loaded_keys_, &key[9]);
+  }
+  free(key);
+}
+
+static void ParseLoadedLocked(const char* text, intptr_t length) {
+  intptr_t start = 0;
+  // The last line need not end with a newline.
+  for (intptr_t i = 0; i <= length; i++) {
+    if (i < length && text[i] != '\n') continue;
+    AddLoadedKeyLocked(&text[start], i - start);
+    start = i + 1;
+  }
+}
+
+static void LoadFile(const char* path) {
+  Dart_FileOpenCallback file_open = Dart::file_open_callback();
+  Dart_FileReadCallback file_read = Dart::file_read_callback();
+  Dart_FileCloseCallback file_close = Dart::file_close_callback();
+  if ((file_open == nullptr) || (file_read == nullptr) ||
+      (file_close == nullptr)) {
+    OS::PrintErr("warning: Could not access file callbacks to read %s.\n",
+                 path);
+    return;
+  }
+  void* file = (*file_open)(path, /*write=*/false);
+  if (file == nullptr) {
+    // No list yet, e.g. on the first run.
+    return;
+  }
+  uint8_t* data = nullptr;
+  intptr_t length = -1;
+  (*file_read)(&data, &length, file);
+  (*file_close)(file);
+  if (data == nullptr || length <= 0) {
+    free(data);
+    return;
+  }
+  ParseLoadedLocked(reinterpret_cast<const char*>(data), length);
+  free(data);
+}
+
+static void SaveFile(const char* path) {
+  Dart_FileOpenCallback file_open = Dart::file_open_callback();
+  Dart_FileWriteCallback file_write = Dart::file_write_callback();
+  Dart_FileCloseCallback file_close = Dart::file_close_callback();
+  if ((file_open == nullptr) || (file_write == nullptr) ||
+      (file_close == nullptr)) {
+    OS::PrintErr("warning: Could not access file callbacks to write %s.\n",
+                 path);
+    return;
+  }
+  void* file = (*file_open)(path, /*write=*/true);
+  if (file == nullptr) {
+    OS::PrintErr("warning: Failed to write hot functions to %s.\n", path);
+    return;
+  }
+  for (intptr_t i = 0; i < recorded_keys_->length(); i++) {
+    const char* key = recorded_keys_->At(i);
+    (*file_write)(key, strlen(key), file);
+    (*file_write)("\n", 1, file);
+  }
+  (*file_close)(file);
+}
+
+void HotFunctionCache::Init() {
+  MutexLocker ml(cache_lock_);
+  if (FLAG_load_hot_functions != nullptr) {
+    loaded_ = new CStringSet();
+    loaded_keys_ = new MallocGrowableArray<char*>();
+    loaded_names_ = new CStringSet();
+    LoadFile(FLAG_load_hot_functions);
+  }
+  if (FLAG_save_hot_functions != nullptr) {
+    recorded_ = new CStringSet();
+    recorded_keys_ = new MallocGrowableArray<char*>();
+  }
+}
+
+static void FreeLoadedLocked() {
+  if (loaded_ != nullptr) {
+    FreeKeys(loaded_keys_);
+    delete loaded_keys_;
+    loaded_keys_ = nullptr;
+    delete loaded_;
+    loaded_ = nullptr;
+    delete loaded_names_;
+    loaded_names_ = nullptr;
+  }
+}
+
+void HotFunctionCache::Cleanup() {
+  MutexLocker ml(cache_lock_);
+  if (recorded_ != nullptr) {
+    SaveFile(FLAG_save_hot_functions);
+    FreeKeys(recorded_keys_);
+    delete recorded_keys_;
+    recorded_keys_ = nullptr;
+    delete recorded_;
+    recorded_ = nullptr;
+  }
+  FreeLoadedLocked();
+}
+
+#if defined(TESTING)
+void HotFunctionCache::LoadForTesting(const char* contents) {
+  MutexLocker ml(cache_lock_);
+  FreeLoadedLocked();
+  if (contents != nullptr) {
+    loaded_ = new CStringSet();
+    loaded_keys_ = new MallocGrowableArray<char*>();
+    loaded_names_ = new CStringSet();
+    ParseLoadedLocked(contents, strlen(contents));
+  }
+}
+#endif  // defined(TESTING)
+
+static uint32_t ProgramHash(IsolateGroupSource* source) {
+  uint32_t hash = source->program_hash;
+  if (hash != 0) {
+    return hash;
+  }
+  // The main program is either given at group creation or loaded later with
+  // Dart_LoadScriptFromKernel. Groups running from a snapshot have neither;
+  // their script URI is the best available key.
+  const uint8_t* kernel = source->script_kernel_buffer;
+  intptr_t kernel_size = source->script_kernel_size;
+  if (kernel == nullptr) {
+    kernel = source->kernel_buffer;
+    kernel_size = source->kernel_buffer_size;
+  }
+  if (kernel != nullptr && kernel_size > 0) {
+    hash = Utils::StringHash(kernel, kernel_size);
+  } else if (source->script_uri != nullptr) {
+    hash = Utils::StringHash(source->script_uri, strlen(source->script_uri));
+  }
+  // Racing threads compute the same value.
+  hash = FinalizeHash(hash, kBitsPerInt32);
+  source->program_hash = hash;
+  return hash;
+}
+
+const char* HotFunctionCache::KeyFor(Thread* thread, const Function& function) {
+  const uint32_t hash = ProgramHash(thread->isolate_group()->source());
+  return OS::SCreate(thread->zone(), "%08x %s", hash,
+                     function.ToLibNamePrefixedQualifiedCString());
+}
+
+void HotFunctionCache::RecordOptimized(Thread* thread,
+                                       const Function& function) {
+  if (recorded_ == nullptr) return;
+  const char* key = KeyFor(thread, function);
+  MutexLocker ml(cache_lock_);
+  if (recorded_ != nullptr) {
+    AddKeyLocked(recorded_, recorded_keys_, key);
+  }
+}
+
+void HotFunctionCache::ApplyHint(Thread* thread, const Function& function) {
+  if (loaded_ == nullptr || loaded_keys_->is_empty()) return;
+  if (!function.IsOptimizable()) return;
+  const char* key = KeyFor(thread, function);
+  {
+    MutexLocker ml(cache_lock_);
+    if (loaded_ == nullptr || !loaded_->HasKey(key)) return;
+  }
+  const intptr_t threshold =
+      thread->isolate_group()->optimization_counter_threshold();
+  const intptr_t hinted = threshold - threshold / kHintedWarmupDivisor;
+  if (function.usage_counter() < hinted) {
+    function.SetUsageCounter(hinted);
+  }
+}
+
+bool HotFunctionCache::IsHotInTraining(const Function& function) {
+  if (loaded_names_ == nullptr || loaded_keys_->is_empty()) return false;
+  const char* name = function.ToLibNamePrefixedQualifiedCString();
+  MutexLocker ml(cache_lock_);
+  return loaded_names_ != nullptr && loaded_names_->HasKey(name);
+}
+
+}  // namespace dart
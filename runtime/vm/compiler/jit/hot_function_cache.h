@@ -0,0 +1,65 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_COMPILER_JIT_HOT_FUNCTION_CACHE_H_
+#define RUNTIME_VM_COMPILER_JIT_HOT_FUNCTION_CACHE_H_
+
+#if defined(DART_PRECOMPILED_RUNTIME)
+#error "AOT runtime should not use compiler sources (including header files)"
+#endif  // defined(DART_PRECOMPILED_RUNTIME)
+
+#include "vm/allocation.h"
+#include "vm/globals.h"
+
+namespace dart {
+
+class Function;
+class Thread;
+
+// Remembers across process restarts which functions the JIT optimized.
+//
+// With --save_hot_functions=<file> every function that is compiled with the
+// optimizing compiler is recorded and the list is written out when the VM
+// shuts down. With --load_hot_functions=<file> a function in the list starts
+// counting towards the optimization threshold from close to it as soon as it
+// has unoptimized code, so a restarted process skips most of its warm-up.
+//
+// Only the list of names is persisted, not code: the function is still
+// optimized in this process with this process's type feedback, CHA and field
+// guards, so a stale or mismatched list can only cost an early optimization.
+// Entries are keyed by a hash of the isolate group's kernel so that a list
+// recorded for another program is ignored.
+//
+// The AOT compiler can use the list of a JIT training run as a profile: see
+// IsHotInTraining.
+class HotFunctionCache : public AllStatic {
+ public:
+  static void Init();
+  static void Cleanup();
+
+  // Records that 'function' has been compiled with the optimizing compiler.
+  static void RecordOptimized(Thread* thread, const Function& function);
+
+  // Called once 'function' has unoptimized code. Advances its usage counter
+  // if it was optimized in a previous run.
+  static void ApplyHint(Thread* thread, const Function& function);
+
+  // Returns true if the list loaded with --load_hot_functions contains
+  // 'function' for any program. The kernel given to the AOT compiler is not
+  // the one the list was recorded for, so only the names are compared.
+  static bool IsHotInTraining(const Function& function);
+
+#if defined(TESTING)
+  // Replaces the loaded list with 'contents', in the format written by
+  // --save_hot_functions. A nullptr 'contents' clears the loaded list.
+  static void LoadForTesting(const char* contents);
+#endif  // defined(TESTING)
+
+ private:
+  static const char* KeyFor(Thread* thread, const Function& function);
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_COMPILER_JIT_HOT_FUNCTION_CACHE_H_
@@ -55,6 +55,13 @@ bool WillAllocateNewOrRememberedArray(intptr_t length) {
 #if !defined(DART_PRECOMPILED_RUNTIME)
 
 namespace dart {
+
+DEFINE_FLAG(bool,
+            print_boxed_nullable_fields,
+            false,
+            "Print the instance fields of unboxable types which are stored "
+            "boxed because they are nullable.");
+
 namespace compiler {
 
 bool IsSameObject(const Object& a, const Object& b) {
@@ -1092,6 +1099,14 @@ void UnboxFieldIfSupported(const dart::Field& field,
   }
 
   if (type.IsNullable()) {
+    // SIMD values are only unboxed on targets which support it, elsewhere
+    // such a field would be boxed even if it were not nullable.
+    if (FLAG_print_boxed_nullable_fields &&
+        (type.IsDoubleType() ||
+         ((type.IsFloat32x4Type() || type.IsFloat64x2Type()) &&
+          FlowGraphCompiler::SupportsUnboxedSimd128()))) {
+      THR_Print("Nullable field %s is stored boxed\n", field.ToCString());
+    }
     return;
   }
 
@@ -6,6 +6,8 @@
 #include "platform/assert.h"
 #include "vm/class_finalizer.h"
 #include "vm/code_patcher.h"
+#include "vm/compiler/backend/il_test_helper.h"
+#include "vm/compiler/jit/hot_function_cache.h"
 #include "vm/dart_api_impl.h"
 #include "vm/heap/safepoint.h"
 #include "vm/kernel_isolate.h"
@@ -16,6 +18,8 @@
 
 namespace dart {
 
+DECLARE_FLAG(bool, baseline_optimization);
+
 ISOLATE_UNIT_TEST_CASE(CompileFunction) {
   const char* kScriptChars =
       "class A {\n"
@@ -127,6 +131,100 @@ ISOLATE_UNIT_TEST_CASE(CompileFunctionOnHelperThread) {
   EXPECT(func.HasCode());
 }
 
+ISOLATE_UNIT_TEST_CASE(BackgroundCompilerQueueOrder) {
+  const char* kScriptChars =
+      "class A {\n"
+      "  static a() { return 1; }\n"
+      "  static b() { return 2; }\n"
+      "  static c() { return 3; }\n"
+      "}\n";
+  Dart_Handle library;
+  {
+    TransitionVMToNative transition(thread);
+    library = TestCase::LoadTestScript(kScriptChars, nullptr);
+  }
+  const Library& lib =
+      Library::Handle(Library::RawCast(Api::UnwrapHandle(library)));
+  EXPECT(ClassFinalizer::ProcessPendingClasses());
+  Class& cls =
+      Class::Handle(lib.LookupClass(String::Handle(Symbols::New(thread, "A"))));
+  EXPECT(!cls.IsNull());
+  const auto& error = cls.EnsureIsFinalized(thread);
+  EXPECT(error == Error::null());
+  const Function& a = Function::Handle(
+      cls.LookupStaticFunction(String::Handle(String::New("a"))));
+  const Function& b = Function::Handle(
+      cls.LookupStaticFunction(String::Handle(String::New("b"))));
+  const Function& c = Function::Handle(
+      cls.LookupStaticFunction(String::Handle(String::New("c"))));
+
+  // Counters of enqueued functions start at INT32_MIN and count the calls
+  // made while waiting.
+  a.SetUsageCounter(INT32_MIN + 10);
+  b.SetUsageCounter(INT32_MIN + 30);
+  c.SetUsageCounter(INT32_MIN + 10);
+
+  BackgroundCompiler compiler(thread->isolate_group());
+  compiler.AddForTesting(a);
+  compiler.AddForTesting(b);
+  compiler.AddForTesting(c);
+
+  // The hottest function is taken first, ties keep FIFO order.
+  EXPECT_EQ(b.ptr(), compiler.RemoveHottestForTesting());
+
+  // A failed compilation leaves b's counter just below the optimization
+  // threshold. Requeueing it must not put it ahead of the functions which
+  // have been waiting.
+  b.SetUsageCounter(thread->isolate_group()->optimization_counter_threshold() -
+                    100);
+  compiler.RequeueForTesting(b);
+  EXPECT_EQ(INT32_MIN, b.usage_counter());
+  EXPECT_EQ(a.ptr(), compiler.RemoveHottestForTesting());
+  EXPECT_EQ(c.ptr(), compiler.RemoveHottestForTesting());
+  EXPECT_EQ(b.ptr(), compiler.RemoveHottestForTesting());
+}
+
+ISOLATE_UNIT_TEST_CASE(BaselineTierIsReplacedByFullOptimization) {
+  SetFlagScope<bool> sfs(&FLAG_baseline_optimization, true);
+  const char* kScript = R"(
+    @pragma('vm:prefer-inline')
+    int add(int a, int b) => a + b;
+    int foo(int x) => add(x, 1);
+    main() {
+      for (int i = 0; i < 10; i++) {
+        foo(i);
+      }
+    }
+  )";
+  const auto& root_library = Library::Handle(LoadTestScript(kScript));
+  const auto& function = Function::Handle(GetFunction(root_library, "foo"));
+  Invoke(root_library, "main");
+  EXPECT(!function.HasOptimizedCode());
+
+  // The first optimization goes through the baseline tier, which does not
+  // inline.
+  Compiler::CompileOptimizedFunction(thread, function);
+  EXPECT(function.HasOptimizedCode());
+  const auto& baseline_code = Code::Handle(function.CurrentCode());
+  EXPECT(baseline_code.is_optimized());
+  EXPECT_EQ(0, Array::Handle(baseline_code.inlined_id_to_function()).Length());
+
+  // Baseline code counts its invocations at the entry, so that the function
+  // is promoted once it stays hot.
+  function.SetUsageCounter(0);
+  Invoke(root_library, "main");
+  EXPECT(function.HasOptimizedCode());
+  EXPECT_EQ(baseline_code.ptr(), function.CurrentCode());
+  EXPECT_LE(10, function.usage_counter());
+
+  // Optimizing the function again uses the full pipeline.
+  Compiler::CompileOptimizedFunction(thread, function);
+  EXPECT(function.HasOptimizedCode());
+  const auto& full_code = Code::Handle(function.CurrentCode());
+  EXPECT(full_code.ptr() != baseline_code.ptr());
+  EXPECT_LT(0, Array::Handle(full_code.inlined_id_to_function()).Length());
+}
+
 ISOLATE_UNIT_TEST_CASE(RegenerateAllocStubs) {
   const char* kScriptChars =
       "class A {\n"
@@ -314,4 +412,28 @@ TEST_CASE(ManyClasses) {
 }
 #endif  // !defined(DEBUG) && !defined(USING_THREAD_SANITIZER)
 
+ISOLATE_UNIT_TEST_CASE(HotFunctionCache_IsHotInTraining) {
+  const char* kScript = R"(
+    int hot() => 1;
+    int cold() => 2;
+    int main() => hot() + cold();
+  )";
+  const auto& root_library = Library::Handle(LoadTestScript(kScript));
+  const auto& hot = Function::Handle(GetFunction(root_library, "hot"));
+  const auto& cold = Function::Handle(GetFunction(root_library, "cold"));
+  EXPECT(!HotFunctionCache::IsHotInTraining(hot));
+
+  // The AOT compiler sees different kernel than the training run, so the
+  // program hash of an entry is ignored. Lists edited on Windows are
+  // accepted and the last line need not end with a newline.
+  HotFunctionCache::LoadForTesting(OS::SCreate(
+      thread->zone(), "0badf00d %s\r\n12345678 %s",
+      hot.ToLibNamePrefixedQualifiedCString(), "unrelated::function"));
+  EXPECT(HotFunctionCache::IsHotInTraining(hot));
+  EXPECT(!HotFunctionCache::IsHotInTraining(cold));
+
+  HotFunctionCache::LoadForTesting(nullptr);
+  EXPECT(!HotFunctionCache::IsHotInTraining(hot));
+}
+
 }  // namespace dart
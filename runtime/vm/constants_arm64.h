@@ -1088,14 +1088,18 @@ enum FPIntCvtOp {
   SCVTFD = FPIntCvtFixed | B22 | B17,
 };
 
-#define APPLY_OP_LIST(_V)                                                      \
+// Instruction groups, which are split further into the leaf instruction
+// classes below.
+#define APPLY_OP_GROUP_LIST(_V)                                                \
   _V(DPImmediate)                                                              \
   _V(CompareBranch)                                                            \
   _V(LoadStore)                                                                \
   _V(DPRegister)                                                               \
   _V(DPSimd1)                                                                  \
   _V(DPSimd2)                                                                  \
-  _V(FP)                                                                       \
+  _V(FP)
+
+#define APPLY_OP_LEAF_LIST(_V)                                                 \
   _V(CompareAndBranch)                                                         \
   _V(ConditionalBranch)                                                        \
   _V(ExceptionGen)                                                             \
@@ -1129,6 +1133,10 @@ enum FPIntCvtOp {
   _V(FPImm)                                                                    \
   _V(FPIntCvt)
 
+#define APPLY_OP_LIST(_V)                                                      \
+  APPLY_OP_GROUP_LIST(_V)                                                      \
+  APPLY_OP_LEAF_LIST(_V)
+
 enum Shift {
   kNoShift = -1,
   LSL = 0,  // Logical shift left
@@ -12,6 +12,9 @@
 
 #include "vm/app_snapshot.h"
 #include "vm/code_observers.h"
+#if !defined(DART_PRECOMPILED_RUNTIME)
+#include "vm/compiler/jit/hot_function_cache.h"
+#endif
 #include "vm/compiler/runtime_offsets_extracted.h"
 #include "vm/compiler/runtime_offsets_list.h"
 #include "vm/cpu.h"
@@ -27,11 +30,14 @@
 #include "vm/heap/become.h"
 #include "vm/heap/freelist.h"
 #include "vm/heap/heap.h"
+#include "vm/heap/numa.h"
 #include "vm/heap/pointer_block.h"
 #include "vm/isolate.h"
 #include "vm/isolate_reload.h"
+#include "vm/json_writer.h"
 #include "vm/kernel_isolate.h"
 #include "vm/message_handler.h"
+#include "vm/message_snapshot.h"
 #include "vm/metrics.h"
 #include "vm/native_entry.h"
 #include "vm/native_message_handler.h"
@@ -60,6 +66,17 @@ namespace dart {
 
 DECLARE_FLAG(bool, print_class_table);
 DEFINE_FLAG(bool, trace_shutdown, false, "Trace VM shutdown on stderr");
+DEFINE_FLAG(bool,
+            print_startup_timings,
+            false,
+            "Print the time spent in each phase of VM and isolate group "
+            "startup as JSON on stderr");
+
+// Microseconds spent in phases of Dart::Init, reported with the timings of
+// each isolate group by --print_startup_timings.
+static int64_t vm_init_micros = 0;
+static int64_t read_vm_snapshot_micros = 0;
+static int64_t finalize_vm_isolate_micros = 0;
 
 Isolate* Dart::vm_isolate_ = nullptr;
 int64_t Dart::start_time_micros_ = 0;
@@ -339,12 +356,17 @@ char* Dart::DartInit(const Dart_InitializeParams* params) {
   UserTags::Init();
   PortMap::Init();
   NativeMessageHandler::Init();
+  MessageClassRegistry::Init();
   Service::Init();
   FreeListElement::Init();
   ForwardingCorpse::Init();
   Api::Init();
   NativeSymbolResolver::Init();
   Page::Init();
+  Numa::Init();
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  HotFunctionCache::Init();
+#endif
   StoreBuffer::Init();
   MarkingStack::Init();
   TargetCPUFeatures::Init();
@@ -406,6 +428,7 @@ char* Dart::DartInit(const Dart_InitializeParams* params) {
 #if defined(SUPPORT_TIMELINE)
       TimelineBeginEndScope tbes(Timeline::GetVMStream(), "ReadVMSnapshot");
 #endif
+      const int64_t read_start = OS::GetCurrentMonotonicMicros();
       ASSERT(snapshot != nullptr);
       vm_snapshot_kind_ = snapshot->kind();
 
@@ -457,6 +480,7 @@ char* Dart::DartInit(const Dart_InitializeParams* params) {
         OS::PrintErr("VM Isolate: Number of symbols : %" Pd "\n", size);
         OS::PrintErr("VM Isolate: Symbol table capacity : %" Pd "\n", capacity);
       }
+      read_vm_snapshot_micros = OS::GetCurrentMonotonicMicros() - read_start;
     } else {
 #if defined(DART_PRECOMPILED_RUNTIME)
       return Utils::StrDup(
@@ -481,7 +505,10 @@ char* Dart::DartInit(const Dart_InitializeParams* params) {
 #if defined(SUPPORT_TIMELINE)
       TimelineBeginEndScope tbes(Timeline::GetVMStream(), "FinalizeVMIsolate");
 #endif
+      const int64_t finalize_start = OS::GetCurrentMonotonicMicros();
       Object::FinalizeVMIsolate(vm_isolate_->group());
+      finalize_vm_isolate_micros =
+          OS::GetCurrentMonotonicMicros() - finalize_start;
     }
 #if defined(DEBUG)
     vm_isolate_group()->heap()->Verify("Dart::DartInit", kRequireMarked);
@@ -538,6 +565,7 @@ char* Dart::Init(const Dart_InitializeParams* params) {
     return retval;
   }
   DartInitializationState::SetInitialized();
+  vm_init_micros = UptimeMicros();
   return nullptr;
 }
 
@@ -751,6 +779,7 @@ char* Dart::Cleanup() {
   ASSERT(Isolate::IsolateListLength() == 0);
   Service::Cleanup();
   PortMap::Cleanup();
+  MessageClassRegistry::Cleanup();
   UserTags::Cleanup();
   IsolateGroup::Cleanup();
   ICData::Cleanup();
@@ -762,6 +791,10 @@ char* Dart::Cleanup() {
   StoreBuffer::Cleanup();
   Object::Cleanup();
   Page::Cleanup();
+  Numa::Cleanup();
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  HotFunctionCache::Cleanup();
+#endif
   StubCode::Cleanup();
 #if defined(SUPPORT_TIMELINE)
   if (FLAG_trace_shutdown) {
@@ -910,17 +943,40 @@ static void FinalizeBuiltinClasses(Thread* thread) {
 }
 #endif  // !defined(DART_PRECOMPILED_RUNTIME)
 
+static void PrintStartupTimings(IsolateGroup* isolate_group,
+                                bool from_snapshot,
+                                int64_t load_micros,
+                                int64_t initialize_micros) {
+  JSONWriter writer;
+  writer.OpenObject();
+  writer.PrintProperty("type", "StartupTimings");
+  writer.PrintProperty("isolateGroup", isolate_group->source()->name);
+  writer.PrintProperty64("uptimeMicros", Dart::UptimeMicros());
+  writer.PrintProperty64("vmInitMicros", vm_init_micros);
+  writer.PrintProperty64("readVMSnapshotMicros", read_vm_snapshot_micros);
+  writer.PrintProperty64("finalizeVMIsolateMicros",
+                         finalize_vm_isolate_micros);
+  writer.PrintProperty64(
+      from_snapshot ? "readProgramSnapshotMicros" : "loadKernelMicros",
+      load_micros);
+  writer.PrintProperty64("initializeIsolateGroupMicros", initialize_micros);
+  writer.CloseObject();
+  OS::PrintErr("%s\n", writer.ToCString());
+}
+
 ErrorPtr Dart::InitializeIsolateGroup(Thread* T,
                                       const uint8_t* snapshot_data,
                                       const uint8_t* snapshot_instructions,
                                       const uint8_t* kernel_buffer,
                                       intptr_t kernel_buffer_size) {
+  const int64_t start = OS::GetCurrentMonotonicMicros();
   auto& error = Error::Handle(
       InitIsolateGroupFromSnapshot(T, snapshot_data, snapshot_instructions,
                                    kernel_buffer, kernel_buffer_size));
   if (!error.IsNull()) {
     return error.ptr();
   }
+  const int64_t load_micros = OS::GetCurrentMonotonicMicros() - start;
 
   Object::VerifyBuiltinVtables();
 
@@ -949,6 +1005,13 @@ ErrorPtr Dart::InitializeIsolateGroup(Thread* T,
     IG->class_table()->Print();
   }
 
+  if (FLAG_print_startup_timings) {
+    const bool from_snapshot =
+        snapshot_data != nullptr && kernel_buffer == nullptr;
+    PrintStartupTimings(IG, from_snapshot, load_micros,
+                        OS::GetCurrentMonotonicMicros() - start);
+  }
+
   return Error::null();
 }
 
@@ -1779,6 +1779,15 @@ DART_EXPORT void Dart_NotifyIdle(int64_t deadline) {
   T->isolate()->group()->idle_time_handler()->NotifyIdle(deadline);
 }
 
+DART_EXPORT int64_t Dart_PerformIdleGCSlice(int64_t deadline) {
+  Thread* T = Thread::Current();
+  CHECK_ISOLATE(T->isolate());
+  API_TIMELINE_BEGIN_END(T);
+  TransitionNativeToVM transition(T);
+  return T->isolate()->group()->idle_time_handler()->PerformIdleSlice(
+      deadline);
+}
+
 DART_EXPORT void Dart_NotifyDestroyed() {
   Thread* T = Thread::Current();
   CHECK_ISOLATE(T->isolate());
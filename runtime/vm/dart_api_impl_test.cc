@@ -16,11 +16,18 @@
 #include "vm/dart.h"
 #include "vm/dart_api_state.h"
 #include "vm/debugger_api_impl_test.h"
+#include "vm/heap/live_heap_profile.h"
 #include "vm/heap/verifier.h"
 #include "vm/lockers.h"
 #include "vm/timeline.h"
 #include "vm/unit_test.h"
 
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID) ||            \
+    defined(DART_HOST_OS_MACOS)
+#include <sys/wait.h>  // NOLINT
+#include <unistd.h>    // NOLINT
+#endif
+
 namespace dart {
 
 DECLARE_FLAG(bool, verify_acquired_data);
@@ -9769,6 +9776,30 @@ void main() {
   EXPECT_VALID(result);
 }
 
+TEST_CASE(DartAPI_PerformIdleGCSlice) {
+  {
+    TransitionNativeToVM transition(thread);
+    GCTestHelper::CollectAllGarbage();
+    thread->heap()->StartConcurrentMarking(thread, GCReason::kDebugging);
+  }
+  // Each slice makes progress, so the collection finishes without any
+  // mutator allocation driving it.
+  int64_t remaining = 1;
+  for (intptr_t i = 0; i < 1000 && remaining != 0; i++) {
+    remaining = Dart_PerformIdleGCSlice(Dart_TimelineGetMicros() +
+                                        10 * kMicrosecondsPerMillisecond);
+    EXPECT(remaining >= 0);
+    if (remaining != 0) {
+      // Let the concurrent marker and sweeper tasks run too.
+      OS::Sleep(1);
+    }
+  }
+  EXPECT_EQ(0, remaining);
+  // Slices never start a new collection.
+  EXPECT_EQ(0, Dart_PerformIdleGCSlice(Dart_TimelineGetMicros() +
+                                       10 * kMicrosecondsPerMillisecond));
+}
+
 static void NotifyDestroyedNative(Dart_NativeArguments args) {
   Dart_NotifyDestroyed();
 }
@@ -10390,6 +10421,61 @@ TEST_CASE(DartAPI_HeapSampling_UserDefinedClass) {
   Dart_EnterIsolate(isolate);
 }
 
+#if !defined(PRODUCT)
+TEST_CASE(DartAPI_LiveHeapProfile) {
+  DisableBackgroundCompilationScope scope;
+  const char* kScriptChars = R"(
+    class Bar {}
+    final list = [];
+    foo() {
+      for (int i = 0; i < 100000; ++i) {
+        list.add(Bar());
+      }
+    }
+    clear() {
+      list.clear();
+    }
+    )";
+
+  Dart_Handle lib = TestCase::LoadTestScript(kScriptChars, nullptr);
+  EXPECT_VALID(lib);
+
+  if (!LiveHeapProfile::Enable(true)) {
+    // Another test in this process registered embedder callbacks.
+    return;
+  }
+  Dart_SetHeapSamplingPeriod(1 * KB);
+  HandleInterrupts(thread);
+
+  int64_t before = LiveHeapProfile::LiveBytes();
+  Dart_Handle result = Dart_Invoke(lib, NewString("foo"), 0, nullptr);
+  EXPECT_VALID(result);
+  int64_t retained = LiveHeapProfile::LiveBytes();
+  EXPECT(retained > before);
+  {
+    JSONStream js;
+    LiveHeapProfile::PrintJSON(&js);
+    EXPECT_SUBSTRING("\"type\":\"_LiveHeapProfile\"", js.ToCString());
+    EXPECT_SUBSTRING("\"inuse_space\"", js.ToCString());
+    EXPECT_SUBSTRING("\"foo\"", js.ToCString());
+    EXPECT_SUBSTRING("\"Bar\"", js.ToCString());
+  }
+
+  result = Dart_Invoke(lib, NewString("clear"), 0, nullptr);
+  EXPECT_VALID(result);
+  {
+    TransitionNativeToVM transition(thread);
+    GCTestHelper::CollectAllGarbage();
+  }
+  // The Bar samples died with their objects.
+  EXPECT(LiveHeapProfile::LiveBytes() < retained);
+
+  LiveHeapProfile::Enable(false);
+  Dart_SetHeapSamplingPeriod(512 * KB);
+  HandleInterrupts(thread);
+}
+#endif  // !defined(PRODUCT)
+
 TEST_CASE(DartAPI_HeapSampling_APIAllocations) {
   InitHeapSampling(thread, "List");
 
@@ -10577,4 +10663,64 @@ TEST_CASE(DartAPI_WriteHeapSnapshot) {
 }
 #endif  // defined(DART_ENABLE_HEAP_SNAPSHOT_WRITER)
 
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID) ||            \
+    defined(DART_HOST_OS_MACOS)
+static intptr_t secure_random_fills = 0;
+
+// Fills the whole buffer with the number of the fill, so every byte tells
+// which fill it came from.
+static bool CountingEntropySource(uint8_t* buffer, intptr_t length) {
+  secure_random_fills++;
+  memset(buffer, static_cast<uint8_t>(secure_random_fills), length);
+  return true;
+}
+
+TEST_CASE(DartAPI_SecureRandomAfterFork) {
+  const char* kScriptChars =
+      "import 'dart:math';\n"
+      "final rng = Random.secure();\n"
+      "int draw() => rng.nextInt(256);\n";
+  Dart_EntropySource saved_source = Dart::entropy_source_callback();
+  Dart::set_entropy_source_callback(CountingEntropySource);
+  secure_random_fills = 0;
+
+  Dart_Handle lib = TestCase::LoadTestScript(kScriptChars, nullptr);
+  EXPECT_VALID(lib);
+  int64_t value = -1;
+  Dart_Handle result = Dart_Invoke(lib, NewString("draw"), 0, nullptr);
+  EXPECT_VALID(result);
+  EXPECT_VALID(Dart_IntegerToInt64(result, &value));
+  const int64_t fill = value;
+  const int64_t fills_before_fork = secure_random_fills;
+
+  const pid_t pid = fork();
+  if (pid == 0) {
+    // The child must not keep handing out the bytes left in the buffer it
+    // inherited from the parent.
+    result = Dart_Invoke(lib, NewString("draw"), 0, nullptr);
+    int64_t child_value = -1;
+    if (Dart_IsError(result) ||
+        Dart_IsError(Dart_IntegerToInt64(result, &child_value))) {
+      _exit(255);
+    }
+    _exit(static_cast<int>(child_value));
+  }
+  EXPECT(pid > 0);
+
+  result = Dart_Invoke(lib, NewString("draw"), 0, nullptr);
+  EXPECT_VALID(result);
+  EXPECT_VALID(Dart_IntegerToInt64(result, &value));
+  // The parent keeps using the bytes of its current fill.
+  EXPECT_EQ(fill, value);
+
+  int status = 0;
+  EXPECT_EQ(pid, waitpid(pid, &status, 0));
+  EXPECT(WIFEXITED(status));
+  // The child refilled its buffer.
+  EXPECT_EQ(fills_before_fork + 1, WEXITSTATUS(status));
+
+  Dart::set_entropy_source_callback(saved_source);
+}
+#endif  // defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID) || ...
+
 }  // namespace dart
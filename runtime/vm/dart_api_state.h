@@ -232,8 +232,9 @@ class FinalizablePersistentHandle {
     if (SpaceForExternal() == Heap::kNew) {
       SetExternalNewSpaceBit();
     }
-    return isolate_group->heap()->AllocatedExternal(external_size(),
-                                                    SpaceForExternal());
+    external_kind_ = KindForExternal();
+    return isolate_group->heap()->AllocatedExternal(
+        external_size(), SpaceForExternal(), external_kind_);
   }
 
   // Called when the referent becomes unreachable.
@@ -245,7 +246,7 @@ class FinalizablePersistentHandle {
   // Called when the referent has moved, potentially between generations.
   void UpdateRelocated(IsolateGroup* isolate_group) {
     if (IsSetNewSpaceBit() && (SpaceForExternal() == Heap::kOld)) {
-      isolate_group->heap()->PromotedExternal(external_size());
+      isolate_group->heap()->PromotedExternal(external_size(), external_kind_);
       ClearExternalNewSpaceBit();
     }
   }
@@ -253,7 +254,8 @@ class FinalizablePersistentHandle {
   // Idempotent. Called when the handle is explicitly deleted or the
   // referent becomes unreachable.
   void EnsureFreedExternal(IsolateGroup* isolate_group) {
-    isolate_group->heap()->FreedExternal(external_size(), SpaceForExternal());
+    isolate_group->heap()->FreedExternal(external_size(), SpaceForExternal(),
+                                         external_kind_);
     set_external_size(0);
   }
 
@@ -272,7 +274,11 @@ class FinalizablePersistentHandle {
   friend class FinalizablePersistentHandles;
 
   FinalizablePersistentHandle()
-      : ptr_(nullptr), peer_(nullptr), external_data_(0), callback_(nullptr) {}
+      : ptr_(nullptr),
+        peer_(nullptr),
+        external_data_(0),
+        callback_(nullptr),
+        external_kind_(Heap::ExternalKind::kApi) {}
   ~FinalizablePersistentHandle() {}
 
   static void Finalize(IsolateGroup* isolate_group,
@@ -305,6 +311,7 @@ class FinalizablePersistentHandle {
     external_data_ = 0;
     callback_ = nullptr;
     auto_delete_ = false;
+    external_kind_ = Heap::ExternalKind::kApi;
   }
 
   void set_ptr(ObjectPtr raw) { ptr_ = raw; }
@@ -342,11 +349,25 @@ class FinalizablePersistentHandle {
     return ptr_->IsImmediateOrOldObject() ? Heap::kOld : Heap::kNew;
   }
 
+  // Returns the kind to account the external size to.
+  Heap::ExternalKind KindForExternal() const {
+    if (ptr_->IsHeapObject()) {
+      const intptr_t cid = ptr_->GetClassIdOfHeapObject();
+      if (IsExternalTypedDataClassId(cid) ||
+          (cid == kTransferableTypedDataCid)) {
+        return Heap::ExternalKind::kTypedData;
+      }
+    }
+    return Heap::ExternalKind::kApi;
+  }
+
   ObjectPtr ptr_;
   void* peer_;
   uword external_data_;
   Dart_HandleFinalizer callback_;
   bool auto_delete_;
+  // The kind the external size was accounted to, fixed when the size is set.
+  Heap::ExternalKind external_kind_;
 
   DISALLOW_ALLOCATION();  // Allocated through AllocateHandle methods.
   DISALLOW_COPY_AND_ASSIGN(FinalizablePersistentHandle);
@@ -1512,11 +1512,43 @@ bool Debugger::SetResumeAction(ResumeAction action,
   }
 }
 
-// Deoptimize all functions in the isolate.
-// TODO(hausner): Actually we only need to deoptimize those functions
-// that inline the function that contains the newly created breakpoint.
-// We currently don't have this info so we deoptimize all functions.
-void Debugger::DeoptimizeWorld() {
+#if !defined(DART_PRECOMPILED_RUNTIME)
+// Returns whether |function| is one of |targets| or has optimized code that
+// inlines one of them.
+static bool IsOrInlinesAnyOf(const Function& function,
+                             const GrowableObjectArray& targets,
+                             Code* code,
+                             Array* inlined) {
+  const intptr_t num_targets = targets.Length();
+  for (intptr_t i = 0; i < num_targets; i++) {
+    if (targets.At(i) == function.ptr()) {
+      return true;
+    }
+  }
+  if (!function.HasOptimizedCode()) {
+    return false;
+  }
+  *code = function.CurrentCode();
+  *inlined = code->inlined_id_to_function();
+  if (inlined->IsNull()) {
+    return false;
+  }
+  for (intptr_t i = 0; i < inlined->Length(); i++) {
+    for (intptr_t j = 0; j < num_targets; j++) {
+      if (inlined->At(i) == targets.At(j)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+
+// Deoptimize all functions in the isolate, or if |targets| is given, only
+// the functions that are or inline one of |targets|. The compiler does not
+// optimize or inline functions with breakpoints, so code created later does
+// not need to be considered.
+void Debugger::DeoptimizeWorld(const GrowableObjectArray* targets) {
 #if defined(DART_PRECOMPILED_RUNTIME)
   UNREACHABLE();
 #else
@@ -1538,6 +1570,26 @@ void Debugger::DeoptimizeWorld() {
   Array& functions = Array::Handle(zone);
   Function& function = Function::Handle(zone);
   Code& code = Code::Handle(zone);
+  Array& inlined = Array::Handle(zone);
+
+  auto deoptimize = [&](const Function& function) {
+    // Force-optimized functions don't have unoptimized code and can't
+    // deoptimize. Their optimized codes are still valid.
+    if (function.ForceOptimize()) {
+      return;
+    }
+    if (targets != nullptr &&
+        !IsOrInlinesAnyOf(function, *targets, &code, &inlined)) {
+      return;
+    }
+    if (function.HasOptimizedCode()) {
+      function.SwitchToUnoptimizedCode();
+    }
+    code = function.unoptimized_code();
+    if (!code.IsNull()) {
+      resetter.ResetSwitchableCalls(code);
+    }
+  };
 
   const intptr_t num_classes = class_table.NumCids();
   const intptr_t num_tlc_classes = class_table.NumTopLevelCids();
@@ -1555,29 +1607,11 @@ void Debugger::DeoptimizeWorld() {
         for (intptr_t pos = 0; pos < num_functions; pos++) {
           function ^= functions.At(pos);
           ASSERT(!function.IsNull());
-          // Force-optimized functions don't have unoptimized code and can't
-          // deoptimize. Their optimized codes are still valid.
-          if (!function.ForceOptimize()) {
-            if (function.HasOptimizedCode()) {
-              function.SwitchToUnoptimizedCode();
-            }
-            code = function.unoptimized_code();
-            if (!code.IsNull()) {
-              resetter.ResetSwitchableCalls(code);
-            }
-          }
+          deoptimize(function);
           // Also disable any optimized implicit closure functions.
           if (function.HasImplicitClosureFunction()) {
             function = function.ImplicitClosureFunction();
-            if (!function.ForceOptimize()) {
-              if (function.HasOptimizedCode()) {
-                function.SwitchToUnoptimizedCode();
-              }
-              code = function.unoptimized_code();
-              if (!code.IsNull()) {
-                resetter.ResetSwitchableCalls(code);
-              }
-            }
+            deoptimize(function);
           }
         }
       }
@@ -1586,27 +1620,21 @@ void Debugger::DeoptimizeWorld() {
 
   // Disable optimized closure functions.
   ClosureFunctionsCache::ForAllClosureFunctions([&](const Function& function) {
-    if (!function.ForceOptimize()) {
-      if (function.HasOptimizedCode()) {
-        function.SwitchToUnoptimizedCode();
-      }
-      code = function.unoptimized_code();
-      if (!code.IsNull()) {
-        resetter.ResetSwitchableCalls(code);
-      }
-    }
+    deoptimize(function);
     return true;  // Continue iteration.
   });
 #endif  // defined(DART_PRECOMPILED_RUNTIME)
 }
 
-void Debugger::RunWithStoppedDeoptimizedWorld(std::function<void()> fun) {
+void Debugger::RunWithStoppedDeoptimizedWorld(
+    std::function<void()> fun,
+    const GrowableObjectArray* targets) {
 #if !defined(DART_PRECOMPILED_RUNTIME)
   // RELOAD_OPERATION_SCOPE is used here because is is guaranteed that
   // isolates at reload safepoints hold no safepoint locks.
   RELOAD_OPERATION_SCOPE(Thread::Current());
   group_debugger()->isolate_group()->RunWithStoppedMutators([&]() {
-    DeoptimizeWorld();
+    DeoptimizeWorld(targets);
     fun();
   });
 #endif
@@ -2715,12 +2743,15 @@ ErrorPtr Debugger::SetBreakpoint(
       BreakpointLocation* loc = nullptr;
       // Ensure that code stays deoptimized (and background compiler disabled)
       // until we have installed the breakpoint (at which point the compiler
-      // will not try to optimize it anymore).
-      RunWithStoppedDeoptimizedWorld([&] {
-        loc = SetCodeBreakpoints(scripts, token_pos, last_token_pos,
-                                 requested_line, requested_column,
-                                 exact_token_pos, code_functions);
-      });
+      // will not try to optimize it anymore). Only code that contains the
+      // functions of the breakpoint needs to be deoptimized.
+      RunWithStoppedDeoptimizedWorld(
+          [&] {
+            loc = SetCodeBreakpoints(scripts, token_pos, last_token_pos,
+                                     requested_line, requested_column,
+                                     exact_token_pos, code_functions);
+          },
+          &code_functions);
       if (loc != nullptr) {
         *result_breakpoint_location = loc;
         return Error::null();
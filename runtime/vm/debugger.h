@@ -843,8 +843,10 @@ class Debugger {
                    TokenPosition token_pos,
                    TokenPosition last_token_pos,
                    Function* best_fit);
-  void DeoptimizeWorld();
-  void RunWithStoppedDeoptimizedWorld(std::function<void()> fun);
+  void DeoptimizeWorld(const GrowableObjectArray* targets = nullptr);
+  void RunWithStoppedDeoptimizedWorld(
+      std::function<void()> fun,
+      const GrowableObjectArray* targets = nullptr);
   void NotifySingleStepping(bool value);
   BreakpointLocation* SetCodeBreakpoints(
       const GrowableHandlePtrArray<const Script>& scripts,
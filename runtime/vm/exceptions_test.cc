@@ -4,6 +4,7 @@
 
 #include "include/dart_api.h"
 #include "platform/assert.h"
+#include "platform/text_buffer.h"
 #include "vm/dart_api_impl.h"
 #include "vm/unit_test.h"
 
@@ -125,4 +126,38 @@ TEST_CASE(UnhandledExceptions) {
   EXPECT_VALID(Dart_Invoke(lib, NewString("testMain"), 0, nullptr));
 }
 
+// Throwing through more frames outside of try blocks than the caches hold
+// must not evict the handler found for the frame that catches.
+TEST_CASE(ExceptionHandlerCacheNotInTryBlock) {
+  const intptr_t kFrames = 20;
+  TextBuffer script(1024);
+  script.AddString("int count = 0;\n");
+  for (intptr_t i = 0; i < kFrames; i++) {
+    script.Printf("void f%" Pd "() {\n", i);
+    script.AddString("  try { count++; } catch (_) { count--; }\n");
+    if (i < kFrames - 1) {
+      script.Printf("  f%" Pd "();\n", i + 1);
+    } else {
+      script.AddString("  throw 'x';\n");
+    }
+    script.AddString("}\n");
+  }
+  script.AddString(
+      "void testMain() {\n"
+      "  for (int i = 0; i < 3; i++) {\n"
+      "    try { f0(); } catch (e) { count++; }\n"
+      "  }\n"
+      "}\n");
+  Dart_Handle lib = TestCase::LoadTestScript(script.buffer(), nullptr);
+  EXPECT_VALID(lib);
+
+  Isolate* isolate = Isolate::Current();
+  isolate->handler_info_cache()->Clear();
+  isolate->not_in_try_block_cache()->Clear();
+  EXPECT_VALID(Dart_Invoke(lib, NewString("testMain"), 0, nullptr));
+  // Only testMain's frame is inside a try block.
+  EXPECT_EQ(1, isolate->handler_info_cache()->Length());
+  EXPECT_EQ(16, isolate->not_in_try_block_cache()->Length());
+}
+
 }  // namespace dart
@@ -64,6 +64,11 @@ class FixedCache {
     length_ = 0;
   }
 
+  intptr_t Length() {
+    MutexLocker ml(&mutex_);
+    return length_;
+  }
+
  private:
   intptr_t LowerBound(K key) {
     intptr_t low = 0, high = length_;
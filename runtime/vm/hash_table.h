@@ -777,10 +777,12 @@ class HashMap : public BaseIterTable {
   }
 };
 
-template <typename KeyTraits>
-class UnorderedHashMap : public HashMap<UnorderedHashTable<KeyTraits, 1> > {
+template <typename KeyTraits, typename TableStorageTraits = ArrayStorageTraits>
+class UnorderedHashMap
+    : public HashMap<UnorderedHashTable<KeyTraits, 1, TableStorageTraits> > {
  public:
-  typedef HashMap<UnorderedHashTable<KeyTraits, 1> > BaseMap;
+  typedef HashMap<UnorderedHashTable<KeyTraits, 1, TableStorageTraits> >
+      BaseMap;
   explicit UnorderedHashMap(ArrayPtr data)
       : BaseMap(Thread::Current()->zone(), data) {}
   UnorderedHashMap(Zone* zone, ArrayPtr data) : BaseMap(zone, data) {}
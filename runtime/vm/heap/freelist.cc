@@ -5,6 +5,7 @@
 #include "vm/heap/freelist.h"
 
 #include "vm/bit_set.h"
+#include "vm/flags.h"
 #include "vm/hash_map.h"
 #include "vm/lockers.h"
 #include "vm/object.h"
@@ -13,6 +14,8 @@
 
 namespace dart {
 
+DECLARE_FLAG(bool, old_space_thread_caches);
+
 FreeListElement* FreeListElement::AsElement(uword addr, intptr_t size) {
   // Precondition: the (page containing the) header of the element is
   // writable.
@@ -79,11 +82,81 @@ FreeList::FreeList() : mutex_() {
 
 FreeList::~FreeList() {}
 
+// Takes the lock on behalf of an allocating thread. Contention is only
+// counted with --old_space_thread_caches, which the counts are reported for,
+// so the default allocation path does not pay for the atomic updates.
+class FreeList::AllocationLocker : public ValueObject {
+ public:
+  explicit AllocationLocker(FreeList* freelist)
+      : freelist_(freelist), counted_(FLAG_old_space_thread_caches) {
+    if (counted_) {
+      if (freelist_->lock_users_.fetch_add(1) != 0) {
+        freelist_->lock_contentions_.fetch_add(1);
+      }
+      freelist_->lock_acquisitions_.fetch_add(1);
+    }
+    freelist_->mutex_.Lock();
+  }
+  ~AllocationLocker() {
+    freelist_->mutex_.Unlock();
+    if (counted_) {
+      freelist_->lock_users_.fetch_sub(1);
+    }
+  }
+
+ private:
+  FreeList* freelist_;
+  const bool counted_;
+
+  DISALLOW_COPY_AND_ASSIGN(AllocationLocker);
+};
+
 uword FreeList::TryAllocate(intptr_t size, bool is_protected) {
-  MutexLocker ml(&mutex_);
+  AllocationLocker ml(this);
   return TryAllocateLocked(size, is_protected);
 }
 
+uword FreeList::TryAllocateAndRefill(intptr_t size, FreeListCache* cache) {
+  ASSERT(FreeListCache::Handles(size));
+  ASSERT(cache->owner_ == nullptr || cache->owner_ == this);
+  AllocationLocker ml(this);
+  // Carve the batch out of one element so the cached objects are contiguous.
+  const intptr_t batch_size = size * (FreeListCache::kRefillCount + 1);
+  uword batch = TryAllocateLocked(batch_size, /*is_protected=*/false);
+  if (batch == 0) {
+    return TryAllocateLocked(size, /*is_protected=*/false);
+  }
+  cache_refills_.fetch_add(1);
+  cache->owner_ = this;
+  const intptr_t index = size >> kObjectAlignmentLog2;
+  // Push in reverse so the cache hands out ascending addresses.
+  for (intptr_t i = FreeListCache::kRefillCount; i > 0; i--) {
+    cache->Push(FreeListElement::AsElement(batch + i * size, size), index);
+  }
+  return batch;
+}
+
+void FreeList::Flush(FreeListCache* cache) {
+  if (cache->owner_ == nullptr) {
+    ASSERT(cache->IsEmpty());
+    return;
+  }
+  ASSERT(cache->owner_ == this);
+  MutexLocker ml(&mutex_);
+  for (intptr_t index = 0; index < FreeListCache::kNumSizeClasses; index++) {
+    FreeListElement* element = cache->lists_[index];
+    while (element != nullptr) {
+      FreeListElement* next = element->next();
+      EnqueueElement(element, index);
+      element = next;
+    }
+    cache->lists_[index] = nullptr;
+  }
+  cache_hits_.fetch_add(cache->hits_);
+  cache->hits_ = 0;
+  cache->owner_ = nullptr;
+}
+
 uword FreeList::TryAllocateLocked(intptr_t size, bool is_protected) {
   DEBUG_ASSERT(mutex_.IsOwnedByCurrentThread());
   // Precondition: is_protected is false or else all free list elements are
@@ -76,12 +76,78 @@ class FreeListElement {
   DISALLOW_IMPLICIT_CONSTRUCTORS(FreeListElement);
 };
 
+class FreeList;
+
+// A thread-local cache of small free-list elements, segregated by size.
+//
+// The cache is refilled in batches from a shared FreeList so that most small
+// old-space allocations by a mutator do not take the shared list's lock. The
+// owning thread allocates from it without synchronization. Cached memory is
+// still formatted as FreeListElements, so the heap stays iterable, but it
+// must be returned to the shared list before the sweeper or compactor
+// rebuilds free lists: it is flushed when the thread is suspended and by the
+// GC at the start of every old-space collection.
+class FreeListCache {
+ public:
+  static constexpr intptr_t kNumSizeClasses = 16;
+  static constexpr intptr_t kRefillCount = 8;
+
+  FreeListCache() {}
+  ~FreeListCache() { ASSERT(IsEmpty()); }
+
+  static bool Handles(intptr_t size) {
+    return (size >> kObjectAlignmentLog2) < kNumSizeClasses;
+  }
+
+  DART_FORCE_INLINE
+  uword TryAllocate(intptr_t size) {
+    ASSERT(Handles(size));
+    ASSERT(Utils::IsAligned(size, kObjectAlignment));
+    intptr_t index = size >> kObjectAlignmentLog2;
+    FreeListElement* element = lists_[index];
+    if (element == nullptr) {
+      return 0;
+    }
+    lists_[index] = element->next();
+    hits_++;
+    return reinterpret_cast<uword>(element);
+  }
+
+  bool IsEmpty() const {
+    for (intptr_t i = 0; i < kNumSizeClasses; i++) {
+      if (lists_[i] != nullptr) return false;
+    }
+    return true;
+  }
+
+ private:
+  void Push(FreeListElement* element, intptr_t index) {
+    element->set_next(lists_[index]);
+    lists_[index] = element;
+  }
+
+  FreeListElement* lists_[kNumSizeClasses] = {};
+  // The shared list the cached elements came from.
+  FreeList* owner_ = nullptr;
+  // Allocations served by the cache since the last flush.
+  intptr_t hits_ = 0;
+
+  friend class FreeList;
+  DISALLOW_COPY_AND_ASSIGN(FreeListCache);
+};
+
 class FreeList {
  public:
   FreeList();
   ~FreeList();
 
   uword TryAllocate(intptr_t size, bool is_protected);
+
+  // Allocates an unprotected small object of 'size' and moves up to
+  // FreeListCache::kRefillCount more elements of the same size into 'cache'.
+  uword TryAllocateAndRefill(intptr_t size, FreeListCache* cache);
+  // Returns all elements in 'cache' to this list.
+  void Flush(FreeListCache* cache);
   void Free(uword addr, intptr_t size);
 
   void Reset();
@@ -162,7 +228,17 @@ class FreeList {
   void set_end(uword value) { end_ = value; }
   void AddUnaccountedSize(intptr_t size) { unaccounted_size_ += size; }
 
+  // Counters for the lock taken by mutator allocation, maintained only with
+  // --old_space_thread_caches. A contention is an acquisition that found
+  // another allocating thread holding or waiting for the lock.
+  int64_t lock_acquisitions() const { return lock_acquisitions_; }
+  int64_t lock_contentions() const { return lock_contentions_; }
+  int64_t cache_hits() const { return cache_hits_; }
+  int64_t cache_refills() const { return cache_refills_; }
+
  private:
+  class AllocationLocker;
+
   static constexpr int kNumLists = 128;
   static constexpr intptr_t kInitialFreeListSearchBudget = 1000;
 
@@ -224,6 +300,12 @@ class FreeList {
   // The largest available small size in bytes, or negative if there is none.
   intptr_t last_free_small_size_;
 
+  RelaxedAtomic<intptr_t> lock_users_ = {0};
+  RelaxedAtomic<int64_t> lock_acquisitions_ = {0};
+  RelaxedAtomic<int64_t> lock_contentions_ = {0};
+  RelaxedAtomic<int64_t> cache_hits_ = {0};
+  RelaxedAtomic<int64_t> cache_refills_ = {0};
+
   friend class GCIncrementalCompactor;
   friend class PrologueTask;
 
@@ -11,6 +11,8 @@
 
 namespace dart {
 
+DECLARE_FLAG(bool, old_space_thread_caches);
+
 static uword Allocate(FreeList* free_list, intptr_t size, bool is_protected) {
   uword result = free_list->TryAllocate(size, is_protected);
   if ((result != 0u) && is_protected) {
@@ -234,4 +236,52 @@ TEST_CASE(Regress38528) {
   }
 }
 
+TEST_CASE(FreeListCacheRefillAndFlush) {
+  SetFlagScope<bool> sfs(&FLAG_old_space_thread_caches, true);
+  std::unique_ptr<FreeList> free_list(new FreeList());
+  std::unique_ptr<VirtualMemory> blob(VirtualMemory::Allocate(
+      VirtualMemory::PageSize(),
+      /*is_executable=*/false, /*is_compressed=*/false, "test"));
+  free_list->Free(blob->start(), blob->size());
+
+  const intptr_t kObjectSize = 4 * kWordSize;
+  FreeListCache cache;
+  EXPECT_EQ(0u, cache.TryAllocate(kObjectSize));
+
+  // The first allocation refills the cache from one contiguous batch.
+  uword first = free_list->TryAllocateAndRefill(kObjectSize, &cache);
+  EXPECT_EQ(blob->start(), first);
+  EXPECT_EQ(1, free_list->cache_refills());
+  for (intptr_t i = 1; i <= FreeListCache::kRefillCount; i++) {
+    EXPECT_EQ(first + i * kObjectSize, cache.TryAllocate(kObjectSize));
+  }
+  EXPECT_EQ(0u, cache.TryAllocate(kObjectSize));
+  EXPECT(cache.IsEmpty());
+
+  // Flushed elements are available to the shared list again.
+  uword second = free_list->TryAllocateAndRefill(kObjectSize, &cache);
+  EXPECT(!cache.IsEmpty());
+  free_list->Flush(&cache);
+  EXPECT(cache.IsEmpty());
+  EXPECT_EQ(FreeListCache::kRefillCount, free_list->cache_hits());
+  EXPECT_EQ(second + FreeListCache::kRefillCount * kObjectSize,
+            free_list->TryAllocate(kObjectSize, /*is_protected=*/false));
+  EXPECT_EQ(3, free_list->lock_acquisitions());
+  EXPECT_EQ(0, free_list->lock_contentions());
+}
+
+TEST_CASE(FreeListLockNotCountedWithoutThreadCaches) {
+  SetFlagScope<bool> sfs(&FLAG_old_space_thread_caches, false);
+  std::unique_ptr<FreeList> free_list(new FreeList());
+  std::unique_ptr<VirtualMemory> blob(VirtualMemory::Allocate(
+      VirtualMemory::PageSize(),
+      /*is_executable=*/false, /*is_compressed=*/false, "test"));
+  free_list->Free(blob->start(), blob->size());
+
+  EXPECT_EQ(blob->start(),
+            free_list->TryAllocate(4 * kWordSize, /*is_protected=*/false));
+  EXPECT_EQ(0, free_list->lock_acquisitions());
+  EXPECT_EQ(0, free_list->lock_contentions());
+}
+
 }  // namespace dart
@@ -20,6 +20,8 @@
 
 namespace dart {
 
+DECLARE_FLAG(bool, defer_native_finalizers);
+
 // These object types have a linked list chaining all pending objects when
 // processing these in the GC.
 // The field should not be visited by pointer visitors.
@@ -132,14 +134,19 @@ void RunNativeFinalizerCallback(NativeFinalizerPtr raw_finalizer,
                       raw_finalizer->untag(), callback, peer);
     }
     raw_entry.untag()->set_token(raw_entry);
-    (*callback)(peer);
+    if (FLAG_defer_native_finalizers) {
+      visitor->isolate_group()->heap()->DeferNativeFinalizerCallback(callback,
+                                                                     peer);
+    } else {
+      (*callback)(peer);
+    }
     if (external_size > 0) {
       if (FLAG_trace_finalizers) {
         TRACE_FINALIZER("Clearing external size %" Pd " bytes in %s space",
                         external_size, before_gc_space == 0 ? "new" : "old");
       }
-      visitor->isolate_group()->heap()->FreedExternal(external_size,
-                                                      before_gc_space);
+      visitor->isolate_group()->heap()->FreedExternal(
+          external_size, before_gc_space, Heap::ExternalKind::kFfi);
       raw_entry->untag()->set_external_size(0);
     }
   }
@@ -174,7 +181,8 @@ void MournFinalizerEntry(GCVisitorType* visitor,
       TRACE_FINALIZER("Promoting external size %" Pd
                       " bytes from new to old space",
                       external_size);
-      visitor->isolate_group()->heap()->PromotedExternal(external_size);
+      visitor->isolate_group()->heap()->PromotedExternal(
+          external_size, Heap::ExternalKind::kFfi);
     }
   }
   GCVisitorType::ForwardOrSetNullIfCollected(current_entry,
@@ -13,6 +13,7 @@
 #include "vm/dart.h"
 #include "vm/flags.h"
 #include "vm/heap/incremental_compactor.h"
+#include "vm/heap/numa.h"
 #include "vm/heap/pages.h"
 #include "vm/heap/safepoint.h"
 #include "vm/heap/scavenger.h"
@@ -40,6 +41,15 @@ DEFINE_FLAG(bool,
             disable_heap_verification,
             false,
             "Explicitly disable heap verification.");
+DEFINE_FLAG(bool,
+            defer_native_finalizers,
+            false,
+            "Run NativeFinalizer callbacks on a thread pool task after the GC "
+            "that found them, instead of during its pause.");
+
+// The window of heap.mutator.utilization.min.
+static constexpr int64_t kMutatorUtilizationWindowMicros =
+    10 * kMicrosecondsPerMillisecond;
 
 Heap::Heap(IsolateGroup* isolate_group,
            bool is_vm_isolate,
@@ -51,7 +61,8 @@ Heap::Heap(IsolateGroup* isolate_group,
       old_space_(this, max_old_gen_words),
       read_only_(false),
       assume_scavenge_will_fail_(false),
-      gc_on_nth_allocation_(kNoForcedGarbageCollection) {
+      gc_on_nth_allocation_(kNoForcedGarbageCollection),
+      native_finalizer_backlog_(std::make_shared<RelaxedAtomic<intptr_t>>(0)) {
   UpdateGlobalMaxUsed();
   for (int sel = 0; sel < kNumWeakSelectors; sel++) {
     new_weak_tables_[sel] = new WeakTable();
@@ -74,6 +85,9 @@ Heap::~Heap() {
     delete new_weak_tables_[sel];
     delete old_weak_tables_[sel];
   }
+
+  // Callbacks are handed off at the end of each GC, so none should be left.
+  ASSERT(deferred_native_finalizers_ == nullptr);
 }
 
 uword Heap::AllocateNew(Thread* thread, intptr_t size) {
@@ -177,7 +191,7 @@ uword Heap::AllocateOld(Thread* thread, intptr_t size, bool is_exec) {
   return 0;
 }
 
-bool Heap::AllocatedExternal(intptr_t size, Space space) {
+bool Heap::AllocatedExternal(intptr_t size, Space space, ExternalKind kind) {
   if (space == kNew) {
     if (!new_space_.AllocatedExternal(size)) {
       return false;
@@ -188,6 +202,8 @@ bool Heap::AllocatedExternal(intptr_t size, Space space) {
       return false;
     }
   }
+  external_by_kind_[SpaceIndexForExternal(space)][static_cast<intptr_t>(kind)]
+      .fetch_add(size);
 
   Thread* thread = Thread::Current();
   if ((thread->no_callback_scope_depth() == 0) && !thread->force_growth()) {
@@ -198,18 +214,83 @@ bool Heap::AllocatedExternal(intptr_t size, Space space) {
   return true;
 }
 
-void Heap::FreedExternal(intptr_t size, Space space) {
+void Heap::FreedExternal(intptr_t size, Space space, ExternalKind kind) {
   if (space == kNew) {
     new_space_.FreedExternal(size);
   } else {
     ASSERT(space == kOld);
     old_space_.FreedExternal(size);
   }
+  external_by_kind_[SpaceIndexForExternal(space)][static_cast<intptr_t>(kind)]
+      .fetch_sub(size);
 }
 
-void Heap::PromotedExternal(intptr_t size) {
+void Heap::PromotedExternal(intptr_t size, ExternalKind kind) {
   new_space_.FreedExternal(size);
   old_space_.AllocatedExternal(size);
+  const intptr_t k = static_cast<intptr_t>(kind);
+  external_by_kind_[SpaceIndexForExternal(kNew)][k].fetch_sub(size);
+  external_by_kind_[SpaceIndexForExternal(kOld)][k].fetch_add(size);
+}
+
+class Heap::NativeFinalizerTask : public ThreadPool::Task {
+ public:
+  NativeFinalizerTask(MallocGrowableArray<DeferredNativeFinalizer>* callbacks,
+                      std::shared_ptr<RelaxedAtomic<intptr_t>> backlog)
+      : callbacks_(callbacks), backlog_(std::move(backlog)) {}
+
+  // The thread pool deletes tasks it refuses to run when it is shutting down,
+  // so the callbacks still run in that case.
+  ~NativeFinalizerTask() { RunCallbacks(); }
+
+  void Run() { RunCallbacks(); }
+
+ private:
+  void RunCallbacks() {
+    if (callbacks_ == nullptr) return;
+    if (FLAG_trace_finalizers) {
+      OS::PrintErr("Running %" Pd " deferred native finalizers\n",
+                   callbacks_->length());
+    }
+    for (intptr_t i = 0; i < callbacks_->length(); i++) {
+      const DeferredNativeFinalizer& entry = callbacks_->At(i);
+      entry.callback(entry.peer);
+      backlog_->fetch_sub(1);
+    }
+    delete callbacks_;
+    callbacks_ = nullptr;
+  }
+
+  MallocGrowableArray<DeferredNativeFinalizer>* callbacks_;
+  std::shared_ptr<RelaxedAtomic<intptr_t>> backlog_;
+
+  DISALLOW_COPY_AND_ASSIGN(NativeFinalizerTask);
+};
+
+void Heap::DeferNativeFinalizerCallback(void (*callback)(void*), void* peer) {
+  MutexLocker ml(&deferred_native_finalizers_mutex_);
+  if (deferred_native_finalizers_ == nullptr) {
+    deferred_native_finalizers_ =
+        new MallocGrowableArray<DeferredNativeFinalizer>();
+  }
+  deferred_native_finalizers_->Add({callback, peer});
+  native_finalizer_backlog_->fetch_add(1);
+}
+
+void Heap::ScheduleDeferredNativeFinalizers() {
+  MallocGrowableArray<DeferredNativeFinalizer>* callbacks;
+  {
+    MutexLocker ml(&deferred_native_finalizers_mutex_);
+    callbacks = deferred_native_finalizers_;
+    deferred_native_finalizers_ = nullptr;
+  }
+  if (callbacks == nullptr) return;
+  isolate_group_->GetNativeFinalizerBacklogMaxMetric()->SetValue(
+      *native_finalizer_backlog_);
+  // The callbacks may run on any thread (see NativeFinalizer) and only get
+  // their peer, so they can outlive the isolate group.
+  Dart::thread_pool()->Run<NativeFinalizerTask>(callbacks,
+                                                native_finalizer_backlog_);
 }
 
 void Heap::CheckExternalGC(Thread* thread) {
@@ -433,6 +514,36 @@ void Heap::NotifyIdle(int64_t deadline) {
   }
 }
 
+int64_t Heap::PerformIdleSlice(int64_t deadline) {
+  Thread* thread = Thread::Current();
+  TIMELINE_FUNCTION_GC_DURATION(thread, "PerformIdleSlice");
+  PageSpace::Phase phase;
+  {
+    MonitorLocker ml(old_space_.tasks_lock());
+    phase = old_space_.phase();
+  }
+  switch (phase) {
+    case PageSpace::kMarking:
+      old_space_.IncrementalMarkWithTimeBudget(deadline);
+      break;
+    case PageSpace::kAwaitingFinalization:
+      // Finalization cannot be split, so only start it if it is expected to
+      // complete on time.
+      if (old_space_.ShouldFinalizeIdleMarkSweep(deadline)) {
+        GcSafepointOperationScope safepoint_operation(thread);
+        CollectOldSpaceGarbage(thread, GCType::kMarkSweep, GCReason::kFinalize);
+      }
+      break;
+    case PageSpace::kSweepingLarge:
+    case PageSpace::kSweepingRegular:
+      old_space_.SweepWithTimeBudget(deadline);
+      break;
+    case PageSpace::kDone:
+      break;
+  }
+  return old_space_.EstimatedIdleWorkInBytes();
+}
+
 void Heap::NotifyDestroyed() {
   TIMELINE_FUNCTION_GC_DURATION(Thread::Current(), "NotifyDestroyed");
   CollectAllGarbage(GCReason::kDestroyed, /*compact=*/true);
@@ -495,6 +606,7 @@ void Heap::CollectNewSpaceGarbage(Thread* thread,
       }
     }
   }
+  ScheduleDeferredNativeFinalizers();
 }
 
 void Heap::CollectOldSpaceGarbage(Thread* thread,
@@ -538,6 +650,7 @@ void Heap::CollectOldSpaceGarbage(Thread* thread,
     TIMELINE_FUNCTION_GC_DURATION(thread, "CollectOldGeneration");
     old_space_.CollectGarbage(thread, /*compact=*/type == GCType::kMarkCompact,
                               /*finalize=*/true);
+    new_space_.pretenure_feedback()->Reset();
     RecordAfterGC(type);
     PrintStats();
 #if defined(SUPPORT_TIMELINE)
@@ -548,11 +661,13 @@ void Heap::CollectOldSpaceGarbage(Thread* thread,
     thread->isolate_group()->ForEachIsolate(
         [&](Isolate* isolate) {
           isolate->handler_info_cache()->Clear();
+          isolate->not_in_try_block_cache()->Clear();
           isolate->catch_entry_moves_cache()->Clear();
         },
         /*at_safepoint=*/true);
     assume_scavenge_will_fail_ = false;
   }
+  ScheduleDeferredNativeFinalizers();
 }
 
 void Heap::CollectGarbage(Thread* thread, GCType type, GCReason reason) {
@@ -987,6 +1102,24 @@ void Heap::PrintToJSONObject(Space space, JSONObject* object) const {
   } else {
     old_space_.PrintToJSONObject(object);
   }
+  {
+    JSONObject external(object, space == kNew ? "_newExternalByKind"
+                                              : "_oldExternalByKind");
+    external.AddProperty64("api", ExternalInBytes(space, ExternalKind::kApi));
+    external.AddProperty64("typedData",
+                           ExternalInBytes(space, ExternalKind::kTypedData));
+    external.AddProperty64("ffi", ExternalInBytes(space, ExternalKind::kFfi));
+  }
+  if (Numa::IsEnabled()) {
+    const bool is_new = space == kNew;
+    JSONArray nodes(object, is_new ? "_newNumaNodes" : "_oldNumaNodes");
+    for (intptr_t i = 0; i < Numa::NodeCount(); i++) {
+      JSONObject node(&nodes);
+      node.AddProperty("node", i);
+      node.AddProperty64("allocatedPages", Numa::AllocatedPages(i, is_new));
+      node.AddProperty64("allocatedBytes", Numa::AllocatedBytes(i, is_new));
+    }
+  }
 }
 
 void Heap::PrintMemoryUsageJSON(JSONStream* stream) const {
@@ -1012,9 +1145,44 @@ void Heap::RecordBeforeGC(GCType type, GCReason reason) {
   stats_.before_.store_buffer_ = isolate_group_->store_buffer()->Size();
 }
 
+void Heap::RecordPause(GCType type,
+                       int64_t start_micros,
+                       int64_t end_micros) {
+  const int64_t pause = end_micros - start_micros;
+  switch (type) {
+    case GCType::kScavenge:
+    case GCType::kEvacuate:
+      isolate_group_->GetHeapNewPauseMaxMetric()->SetValue(pause);
+      break;
+    case GCType::kMarkCompact:
+      isolate_group_->GetHeapCompactPauseMaxMetric()->SetValue(pause);
+      break;
+    default:
+      isolate_group_->GetHeapOldPauseMaxMetric()->SetValue(pause);
+      break;
+  }
+
+  recent_pauses_[recent_pauses_next_] = {start_micros, end_micros};
+  recent_pauses_next_ = (recent_pauses_next_ + 1) % kNumRecentPauses;
+
+  // Fraction of the window ending now that the mutator was not paused.
+  const int64_t window = kMutatorUtilizationWindowMicros;
+  const int64_t window_start = end_micros - window;
+  int64_t paused = 0;
+  for (intptr_t i = 0; i < kNumRecentPauses; i++) {
+    const Pause& p = recent_pauses_[i];
+    if (p.end_micros <= window_start) continue;
+    paused += p.end_micros - Utils::Maximum(p.start_micros, window_start);
+  }
+  paused = Utils::Minimum(paused, window);
+  isolate_group_->GetHeapMutatorUtilizationMinMetric()->SetValue(
+      100 - (paused * 100) / window);
+}
+
 void Heap::RecordAfterGC(GCType type) {
   stats_.after_.micros_ = OS::GetCurrentMonotonicMicros();
   int64_t delta = stats_.after_.micros_ - stats_.before_.micros_;
+  RecordPause(type, stats_.before_.micros_, stats_.after_.micros_);
   if (stats_.type_ == GCType::kScavenge) {
     new_space_.AddGCTime(delta);
     new_space_.IncrementCollections();
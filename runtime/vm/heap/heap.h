@@ -9,12 +9,15 @@
 #error "Should not include runtime"
 #endif
 
+#include <memory>
+
 #include "include/dart_tools_api.h"
 
 #include "platform/assert.h"
 #include "vm/allocation.h"
 #include "vm/flags.h"
 #include "vm/globals.h"
+#include "vm/growable_array.h"
 #include "vm/heap/pages.h"
 #include "vm/heap/scavenger.h"
 #include "vm/heap/spaces.h"
@@ -81,13 +84,37 @@ class Heap {
     return 0;
   }
 
+  // What reported an external size. This is only used for accounting: GC is
+  // triggered by the total external size of a space, there is no budget per
+  // kind.
+  enum class ExternalKind {
+    // Finalizable handles on other objects. Images and other native resources
+    // of an embedder reach the VM this way.
+    kApi,
+    // Finalizable handles on external and transferable typed data.
+    kTypedData,
+    // Entries of a NativeFinalizer attached with an external size.
+    kFfi,
+  };
+  static constexpr intptr_t kNumExternalKinds = 3;
+
   // Tracks an external allocation. Returns false without tracking the
   // allocation if it will make the total external size exceed
   // kMaxAddrSpaceInWords.
-  bool AllocatedExternal(intptr_t size, Space space);
-  void FreedExternal(intptr_t size, Space space);
+  bool AllocatedExternal(intptr_t size, Space space, ExternalKind kind);
+  void FreedExternal(intptr_t size, Space space, ExternalKind kind);
   // Move external size from new to old space. Does not by itself trigger GC.
-  void PromotedExternal(intptr_t size);
+  void PromotedExternal(intptr_t size, ExternalKind kind);
+
+  // Queues a NativeFinalizer callback found by the GC in progress. The queued
+  // callbacks run on a thread pool task once the GC is done, instead of
+  // during its pause. Used when --defer_native_finalizers is set.
+  void DeferNativeFinalizerCallback(void (*callback)(void*), void* peer);
+  // The number of deferred callbacks that are queued or handed to a task but
+  // have not run yet.
+  intptr_t native_finalizer_backlog() const {
+    return *native_finalizer_backlog_;
+  }
   void CheckExternalGC(Thread* thread);
 
   // Heap contains the specified address.
@@ -98,6 +125,9 @@ class Heap {
   bool DataContains(uword addr) const;
 
   void NotifyIdle(int64_t deadline);
+  // Continues the old-space collection in progress until 'deadline' without
+  // starting a new one. Returns the estimated work left in bytes.
+  int64_t PerformIdleSlice(int64_t deadline);
   void NotifyDestroyed();
 
   Dart_PerformanceMode mode() const { return mode_; }
@@ -145,6 +175,11 @@ class Heap {
   intptr_t UsedInWords(Space space) const;
   intptr_t CapacityInWords(Space space) const;
   intptr_t ExternalInWords(Space space) const;
+  // The external size in bytes that 'kind' reported in a space.
+  intptr_t ExternalInBytes(Space space, ExternalKind kind) const {
+    return external_by_kind_[SpaceIndexForExternal(space)]
+                            [static_cast<intptr_t>(kind)];
+  }
 
   intptr_t TotalUsedInWords() const;
   intptr_t TotalCapacityInWords() const;
@@ -279,6 +314,12 @@ class Heap {
 
   Space SpaceForExternal(intptr_t size) const;
 
+  // The space runtime allocations of 'cid' should use, given survival
+  // feedback from the scavenger. See PretenureFeedback.
+  Space SpaceForAllocation(intptr_t cid) const {
+    return new_space_.pretenure_feedback()->ShouldPretenure(cid) ? kOld : kNew;
+  }
+
   void CollectOnNthAllocation(intptr_t num_allocations);
 
  private:
@@ -338,6 +379,7 @@ class Heap {
   // GC stats collection.
   void RecordBeforeGC(GCType type, GCReason reason);
   void RecordAfterGC(GCType type);
+  void RecordPause(GCType type, int64_t start_micros, int64_t end_micros);
   void PrintStats();
   void PrintStatsToTimeline(TimelineEventScope* event, GCReason reason);
 
@@ -346,6 +388,14 @@ class Heap {
   // Trigger major GC if 'gc_on_nth_allocation_' is set.
   void CollectForDebugging(Thread* thread);
 
+  // Hands the callbacks queued by DeferNativeFinalizerCallback to a task.
+  void ScheduleDeferredNativeFinalizers();
+
+  static intptr_t SpaceIndexForExternal(Space space) {
+    ASSERT(space == kNew || space == kOld);
+    return space == kNew ? 0 : 1;
+  }
+
   IsolateGroup* isolate_group_;
   bool is_vm_isolate_;
 
@@ -359,6 +409,17 @@ class Heap {
   // GC stats collection.
   GCStats stats_;
 
+  // The most recent pauses, used to compute the mutator utilization over the
+  // window ending at each pause. Pauses that fell out of the buffer are
+  // ignored, which only matters for a burst of tiny pauses.
+  static constexpr intptr_t kNumRecentPauses = 16;
+  struct Pause {
+    int64_t start_micros;
+    int64_t end_micros;
+  };
+  Pause recent_pauses_[kNumRecentPauses] = {};
+  intptr_t recent_pauses_next_ = 0;
+
   RelaxedAtomic<Dart_PerformanceMode> mode_ = {Dart_PerformanceMode_Default};
 
   // This heap is in read-only mode: No allocation is allowed.
@@ -373,6 +434,23 @@ class Heap {
   // sensitive codepaths.
   intptr_t gc_on_nth_allocation_;
 
+  // External sizes in bytes by new/old space and by kind. Their sum per space
+  // is the space's external size.
+  RelaxedAtomic<intptr_t> external_by_kind_[2][kNumExternalKinds] = {};
+
+  struct DeferredNativeFinalizer {
+    void (*callback)(void*);
+    void* peer;
+  };
+  class NativeFinalizerTask;
+
+  // Parallel scavenger workers queue callbacks concurrently.
+  Mutex deferred_native_finalizers_mutex_;
+  MallocGrowableArray<DeferredNativeFinalizer>* deferred_native_finalizers_ =
+      nullptr;
+  // Shared with the tasks, which may outlive the heap.
+  std::shared_ptr<RelaxedAtomic<intptr_t>> native_finalizer_backlog_;
+
   friend class Become;       // VisitObjectPointers
   friend class GCCompactor;  // VisitObjectPointers
   friend class Precompiler;  // VisitObjects
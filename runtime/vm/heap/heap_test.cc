@@ -25,6 +25,8 @@
 namespace dart {
 
 DECLARE_FLAG(int, early_tenuring_threshold);
+DECLARE_FLAG(bool, pretenure_feedback);
+DECLARE_FLAG(int, new_gen_target_pause_ms);
 
 TEST_CASE(OldGC) {
   const char* kScriptChars =
@@ -632,9 +634,42 @@ ISOLATE_UNIT_TEST_CASE(ExternalAllocationStats) {
               heap->old_space()->ExternalInWords() * kWordSize);
     EXPECT_LE(visitor.new_external_size_[kArrayCid],
               heap->new_space()->ExternalInWords() * kWordSize);
+    EXPECT_LE((i + 1) * MB,
+              heap->ExternalInBytes(Heap::kNew, Heap::ExternalKind::kApi) +
+                  heap->ExternalInBytes(Heap::kOld, Heap::ExternalKind::kApi));
   }
 }
 
+ISOLATE_UNIT_TEST_CASE(ExternalAllocationStatsByKind) {
+  Heap* heap = thread->isolate_group()->heap();
+  auto external_in_bytes = [&](Heap::ExternalKind kind) {
+    return heap->ExternalInBytes(Heap::kNew, kind) +
+           heap->ExternalInBytes(Heap::kOld, kind);
+  };
+  const intptr_t api_before = external_in_bytes(Heap::ExternalKind::kApi);
+  const intptr_t typed_data_before =
+      external_in_bytes(Heap::ExternalKind::kTypedData);
+
+  const intptr_t kLength = 1 * MB;
+  uint8_t* data = reinterpret_cast<uint8_t*>(malloc(kLength));
+  const auto& typed_data = ExternalTypedData::Handle(ExternalTypedData::New(
+      kExternalTypedDataUint8ArrayCid, data, kLength, Heap::kOld));
+  FinalizablePersistentHandle* handle = FinalizablePersistentHandle::New(
+      thread->isolate_group(), typed_data, data, NoopFinalizer, kLength,
+      /*auto_delete=*/false);
+  EXPECT(handle != nullptr);
+
+  // External typed data is not lumped in with the other API handles.
+  EXPECT_EQ(typed_data_before + kLength,
+            external_in_bytes(Heap::ExternalKind::kTypedData));
+  EXPECT_EQ(api_before, external_in_bytes(Heap::ExternalKind::kApi));
+
+  handle->EnsureFreedExternal(thread->isolate_group());
+  EXPECT_EQ(typed_data_before,
+            external_in_bytes(Heap::ExternalKind::kTypedData));
+  free(data);
+}
+
 ISOLATE_UNIT_TEST_CASE(ExternalSizeLimit) {
   // This test checks that the tracked total size of external data never exceeds
   // the amount of memory on the system. To accomplish this, the test performs
@@ -1362,9 +1397,104 @@ ISOLATE_UNIT_TEST_CASE(CardRememberedImmutableArray) {
   TestCardRememberedArray(false, false);
 }
 
+static CompressedObjectPtr* ElementSlot(const Array& array, intptr_t i) {
+  return reinterpret_cast<CompressedObjectPtr*>(
+      UntaggedObject::ToAddr(array.ptr()) + Array::element_offset(i));
+}
+
+// A huge array with only a few young elements, as for large caches.
+ISOLATE_UNIT_TEST_CASE(CardRememberedSparseArray) {
+  constexpr intptr_t kNumElements = 1 * MB;
+  constexpr intptr_t kStride = 12345;
+  Array& array = Array::Handle(Array::New(kNumElements, Heap::kOld));
+  EXPECT(array.ptr()->untag()->IsCardRemembered());
+  Page* page = Page::Of(array.ptr());
+
+  {
+    HANDLESCOPE(thread);
+    Object& element = Object::Handle();
+    for (intptr_t i = 0; i < kNumElements; i += kStride) {
+      element = Double::New(i, Heap::kNew);
+      array.SetAt(i, element);
+      EXPECT(page->IsCardRemembered(ElementSlot(array, i)));
+    }
+  }
+
+  // Survivors stay remembered until they are promoted.
+  GCTestHelper::CollectNewSpace();
+  {
+    HANDLESCOPE(thread);
+    Object& element = Object::Handle();
+    for (intptr_t i = 0; i < kNumElements; i++) {
+      element = array.At(i);
+      if ((i % kStride) == 0) {
+        EXPECT(element.IsDouble());
+        EXPECT(Double::Cast(element).value() == i);
+      } else {
+        EXPECT(element.IsNull());
+      }
+    }
+  }
+  GCTestHelper::CollectNewSpace();
+  GCTestHelper::CollectNewSpace();
+  for (intptr_t i = 0; i < kNumElements; i += kStride) {
+    EXPECT(array.At(i) != Object::null());
+    EXPECT(!array.At(i)->IsNewObject());
+    EXPECT(!page->IsCardRemembered(ElementSlot(array, i)));
+  }
+}
+
 ISOLATE_UNIT_TEST_CASE(CardRememberedWeakArray) {
   TestCardRememberedWeakArray(true);
   TestCardRememberedWeakArray(false);
 }
 
+ISOLATE_UNIT_TEST_CASE(PretenureFeedback) {
+  // An early tenuring threshold of 100 turns early tenuring off.
+  SetFlagScope<int> sfs_tenuring(&FLAG_early_tenuring_threshold, 100);
+  SetFlagScope<bool> sfs_pretenure(&FLAG_pretenure_feedback, true);
+  Heap* heap = thread->heap();
+
+  GCTestHelper::CollectAllGarbage();
+  EXPECT_EQ(Heap::kNew, heap->SpaceForAllocation(kArrayCid));
+
+  // Enough long-lived arrays to outweigh any short-lived ones.
+  const intptr_t kNumArrays = 1024;
+  const Array& holder = Array::Handle(Array::New(kNumArrays, Heap::kOld));
+  Array& element = Array::Handle();
+  for (intptr_t i = 0; i < kNumArrays; i++) {
+    element = Array::New(32, Heap::kNew);
+    holder.SetAt(i, element);
+  }
+
+  GCTestHelper::CollectNewSpace();  // Copied.
+  EXPECT_EQ(Heap::kNew, heap->SpaceForAllocation(kArrayCid));
+  GCTestHelper::CollectNewSpace();  // Promoted.
+  EXPECT_EQ(Heap::kOld, heap->SpaceForAllocation(kArrayCid));
+#if !defined(PRODUCT)
+  EXPECT(!IsolateGroup::Current()->class_table()->ShouldTraceAllocationFor(
+      kArrayCid));
+#endif
+
+  // Decisions are reconsidered after an old-space GC.
+  GCTestHelper::CollectOldSpace();
+  EXPECT_EQ(Heap::kNew, heap->SpaceForAllocation(kArrayCid));
+}
+
+ISOLATE_UNIT_TEST_CASE(NewGenTargetPause) {
+  SetFlagScope<int> sfs(&FLAG_new_gen_target_pause_ms, 1);
+  Scavenger* new_space = thread->heap()->new_space();
+  const intptr_t min_size_in_words =
+      2 * thread->isolate_group()->MutatorCount() * kPageSizeInWords;
+  for (intptr_t i = 0; i < 4; i++) {
+    // The next semi-space is sized at the flip, with the speed measured by
+    // the previous scavenges.
+    const int64_t pause_size_in_words =
+        new_space->scavenge_words_per_micro() * kMicrosecondsPerMillisecond;
+    GCTestHelper::CollectNewSpace();
+    EXPECT_LE(new_space->ThresholdInWords(),
+              Utils::Maximum<int64_t>(pause_size_in_words, min_size_in_words));
+  }
+}
+
 }  // namespace dart
@@ -18,6 +18,13 @@
 
 namespace dart {
 
+DEFINE_FLAG(int,
+            incremental_compactor_pause_ms,
+            0,
+            "If positive, select no more evacuation candidates than can be "
+            "copied in this many milliseconds at the measured evacuation "
+            "speed. The remaining candidates are left for later cycles.");
+
 void GCIncrementalCompactor::Prologue(PageSpace* old_space) {
   ASSERT(Thread::Current()->OwnsGCSafepoint());
   TIMELINE_FUNCTION_GC_DURATION(Thread::Current(), "StartIncrementalCompact");
@@ -222,8 +229,20 @@ bool GCIncrementalCompactor::SelectEvacuationCandidates(PageSpace* old_space) {
   // Evacuate no more than this amount of objects. This puts a bound on the
   // stop-the-world evacuate step that is similar to the existing longest
   // stop-the-world step of the scavenger.
-  const intptr_t kMaxEvacuatedBytes =
+  intptr_t max_evacuated_bytes =
       (old_space->heap_->new_space()->ThresholdInWords() << kWordSizeLog2) / 4;
+  if (FLAG_incremental_compactor_pause_ms > 0) {
+    // Tighter bound for latency-sensitive embedders. The forwarding part of
+    // the pause depends on the sizes of new space and the store buffer rather
+    // than the candidates, so this only bounds the copying part.
+    const int64_t budget_bytes =
+        static_cast<int64_t>(FLAG_incremental_compactor_pause_ms) *
+        kMicrosecondsPerMillisecond * old_space->evacuate_words_per_micro_ *
+        kWordSize;
+    if (budget_bytes < max_evacuated_bytes) {
+      max_evacuated_bytes = static_cast<intptr_t>(budget_bytes);
+    }
+  }
 
   PrologueState state;
   {
@@ -247,7 +266,7 @@ bool GCIncrementalCompactor::SelectEvacuationCandidates(PageSpace* old_space) {
     intptr_t cumulative_live_bytes = 0;
     for (intptr_t i = 0; i < state.pages.length(); i++) {
       intptr_t live_bytes = state.pages[i].live_bytes;
-      if (cumulative_live_bytes + live_bytes <= kMaxEvacuatedBytes) {
+      if (cumulative_live_bytes + live_bytes <= max_evacuated_bytes) {
         num_candidates++;
         cumulative_live_bytes += live_bytes;
         state.pages[i].page->set_evacuation_candidate(true);
@@ -624,6 +643,17 @@ class EpilogueState {
   void AddNewFreeSize(intptr_t size) { new_free_size_ += size; }
   intptr_t NewFreeSize() { return new_free_size_; }
 
+  void AddEvacuated(intptr_t bytes, int64_t micros) {
+    bytes_evacuated_ += bytes;
+    // Workers copy in parallel; the slowest one determines the pause.
+    int64_t expected = evacuate_micros_.load();
+    while (micros > expected &&
+           !evacuate_micros_.compare_exchange_weak(expected, micros)) {
+    }
+  }
+  intptr_t BytesEvacuated() { return bytes_evacuated_; }
+  int64_t EvacuateMicros() { return evacuate_micros_; }
+
  private:
   Page* evac_page_;
   StoreBufferBlock* block_;
@@ -637,6 +667,8 @@ class EpilogueState {
   RelaxedAtomic<bool> roots_slice_ = {true};
   RelaxedAtomic<bool> reset_progress_bars_slice_ = {true};
   RelaxedAtomic<intptr_t> new_free_size_ = {0};
+  RelaxedAtomic<intptr_t> bytes_evacuated_ = {0};
+  RelaxedAtomic<int64_t> evacuate_micros_ = {0};
 };
 
 class EpilogueTask : public SafepointTask {
@@ -752,6 +784,7 @@ class EpilogueTask : public SafepointTask {
 
   void Evacuate() {
     TIMELINE_FUNCTION_GC_DURATION(Thread::Current(), "Evacuate");
+    const int64_t start = OS::GetCurrentMonotonicMicros();
 
     old_space_->AcquireLock(freelist_);
 
@@ -804,6 +837,8 @@ class EpilogueTask : public SafepointTask {
 
     old_space_->ReleaseLock(freelist_);
     old_space_->usage_.used_in_words -= (bytes_evacuated >> kWordSizeLog2);
+    state_->AddEvacuated(bytes_evacuated,
+                         OS::GetCurrentMonotonicMicros() - start);
 #if defined(SUPPORT_TIMELINE)
     tbes.SetNumArguments(1);
     tbes.FormatArgument(0, "bytes_evacuated", "%" Pd, bytes_evacuated);
@@ -921,6 +956,14 @@ void GCIncrementalCompactor::Evacuate(PageSpace* old_space) {
 
   old_space->heap_->new_space()->set_freed_in_words(state.NewFreeSize() >>
                                                     kWordSizeLog2);
+
+  // Too little copying gives a noisy speed; keep the previous estimate.
+  const intptr_t words_evacuated = state.BytesEvacuated() >> kWordSizeLog2;
+  const int64_t micros = state.EvacuateMicros();
+  if (words_evacuated >= kPageSizeInWords && micros > 0) {
+    old_space->evacuate_words_per_micro_ =
+        Utils::Maximum<intptr_t>(1, words_evacuated / micros);
+  }
 }
 
 void GCIncrementalCompactor::CheckPostEvacuate(PageSpace* old_space) {
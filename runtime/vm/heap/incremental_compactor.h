@@ -17,6 +17,8 @@ class IncrementalForwardingVisitor;
 // An evacuating compactor that is incremental in the sense that building the
 // remembered set is interleaved with the mutator. The evacuation and forwarding
 // is not interleaved with the mutator, which would require a read barrier.
+// Instead the amount evacuated per cycle is bounded so that the
+// stop-the-world step stays short; see --incremental_compactor_pause_ms.
 class GCIncrementalCompactor : public AllStatic {
  public:
   static void Prologue(PageSpace* old_space);
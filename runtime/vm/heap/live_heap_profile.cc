@@ -0,0 +1,259 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#if !defined(PRODUCT)
+
+#include "vm/heap/live_heap_profile.h"
+
+#include "platform/utils.h"
+#include "vm/growable_array.h"
+#include "vm/handles.h"
+#include "vm/hash.h"
+#include "vm/hash_map.h"
+#include "vm/heap/sampler.h"
+#include "vm/json_stream.h"
+#include "vm/lockers.h"
+#include "vm/object.h"
+#include "vm/os.h"
+#include "vm/stack_frame.h"
+#include "vm/thread.h"
+#include "vm/zone.h"
+
+namespace dart {
+
+// Deeper stacks are truncated at the root end.
+static constexpr intptr_t kMaxFrames = 64;
+
+// A unique allocation stack and the live samples attributed to it. Frames
+// and the class are indices into the name table; frames are leaf first.
+// Stacks are never freed, so their number is bounded by the program.
+class LiveHeapStack : public MallocAllocated {
+ public:
+  LiveHeapStack(const intptr_t* frames, intptr_t length, intptr_t class_index)
+      : frames_(frames), length_(length), class_index_(class_index) {
+    uint32_t hash = static_cast<uint32_t>(class_index);
+    for (intptr_t i = 0; i < length; i++) {
+      hash = CombineHashes(hash, static_cast<uint32_t>(frames[i]));
+    }
+    hash_ = FinalizeHash(hash);
+  }
+
+  // Takes a copy of the frames, for an entry that outlives the sample.
+  LiveHeapStack* Clone() const {
+    intptr_t* frames = reinterpret_cast<intptr_t*>(
+        malloc(Utils::Maximum<intptr_t>(1, length_) * sizeof(intptr_t)));
+    memmove(frames, frames_, length_ * sizeof(intptr_t));
+    return new LiveHeapStack(frames, length_, class_index_);
+  }
+
+  uword Hash() const { return hash_; }
+  bool Equals(const LiveHeapStack& other) const {
+    if (length_ != other.length_ || class_index_ != other.class_index_) {
+      return false;
+    }
+    for (intptr_t i = 0; i < length_; i++) {
+      if (frames_[i] != other.frames_[i]) return false;
+    }
+    return true;
+  }
+
+  intptr_t length() const { return length_; }
+  intptr_t FrameAt(intptr_t i) const { return frames_[i]; }
+  intptr_t class_index() const { return class_index_; }
+
+  intptr_t live_samples = 0;
+  int64_t live_bytes = 0;
+
+ private:
+  const intptr_t* frames_;
+  const intptr_t length_;
+  const intptr_t class_index_;
+  uword hash_;
+
+  DISALLOW_COPY_AND_ASSIGN(LiveHeapStack);
+};
+
+struct LiveHeapSample {
+  LiveHeapStack* stack;
+  intptr_t size;
+};
+
+// Guards everything below. Samples are created by any mutator and deleted
+// by the GC, at most once per sampling interval, so contention is low.
+static Mutex* profile_lock_ = new Mutex();
+static bool enabled_ = false;
+static MallocGrowableArray<char*>* names_ = nullptr;
+static MallocDirectChainedHashMap<CStringIntMapKeyValueTrait>* name_ids_ =
+    nullptr;
+static MallocDirectChainedHashMap<PointerSetKeyValueTrait<LiveHeapStack>>*
+    stacks_ = nullptr;
+static MallocGrowableArray<LiveHeapStack*>* stack_list_ = nullptr;
+
+static intptr_t InternNameLocked(const char* name) {
+  CStringIntMapKeyValueTrait::Pair* pair = name_ids_->Lookup(name);
+  if (pair != nullptr) {
+    return pair->value;
+  }
+  char* copy = Utils::StrDup(name);
+  intptr_t id = names_->length();
+  names_->Add(copy);
+  name_ids_->Insert({copy, id});
+  return id;
+}
+
+static const char* FrameName(Zone* zone, const Function& function) {
+  const Class& owner = Class::Handle(zone, function.Owner());
+  const String& name = String::Handle(zone, function.name());
+  if (owner.IsNull() || owner.IsTopLevel()) {
+    return name.ToCString();
+  }
+  const String& owner_name = String::Handle(zone, owner.Name());
+  return OS::SCreate(zone, "%s.%s", owner_name.ToCString(), name.ToCString());
+}
+
+bool LiveHeapProfile::Enable(bool enable) {
+  Dart_HeapSamplingDeleteCallback current =
+      HeapProfileSampler::delete_callback();
+  if (current != nullptr && current != DeleteSample) {
+    return false;
+  }
+  {
+    MutexLocker ml(profile_lock_);
+    if (names_ == nullptr) {
+      names_ = new MallocGrowableArray<char*>();
+      name_ids_ = new MallocDirectChainedHashMap<CStringIntMapKeyValueTrait>();
+      stacks_ = new MallocDirectChainedHashMap<
+          PointerSetKeyValueTrait<LiveHeapStack>>();
+      stack_list_ = new MallocGrowableArray<LiveHeapStack*>();
+    }
+    enabled_ = enable;
+  }
+  if (enable) {
+    HeapProfileSampler::SetSamplingCallback(CreateSample, DeleteSample);
+  }
+  HeapProfileSampler::Enable(enable);
+  return true;
+}
+
+bool LiveHeapProfile::IsEnabled() {
+  MutexLocker ml(profile_lock_);
+  return enabled_;
+}
+
+void* LiveHeapProfile::CreateSample(Dart_Isolate isolate,
+                                    Dart_IsolateGroup isolate_group,
+                                    const char* cls_name,
+                                    intptr_t allocation_size) {
+  Thread* thread = Thread::Current();
+  ASSERT(thread != nullptr);
+  // Called from Object::Allocate: nothing here may allocate in the heap.
+  StackZone stack_zone(thread);
+  Zone* zone = stack_zone.GetZone();
+  HANDLESCOPE(thread);
+
+  const char* names[kMaxFrames];
+  intptr_t length = 0;
+  if (thread->IsDartMutatorThread() && thread->top_exit_frame_info() != 0) {
+    Function& function = Function::Handle(zone);
+    DartFrameIterator iterator(thread,
+                               StackFrameIterator::kNoCrossThreadIteration);
+    for (StackFrame* frame = iterator.NextFrame();
+         frame != nullptr && length < kMaxFrames;
+         frame = iterator.NextFrame()) {
+      function = frame->LookupDartFunction();
+      if (function.IsNull()) continue;
+      names[length++] = FrameName(zone, function);
+    }
+  }
+
+  intptr_t frames[kMaxFrames];
+  MutexLocker ml(profile_lock_);
+  for (intptr_t i = 0; i < length; i++) {
+    frames[i] = InternNameLocked(names[i]);
+  }
+  LiveHeapStack key(frames, length, InternNameLocked(cls_name));
+  LiveHeapStack* stack = stacks_->LookupValue(&key);
+  if (stack == nullptr) {
+    stack = key.Clone();
+    stacks_->Insert(stack);
+    stack_list_->Add(stack);
+  }
+  stack->live_samples++;
+  stack->live_bytes += allocation_size;
+  return new LiveHeapSample{stack, allocation_size};
+}
+
+void LiveHeapProfile::DeleteSample(void* data) {
+  LiveHeapSample* sample = reinterpret_cast<LiveHeapSample*>(data);
+  {
+    MutexLocker ml(profile_lock_);
+    sample->stack->live_samples--;
+    sample->stack->live_bytes -= sample->size;
+  }
+  delete sample;
+}
+
+int64_t LiveHeapProfile::LiveBytes() {
+  MutexLocker ml(profile_lock_);
+  int64_t result = 0;
+  if (stack_list_ != nullptr) {
+    for (intptr_t i = 0; i < stack_list_->length(); i++) {
+      result += stack_list_->At(i)->live_bytes;
+    }
+  }
+  return result;
+}
+
+void LiveHeapProfile::PrintJSON(JSONStream* stream) {
+  MutexLocker ml(profile_lock_);
+  JSONObject obj(stream);
+  obj.AddProperty("type", "_LiveHeapProfile");
+  obj.AddProperty("enabled", enabled_);
+  {
+    JSONArray sample_types(&obj, "sampleTypes");
+    {
+      JSONObject type(&sample_types);
+      type.AddProperty("type", "inuse_objects");
+      type.AddProperty("unit", "count");
+    }
+    {
+      JSONObject type(&sample_types);
+      type.AddProperty("type", "inuse_space");
+      type.AddProperty("unit", "bytes");
+    }
+  }
+  {
+    JSONArray names(&obj, "names");
+    if (names_ != nullptr) {
+      for (intptr_t i = 0; i < names_->length(); i++) {
+        names.AddValue(names_->At(i));
+      }
+    }
+  }
+  JSONArray samples(&obj, "samples");
+  if (stack_list_ == nullptr) {
+    return;
+  }
+  for (intptr_t i = 0; i < stack_list_->length(); i++) {
+    LiveHeapStack* stack = stack_list_->At(i);
+    if (stack->live_samples == 0) continue;
+    JSONObject sample(&samples);
+    {
+      JSONArray locations(&sample, "locations");
+      for (intptr_t j = 0; j < stack->length(); j++) {
+        locations.AddValue(stack->FrameAt(j));
+      }
+    }
+    sample.AddProperty("class", stack->class_index());
+    {
+      JSONArray values(&sample, "values");
+      values.AddValue(stack->live_samples);
+      values.AddValue64(stack->live_bytes);
+    }
+  }
+}
+
+}  // namespace dart
+
+#endif  // !defined(PRODUCT)
@@ -0,0 +1,58 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_HEAP_LIVE_HEAP_PROFILE_H_
+#define RUNTIME_VM_HEAP_LIVE_HEAP_PROFILE_H_
+
+#if !defined(PRODUCT)
+
+#include "include/dart_api.h"
+#include "vm/allocation.h"
+#include "vm/globals.h"
+
+namespace dart {
+
+class JSONStream;
+
+// A sampled profile of the live heap by allocation stack, built on the
+// HeapProfileSampler.
+//
+// Each sampled allocation records the Dart stack of the allocating thread.
+// The sample is attached to the object through the kHeapSamplingData weak
+// table, so scavenges, marking and compaction keep it with the object and
+// drop it when the object dies. Live totals per stack are maintained as
+// samples are created and deleted, so the profile can be printed at any time
+// without walking the heap.
+//
+// The profile uses the sampler's callbacks, so it is not available when the
+// embedder has registered its own with Dart_RegisterHeapSamplingCallback.
+class LiveHeapProfile : public AllStatic {
+ public:
+  // Starts or stops sampling. Samples taken while enabled stay in the profile
+  // until their objects die. Returns false if the embedder owns the sampling
+  // callbacks.
+  static bool Enable(bool enable);
+  static bool IsEnabled();
+
+  // Prints the profile in the layout of pprof's Profile message: a table of
+  // function and class names and, for each stack with live samples, its
+  // leaf-first locations, its class, and inuse_objects and inuse_space
+  // values. Frames are not expanded for inlining.
+  static void PrintJSON(JSONStream* stream);
+
+  // The estimated size of the sampled live objects, for testing.
+  static int64_t LiveBytes();
+
+ private:
+  static void* CreateSample(Dart_Isolate isolate,
+                            Dart_IsolateGroup isolate_group,
+                            const char* cls_name,
+                            intptr_t allocation_size);
+  static void DeleteSample(void* data);
+};
+
+}  // namespace dart
+
+#endif  // !defined(PRODUCT)
+#endif  // RUNTIME_VM_HEAP_LIVE_HEAP_PROFILE_H_
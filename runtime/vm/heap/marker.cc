@@ -9,8 +9,10 @@
 #include "vm/allocation.h"
 #include "vm/dart_api_state.h"
 #include "vm/heap/gc_shared.h"
+#include "vm/heap/numa.h"
 #include "vm/heap/pages.h"
 #include "vm/heap/pointer_block.h"
+#include "vm/heap/work_stealing_deque.h"
 #include "vm/isolate.h"
 #include "vm/log.h"
 #include "vm/object_id_ring.h"
@@ -24,6 +26,12 @@
 
 namespace dart {
 
+// Old-space objects discovered during parallel marking are first pushed to a
+// per-task deque so that idle tasks can steal them. When a deque is full, work
+// overflows into the shared old-space marking stack.
+static constexpr intptr_t kMarkingDequeCapacity = 4 * KB;
+typedef WorkStealingDeque<ObjectPtr, kMarkingDequeCapacity> MarkingDeque;
+
 template <bool sync>
 class MarkingVisitorBase : public ObjectPointerVisitor {
  public:
@@ -43,13 +51,48 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
         marked_micros_(0),
         concurrent_(true),
         has_evacuation_candidate_(false) {}
-  ~MarkingVisitorBase() { ASSERT(delayed_.IsEmpty()); }
+  ~MarkingVisitorBase() {
+    ASSERT(delayed_.IsEmpty());
+    delete deque_;
+  }
 
   uintptr_t marked_bytes() const { return marked_bytes_; }
   int64_t marked_micros() const { return marked_micros_; }
   void AddMicros(int64_t micros) { marked_micros_ += micros; }
   void set_concurrent(bool value) { concurrent_ = value; }
 
+  intptr_t steals() const { return steals_; }
+  intptr_t failed_steals() const { return failed_steals_; }
+  int64_t idle_micros() const { return idle_micros_; }
+  // Time spent on weak properties whose keys might have been marked, and on
+  // clearing weak objects after marking.
+  int64_t weak_micros() const { return weak_micros_; }
+  void AddWeakMicros(int64_t micros) { weak_micros_ += micros; }
+
+  // Allows this visitor to share its old-space work with, and take work from,
+  // the other visitors of the same parallel mark. Stealing is only active
+  // between StartWorkStealing and StopWorkStealing.
+  void EnableWorkStealing(MarkingVisitorBase** peers,
+                          intptr_t num_peers,
+                          intptr_t index) {
+    if (deque_ == nullptr) {
+      deque_ = new MarkingDeque();
+    }
+    peers_ = peers;
+    num_peers_ = num_peers;
+    index_ = index;
+  }
+  void StartWorkStealing() {
+    // Visitors are created concurrent and only switch when their parallel
+    // mark task starts, so check here rather than in EnableWorkStealing.
+    ASSERT(deque_ == nullptr || !concurrent_);
+    stealing_ = (deque_ != nullptr);
+  }
+  void StopWorkStealing() {
+    ASSERT(deque_ == nullptr || deque_->IsEmpty());
+    stealing_ = false;
+  }
+
 #ifdef DEBUG
   constexpr static const char* const kName = "Marker";
 #endif
@@ -65,6 +108,7 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
   }
 
   bool ProcessPendingWeakProperties() {
+    const int64_t start = OS::GetCurrentMonotonicMicros();
     bool more_to_mark = false;
     WeakPropertyPtr cur_weak = delayed_.weak_properties.Release();
     while (cur_weak != WeakProperty::null()) {
@@ -99,6 +143,7 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
       // Advance to next weak property in the queue.
       cur_weak = next_weak;
     }
+    weak_micros_ += OS::GetCurrentMonotonicMicros() - start;
     return more_to_mark;
   }
 
@@ -236,7 +281,7 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
     Thread* thread = Thread::Current();
     do {
       ObjectPtr obj;
-      while (MarkerWorkList::Pop(&old_work_list_, &new_work_list_, &obj)) {
+      while (PopWork(&obj)) {
         ASSERT(!has_evacuation_candidate_);
 
         const intptr_t class_id = obj->GetClassIdOfHeapObject();
@@ -586,6 +631,9 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
   }
 
   bool WaitForWork(RelaxedAtomic<uintptr_t>* num_busy) {
+    if (stealing_) {
+      return StealWork(num_busy);
+    }
     return old_work_list_.WaitForWork(num_busy);
   }
 
@@ -625,6 +673,91 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
   GCLinkedLists* delayed() { return &delayed_; }
 
  private:
+  DART_FORCE_INLINE
+  bool PopWork(ObjectPtr* obj) {
+    if (stealing_ && deque_->Pop(obj)) {
+      return true;
+    }
+    return MarkerWorkList::Pop(&old_work_list_, &new_work_list_, obj);
+  }
+
+  DART_FORCE_INLINE
+  void PushOld(ObjectPtr obj) {
+    if (stealing_ && deque_->Push(obj)) {
+      return;
+    }
+    old_work_list_.Push(obj);
+  }
+
+  bool MightHaveWork() {
+    for (intptr_t i = 0; i < num_peers_; i++) {
+      if (i != index_ && !peers_[i]->deque_->IsEmpty()) {
+        return true;
+      }
+    }
+    return !old_work_list_.IsEmpty() || !new_work_list_.IsEmpty();
+  }
+
+  bool TrySteal() {
+    // Take a batch from a single victim to amortize the cost of finding one.
+    constexpr intptr_t kStealBatch = 32;
+    for (intptr_t i = 1; i < num_peers_; i++) {
+      MarkingDeque* victim = peers_[(index_ + i) % num_peers_]->deque_;
+      intptr_t stolen = 0;
+      intptr_t budget = Utils::Minimum(kStealBatch, (victim->Size() + 1) / 2);
+      while (stolen < budget) {
+        ObjectPtr obj;
+        auto result = victim->Steal(&obj);
+        if (result == MarkingDeque::kSuccess) {
+          PushOld(obj);
+          stolen++;
+        } else {
+          if (result == MarkingDeque::kAborted) {
+            failed_steals_++;
+          }
+          break;
+        }
+      }
+      if (stolen > 0) {
+        steals_ += stolen;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Called with all local work exhausted. Returns true with this task counted
+  // in num_busy if more work may be available, or false once all tasks are
+  // idle. A task only counts itself as busy before attempting to take work,
+  // so num_busy reaching zero means no task holds any work.
+  bool StealWork(RelaxedAtomic<uintptr_t>* num_busy) {
+    ASSERT(old_work_list_.IsLocalEmpty());
+    ASSERT(deque_->IsEmpty());
+    const int64_t start = OS::GetCurrentMonotonicMicros();
+    num_busy->fetch_sub(1u);
+    bool found = false;
+    for (intptr_t round = 0;; round++) {
+      if (MightHaveWork()) {
+        num_busy->fetch_add(1u);
+        if (TrySteal() || !old_work_list_.IsEmpty() ||
+            !new_work_list_.IsEmpty()) {
+          found = true;
+          break;
+        }
+        num_busy->fetch_sub(1u);
+      } else if (num_busy->load() == 0) {
+        break;
+      }
+      if (round > kSpinRounds) {
+        OS::SleepMicros(kIdleSleepMicros);
+      }
+    }
+    idle_micros_ += OS::GetCurrentMonotonicMicros() - start;
+    return found;
+  }
+  static constexpr intptr_t kSpinRounds = 64;
+  static constexpr int64_t kIdleSleepMicros = 20;
+
   static bool TryAcquireMarkBit(ObjectPtr obj) {
     if constexpr (!sync) {
       if (!obj->untag()->IsMarked()) {
@@ -676,7 +809,7 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
     }
 
     if (TryAcquireMarkBit(obj)) {
-      old_work_list_.Push(obj);
+      PushOld(obj);
     }
 
     return UntaggedObject::IsEvacuationCandidate(tags);
@@ -693,6 +826,16 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
   bool concurrent_;
   bool has_evacuation_candidate_;
 
+  MarkingDeque* deque_ = nullptr;
+  MarkingVisitorBase** peers_ = nullptr;
+  intptr_t num_peers_ = 0;
+  intptr_t index_ = 0;
+  bool stealing_ = false;
+  intptr_t steals_ = 0;
+  intptr_t failed_steals_ = 0;
+  int64_t idle_micros_ = 0;
+  int64_t weak_micros_ = 0;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(MarkingVisitorBase);
 };
 
@@ -908,13 +1051,15 @@ class ParallelMarkTask : public SafepointTask {
                    MarkingStack* marking_stack,
                    ThreadBarrier* barrier,
                    SyncMarkingVisitor* visitor,
-                   RelaxedAtomic<uintptr_t>* num_busy)
+                   RelaxedAtomic<uintptr_t>* num_busy,
+                   intptr_t id)
       : marker_(marker),
         isolate_group_(isolate_group),
         marking_stack_(marking_stack),
         barrier_(barrier),
         visitor_(visitor),
-        num_busy_(num_busy) {}
+        num_busy_(num_busy),
+        id_(id) {}
   ~ParallelMarkTask() { barrier_->Release(); }
 
   void Run() override {
@@ -922,6 +1067,8 @@ class ParallelMarkTask : public SafepointTask {
       return;
     }
 
+    NumaAffinityScope affinity(id_);
+
     bool result = Thread::EnterIsolateGroupAsHelper(
         isolate_group_, Thread::kMarkerTask, /*bypass_safepoint=*/true);
     ASSERT(result);
@@ -964,6 +1111,7 @@ class ParallelMarkTask : public SafepointTask {
       // Phase 1: Iterate over roots and drain marking stack in tasks.
       num_busy_->fetch_add(1u);
       visitor_->set_concurrent(false);
+      visitor_->StartWorkStealing();
       marker_->IterateRoots(visitor_);
       visitor_->FinishedRoots();
 
@@ -1004,15 +1152,18 @@ class ParallelMarkTask : public SafepointTask {
         }
         barrier_->Sync();
       } while (more_to_mark);
+      visitor_->StopWorkStealing();
 
       // Phase 2: deferred marking.
       visitor_->ProcessDeferredMarking();
       barrier_->Sync();
 
       // Phase 3: Weak processing and statistics.
+      const int64_t mourn_start = OS::GetCurrentMonotonicMicros();
       visitor_->MournWeakProperties();
       visitor_->MournWeakReferences();
       visitor_->MournWeakArrays();
+      visitor_->AddWeakMicros(OS::GetCurrentMonotonicMicros() - mourn_start);
       // Don't MournFinalizerEntries here, do it on main thread, so that we
       // don't have to coordinate workers.
 
@@ -1035,6 +1186,7 @@ class ParallelMarkTask : public SafepointTask {
   ThreadBarrier* barrier_;
   SyncMarkingVisitor* visitor_;
   RelaxedAtomic<uintptr_t>* num_busy_;
+  intptr_t id_;
 
   DISALLOW_COPY_AND_ASSIGN(ParallelMarkTask);
 };
@@ -1055,6 +1207,8 @@ class ConcurrentMarkTask : public ThreadPool::Task {
 #endif
   }
 
+  virtual Kind kind() const { return kGC; }
+
   virtual void Run() {
     bool result = Thread::EnterIsolateGroupAsHelper(
         isolate_group_, Thread::kMarkerTask, /*bypass_safepoint=*/true);
@@ -1386,7 +1540,12 @@ void GCMarker::MarkObjects(PageSpace* page_space) {
         // Need to move weak property list too.
         tasks.Append(new ParallelMarkTask(this, isolate_group_,
                                           &old_marking_stack_, barrier, visitor,
-                                          &num_busy));
+                                          &num_busy, i));
+      }
+      if (FLAG_marker_work_stealing && (num_tasks > 1)) {
+        for (intptr_t i = 0; i < num_tasks; i++) {
+          visitors_[i]->EnableWorkStealing(visitors_, num_tasks, i);
+        }
       }
       visitors_[0]->Adopt(&global_list_);
       isolate_group_->safepoint_handler()->RunTasks(&tasks);
@@ -1396,6 +1555,16 @@ void GCMarker::MarkObjects(PageSpace* page_space) {
         visitor->FinalizeMarking();
         marked_bytes_ += visitor->marked_bytes();
         marked_micros_ += visitor->marked_micros();
+        if (FLAG_verbose_gc) {
+          OS::PrintErr("[ GC marker task %" Pd ": marked %" Pd
+                       " kB in %.1f ms, steals %" Pd " (%" Pd
+                       " contended), idle %.1f ms, weak %.1f ms ]\n",
+                       i, visitor->marked_bytes() / KB,
+                       MicrosecondsToMilliseconds(visitor->marked_micros()),
+                       visitor->steals(), visitor->failed_steals(),
+                       MicrosecondsToMilliseconds(visitor->idle_micros()),
+                       MicrosecondsToMilliseconds(visitor->weak_micros()));
+        }
         delete visitor;
         visitors_[i] = nullptr;
       }
@@ -0,0 +1,179 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/heap/numa.h"
+
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+#include <errno.h>        // NOLINT
+#include <stdio.h>        // NOLINT
+#include <sys/syscall.h>  // NOLINT
+#include <unistd.h>       // NOLINT
+#endif
+
+#include "platform/assert.h"
+#include "platform/utils.h"
+#include "vm/os.h"
+
+namespace dart {
+
+DEFINE_FLAG(bool,
+            numa_aware_heap,
+            false,
+            "Prefer memory from the NUMA node of the allocating thread for "
+            "heap pages and pin parallel GC workers to nodes.");
+
+intptr_t Numa::node_count_ = 1;
+Numa::NodeCounters Numa::counters_[Numa::kMaxNodes];
+
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+
+// From <linux/mempolicy.h>, which is not available on all sysroots.
+static constexpr int kMpolPreferred = 1;
+static constexpr unsigned kMpolMfMove = 1 << 1;
+
+static cpu_set_t node_cpus[Numa::kMaxNodes];
+
+// Parses a sysfs list such as "0-3,8,10-11". Calls 'action' for each
+// element. Returns false if the file cannot be read.
+template <typename Lambda>
+static bool ParseSysfsList(const char* path, Lambda action) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    return false;
+  }
+  char buffer[1024];
+  bool result = fgets(buffer, sizeof(buffer), file) != nullptr;
+  fclose(file);
+  if (!result) {
+    return false;
+  }
+  char* cursor = buffer;
+  while (*cursor != '\0' && *cursor != '\n') {
+    char* end;
+    intptr_t first = strtol(cursor, &end, 10);
+    if (end == cursor) {
+      return false;
+    }
+    intptr_t last = first;
+    cursor = end;
+    if (*cursor == '-') {
+      cursor++;
+      last = strtol(cursor, &end, 10);
+      if (end == cursor) {
+        return false;
+      }
+      cursor = end;
+    }
+    for (intptr_t i = first; i <= last; i++) {
+      action(i);
+    }
+    if (*cursor == ',') {
+      cursor++;
+    }
+  }
+  return true;
+}
+
+void Numa::Init() {
+  node_count_ = 1;
+  intptr_t max_node = 0;
+  if (!ParseSysfsList("/sys/devices/system/node/online", [&](intptr_t node) {
+        max_node = Utils::Maximum(max_node, node);
+      })) {
+    return;
+  }
+  if (max_node >= kMaxNodes) {
+    // Unusual topology; do not attempt NUMA placement.
+    return;
+  }
+  for (intptr_t node = 0; node <= max_node; node++) {
+    CPU_ZERO(&node_cpus[node]);
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%" Pd "/cpulist",
+             node);
+    ParseSysfsList(path, [&](intptr_t cpu) {
+      if (cpu < CPU_SETSIZE) {
+        CPU_SET(cpu, &node_cpus[node]);
+      }
+    });
+  }
+  node_count_ = max_node + 1;
+}
+
+intptr_t Numa::CurrentNode() {
+  if (node_count_ <= 1) {
+    return 0;
+  }
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+    return 0;
+  }
+  return static_cast<intptr_t>(node) < node_count_ ? node : 0;
+}
+
+bool Numa::BindMemory(void* address, intptr_t size, intptr_t node) {
+  ASSERT(node >= 0 && node < node_count_);
+  unsigned long mask = 1UL << node;  // NOLINT
+  return syscall(SYS_mbind, address, size, kMpolPreferred, &mask,
+                 sizeof(mask) * kBitsPerByte, kMpolMfMove) == 0;
+}
+
+NumaAffinityScope::NumaAffinityScope(intptr_t node) {
+  if (node == Numa::kNoNode || !Numa::IsEnabled()) {
+    return;
+  }
+  node = node % Numa::NodeCount();
+  if (CPU_COUNT(&node_cpus[node]) == 0) {
+    return;  // Memory-only node.
+  }
+  if (sched_getaffinity(0, sizeof(saved_mask_), &saved_mask_) != 0) {
+    return;
+  }
+  pinned_ = sched_setaffinity(0, sizeof(node_cpus[node]), &node_cpus[node]) ==
+            0;
+}
+
+NumaAffinityScope::~NumaAffinityScope() {
+  if (pinned_) {
+    sched_setaffinity(0, sizeof(saved_mask_), &saved_mask_);
+  }
+}
+
+#else  // defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+
+void Numa::Init() {
+  node_count_ = 1;
+}
+
+intptr_t Numa::CurrentNode() {
+  return 0;
+}
+
+bool Numa::BindMemory(void* address, intptr_t size, intptr_t node) {
+  return false;
+}
+
+NumaAffinityScope::NumaAffinityScope(intptr_t node) {}
+
+NumaAffinityScope::~NumaAffinityScope() {}
+
+#endif  // defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+
+void Numa::Cleanup() {
+  for (intptr_t i = 0; i < kMaxNodes; i++) {
+    for (intptr_t j = 0; j < 2; j++) {
+      counters_[i].pages[j] = 0;
+      counters_[i].bytes[j] = 0;
+    }
+  }
+}
+
+void Numa::RecordPageAllocation(intptr_t node, intptr_t size, bool is_new) {
+  ASSERT(node >= 0 && node < node_count_);
+  counters_[node].pages[is_new ? 1 : 0].fetch_add(1);
+  counters_[node].bytes[is_new ? 1 : 0].fetch_add(size);
+}
+
+}  // namespace dart
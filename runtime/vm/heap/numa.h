@@ -0,0 +1,93 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_HEAP_NUMA_H_
+#define RUNTIME_VM_HEAP_NUMA_H_
+
+#include "vm/globals.h"
+
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+#include <sched.h>  // NOLINT
+#endif
+
+#include "platform/atomic.h"
+#include "vm/allocation.h"
+#include "vm/flags.h"
+
+namespace dart {
+
+DECLARE_FLAG(bool, numa_aware_heap);
+
+// Minimal NUMA support for the heap, used when --numa_aware_heap is given.
+//
+// Heap pages get a preferred memory policy for the node of the thread that
+// allocates them, so new-space pages and the TLAB/promotion pages of each GC
+// worker are normally local to that worker. The pages themselves are not
+// pinned: the kernel falls back to other nodes when the preferred one is
+// full. GC worker threads are pinned to the CPUs of a node for the duration
+// of a parallel scavenge or mark.
+//
+// On platforms without NUMA support there is a single node and all
+// operations are no-ops.
+class Numa : public AllStatic {
+ public:
+  static constexpr intptr_t kMaxNodes = 64;
+  static constexpr intptr_t kNoNode = -1;
+
+  static void Init();
+  static void Cleanup();
+
+  // Whether NUMA placement is requested and there is more than one node.
+  static bool IsEnabled() { return FLAG_numa_aware_heap && node_count_ > 1; }
+
+  static intptr_t NodeCount() { return node_count_; }
+
+  // The node of the CPU the calling thread is currently running on.
+  static intptr_t CurrentNode();
+
+  // Prefer physical memory from 'node' for [address, address + size), moving
+  // already-faulted pages. Returns false if the kernel refused.
+  static bool BindMemory(void* address, intptr_t size, intptr_t node);
+
+  // Counters of pages given a preferred node, process-wide since pages are
+  // shared by all isolate groups.
+  static void RecordPageAllocation(intptr_t node, intptr_t size, bool is_new);
+  static int64_t AllocatedPages(intptr_t node, bool is_new) {
+    return counters_[node].pages[is_new ? 1 : 0].load();
+  }
+  static int64_t AllocatedBytes(intptr_t node, bool is_new) {
+    return counters_[node].bytes[is_new ? 1 : 0].load();
+  }
+
+ private:
+  struct NodeCounters {
+    RelaxedAtomic<int64_t> pages[2];
+    RelaxedAtomic<int64_t> bytes[2];
+  };
+
+  static intptr_t node_count_;
+  static NodeCounters counters_[kMaxNodes];
+
+  friend class NumaAffinityScope;
+};
+
+// Pins the current thread to the CPUs of one node and restores the previous
+// affinity on destruction. Does nothing unless Numa::IsEnabled().
+class NumaAffinityScope : public ValueObject {
+ public:
+  explicit NumaAffinityScope(intptr_t node);
+  ~NumaAffinityScope();
+
+ private:
+  bool pinned_ = false;
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+  cpu_set_t saved_mask_;
+#endif
+
+  DISALLOW_COPY_AND_ASSIGN(NumaAffinityScope);
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_HEAP_NUMA_H_
@@ -0,0 +1,76 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "platform/assert.h"
+
+#include "vm/heap/numa.h"
+#include "vm/object.h"
+#include "vm/unit_test.h"
+
+namespace dart {
+
+static int64_t TotalAllocatedPages(bool is_new) {
+  int64_t total = 0;
+  for (intptr_t i = 0; i < Numa::NodeCount(); i++) {
+    total += Numa::AllocatedPages(i, is_new);
+  }
+  return total;
+}
+
+ISOLATE_UNIT_TEST_CASE(Numa_Topology) {
+  SetFlagScope<bool> sfs(&FLAG_numa_aware_heap, true);
+  EXPECT(Numa::NodeCount() >= 1);
+  EXPECT(Numa::NodeCount() <= Numa::kMaxNodes);
+  const intptr_t node = Numa::CurrentNode();
+  EXPECT(node >= 0);
+  EXPECT(node < Numa::NodeCount());
+  // A single node host has nothing to place pages on.
+  EXPECT_EQ(Numa::NodeCount() > 1, Numa::IsEnabled());
+}
+
+ISOLATE_UNIT_TEST_CASE(Numa_OldPageAllocationIsCounted) {
+  SetFlagScope<bool> sfs(&FLAG_numa_aware_heap, true);
+  const int64_t before = TotalAllocatedPages(/*is_new=*/false);
+  // Large enough to get a page of its own.
+  const Array& array = Array::Handle(Array::New(1 * MB, Heap::kOld));
+  EXPECT(!array.IsNull());
+  const int64_t after = TotalAllocatedPages(/*is_new=*/false);
+  if (Numa::IsEnabled()) {
+    // Other isolate groups may allocate pages at the same time.
+    EXPECT(after >= before + 1);
+  } else {
+    EXPECT_EQ(before, after);
+  }
+}
+
+ISOLATE_UNIT_TEST_CASE(Numa_NoPlacementWithoutFlag) {
+  SetFlagScope<bool> sfs(&FLAG_numa_aware_heap, false);
+  EXPECT(!Numa::IsEnabled());
+  const int64_t before = TotalAllocatedPages(/*is_new=*/false);
+  const Array& array = Array::Handle(Array::New(1 * MB, Heap::kOld));
+  EXPECT(!array.IsNull());
+  EXPECT_EQ(before, TotalAllocatedPages(/*is_new=*/false));
+}
+
+#if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+ISOLATE_UNIT_TEST_CASE(Numa_AffinityScopeRestoresAffinity) {
+  SetFlagScope<bool> sfs(&FLAG_numa_aware_heap, true);
+  cpu_set_t before;
+  EXPECT_EQ(0, sched_getaffinity(0, sizeof(before), &before));
+  for (intptr_t i = 0; i < Numa::NodeCount() + 1; i++) {
+    NumaAffinityScope scope(i);
+    cpu_set_t inside;
+    EXPECT_EQ(0, sched_getaffinity(0, sizeof(inside), &inside));
+    if (!Numa::IsEnabled()) {
+      EXPECT(CPU_EQUAL(&before, &inside));
+    }
+  }
+  NumaAffinityScope no_node(Numa::kNoNode);
+  cpu_set_t after;
+  EXPECT_EQ(0, sched_getaffinity(0, sizeof(after), &after));
+  EXPECT(CPU_EQUAL(&before, &after));
+}
+#endif  // defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+
+}  // namespace dart
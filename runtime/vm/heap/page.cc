@@ -10,6 +10,7 @@
 #include "vm/heap/become.h"
 #include "vm/heap/compactor.h"
 #include "vm/heap/marker.h"
+#include "vm/heap/numa.h"
 #include "vm/heap/safepoint.h"
 #include "vm/heap/sweeper.h"
 #include "vm/lockers.h"
@@ -21,6 +22,12 @@
 
 namespace dart {
 
+DEFINE_FLAG(bool,
+            use_huge_pages,
+            false,
+            "Back regular heap pages with transparent huge pages, packing "
+            "several pages into each huge page.");
+
 // This cache needs to be at least as big as FLAG_new_gen_semi_max_size or
 // munmap will noticeably impact performance.
 static constexpr intptr_t kPageCacheCapacity = 128 * kWordSize;
@@ -58,6 +65,56 @@ static bool CanUseCache(uword flags) {
                    Page::kVMIsolate)) == 0;
 }
 
+static constexpr intptr_t kHugePageSize = 2 * MB;
+static constexpr intptr_t kPagesPerHugePage = kHugePageSize / kPageSize;
+static_assert(kPagesPerHugePage >= 1, "Huge pages are smaller than kPageSize");
+
+// Set once the OS refuses to back a region with huge pages, to avoid paying
+// for 2MB-aligned reservations that will not improve TLB reach.
+static RelaxedAtomic<bool> huge_pages_refused = false;
+
+// Allocates a huge-page-aligned region, asks for it to be backed by a huge
+// page, and splits it into kPageSize pieces. The first piece is returned and
+// the rest are placed in the page cache so that neighbouring heap pages share
+// a TLB entry. Returns nullptr if huge pages are not in use.
+static VirtualMemory* AllocateFromHugePage(bool compressed, const char* name) {
+  if (!FLAG_use_huge_pages || !VirtualMemory::SupportsHugePages() ||
+      huge_pages_refused) {
+    return nullptr;
+  }
+  {
+    // Don't allocate pieces the cache can't hold.
+    MutexLocker ml(page_cache_mutex);
+    if (page_cache_size + kPagesPerHugePage - 1 > kPageCacheCapacity) {
+      return nullptr;
+    }
+  }
+  VirtualMemory* memory = VirtualMemory::AllocateAligned(
+      kHugePageSize, kHugePageSize, /*is_executable=*/false, compressed, name);
+  if (memory == nullptr) {
+    return nullptr;
+  }
+  if (!VirtualMemory::AdviseHugePages(memory->address(), memory->size())) {
+    huge_pages_refused = true;
+    if (FLAG_verbose_gc) {
+      OS::PrintErr("Huge pages unavailable, using regular pages\n");
+    }
+    // Still usable as regular pages.
+  }
+  VirtualMemory* pieces[kPagesPerHugePage];
+  VirtualMemory::Split(memory, kPageSize, pieces);
+  MutexLocker ml(page_cache_mutex);
+  // Push in reverse so that pieces are handed out in address order.
+  for (intptr_t i = kPagesPerHugePage - 1; i > 0; i--) {
+    if (page_cache_size < kPageCacheCapacity) {
+      page_cache[page_cache_size++] = pieces[i];
+    } else {
+      delete pieces[i];
+    }
+  }
+  return pieces[0];
+}
+
 Page* Page::Allocate(intptr_t size, uword flags) {
   const bool executable = (flags & Page::kExecutable) != 0;
   const bool compressed = !executable;
@@ -77,6 +134,9 @@ Page* Page::Allocate(intptr_t size, uword flags) {
       memory = page_cache[--page_cache_size];
     }
   }
+  if (memory == nullptr && CanUseCache(flags)) {
+    memory = AllocateFromHugePage(compressed, name);
+  }
   if (memory == nullptr) {
     memory = VirtualMemory::AllocateAligned(size, kPageSize, executable,
                                             compressed, name);
@@ -85,6 +145,15 @@ Page* Page::Allocate(intptr_t size, uword flags) {
     return nullptr;  // Out of memory.
   }
 
+  if (Numa::IsEnabled() && (flags & (kExecutable | kImage | kVMIsolate)) == 0) {
+    // Cached pages may have last been used on another node, so bind even when
+    // reusing. Binding happens before the page header is written below.
+    const intptr_t node = Numa::CurrentNode();
+    if (Numa::BindMemory(memory->address(), size, node)) {
+      Numa::RecordPageAllocation(node, size, (flags & kNew) != 0);
+    }
+  }
+
   if ((flags & kNew) != 0) {
     // Initialized by generated code.
     MSAN_UNPOISON(memory->address(), size);
@@ -247,44 +316,60 @@ void Page::VisitRememberedCards(PredicateObjectPointerVisitor* visitor,
   const size_t size_in_words =
       Utils::RoundUp(size_in_bits, kBitsPerWord) >> kBitsPerWordLog2;
   for (;;) {
-    const size_t word_offset = progress_bar_.fetch_add(1);
-    if (word_offset >= size_in_words) break;
-
-    uword cell = card_table_[word_offset];
-    if (cell == 0) continue;
-
-    for (intptr_t bit_offset = 0; bit_offset < kBitsPerWord; bit_offset++) {
-      const uword bit_mask = static_cast<uword>(1) << bit_offset;
-      if ((cell & bit_mask) == 0) continue;
-      const intptr_t i = (word_offset << kBitsPerWordLog2) + bit_offset;
-
-      CompressedObjectPtr* card_from =
-          reinterpret_cast<CompressedObjectPtr*>(this) +
-          (i << kSlotsPerCardLog2);
-      CompressedObjectPtr* card_to =
-          reinterpret_cast<CompressedObjectPtr*>(card_from) +
-          (1 << kSlotsPerCardLog2) - 1;
-      // Minus 1 because to is inclusive.
-
-      if (card_from < obj_from) {
-        // First card overlaps with header.
-        card_from = obj_from;
-      }
-      if (card_to > obj_to) {
-        // Last card(s) may extend past the object. Array truncation can make
-        // this happen for more than one card.
-        card_to = obj_to;
-      }
+    // Claim several words of the table at once, so sparse tables of huge
+    // arrays cost one atomic per claim instead of one per word.
+    const size_t claim_start = progress_bar_.fetch_add(kCardWordsPerClaim);
+    if (claim_start >= size_in_words) break;
+    const size_t claim_end =
+        Utils::Minimum<size_t>(claim_start + kCardWordsPerClaim, size_in_words);
+    for (size_t word_offset = claim_start; word_offset < claim_end;
+         word_offset++) {
+      VisitRememberedCardsInWord(visitor, word_offset, heap_base, obj_from,
+                                 obj_to);
+    }
+  }
+}
 
-      bool has_new_target = visitor->PredicateVisitCompressedPointers(
-          heap_base, card_from, card_to);
+void Page::VisitRememberedCardsInWord(PredicateObjectPointerVisitor* visitor,
+                                      intptr_t word_offset,
+                                      uword heap_base,
+                                      CompressedObjectPtr* obj_from,
+                                      CompressedObjectPtr* obj_to) {
+  uword cell = card_table_[word_offset];
+  if (cell == 0) return;
+
+  // Visit only the set bits rather than testing every card in the word.
+  for (uword pending = cell; pending != 0; pending &= pending - 1) {
+    const intptr_t bit_offset = Utils::CountTrailingZerosWord(pending);
+    const uword bit_mask = static_cast<uword>(1) << bit_offset;
+    const intptr_t i = (word_offset << kBitsPerWordLog2) + bit_offset;
+
+    CompressedObjectPtr* card_from =
+        reinterpret_cast<CompressedObjectPtr*>(this) +
+        (i << kSlotsPerCardLog2);
+    CompressedObjectPtr* card_to =
+        reinterpret_cast<CompressedObjectPtr*>(card_from) +
+        (1 << kSlotsPerCardLog2) - 1;
+    // Minus 1 because to is inclusive.
+
+    if (card_from < obj_from) {
+      // First card overlaps with header.
+      card_from = obj_from;
+    }
+    if (card_to > obj_to) {
+      // Last card(s) may extend past the object. Array truncation can make
+      // this happen for more than one card.
+      card_to = obj_to;
+    }
 
-      if (!has_new_target) {
-        cell ^= bit_mask;
-      }
+    bool has_new_target = visitor->PredicateVisitCompressedPointers(
+        heap_base, card_from, card_to);
+
+    if (!has_new_target) {
+      cell ^= bit_mask;
     }
-    card_table_[word_offset] = cell;
   }
+  card_table_[word_offset] = cell;
 }
 
 void Page::ResetProgressBar() {
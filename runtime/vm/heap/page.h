@@ -175,6 +175,9 @@ class Page {
   static constexpr intptr_t kSlotsPerCard = 1 << kSlotsPerCardLog2;
   static constexpr intptr_t kBytesPerCardLog2 =
       kCompressedWordSizeLog2 + kSlotsPerCardLog2;
+  // Words of the card table (kBitsPerWord cards each) claimed at a time by
+  // the workers visiting remembered cards.
+  static constexpr intptr_t kCardWordsPerClaim = 8;
 
   intptr_t card_table_size() const {
     return memory_->size() >> kBytesPerCardLog2;
@@ -298,6 +301,11 @@ class Page {
     reinterpret_cast<std::atomic<uword>*>(&card_table[word_offset])
         ->fetch_or(bit_mask, std::memory_order_relaxed);
   }
+  void VisitRememberedCardsInWord(PredicateObjectPointerVisitor* visitor,
+                                  intptr_t word_offset,
+                                  uword heap_base,
+                                  CompressedObjectPtr* obj_from,
+                                  CompressedObjectPtr* obj_to);
   bool IsCardRemembered(uword slot) {
     ASSERT(Contains(slot));
     if (card_table_ == nullptr) {
@@ -45,12 +45,18 @@ DEFINE_FLAG(bool,
             false,
             "Print free list statistics after a GC");
 DEFINE_FLAG(bool, log_growth, false, "Log PageSpace growth policy decisions.");
+DEFINE_FLAG(bool,
+            old_space_thread_caches,
+            false,
+            "Serve small old-space allocations from per-thread caches that "
+            "refill in batches from the shared free list.");
 
 // The initial estimate of how many words we can mark per microsecond (usage
 // before / mark-sweep time). This is a conservative value observed running
 // Flutter on a Nexus 4. After the first mark-sweep, we instead use a value
 // based on the device's actual speed.
 static constexpr intptr_t kConservativeInitialMarkSpeed = 20;
+static constexpr intptr_t kConservativeInitialEvacuateSpeed = 20;
 
 PageSpace::PageSpace(Heap* heap, intptr_t max_capacity_in_words)
     : heap_(heap),
@@ -77,6 +83,7 @@ PageSpace::PageSpace(Heap* heap, intptr_t max_capacity_in_words)
       gc_time_micros_(0),
       collections_(0),
       mark_words_per_micro_(kConservativeInitialMarkSpeed),
+      evacuate_words_per_micro_(kConservativeInitialEvacuateSpeed),
       enable_concurrent_mark_(FLAG_concurrent_mark) {
   ASSERT(heap != nullptr);
 
@@ -411,6 +418,11 @@ uword PageSpace::TryAllocateInternal(intptr_t size,
     } else {
       result = freelist->TryAllocate(size, is_protected);
     }
+    if (result == 0 && !is_exec && !is_locked && !is_protected) {
+      // Pay for what we allocate by sweeping pages the concurrent sweeper
+      // has not reached yet, rather than growing the heap.
+      result = TryAllocateBySweeping(size, freelist);
+    }
     if (result == 0) {
       result = TryAllocateInFreshPage(size, freelist, is_exec, growth_policy,
                                       is_locked);
@@ -429,6 +441,44 @@ uword PageSpace::TryAllocateInternal(intptr_t size,
   return result;
 }
 
+uword PageSpace::TryAllocateCached(intptr_t size) {
+  Thread* thread = Thread::Current();
+  // GC helpers run inside safepoints, when the caches must stay empty.
+  if (thread->BypassSafepoints() ||
+      thread->isolate_group() != heap_->isolate_group()) {
+    return 0;
+  }
+  FreeListCache* cache = thread->old_space_cache();
+  if (UNLIKELY(cache == nullptr)) {
+    cache = new FreeListCache();
+    thread->set_old_space_cache(cache);
+  }
+  uword result = cache->TryAllocate(size);
+  if (result == 0) {
+    result = freelists_[kDataFreelist].TryAllocateAndRefill(size, cache);
+    if (result == 0) {
+      return 0;
+    }
+  }
+  Page::Of(result)->add_live_bytes(size);
+  usage_.used_in_words += (size >> kWordSizeLog2);
+  ASSERT((result & kObjectAlignmentMask) == kOldObjectAlignmentOffset);
+  return result;
+}
+
+void PageSpace::FlushThreadCache(Thread* thread) {
+  FreeListCache* cache = thread->old_space_cache();
+  if (cache != nullptr) {
+    freelists_[kDataFreelist].Flush(cache);
+  }
+}
+
+void PageSpace::FlushThreadCaches() {
+  ASSERT(Thread::Current()->OwnsGCSafepoint());
+  heap_->isolate_group()->thread_registry()->ForEachThread(
+      [&](Thread* thread) { FlushThreadCache(thread); });
+}
+
 void PageSpace::AcquireLock(FreeList* freelist) {
   freelist->mutex()->Lock();
 }
@@ -744,6 +794,12 @@ void PageSpace::PrintToJSONObject(JSONObject* object) const {
   space.AddProperty64("capacity", CapacityInWords() * kWordSize);
   space.AddProperty64("external", ExternalInWords() * kWordSize);
   space.AddProperty("time", MicrosecondsToSeconds(gc_time_micros()));
+  const FreeList& freelist = freelists_[kDataFreelist];
+  space.AddProperty64("_freeListLockAcquisitions",
+                      freelist.lock_acquisitions());
+  space.AddProperty64("_freeListLockContentions", freelist.lock_contentions());
+  space.AddProperty64("_threadCacheHits", freelist.cache_hits());
+  space.AddProperty64("_threadCacheRefills", freelist.cache_refills());
   if (collections() > 0) {
     int64_t run_time = isolate_group->UptimeMicros();
     run_time = Utils::Maximum(run_time, static_cast<int64_t>(0));
@@ -902,6 +958,15 @@ bool PageSpace::ShouldPerformIdleMarkCompact(int64_t deadline) {
   return estimated_mark_compact_completion <= deadline;
 }
 
+bool PageSpace::ShouldFinalizeIdleMarkSweep(int64_t deadline) {
+  // Like starting the marker, finalizing mostly depends on the size of the
+  // root set, which is mostly new-space.
+  int64_t estimated_finalize_completion =
+      OS::GetCurrentMonotonicMicros() +
+      heap_->new_space()->UsedInWords() / mark_words_per_micro_;
+  return estimated_finalize_completion <= deadline;
+}
+
 void PageSpace::IncrementalMarkWithSizeBudget(intptr_t size) {
   if (marker_ != nullptr) {
     marker_->IncrementalMarkWithSizeBudget(this, size);
@@ -914,6 +979,56 @@ void PageSpace::IncrementalMarkWithTimeBudget(int64_t deadline) {
   }
 }
 
+void PageSpace::SweepWithTimeBudget(int64_t deadline) {
+  TIMELINE_FUNCTION_GC_DURATION(Thread::Current(), "SweepWithTimeBudget");
+
+  // Large pages are left to the sweeper tasks; there are few of them and
+  // each is swept in constant time.
+  GCSweeper sweeper;
+  FreeList* freelist = DataFreeList();
+  while (OS::GetCurrentMonotonicMicros() < deadline &&
+         SweepNextPage(&sweeper, freelist, /*locked=*/false)) {
+  }
+}
+
+int64_t PageSpace::EstimatedIdleWorkInBytes() {
+  Phase current_phase;
+  intptr_t marked_words = 0;
+  {
+    MonitorLocker ml(tasks_lock());
+    current_phase = phase();
+    if (current_phase == kMarking && marker_ != nullptr) {
+      marked_words = marker_->marked_words();
+    }
+  }
+  switch (current_phase) {
+    case kMarking: {
+      // Assume most of old-space survives, as for the mark speed estimate.
+      const int64_t unmarked_words = UsedInWords() - marked_words;
+      return Utils::Maximum<int64_t>(1, unmarked_words) << kWordSizeLog2;
+    }
+    case kAwaitingFinalization:
+      return Utils::Maximum<int64_t>(1, heap_->new_space()->UsedInWords())
+             << kWordSizeLog2;
+    case kSweepingLarge:
+    case kSweepingRegular: {
+      int64_t unswept_bytes = 0;
+      MutexLocker ml(&pages_lock_);
+      for (Page* page = sweep_regular_; page != nullptr; page = page->next()) {
+        unswept_bytes += page->memory_->size();
+      }
+      for (Page* page = sweep_large_; page != nullptr; page = page->next()) {
+        unswept_bytes += page->memory_->size();
+      }
+      // Pages being swept by the sweeper tasks are no longer on the lists.
+      return Utils::Maximum<int64_t>(1, unswept_bytes);
+    }
+    case kDone:
+      break;
+  }
+  return 0;
+}
+
 void PageSpace::AssistTasks(MonitorLocker* ml) {
   if (phase() == PageSpace::kMarking) {
     ml->Exit();
@@ -1029,6 +1144,9 @@ void PageSpace::CollectGarbageHelper(Thread* thread,
 
   NoSafepointScope no_safepoints(thread);
 
+  // Cached elements would otherwise be swept or evacuated while cached.
+  FlushThreadCaches();
+
   if (FLAG_print_free_list_before_gc) {
     for (intptr_t i = 0; i < num_freelists_; i++) {
       OS::PrintErr("Before GC: Freelist %" Pd "\n", i);
@@ -1386,50 +1504,77 @@ void PageSpace::Sweep(bool exclusive) {
     }
   }
 
-  MutexLocker ml(&pages_lock_);
-  while (sweep_regular_ != nullptr) {
-    Page* page = sweep_regular_;
-    sweep_regular_ = page->next();
-    page->set_next(nullptr);
-    ASSERT(!page->is_executable());
-
-    ml.Unlock();
-    // Cycle through the shards round-robin so that free space is roughly
-    // evenly distributed among the freelists and so roughly evenly available
-    // to each scavenger worker.
+  // Cycle through the shards round-robin so that free space is roughly
+  // evenly distributed among the freelists and so roughly evenly available
+  // to each scavenger worker.
+  do {
     shard = (shard + 1) % num_shards;
-    FreeList* freelist = DataFreeList(shard);
-    if (!exclusive) {
-      freelist->mutex()->Lock();
-    }
-    bool page_in_use = sweeper.SweepPage(page, freelist);
-    if (!exclusive) {
-      freelist->mutex()->Unlock();
-    }
-    intptr_t size;
-    if (!page_in_use) {
-      size = page->memory_->size();
-      page->Deallocate();
+  } while (SweepNextPage(&sweeper, DataFreeList(shard), exclusive));
+
+  if (exclusive) {
+    for (intptr_t i = 0; i < num_shards; i++) {
+      DataFreeList(i)->mutex()->Unlock();
     }
-    ml.Lock();
+  }
+}
 
-    if (page_in_use) {
-      AddPageLocked(page);
-    } else {
-      IncreaseCapacityInWordsLocked(-(size >> kWordSizeLog2));
+bool PageSpace::SweepNextPage(GCSweeper* sweeper,
+                              FreeList* freelist,
+                              bool locked) {
+  Page* page;
+  {
+    MutexLocker ml(&pages_lock_);
+    page = sweep_regular_;
+    if (page == nullptr) {
+      return false;
     }
+    sweep_regular_ = page->next();
+    page->set_next(nullptr);
   }
+  ASSERT(!page->is_executable());
 
-  if (exclusive) {
-    for (intptr_t i = 0; i < num_shards; i++) {
-      DataFreeList(i)->mutex()->Unlock();
+  if (!locked) {
+    freelist->mutex()->Lock();
+  }
+  bool page_in_use = sweeper->SweepPage(page, freelist);
+  if (!locked) {
+    freelist->mutex()->Unlock();
+  }
+  intptr_t size = 0;
+  if (!page_in_use) {
+    size = page->memory_->size();
+    page->Deallocate();
+  }
+
+  MutexLocker ml(&pages_lock_);
+  if (page_in_use) {
+    AddPageLocked(page);
+  } else {
+    IncreaseCapacityInWordsLocked(-(size >> kWordSizeLog2));
+  }
+  return true;
+}
+
+uword PageSpace::TryAllocateBySweeping(intptr_t size, FreeList* freelist) {
+  // Most misses happen when no sweep is in progress. Only take pages_lock_
+  // when there are pages left to sweep.
+  if (sweep_regular_ == nullptr) {
+    return 0;
+  }
+  GCSweeper sweeper;
+  while (SweepNextPage(&sweeper, freelist, /*locked=*/false)) {
+    uword result = freelist->TryAllocate(size, /*is_protected=*/false);
+    if (result != 0) {
+      return result;
     }
   }
+  return 0;
 }
 
 void PageSpace::ConcurrentSweep(IsolateGroup* isolate_group) {
-  // Start the concurrent sweeper task now.
-  GCSweeper::SweepConcurrent(isolate_group);
+  // Start the concurrent sweeper tasks now.
+  GCSweeper::SweepConcurrent(isolate_group,
+                             Utils::Maximum<intptr_t>(1, FLAG_sweeper_tasks));
 }
 
 void PageSpace::Compact(Thread* thread) {
@@ -18,6 +18,7 @@
 namespace dart {
 
 DECLARE_FLAG(bool, write_protect_code);
+DECLARE_FLAG(bool, old_space_thread_caches);
 
 // Forward declarations.
 class Heap;
@@ -26,6 +27,7 @@ class ObjectPointerVisitor;
 class ObjectSet;
 class ForwardingPage;
 class GCMarker;
+class GCSweeper;
 
 // The history holds the timing information of the last garbage collection
 // runs.
@@ -141,6 +143,13 @@ class PageSpace {
   uword TryAllocate(intptr_t size,
                     bool is_executable = false,
                     GrowthPolicy growth_policy = kControlGrowth) {
+    if (FLAG_old_space_thread_caches && !is_executable &&
+        FreeListCache::Handles(size)) {
+      uword result = TryAllocateCached(size);
+      if (result != 0) {
+        return result;
+      }
+    }
     bool is_protected = (is_executable) && FLAG_write_protect_code;
     bool is_locked = false;
     return TryAllocateInternal(
@@ -168,6 +177,11 @@ class PageSpace {
     return AllocateSnapshotLockedSlow(freelist, size);
   }
 
+  // Return the thread-local free-list caches to the shared data free list.
+  // FlushThreadCaches must be called at a GC safepoint.
+  void FlushThreadCache(Thread* thread);
+  void FlushThreadCaches();
+
   void TryReleaseReservation();
   bool MarkReservation();
   void TryReserveForOOM();
@@ -250,8 +264,13 @@ class PageSpace {
 
   bool ShouldStartIdleMarkSweep(int64_t deadline);
   bool ShouldPerformIdleMarkCompact(int64_t deadline);
+  bool ShouldFinalizeIdleMarkSweep(int64_t deadline);
   void IncrementalMarkWithSizeBudget(intptr_t size);
   void IncrementalMarkWithTimeBudget(int64_t deadline);
+  void SweepWithTimeBudget(int64_t deadline);
+  // An estimate of the bytes still to be marked, treated as roots or swept
+  // in the current collection. Zero if no collection is in progress.
+  int64_t EstimatedIdleWorkInBytes();
   void AssistTasks(MonitorLocker* ml);
 
   void AddGCTime(int64_t micros) { gc_time_micros_ += micros; }
@@ -396,6 +415,7 @@ class PageSpace {
 
   // Attempt to allocate from bump block rather than normal freelist.
   uword TryAllocateDataBumpLocked(FreeList* freelist, intptr_t size);
+  uword TryAllocateCached(intptr_t size);
   uword TryAllocatePromoLockedSlow(FreeList* freelist, intptr_t size);
   uword AllocateSnapshotLockedSlow(FreeList* freelist, intptr_t size);
 
@@ -422,6 +442,12 @@ class PageSpace {
   void SweepNew();
   void SweepLarge();
   void Sweep(bool exclusive);
+  // Claims and sweeps one page of sweep_regular_ into 'freelist'. Returns
+  // false if no pages remain to be swept.
+  bool SweepNextPage(GCSweeper* sweeper, FreeList* freelist, bool locked);
+  // Sweeps pages on demand into 'freelist' until it can satisfy 'size', so
+  // mutators do not grow the heap while sweeping lags behind allocation.
+  uword TryAllocateBySweeping(intptr_t size, FreeList* freelist);
   void ConcurrentSweep(IsolateGroup* isolate_group);
   void Compact(Thread* thread);
 
@@ -463,7 +489,9 @@ class PageSpace {
   Page* large_pages_ = nullptr;
   Page* large_pages_tail_ = nullptr;
   Page* image_pages_ = nullptr;
-  Page* sweep_regular_ = nullptr;
+  // Guarded by pages_lock_. Atomic so that allocation can check for
+  // unswept pages without taking the lock.
+  RelaxedAtomic<Page*> sweep_regular_ = {nullptr};
   Page* sweep_large_ = nullptr;
 
   // Various sizes being tracked for this generation.
@@ -491,6 +519,9 @@ class PageSpace {
   int64_t gc_time_micros_;
   intptr_t collections_;
   intptr_t mark_words_per_micro_;
+  // Measured copying speed of the incremental compactor's evacuation, used to
+  // keep its stop-the-world step within --incremental_compactor_pause_ms.
+  intptr_t evacuate_words_per_micro_;
 
   bool enable_concurrent_mark_;
 
@@ -0,0 +1,155 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/heap/pretenure.h"
+
+#include "vm/class_table.h"
+#include "vm/isolate.h"
+#include "vm/os.h"
+
+namespace dart {
+
+DEFINE_FLAG(bool,
+            pretenure_feedback,
+            false,
+            "Allocate classes whose instances reliably survive two scavenges "
+            "directly in old space.");
+DEFINE_FLAG(int,
+            pretenure_survival_threshold,
+            90,
+            "Percentage of a class's once-surviving bytes that must survive "
+            "the next scavenge for the class to be pretenured.");
+DEFINE_FLAG(int,
+            pretenure_min_kb,
+            64,
+            "Minimum KB of a class that must survive a scavenge before its "
+            "survival rate is considered for pretenuring.");
+DECLARE_FLAG(bool, verbose_gc);
+
+PretenureFeedback::Counters::~Counters() {
+  free(copied_);
+  free(promoted_);
+}
+
+void PretenureFeedback::Counters::Init(intptr_t num_cids) {
+  ASSERT(copied_ == nullptr);
+  if (!FLAG_pretenure_feedback) {
+    return;
+  }
+  num_cids_ = num_cids;
+  copied_ = reinterpret_cast<intptr_t*>(calloc(num_cids, sizeof(intptr_t)));
+  promoted_ = reinterpret_cast<intptr_t*>(calloc(num_cids, sizeof(intptr_t)));
+}
+
+PretenureFeedback::PretenureFeedback(IsolateGroup* isolate_group)
+    : isolate_group_(isolate_group) {}
+
+PretenureFeedback::~PretenureFeedback() {
+  free(copied_);
+  free(promoted_);
+  free(previous_copied_);
+  free(decisions_);
+}
+
+void PretenureFeedback::StartScavenge() {
+  ASSERT(copied_ == nullptr);
+  if (!FLAG_pretenure_feedback) {
+    return;
+  }
+  num_cids_ = isolate_group_->class_table()->NumCids();
+  copied_ = reinterpret_cast<intptr_t*>(calloc(num_cids_, sizeof(intptr_t)));
+  promoted_ = reinterpret_cast<intptr_t*>(calloc(num_cids_, sizeof(intptr_t)));
+}
+
+void PretenureFeedback::Merge(const Counters& counters) {
+  if (counters.copied_ == nullptr || copied_ == nullptr) {
+    return;
+  }
+  ASSERT(counters.num_cids_ <= num_cids_);
+  for (intptr_t cid = 0; cid < counters.num_cids_; cid++) {
+    copied_[cid] += counters.copied_[cid];
+    promoted_[cid] += counters.promoted_[cid];
+  }
+}
+
+void PretenureFeedback::EndScavenge(bool usable) {
+  if (copied_ == nullptr) {
+    return;
+  }
+  if (!usable) {
+    // Counts from an aborted or early-tenuring scavenge say nothing about
+    // the age of the objects.
+    free(copied_);
+    free(promoted_);
+    copied_ = promoted_ = nullptr;
+    free(previous_copied_);
+    previous_copied_ = nullptr;
+    num_previous_ = 0;
+    return;
+  }
+
+  const intptr_t min_bytes = FLAG_pretenure_min_kb * KB;
+  for (intptr_t cid = 0; cid < num_cids_; cid++) {
+    intptr_t candidates = cid < num_previous_ ? previous_copied_[cid] : 0;
+    if (candidates < min_bytes || ShouldPretenure(cid)) {
+      continue;
+    }
+    if (promoted_[cid] * 100 >= candidates * FLAG_pretenure_survival_threshold) {
+      SetDecision(cid, true);
+      if (FLAG_verbose_gc) {
+        OS::PrintErr("[pretenure] cid %" Pd ": %" Pd " of %" Pd
+                     " bytes survived twice\n",
+                     cid, promoted_[cid], candidates);
+      }
+    }
+  }
+
+  free(previous_copied_);
+  previous_copied_ = copied_;
+  num_previous_ = num_cids_;
+  free(promoted_);
+  copied_ = promoted_ = nullptr;
+}
+
+void PretenureFeedback::Reset() {
+  for (intptr_t cid = 0; cid < num_decisions_; cid++) {
+    if (decisions_[cid] != 0) {
+      SetDecision(cid, false);
+    }
+  }
+  free(previous_copied_);
+  previous_copied_ = nullptr;
+  num_previous_ = 0;
+}
+
+intptr_t PretenureFeedback::NumPretenured() const {
+  intptr_t count = 0;
+  for (intptr_t cid = 0; cid < num_decisions_; cid++) {
+    if (decisions_[cid] != 0) {
+      count++;
+    }
+  }
+  return count;
+}
+
+void PretenureFeedback::SetDecision(intptr_t cid, bool pretenure) {
+  if (cid >= num_decisions_) {
+    ASSERT(pretenure);
+    intptr_t new_size = num_cids_;
+    ASSERT(cid < new_size);
+    uint8_t* new_decisions =
+        reinterpret_cast<uint8_t*>(realloc(decisions_, new_size));
+    memset(new_decisions + num_decisions_, 0, new_size - num_decisions_);
+    decisions_ = new_decisions;
+    num_decisions_ = new_size;
+  }
+  decisions_[cid] = pretenure ? 1 : 0;
+#if !defined(PRODUCT)
+  // Divert the inline allocation fast paths, which already check this table
+  // for allocation tracing, to the runtime.
+  isolate_group_->class_table()->SetPretenureFor(cid, pretenure);
+#endif
+}
+
+}  // namespace dart
@@ -0,0 +1,109 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_HEAP_PRETENURE_H_
+#define RUNTIME_VM_HEAP_PRETENURE_H_
+
+#include "platform/assert.h"
+#include "vm/allocation.h"
+#include "vm/flags.h"
+#include "vm/globals.h"
+
+namespace dart {
+
+DECLARE_FLAG(bool, pretenure_feedback);
+
+class IsolateGroup;
+
+// Survival feedback used to allocate long-lived objects directly in old space.
+//
+// The VM has no allocation-site mementos, so feedback is kept per class id.
+// Each scavenge counts, per class, the bytes that survived for the first time
+// (copied within new space) and the bytes that survived for the second time
+// (promoted). When nearly everything that survived one scavenge also survives
+// the next, allocating the class in new space only costs two copies, and the
+// class is pretenured: runtime allocation places its instances in old space
+// and, in non-PRODUCT builds, inline allocation fast paths divert to the
+// runtime for it.
+//
+// Decisions are dropped after each old-space collection so a class whose
+// lifetime changed is reconsidered.
+class PretenureFeedback {
+ public:
+  explicit PretenureFeedback(IsolateGroup* isolate_group);
+  ~PretenureFeedback();
+
+  // Survival counts gathered by one scavenger worker.
+  class Counters : public ValueObject {
+   public:
+    Counters() {}
+    ~Counters();
+
+    // No-op unless --pretenure_feedback.
+    void Init(intptr_t num_cids);
+
+    DART_FORCE_INLINE
+    void RecordCopied(intptr_t cid, intptr_t size) {
+      if (copied_ != nullptr) {
+        ASSERT(cid < num_cids_);
+        copied_[cid] += size;
+      }
+    }
+    DART_FORCE_INLINE
+    void RecordPromoted(intptr_t cid, intptr_t size) {
+      if (promoted_ != nullptr) {
+        ASSERT(cid < num_cids_);
+        promoted_[cid] += size;
+      }
+    }
+
+   private:
+    intptr_t num_cids_ = 0;
+    intptr_t* copied_ = nullptr;
+    intptr_t* promoted_ = nullptr;
+
+    friend class PretenureFeedback;
+    DISALLOW_COPY_AND_ASSIGN(Counters);
+  };
+
+  // Whether new instances of 'cid' should be allocated in old space. May be
+  // called by mutators; decisions only change inside a safepoint.
+  bool ShouldPretenure(intptr_t cid) const {
+    return (cid < num_decisions_) && (decisions_[cid] != 0);
+  }
+
+  // Called at the safepoint of a scavenge. 'usable' is false if the scavenge
+  // was aborted or promoted objects regardless of their age.
+  void StartScavenge();
+  void Merge(const Counters& counters);
+  void EndScavenge(bool usable);
+
+  // Called after an old-space collection.
+  void Reset();
+
+  intptr_t NumPretenured() const;
+
+ private:
+  void SetDecision(intptr_t cid, bool pretenure);
+
+  IsolateGroup* isolate_group_;
+
+  // Bytes copied and promoted, per cid, by the current scavenge.
+  intptr_t num_cids_ = 0;
+  intptr_t* copied_ = nullptr;
+  intptr_t* promoted_ = nullptr;
+  // Bytes copied by the previous scavenge; the candidates for promotion in
+  // the current one.
+  intptr_t num_previous_ = 0;
+  intptr_t* previous_copied_ = nullptr;
+
+  intptr_t num_decisions_ = 0;
+  uint8_t* decisions_ = nullptr;
+
+  DISALLOW_COPY_AND_ASSIGN(PretenureFeedback);
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_HEAP_PRETENURE_H_
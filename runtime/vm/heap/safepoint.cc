@@ -5,8 +5,14 @@
 #include "vm/heap/safepoint.h"
 
 #include "vm/heap/heap.h"
+#include "vm/isolate.h"
+#include "vm/object.h"
+#include "vm/os.h"
+#include "vm/stack_frame.h"
 #include "vm/thread.h"
 #include "vm/thread_registry.h"
+#include "vm/timeline.h"
+#include "vm/zone_text_buffer.h"
 
 namespace dart {
 
@@ -83,6 +89,7 @@ void SafepointHandler::SafepointThreads(Thread* T, SafepointLevel level) {
   ASSERT(T->current_safepoint_level() >= level);
 
   MallocGrowableArray<Dart_Port> oob_isolates;
+  int64_t start_micros;
   {
     MonitorLocker tl(threads_lock());
 
@@ -118,6 +125,7 @@ void SafepointHandler::SafepointThreads(Thread* T, SafepointLevel level) {
       tl.Wait();
     }
     handlers_[level]->SetSafepointInProgress(T);
+    start_micros = OS::GetCurrentMonotonicMicros();
 
     // Ensure a thread is at a safepoint or notify it to get to one.
     handlers_[level]->NotifyThreadsToGetToSafepointLevel(T, &oob_isolates);
@@ -130,6 +138,14 @@ void SafepointHandler::SafepointThreads(Thread* T, SafepointLevel level) {
 
   // Now wait for all threads that are not already at a safepoint to check-in.
   handlers_[level]->WaitUntilThreadsReachedSafepointLevel();
+  const int64_t end_micros = OS::GetCurrentMonotonicMicros();
+  isolate_group_->GetHeapSafepointLatencyMaxMetric()->SetValue(end_micros -
+                                                               start_micros);
+#if defined(SUPPORT_TIMELINE)
+  if (Timeline::GetGCStream()->enabled()) {
+    ReportTimeToSafepoint(T, level, start_micros, end_micros);
+  }
+#endif  // defined(SUPPORT_TIMELINE)
 
   // No other mutator is running at this point. We'll set ourselves as owners of
   // all the lower levels as well - since higher levels provide even more
@@ -164,6 +180,8 @@ void SafepointHandler::LevelHandler::NotifyThreadsToGetToSafepointLevel(
     Thread* T,
     MallocGrowableArray<Dart_Port>* oob_isolates) {
   ASSERT(num_threads_not_parked_ == 0);
+  num_threads_waited_ = 0;
+  last_to_park_ = nullptr;
   for (auto current = isolate_group()->thread_registry()->active_list();
        current != nullptr; current = current->next()) {
     MonitorLocker tl(current->thread_lock());
@@ -192,6 +210,7 @@ void SafepointHandler::LevelHandler::NotifyThreadsToGetToSafepointLevel(
         }
         MonitorLocker sl(&parked_lock_);
         num_threads_not_parked_++;
+        num_threads_waited_++;
       }
     }
   }
@@ -240,6 +259,80 @@ void SafepointHandler::LevelHandler::WaitUntilThreadsReachedSafepointLevel() {
   }
 }
 
+#if defined(SUPPORT_TIMELINE)
+static const char* SafepointLevelName(SafepointLevel level) {
+  switch (level) {
+    case SafepointLevel::kGC:
+      return "GC";
+    case SafepointLevel::kGCAndDeopt:
+      return "GCAndDeopt";
+    case SafepointLevel::kGCAndDeoptAndReload:
+      return "GCAndDeoptAndReload";
+    default:
+      UNREACHABLE();
+  }
+}
+
+// Records how long it took the other threads to check in. If we had to wait,
+// the event names the last thread to check in and the top Dart frames of its
+// stack, which is where it was running without checking for safepoints
+// (e.g. a long native call or a loop without interrupt checks).
+void SafepointHandler::ReportTimeToSafepoint(Thread* T,
+                                             SafepointLevel level,
+                                             int64_t start_micros,
+                                             int64_t end_micros) {
+  const LevelHandler* handler = handlers_[level];
+  const char* thread_name = nullptr;
+  const char* stack = nullptr;
+  Zone* zone = T->zone();
+  if (handler->last_to_park_ != nullptr && zone != nullptr) {
+    // The threads lock keeps the thread in the active list, and it cannot
+    // run Dart code until we resume it, so its stack can be walked.
+    MonitorLocker ml(threads_lock());
+    for (Thread* current = isolate_group()->thread_registry()->active_list();
+         current != nullptr; current = current->next()) {
+      if (current != handler->last_to_park_) continue;
+      OSThread* os_thread = current->os_thread();
+      if (os_thread != nullptr && os_thread->name() != nullptr) {
+        thread_name = zone->MakeCopyOfString(os_thread->name());
+      }
+      ZoneTextBuffer buffer(zone);
+      const intptr_t kMaxFrames = 8;
+      intptr_t num_frames = 0;
+      auto& function = Function::Handle(zone);
+      StackFrameIterator frames(ValidationPolicy::kDontValidateFrames, current,
+                                StackFrameIterator::kAllowCrossThreadIteration);
+      for (StackFrame* frame = frames.NextFrame();
+           frame != nullptr && num_frames < kMaxFrames;
+           frame = frames.NextFrame()) {
+        if (!frame->IsDartFrame(/*validate=*/false)) continue;
+        function = frame->LookupDartFunction();
+        if (function.IsNull()) continue;
+        buffer.Printf("%s%s", num_frames > 0 ? "\n" : "",
+                      function.ToFullyQualifiedCString());
+        num_frames++;
+      }
+      stack = buffer.buffer();
+      break;
+    }
+  }
+
+  TimelineEvent* event = Timeline::GetGCStream()->StartEvent();
+  if (event == nullptr) return;
+  event->Duration("TimeToSafepoint", start_micros, end_micros);
+  event->SetNumArguments(stack != nullptr ? 4 : 2);
+  event->CopyArgument(0, "level", SafepointLevelName(level));
+  event->FormatArgument(1, "threadsWaitedFor", "%" Pd32,
+                        handler->num_threads_waited_);
+  if (stack != nullptr) {
+    event->CopyArgument(2, "lastThread",
+                        thread_name != nullptr ? thread_name : "");
+    event->CopyArgument(3, "lastThreadStack", stack);
+  }
+  event->Complete();
+}
+#endif  // defined(SUPPORT_TIMELINE)
+
 void SafepointHandler::AcquireLowerLevelSafepoints(Thread* T,
                                                    SafepointLevel level) {
   MonitorLocker tl(threads_lock());
@@ -353,6 +446,7 @@ void SafepointHandler::LevelHandler::NotifyWeAreParked(Thread* T) {
   ASSERT(num_threads_not_parked_ > 0);
   num_threads_not_parked_ -= 1;
   if (num_threads_not_parked_ == 0) {
+    last_to_park_ = T;
     sl.Notify();
   }
 }
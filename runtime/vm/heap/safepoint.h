@@ -195,6 +195,11 @@ class SafepointHandler {
     // Count the number of threads the currently in-progress safepoint operation
     // is waiting for to check-in.
     int32_t num_threads_not_parked_ = 0;
+
+    // The number of threads the in-progress safepoint operation had to wait
+    // for and the last of them to check in, for time-to-safepoint events.
+    int32_t num_threads_waited_ = 0;
+    Thread* last_to_park_ = nullptr;
   };
 
   void SafepointThreads(Thread* T, SafepointLevel level);
@@ -204,6 +209,10 @@ class SafepointHandler {
   void AssertWeOwnLowerLevelSafepoints(Thread* T, SafepointLevel level);
   void AssertWeDoNotOwnLowerLevelSafepoints(Thread* T, SafepointLevel level);
   void AcquireLowerLevelSafepoints(Thread* T, SafepointLevel level);
+  void ReportTimeToSafepoint(Thread* T,
+                             SafepointLevel level,
+                             int64_t start_micros,
+                             int64_t end_micros);
 
   // Helper methods for [ResumeThreads]
   void ReleaseLowerLevelSafepoints(Thread* T, SafepointLevel level);
@@ -15,8 +15,10 @@
 #include "vm/heap/become.h"
 #include "vm/heap/gc_shared.h"
 #include "vm/heap/marker.h"
+#include "vm/heap/numa.h"
 #include "vm/heap/pages.h"
 #include "vm/heap/pointer_block.h"
+#include "vm/heap/pretenure.h"
 #include "vm/heap/safepoint.h"
 #include "vm/heap/verifier.h"
 #include "vm/heap/weak_table.h"
@@ -46,6 +48,11 @@ DEFINE_FLAG(int,
             90,
             "Grow new gen when less than this percentage is garbage.");
 DEFINE_FLAG(int, new_gen_growth_factor, 2, "Grow new gen by this factor.");
+DEFINE_FLAG(int,
+            new_gen_target_pause_ms,
+            0,
+            "When positive, limit new gen to the size that the measured "
+            "scavenge speed can collect in this many milliseconds.");
 
 // Scavenger uses the kCardRememberedBit to distinguish forwarded and
 // non-forwarded objects. We must choose a bit that is clear for all new-space
@@ -142,9 +149,12 @@ class ScavengerVisitorBase : public ObjectPointerVisitor,
         page_space_(scavenger->heap_->old_space()),
         freelist_(freelist),
         bytes_promoted_(0),
+        weak_micros_(0),
         visiting_old_object_(nullptr),
         pending_(nullptr),
-        promoted_list_(promotion_stack) {}
+        promoted_list_(promotion_stack) {
+    survival_.Init(isolate_group->class_table()->NumCids());
+  }
   ~ScavengerVisitorBase() { ASSERT(pending_ == nullptr); }
 
 #ifdef DEBUG
@@ -276,6 +286,10 @@ class ScavengerVisitorBase : public ObjectPointerVisitor,
   DART_FORCE_INLINE intptr_t ProcessObject(ObjectPtr obj);
 
   intptr_t bytes_promoted() const { return bytes_promoted_; }
+  // Time spent on weak properties whose keys might have been copied, and on
+  // mourning weak objects after the scavenge.
+  int64_t weak_micros() const { return weak_micros_; }
+  const PretenureFeedback::Counters& survival() const { return survival_; }
 
   void ProcessRoots() {
     thread_ = Thread::Current();
@@ -346,9 +360,11 @@ class ScavengerVisitorBase : public ObjectPointerVisitor,
         page->RecordSurvivors();
       }
 
+      const int64_t mourn_start = OS::GetCurrentMonotonicMicros();
       MournWeakProperties();
       MournWeakReferences();
       MournWeakArrays();
+      weak_micros_ += OS::GetCurrentMonotonicMicros() - mourn_start;
       MournFinalizerEntries();
       scavenger_->IterateWeak();
     }
@@ -470,7 +486,8 @@ class ScavengerVisitorBase : public ObjectPointerVisitor,
       ASSERT(IsAllocatableInNewSpace(size));
       uword new_addr = 0;
       // Check whether object should be promoted.
-      if (!Page::Of(obj)->IsSurvivor(raw_addr)) {
+      const bool is_survivor = Page::Of(obj)->IsSurvivor(raw_addr);
+      if (!is_survivor) {
         // Not a survivor of a previous scavenge. Just copy the object into the
         // to space.
         new_addr = TryAllocateCopy(size);
@@ -517,6 +534,11 @@ class ScavengerVisitorBase : public ObjectPointerVisitor,
           // be traversed later.
           promoted_list_.Push(new_obj);
           bytes_promoted_ += size;
+          if (is_survivor) {
+            survival_.RecordPromoted(cid, size);
+          }
+        } else {
+          survival_.RecordCopied(cid, size);
         }
       } else {
         ASSERT(IsForwarding(header));
@@ -619,8 +641,10 @@ class ScavengerVisitorBase : public ObjectPointerVisitor,
   PageSpace* page_space_;
   FreeList* freelist_;
   intptr_t bytes_promoted_;
+  int64_t weak_micros_;
   ObjectPtr visiting_old_object_;
   StoreBufferBlock* pending_;
+  PretenureFeedback::Counters survival_;
   PromotionWorkList promoted_list_;
   LocalBlockWorkList<64, WeakArrayPtr> weak_array_list_;
   LocalBlockWorkList<64, WeakPropertyPtr> weak_property_list_;
@@ -675,11 +699,13 @@ class ParallelScavengerTask : public SafepointTask {
   ParallelScavengerTask(IsolateGroup* isolate_group,
                         ThreadBarrier* barrier,
                         ParallelScavengerVisitor* visitor,
-                        RelaxedAtomic<uintptr_t>* num_busy)
+                        RelaxedAtomic<uintptr_t>* num_busy,
+                        intptr_t id)
       : isolate_group_(isolate_group),
         barrier_(barrier),
         visitor_(visitor),
-        num_busy_(num_busy) {}
+        num_busy_(num_busy),
+        id_(id) {}
   ~ParallelScavengerTask() { barrier_->Release(); }
 
   void Run() override {
@@ -687,6 +713,10 @@ class ParallelScavengerTask : public SafepointTask {
       return;
     }
 
+    // Spread helpers across nodes so their to-space and promotion pages are
+    // node-local.
+    NumaAffinityScope affinity(id_);
+
     bool result = Thread::EnterIsolateGroupAsHelper(
         isolate_group_, Thread::kScavengerTask, /*bypass_safepoint=*/true);
     ASSERT(result);
@@ -775,6 +805,7 @@ class ParallelScavengerTask : public SafepointTask {
   ThreadBarrier* barrier_;
   ParallelScavengerVisitor* visitor_;
   RelaxedAtomic<uintptr_t>* num_busy_;
+  intptr_t id_;
 
   DISALLOW_COPY_AND_ASSIGN(ParallelScavengerTask);
 };
@@ -845,6 +876,7 @@ static constexpr intptr_t kConservativeInitialScavengeSpeed = 40;
 
 Scavenger::Scavenger(Heap* heap, intptr_t max_semi_capacity_in_words)
     : heap_(heap),
+      pretenure_(heap->isolate_group()),
       max_semi_capacity_in_words_(max_semi_capacity_in_words),
       scavenge_words_per_micro_(kConservativeInitialScavengeSpeed) {
   ASSERT(heap != nullptr);
@@ -902,6 +934,20 @@ intptr_t Scavenger::NewSizeInWords(intptr_t old_size_in_words,
   limit = Utils::Minimum(limit, heap_->old_space()->UsedInWords() / 8);
   // Preserve old behavior when heap size is small.
   limit = Utils::Maximum(limit, max_semi_capacity_in_words_);
+  if (FLAG_new_gen_target_pause_ms > 0) {
+    // Favor latency: shrink new-space if a scavenge of a full new-space would
+    // take longer than the target pause, but keep two TLABs per mutator.
+    int64_t pause_limit = static_cast<int64_t>(scavenge_words_per_micro_) *
+                          FLAG_new_gen_target_pause_ms *
+                          kMicrosecondsPerMillisecond;
+    const intptr_t min_tlabs =
+        2 * Utils::Maximum(num_mutators, static_cast<intptr_t>(1));
+    pause_limit = Utils::Maximum(
+        pause_limit, static_cast<int64_t>(min_tlabs * kPageSizeInWords));
+    if (pause_limit < limit) {
+      limit = static_cast<intptr_t>(pause_limit);
+    }
+  }
   // Align to TLAB size.
   limit = Utils::RoundDown(limit, kPageSizeInWords);
 
@@ -1394,6 +1440,7 @@ void ScavengerVisitorBase<parallel>::ProcessWeakPropertiesScoped() {
   // Finished this round of scavenging. Process the pending weak properties
   // for which the keys have become reachable. Potentially this adds more
   // objects to the to space.
+  const int64_t start = OS::GetCurrentMonotonicMicros();
   weak_property_list_.Process([&](WeakPropertyPtr weak_property) {
     ObjectPtr key = weak_property->untag()->key();
     ASSERT(key->IsHeapObject());
@@ -1408,6 +1455,7 @@ void ScavengerVisitorBase<parallel>::ProcessWeakPropertiesScoped() {
       weak_property_list_.Push(weak_property);
     }
   });
+  weak_micros_ += OS::GetCurrentMonotonicMicros() - start;
 }
 
 void Scavenger::UpdateMaxHeapCapacity() {
@@ -1965,6 +2013,8 @@ void Scavenger::Scavenge(Thread* thread, GCType type, GCReason reason) {
   }
   heap_->old_space()->PauseConcurrentMarking();
   SemiSpace* from = Prologue(reason);
+  const bool early_tenured = early_tenure_;
+  pretenure_.StartScavenge();
 
   intptr_t bytes_promoted;
   if (FLAG_scavenger_tasks == 0) {
@@ -1983,6 +2033,7 @@ void Scavenger::Scavenge(Thread* thread, GCType type, GCReason reason) {
     }
   }
   ASSERT(promotion_stack_.IsEmpty());
+  pretenure_.EndScavenge(/*usable=*/!abort_ && !early_tenured);
 
   // Scavenge finished. Run accounting.
   int64_t end = OS::GetCurrentMonotonicMicros();
@@ -2050,6 +2101,7 @@ intptr_t Scavenger::SerialScavenge(SemiSpace* from) {
   visitor.ProcessWeak();
   visitor.Finalize(heap_->isolate_group()->store_buffer());
   to_->AddList(visitor.head(), visitor.tail());
+  pretenure_.Merge(visitor.survival());
   return visitor.bytes_promoted();
 }
 
@@ -2070,7 +2122,7 @@ intptr_t Scavenger::ParallelScavenge(SemiSpace* from) {
     visitors[i] = new ParallelScavengerVisitor(isolate_group, this, from,
                                                freelist, &promotion_stack_);
     tasks.Append(new ParallelScavengerTask(isolate_group, barrier, visitors[i],
-                                           &num_busy));
+                                           &num_busy, i));
   }
   isolate_group->safepoint_handler()->RunTasks(&tasks);
 
@@ -2080,6 +2132,13 @@ intptr_t Scavenger::ParallelScavenge(SemiSpace* from) {
     visitor->Finalize(store_buffer);
     to_->AddList(visitor->head(), visitor->tail());
     bytes_promoted += visitor->bytes_promoted();
+    pretenure_.Merge(visitor->survival());
+    if (FLAG_verbose_gc) {
+      OS::PrintErr("[ GC scavenger task %" Pd ": promoted %" Pd
+                   " kB, weak %.1f ms ]\n",
+                   i, visitor->bytes_promoted() / KB,
+                   MicrosecondsToMilliseconds(visitor->weak_micros()));
+    }
     delete visitor;
   }
 
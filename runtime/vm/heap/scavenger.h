@@ -12,6 +12,7 @@
 #include "vm/flags.h"
 #include "vm/globals.h"
 #include "vm/heap/page.h"
+#include "vm/heap/pretenure.h"
 #include "vm/heap/spaces.h"
 #include "vm/isolate.h"
 #include "vm/lockers.h"
@@ -174,6 +175,10 @@ class Scavenger {
     return usage;
   }
   intptr_t ThresholdInWords() const { return to_->gc_threshold_in_words(); }
+  // The measured scavenge speed that sizes the next semi-space.
+  intptr_t scavenge_words_per_micro() const {
+    return scavenge_words_per_micro_;
+  }
 
   void VisitObjects(ObjectVisitor* visitor) const;
   void VisitObjectPointers(ObjectPointerVisitor* visitor) const;
@@ -236,6 +241,9 @@ class Scavenger {
 
   Page* head() const { return to_->head(); }
 
+  PretenureFeedback* pretenure_feedback() { return &pretenure_; }
+  const PretenureFeedback* pretenure_feedback() const { return &pretenure_; }
+
   void PruneNew();
   void PruneDeferred();
   void Forward(MarkingStackBlock* blocks);
@@ -304,6 +312,8 @@ class Scavenger {
 
   SemiSpace* to_;
 
+  PretenureFeedback pretenure_;
+
   PromotionStack promotion_stack_;
 
   intptr_t max_semi_capacity_in_words_;
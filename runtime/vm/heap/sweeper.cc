@@ -164,10 +164,22 @@ intptr_t GCSweeper::SweepLargePage(Page* page) {
   return words_to_end;
 }
 
+// Shared by the tasks of one concurrent sweep. Guarded by the tasks lock.
+struct ConcurrentSweepState {
+  explicit ConcurrentSweepState(intptr_t num_tasks)
+      : sweeping_large(num_tasks), running(num_tasks) {}
+
+  // Tasks that have not yet finished with the large pages.
+  intptr_t sweeping_large;
+  // Tasks that have not yet finished.
+  intptr_t running;
+};
+
 class ConcurrentSweeperTask : public ThreadPool::Task {
  public:
-  explicit ConcurrentSweeperTask(IsolateGroup* isolate_group)
-      : isolate_group_(isolate_group) {
+  ConcurrentSweeperTask(IsolateGroup* isolate_group,
+                        ConcurrentSweepState* state)
+      : isolate_group_(isolate_group), state_(state) {
     ASSERT(isolate_group != nullptr);
     PageSpace* old_space = isolate_group->heap()->old_space();
     MonitorLocker ml(old_space->tasks_lock());
@@ -175,6 +187,8 @@ class ConcurrentSweeperTask : public ThreadPool::Task {
     old_space->set_phase(PageSpace::kSweepingLarge);
   }
 
+  virtual Kind kind() const { return kGC; }
+
   virtual void Run() {
     bool result = Thread::EnterIsolateGroupAsNonMutator(isolate_group_,
                                                         Thread::kSweeperTask);
@@ -188,10 +202,13 @@ class ConcurrentSweeperTask : public ThreadPool::Task {
       old_space->SweepLarge();
 
       {
+        // The large page list is complete once every task is done with it.
         MonitorLocker ml(old_space->tasks_lock());
         ASSERT(old_space->phase() == PageSpace::kSweepingLarge);
-        old_space->set_phase(PageSpace::kSweepingRegular);
-        ml.NotifyAll();
+        if (--state_->sweeping_large == 0) {
+          old_space->set_phase(PageSpace::kSweepingRegular);
+          ml.NotifyAll();
+        }
       }
 
       old_space->Sweep(/*exclusive*/ false);
@@ -202,19 +219,29 @@ class ConcurrentSweeperTask : public ThreadPool::Task {
     {
       MonitorLocker ml(old_space->tasks_lock());
       old_space->set_tasks(old_space->tasks() - 1);
-      ASSERT(old_space->phase() == PageSpace::kSweepingRegular);
-      old_space->set_phase(PageSpace::kDone);
+      if (--state_->running == 0) {
+        ASSERT(old_space->phase() == PageSpace::kSweepingRegular);
+        old_space->set_phase(PageSpace::kDone);
+        delete state_;
+      }
       ml.NotifyAll();
     }
   }
 
  private:
   IsolateGroup* isolate_group_;
+  ConcurrentSweepState* state_;
 };
 
-void GCSweeper::SweepConcurrent(IsolateGroup* isolate_group) {
-  bool result = Dart::thread_pool()->Run<ConcurrentSweeperTask>(isolate_group);
-  ASSERT(result);
+void GCSweeper::SweepConcurrent(IsolateGroup* isolate_group,
+                                intptr_t num_tasks) {
+  ASSERT(num_tasks > 0);
+  ConcurrentSweepState* state = new ConcurrentSweepState(num_tasks);
+  for (intptr_t i = 0; i < num_tasks; i++) {
+    bool result =
+        Dart::thread_pool()->Run<ConcurrentSweeperTask>(isolate_group, state);
+    ASSERT(result);
+  }
 }
 
 }  // namespace dart
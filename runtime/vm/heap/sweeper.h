@@ -36,8 +36,9 @@ class GCSweeper {
 
   intptr_t SweepNewPage(Page* page);
 
-  // Sweep the large and regular sized data pages.
-  static void SweepConcurrent(IsolateGroup* isolate_group);
+  // Sweep the large and regular sized data pages on 'num_tasks' concurrent
+  // tasks, which claim pages from the PageSpace's sweep lists one at a time.
+  static void SweepConcurrent(IsolateGroup* isolate_group, intptr_t num_tasks);
 };
 
 }  // namespace dart
@@ -0,0 +1,119 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_VM_HEAP_WORK_STEALING_DEQUE_H_
+#define RUNTIME_VM_HEAP_WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+
+#include "platform/assert.h"
+#include "platform/utils.h"
+#include "vm/allocation.h"
+#include "vm/globals.h"
+
+namespace dart {
+
+// A fixed-capacity Chase-Lev work-stealing deque.
+//
+// The owning thread pushes and pops at the bottom without contention. Any
+// other thread may steal from the top. The memory orderings follow
+// "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al.,
+// PPoPP 2013).
+//
+// The capacity is fixed so that no buffer is ever reclaimed while a thief may
+// still be reading from it. When the deque is full, Push fails and the owner
+// is expected to overflow into a shared structure (e.g., a MarkingStack).
+template <typename T, intptr_t Capacity>
+class WorkStealingDeque : public MallocAllocated {
+ public:
+  static constexpr intptr_t kCapacity = Capacity;
+  static_assert(Utils::IsPowerOfTwo(kCapacity), "Capacity must be power of 2");
+
+  WorkStealingDeque() : top_(0), bottom_(0) {}
+  ~WorkStealingDeque() { ASSERT(IsEmpty()); }
+
+  // Owner only. Returns false if the deque is full.
+  DART_FORCE_INLINE
+  bool Push(T value) {
+    intptr_t b = bottom_.load(std::memory_order_relaxed);
+    intptr_t t = top_.load(std::memory_order_acquire);
+    if (b - t >= kCapacity) {
+      return false;
+    }
+    buffer_[b & kMask].store(value, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Owner only. Returns false if the deque is empty or the last element was
+  // taken by a thief.
+  DART_FORCE_INLINE
+  bool Pop(T* value) {
+    intptr_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    intptr_t t = top_.load(std::memory_order_relaxed);
+    if (t > b) {
+      // Empty.
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return false;
+    }
+    *value = buffer_[b & kMask].load(std::memory_order_relaxed);
+    if (t == b) {
+      // Last element: race against thieves.
+      bool won = top_.compare_exchange_strong(
+          t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return won;
+    }
+    return true;
+  }
+
+  enum StealResult {
+    kEmpty,
+    kAborted,  // Lost a race with the owner or another thief.
+    kSuccess,
+  };
+
+  // Any thread.
+  StealResult Steal(T* value) {
+    intptr_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    intptr_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) {
+      return kEmpty;
+    }
+    T result = buffer_[t & kMask].load(std::memory_order_relaxed);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return kAborted;
+    }
+    *value = result;
+    return kSuccess;
+  }
+
+  // Approximate when called by a thread other than the owner.
+  intptr_t Size() const {
+    intptr_t b = bottom_.load(std::memory_order_relaxed);
+    intptr_t t = top_.load(std::memory_order_relaxed);
+    return b > t ? b - t : 0;
+  }
+  bool IsEmpty() const { return Size() == 0; }
+
+ private:
+  static constexpr intptr_t kMask = kCapacity - 1;
+
+  // Thieves and the owner write to different ends; keep them on separate
+  // cache lines.
+  alignas(64) std::atomic<intptr_t> top_;
+  alignas(64) std::atomic<intptr_t> bottom_;
+  alignas(64) std::atomic<T> buffer_[kCapacity];
+
+  DISALLOW_COPY_AND_ASSIGN(WorkStealingDeque);
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_HEAP_WORK_STEALING_DEQUE_H_
@@ -0,0 +1,116 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/heap/work_stealing_deque.h"
+#include "platform/assert.h"
+#include "vm/thread_barrier.h"
+#include "vm/thread_pool.h"
+#include "vm/unit_test.h"
+
+namespace dart {
+
+typedef WorkStealingDeque<intptr_t, 16> TestDeque;
+
+VM_UNIT_TEST_CASE(WorkStealingDeque_OwnerLifoThiefFifo) {
+  TestDeque deque;
+  intptr_t value;
+  EXPECT(deque.IsEmpty());
+  EXPECT(!deque.Pop(&value));
+  EXPECT_EQ(TestDeque::kEmpty, deque.Steal(&value));
+
+  for (intptr_t i = 0; i < TestDeque::kCapacity; i++) {
+    EXPECT(deque.Push(i));
+  }
+  // Full.
+  EXPECT(!deque.Push(100));
+  EXPECT_EQ(TestDeque::kCapacity, deque.Size());
+
+  EXPECT(deque.Pop(&value));
+  EXPECT_EQ(TestDeque::kCapacity - 1, value);
+  EXPECT_EQ(TestDeque::kSuccess, deque.Steal(&value));
+  EXPECT_EQ(0, value);
+  EXPECT_EQ(TestDeque::kSuccess, deque.Steal(&value));
+  EXPECT_EQ(1, value);
+
+  // Space freed by thieves can be reused by the owner.
+  EXPECT(deque.Push(200));
+  EXPECT(deque.Push(201));
+  EXPECT(!deque.Push(202));
+
+  intptr_t count = 0;
+  while (deque.Pop(&value)) {
+    count++;
+  }
+  EXPECT_EQ(TestDeque::kCapacity, count);
+  EXPECT(deque.IsEmpty());
+}
+
+typedef WorkStealingDeque<intptr_t, 256> StressDeque;
+
+class StealTask : public ThreadPool::Task {
+ public:
+  StealTask(StressDeque* deque,
+            RelaxedAtomic<intptr_t>* taken,
+            RelaxedAtomic<bool>* done,
+            ThreadBarrier* barrier)
+      : deque_(deque), taken_(taken), done_(done), barrier_(barrier) {}
+
+  virtual void Run() {
+    while (!done_->load() || !deque_->IsEmpty()) {
+      intptr_t value;
+      if (deque_->Steal(&value) == StressDeque::kSuccess) {
+        taken_[value].fetch_add(1);
+      }
+    }
+    barrier_->Sync();
+    barrier_->Release();
+  }
+
+ private:
+  StressDeque* deque_;
+  RelaxedAtomic<intptr_t>* taken_;
+  RelaxedAtomic<bool>* done_;
+  ThreadBarrier* barrier_;
+};
+
+VM_UNIT_TEST_CASE(WorkStealingDeque_ConcurrentSteal) {
+  const intptr_t kNumThieves = 3;
+  const intptr_t kNumValues = 100000;
+  StressDeque deque;
+  RelaxedAtomic<intptr_t>* taken = new RelaxedAtomic<intptr_t>[kNumValues];
+  for (intptr_t i = 0; i < kNumValues; i++) {
+    taken[i] = 0;
+  }
+  RelaxedAtomic<bool> done = false;
+  ThreadBarrier* barrier = new ThreadBarrier(kNumThieves + 1, kNumThieves + 1);
+  for (intptr_t i = 0; i < kNumThieves; i++) {
+    Dart::thread_pool()->Run<StealTask>(&deque, taken, &done, barrier);
+  }
+
+  intptr_t value;
+  for (intptr_t i = 0; i < kNumValues; i++) {
+    while (!deque.Push(i)) {
+      if (deque.Pop(&value)) {
+        taken[value].fetch_add(1);
+      }
+    }
+    if ((i % 3) == 0 && deque.Pop(&value)) {
+      taken[value].fetch_add(1);
+    }
+  }
+  while (deque.Pop(&value)) {
+    taken[value].fetch_add(1);
+  }
+  done = true;
+  barrier->Sync();
+  barrier->Release();
+
+  // Every value is taken exactly once, by either the owner or a thief.
+  for (intptr_t i = 0; i < kNumValues; i++) {
+    EXPECT_EQ(1, taken[i].load());
+  }
+  delete[] taken;
+}
+
+}  // namespace dart
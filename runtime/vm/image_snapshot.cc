@@ -291,6 +291,8 @@ intptr_t ImageWriter::SizeInSnapshot(ObjectPtr raw_object) {
       return compiler::target::String::InstanceSize(
           String::LengthOf(raw_str) * TwoByteString::kBytesPerElement);
     }
+    case kDoubleCid:
+      return compiler::target::Double::InstanceSize();
     default: {
       const Class& clazz = Class::Handle(Object::Handle(raw_object).clazz());
       FATAL("Unsupported class %s in rodata section.\n", clazz.ToCString());
@@ -585,6 +587,12 @@ void ImageWriter::WriteROData(NonStreamingWriteStream* stream, bool vm) {
           str.Length() * (str.IsOneByteString()
                               ? OneByteString::kBytesPerElement
                               : TwoByteString::kBytesPerElement));
+    } else if (obj.IsDouble()) {
+      while (stream->Position() - object_start <
+             compiler::target::Double::value_offset()) {
+        stream->WriteFixed<uint8_t>(0);
+      }
+      stream->WriteFixed<double>(Double::Cast(obj).value());
     } else {
       const Class& clazz = Class::Handle(obj.clazz());
       FATAL("Unsupported class %s in rodata section.\n", clazz.ToCString());
@@ -40,6 +40,13 @@ DEFINE_FLAG(uint64_t,
             interpreter_trace_file_max_bytes,
             100 * MB,
             "Maximum size in bytes of the interpreter trace file");
+#if !defined(DART_PRECOMPILED_RUNTIME)
+DEFINE_FLAG(bool,
+            print_hot_bytecode_functions,
+            false,
+            "Print bytecode functions whose usage counter reaches the "
+            "optimization threshold.");
+#endif
 
 // InterpreterSetjmpBuffer are linked together, and the last created one
 // is referenced by the Interpreter. When an exception is thrown, the exception
@@ -652,6 +659,17 @@ DART_NOINLINE bool Interpreter::InvokeCompiled(Thread* thread,
   return true;
 }
 
+#if !defined(DART_PRECOMPILED_RUNTIME)
+// Bytecode is never compiled, so these functions stay interpreted however hot
+// they get.
+static DART_NOINLINE void ReportHotBytecodeFunction(FunctionPtr function) {
+  const Function& f = Function::Handle(function);
+  if (f.WasReportedHot()) return;
+  f.SetWasReportedHot(true);
+  THR_Print("Hot bytecode function %s\n", f.ToFullyQualifiedCString());
+}
+#endif
+
 DART_FORCE_INLINE bool Interpreter::InvokeBytecode(Thread* thread,
                                                    FunctionPtr function,
                                                    ObjectPtr* call_base,
@@ -669,6 +687,13 @@ DART_FORCE_INLINE bool Interpreter::InvokeBytecode(Thread* thread,
 #endif
   ObjectPtr* callee_fp = call_top + kKBCDartFrameFixedSize;
   ASSERT(function == FrameFunction(callee_fp));
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  if (UNLIKELY(FLAG_print_hot_bytecode_functions) &&
+      function->untag()->usage_counter_ >=
+          thread->isolate_group()->optimization_counter_threshold()) {
+    ReportHotBytecodeFunction(function);
+  }
+#endif
   BytecodePtr bytecode = Function::GetBytecode(function);
   callee_fp[kKBCPcMarkerSlotFromFp] = bytecode;
   callee_fp[kKBCSavedCallerPcSlotFromFp] =
@@ -750,10 +775,12 @@ DART_FORCE_INLINE bool Interpreter::InstanceCall(Thread* thread,
     target = static_cast<FunctionPtr>(top[4]);
     target_name = static_cast<StringPtr>(top[2]);
     argdesc_ = static_cast<ArrayPtr>(top[3]);
+    if (target != Function::null()) {
+      lookup_cache_.Insert(receiver_cid, target_name, argdesc_, target);
+    }
   }
 
   if (target != Function::null()) {
-    lookup_cache_.Insert(receiver_cid, target_name, argdesc_, target);
     top[0] = target;
     return Invoke(thread, call_base, top, pc, FP, SP);
   }
@@ -851,6 +878,27 @@ DART_FORCE_INLINE bool Interpreter::InstanceCall(Thread* thread,
 // Load target of a jump instruction into PC.
 #define LOAD_JUMP_TARGET() pc = rT
 
+// Push the bool result of a comparison and dispatch. Comparisons are usually
+// followed by JumpIfTrue or JumpIfFalse, which is then executed right away
+// instead of materializing the bool and dispatching to the jump.
+#define DISPATCH_COMPARISON_RESULT(condition)                                  \
+  do {                                                                         \
+    const bool result = (condition);                                           \
+    const KBCInstr next_op = *pc;                                              \
+    if (next_op == KernelBytecode::kJumpIfTrue ||                              \
+        next_op == KernelBytecode::kJumpIfFalse) {                             \
+      SP -= 1;                                                                 \
+      if (result == (next_op == KernelBytecode::kJumpIfTrue)) {                \
+        pc += static_cast<int8_t>(pc[1]);                                      \
+      } else {                                                                 \
+        pc += 2;                                                               \
+      }                                                                        \
+      DISPATCH();                                                              \
+    }                                                                          \
+    SP[0] = result ? true_value : false_value;                                 \
+    DISPATCH();                                                                \
+  } while (0)
+
 #define BYTECODE_ENTRY_LABEL(Name) bc##Name:
 #define BYTECODE_WIDE_ENTRY_LABEL(Name) bc##Name##_Wide:
 #define BYTECODE_IMPL_LABEL(Name) bc##Name##Impl:
@@ -2951,8 +2999,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_INT64(a, SP[0], Symbols::RAngleBracket());
     UNBOX_INT64(b, SP[1], Symbols::RAngleBracket());
-    SP[0] = (a > b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_COMPARISON_RESULT(a > b);
   }
 
   {
@@ -2961,8 +3008,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_INT64(a, SP[0], Symbols::LAngleBracket());
     UNBOX_INT64(b, SP[1], Symbols::LAngleBracket());
-    SP[0] = (a < b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_COMPARISON_RESULT(a < b);
   }
 
   {
@@ -2971,8 +3017,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_INT64(a, SP[0], Symbols::GreaterEqualOperator());
     UNBOX_INT64(b, SP[1], Symbols::GreaterEqualOperator());
-    SP[0] = (a >= b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_COMPARISON_RESULT(a >= b);
   }
 
   {
@@ -2981,8 +3026,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_INT64(a, SP[0], Symbols::LessEqualOperator());
     UNBOX_INT64(b, SP[1], Symbols::LessEqualOperator());
-    SP[0] = (a <= b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_COMPARISON_RESULT(a <= b);
   }
 
   {
@@ -3058,8 +3102,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_DOUBLE(a, SP[0], Symbols::RAngleBracket());
     UNBOX_DOUBLE(b, SP[1], Symbols::RAngleBracket());
-    SP[0] = (a > b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_COMPARISON_RESULT(a > b);
   }
 
   {
@@ -3068,8 +3111,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_DOUBLE(a, SP[0], Symbols::LAngleBracket());
     UNBOX_DOUBLE(b, SP[1], Symbols::LAngleBracket());
-    SP[0] = (a < b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_COMPARISON_RESULT(a < b);
   }
 
   {
@@ -3078,8 +3120,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_DOUBLE(a, SP[0], Symbols::GreaterEqualOperator());
     UNBOX_DOUBLE(b, SP[1], Symbols::GreaterEqualOperator());
-    SP[0] = (a >= b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_COMPARISON_RESULT(a >= b);
   }
 
   {
@@ -3088,8 +3129,7 @@ SwitchDispatch:
     SP -= 1;
     UNBOX_DOUBLE(a, SP[0], Symbols::LessEqualOperator());
     UNBOX_DOUBLE(b, SP[1], Symbols::LessEqualOperator());
-    SP[0] = (a <= b) ? true_value : false_value;
-    DISPATCH();
+    DISPATCH_COMPARISON_RESULT(a <= b);
   }
 
   {
@@ -238,6 +238,22 @@ void IdleTimeHandler::NotifyIdle(int64_t deadline) {
   }
 }
 
+int64_t IdleTimeHandler::PerformIdleSlice(int64_t deadline) {
+  {
+    MutexLocker ml(&mutex_);
+    disabled_counter_++;
+  }
+  int64_t remaining = 0;
+  if (heap_ != nullptr) {
+    remaining = heap_->PerformIdleSlice(deadline);
+  }
+  {
+    MutexLocker ml(&mutex_);
+    disabled_counter_--;
+  }
+  return remaining;
+}
+
 void IdleTimeHandler::NotifyIdleUsingDefaultDeadline() {
   const int64_t now = OS::GetCurrentMonotonicMicros();
   NotifyIdle(now + FLAG_idle_duration_micros);
@@ -437,6 +453,26 @@ IsolateGroup::~IsolateGroup() {
   delete debugger_;
   debugger_ = nullptr;
 #endif
+
+  auto it = native_asset_handles_.GetIterator();
+  while (auto* pair = it.Next()) {
+    free(const_cast<char*>(pair->key));
+  }
+}
+
+void* IsolateGroup::LookupNativeAssetHandle(const char* asset_id) {
+  MutexLocker ml(&native_asset_handles_mutex_);
+  auto* const pair = native_asset_handles_.Lookup(asset_id);
+  return pair == nullptr ? nullptr : reinterpret_cast<void*>(pair->value);
+}
+
+void IsolateGroup::AddNativeAssetHandle(const char* asset_id, void* handle) {
+  ASSERT(handle != nullptr);
+  MutexLocker ml(&native_asset_handles_mutex_);
+  if (native_asset_handles_.Lookup(asset_id) == nullptr) {
+    native_asset_handles_.Insert(
+        {Utils::StrDup(asset_id), reinterpret_cast<intptr_t>(handle)});
+  }
 }
 
 void IsolateGroup::RegisterIsolate(Isolate* isolate) {
@@ -1355,12 +1391,24 @@ MessageHandler::MessageStatus IsolateMessageHandler::HandleMessage(
   StackZone stack_zone(thread);
   Zone* zone = stack_zone.GetZone();
   HandleScope handle_scope(thread);
+#if !defined(PRODUCT) || defined(SUPPORT_TIMELINE)
+  // Time the message spent in the queue.
+  const int64_t queue_latency =
+      message->enqueue_micros() == -1
+          ? 0
+          : OS::GetCurrentMonotonicMicros() - message->enqueue_micros();
+#endif
+#if !defined(PRODUCT)
+  I->GetMessageQueueLatencyMetric()->set_value(queue_latency);
+  I->GetMessageQueueLatencyMaxMetric()->SetValue(queue_latency);
+#endif  // !defined(PRODUCT)
 #if defined(SUPPORT_TIMELINE)
   TimelineBeginEndScope tbes(
       thread, Timeline::GetIsolateStream(),
       message->IsOOB() ? "HandleOOBMessage" : "HandleMessage");
-  tbes.SetNumArguments(1);
+  tbes.SetNumArguments(2);
   tbes.CopyArgument(0, "isolateName", I->name());
+  tbes.FormatArgument(1, "queueLatencyMicros", "%" Pd64, queue_latency);
 #endif
 
   // Parse the message.
@@ -1751,6 +1799,7 @@ Isolate::Isolate(IsolateGroup* isolate_group,
       sticky_error_(Error::null()),
       spawn_count_monitor_(),
       handler_info_cache_(),
+      not_in_try_block_cache_(),
       catch_entry_moves_cache_(),
       wake_pause_event_handler_count_(0),
       loaded_prefixes_set_storage_(nullptr) {
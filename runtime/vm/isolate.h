@@ -25,6 +25,7 @@
 #include "vm/field_table.h"
 #include "vm/fixed_cache.h"
 #include "vm/handles.h"
+#include "vm/hash_map.h"
 #include "vm/heap/verifier.h"
 #include "vm/intrusive_dlist.h"
 #include "vm/megamorphic_cache_table.h"
@@ -129,6 +130,9 @@ class LambdaCallable : public Callable {
 typedef FixedCache<intptr_t, ExceptionHandlerInfo, 16> HandlerInfoCache;
 // Fixed cache for catch entry state lookup.
 typedef FixedCache<intptr_t, CatchEntryMovesRefPtr, 16> CatchEntryMovesCache;
+// Fixed cache of pcs in code with exception handlers that are outside of any
+// try block.
+typedef FixedCache<intptr_t, bool, 16> NotInTryBlockCache;
 
 // List of Isolate group flags.
 //
@@ -178,7 +182,8 @@ class IsolateGroupSource {
         script_kernel_buffer(nullptr),
         script_kernel_size(-1),
         loaded_blobs_(nullptr),
-        num_blob_loads_(0) {}
+        num_blob_loads_(0),
+        program_hash(0) {}
   ~IsolateGroupSource() {
     free(script_uri);
     free(name);
@@ -204,6 +209,10 @@ class IsolateGroupSource {
   // List of weak pointers to external typed data for loaded blobs.
   ArrayPtr loaded_blobs_;
   intptr_t num_blob_loads_;
+
+  // Identifies the program across runs; computed on first use by the
+  // HotFunctionCache.
+  RelaxedAtomic<uint32_t> program_hash;
 };
 
 // Tracks idle time and notifies heap when idle time expired.
@@ -231,6 +240,10 @@ class IdleTimeHandler : public ValueObject {
   // Calls [NotifyIdle] with the default deadline.
   void NotifyIdleUsingDefaultDeadline();
 
+  // Lets the heap continue the collection in progress until [deadline].
+  // Returns the estimated work left; see Dart_PerformIdleGCSlice.
+  int64_t PerformIdleSlice(int64_t deadline);
+
  private:
   friend class DisableIdleTimerScope;
 
@@ -783,6 +796,12 @@ class IsolateGroup : public IntrusiveDListEntry<IsolateGroup> {
   }
   NativeAssetsApi* native_assets_api() { return &native_assets_api_; }
 
+  // The handle the library of a native asset was opened with, or nullptr if
+  // it has not been opened yet. Resolving every symbol of an asset would
+  // otherwise open its library again.
+  void* LookupNativeAssetHandle(const char* asset_id);
+  void AddNativeAssetHandle(const char* asset_id, void* handle);
+
  private:
   friend class Dart;  // For `object_store_ = ` in Dart::Init
   friend class Heap;
@@ -931,6 +950,10 @@ class IsolateGroup : public IntrusiveDListEntry<IsolateGroup> {
   NOT_IN_PRODUCT(GroupDebugger* debugger_ = nullptr);
 
   NativeAssetsApi native_assets_api_;
+
+  // Keys are malloced copies of the asset ids.
+  Mutex native_asset_handles_mutex_;
+  MallocDirectChainedHashMap<CStringIntMapKeyValueTrait> native_asset_handles_;
 };
 
 // When an isolate sends-and-exits this class represent things that it passed
@@ -1465,6 +1488,10 @@ class Isolate : public BaseIsolate, public IntrusiveDListEntry<Isolate> {
 
   HandlerInfoCache* handler_info_cache() { return &handler_info_cache_; }
 
+  NotInTryBlockCache* not_in_try_block_cache() {
+    return &not_in_try_block_cache_;
+  }
+
   CatchEntryMovesCache* catch_entry_moves_cache() {
     return &catch_entry_moves_cache_;
   }
@@ -1704,6 +1731,7 @@ class Isolate : public BaseIsolate, public IntrusiveDListEntry<Isolate> {
   intptr_t spawn_count_ = 0;
 
   HandlerInfoCache handler_info_cache_;
+  NotInTryBlockCache not_in_try_block_cache_;
   CatchEntryMovesCache catch_entry_moves_cache_;
 
   DispatchTable* dispatch_table_ = nullptr;
@@ -1981,6 +1981,7 @@ void ProgramReloadContext::ResetUnoptimizedICsOnStack() {
 
 void ProgramReloadContext::ResetMegamorphicCaches() {
   object_store()->set_megamorphic_cache_table(GrowableObjectArray::Handle());
+  object_store()->set_megamorphic_cache_index(Array::Handle());
   // Since any current optimized code will not make any more calls, it may be
   // better to clear the table instead of clearing each of the caches, allow
   // the current megamorphic caches get GC'd and any new optimized code allocate
@@ -2472,6 +2473,8 @@ ErrorPtr ProgramReloadContext::InvalidateWorld() {
   TIMELINE_SCOPE(InvalidateWorld);
   TIR_Print("---- INVALIDATING WORLD\n");
   ResetMegamorphicCaches();
+  object_store()->set_resolution_cache(Array::Handle());
+  object_store()->set_message_class_cids(Array::Handle());
   if (FLAG_trace_deoptimization) {
     THR_Print("Deopt for reload\n");
   }
@@ -27,6 +27,9 @@
 #include "vm/version.h"
 
 namespace dart {
+
+DECLARE_FLAG(bool, print_boxed_nullable_fields);
+
 namespace kernel {
 
 #define Z (zone_)
@@ -770,6 +773,15 @@ void KernelLoader::ReadInferredType(const Field& field,
                           (field.guarded_cid() == kFloat64x2Cid &&
                            FlowGraphCompiler::SupportsUnboxedSimd128()) ||
                           type.IsInt()));
+    if (FLAG_print_boxed_nullable_fields && !field.is_unboxed() &&
+        !field.is_late() && !field.is_static() && field.is_nullable() &&
+        ((field.guarded_cid() == kDoubleCid) ||
+         ((field.guarded_cid() == kFloat32x4Cid ||
+           field.guarded_cid() == kFloat64x2Cid) &&
+          FlowGraphCompiler::SupportsUnboxedSimd128()) ||
+         type.IsInt())) {
+      THR_Print("Nullable field %s is stored boxed\n", field.ToCString());
+    }
   }
 }
 
@@ -799,8 +811,6 @@ LibraryPtr KernelLoader::LoadLibrary(intptr_t index) {
   // Read library index.
   library_kernel_offset_ = library_offset(index);
   correction_offset_ = library_kernel_offset_;
-  intptr_t library_end = library_offset(index + 1);
-  intptr_t library_size = library_end - library_kernel_offset_;
 
   // NOTE: Since |helper_| is used to load the overall kernel program,
   // it's reader's offset is an offset into the overall kernel program.
@@ -843,8 +853,6 @@ LibraryPtr KernelLoader::LoadLibrary(intptr_t index) {
         String::Handle(library.url()).ToCString());
   }
 
-  library_kernel_data_ = helper_.reader_.ViewFromTo(
-      library_kernel_offset_, library_kernel_offset_ + library_size);
   library.set_kernel_library_index(index);
   library.set_kernel_program_info(kernel_program_info_);
 
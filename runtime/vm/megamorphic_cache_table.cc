@@ -6,6 +6,9 @@
 
 #include <stdlib.h>
 #include "vm/compiler/jit/compiler.h"
+#include "vm/dart_entry.h"
+#include "vm/hash.h"
+#include "vm/hash_table.h"
 #include "vm/object.h"
 #include "vm/object_store.h"
 #include "vm/stub_code.h"
@@ -13,6 +16,52 @@
 
 namespace dart {
 
+static uword MegamorphicCacheHash(const String& name, const Array& descriptor) {
+  ArgumentsDescriptor args_desc(descriptor);
+  uint32_t hash = name.Hash();
+  hash = CombineHashes(hash, args_desc.TypeArgsLen());
+  hash = CombineHashes(hash, args_desc.Count());
+  hash = CombineHashes(hash, args_desc.NamedCount());
+  return FinalizeHash(hash, Object::kHashBits);
+}
+
+class MegamorphicCacheKey {
+ public:
+  MegamorphicCacheKey(const String& name, const Array& descriptor)
+      : name_(name), descriptor_(descriptor) {}
+
+  bool Matches(const MegamorphicCache& cache) const {
+    return (cache.target_name() == name_.ptr()) &&
+           (cache.arguments_descriptor() == descriptor_.ptr());
+  }
+  uword Hash() const { return MegamorphicCacheHash(name_, descriptor_); }
+
+ private:
+  const String& name_;
+  const Array& descriptor_;
+};
+
+class MegamorphicCacheTraits {
+ public:
+  static const char* Name() { return "MegamorphicCacheTraits"; }
+  static bool ReportStats() { return false; }
+
+  static bool IsMatch(const Object& a, const Object& b) {
+    return a.ptr() == b.ptr();
+  }
+  static bool IsMatch(const MegamorphicCacheKey& a, const Object& b) {
+    return a.Matches(MegamorphicCache::Cast(b));
+  }
+  static uword Hash(const Object& key) {
+    const auto& cache = MegamorphicCache::Cast(key);
+    return MegamorphicCacheHash(String::Handle(cache.target_name()),
+                                Array::Handle(cache.arguments_descriptor()));
+  }
+  static uword Hash(const MegamorphicCacheKey& key) { return key.Hash(); }
+};
+
+typedef UnorderedHashSet<MegamorphicCacheTraits> MegamorphicCacheSet;
+
 MegamorphicCachePtr MegamorphicCacheTable::Lookup(Thread* thread,
                                                   const String& name,
                                                   const Array& descriptor) {
@@ -22,25 +71,34 @@ MegamorphicCachePtr MegamorphicCacheTable::Lookup(Thread* thread,
   ASSERT(name.IsSymbol());
   // TODO(rmacnak): ASSERT(descriptor.IsCanonical());
 
-  // TODO(rmacnak): Make a proper hashtable a la symbol table.
+  // The caches are kept in a list, for iteration, and in a hash set keyed on
+  // (name, descriptor), for lookups.
   auto& table =
       GrowableObjectArray::Handle(object_store->megamorphic_cache_table());
+  auto& index = Array::Handle(object_store->megamorphic_cache_index());
   MegamorphicCache& cache = MegamorphicCache::Handle();
   if (table.IsNull()) {
     table = GrowableObjectArray::New(Heap::kOld);
     object_store->set_megamorphic_cache_table(table);
-  } else {
+    index = HashTables::New<MegamorphicCacheSet>(16, Heap::kOld);
+  } else if (index.IsNull()) {
+    index = HashTables::New<MegamorphicCacheSet>(table.Length(), Heap::kOld);
+    MegamorphicCacheSet rebuilt(index.ptr());
     for (intptr_t i = 0; i < table.Length(); i++) {
       cache ^= table.At(i);
-      if ((cache.target_name() == name.ptr()) &&
-          (cache.arguments_descriptor() == descriptor.ptr())) {
-        return cache.ptr();
-      }
+      rebuilt.Insert(cache);
     }
+    index = rebuilt.Release().ptr();
   }
 
-  cache = MegamorphicCache::New(name, descriptor);
-  table.Add(cache, Heap::kOld);
+  MegamorphicCacheSet set(index.ptr());
+  cache ^= set.GetOrNull(MegamorphicCacheKey(name, descriptor));
+  if (cache.IsNull()) {
+    cache = MegamorphicCache::New(name, descriptor);
+    table.Add(cache, Heap::kOld);
+    set.Insert(cache);
+  }
+  object_store->set_megamorphic_cache_index(set.Release());
   return cache.ptr();
 }
 
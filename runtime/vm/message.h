@@ -101,6 +101,11 @@ class Message {
   }
   Priority priority() const { return priority_; }
 
+  // When the message was posted to its handler, or -1 if it was not posted
+  // through [MessageHandler::PostMessage].
+  int64_t enqueue_micros() const { return enqueue_micros_; }
+  void set_enqueue_micros(int64_t micros) { enqueue_micros_ = micros; }
+
   // A message processed at any interrupt point (stack overflow check) instead
   // of at the top of the message loop. Control messages from dart:isolate or
   // vm-service requests.
@@ -151,6 +156,7 @@ class Message {
   intptr_t snapshot_length_ = 0;
   MessageFinalizableData* finalizable_data_ = nullptr;
   Priority priority_;
+  int64_t enqueue_micros_ = -1;
 
   DISALLOW_COPY_AND_ASSIGN(Message);
 };
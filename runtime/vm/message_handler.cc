@@ -65,6 +65,7 @@ MessageHandler::MessageHandler()
       is_paused_on_exit_(false),
       remembered_paused_on_exit_status_(kOK),
       paused_timestamp_(-1),
+      task_scheduled_micros_(-1),
 #endif
       task_running_(false),
       pool_(nullptr),
@@ -108,6 +109,9 @@ bool MessageHandler::Run(ThreadPool* pool,
   end_callback_ = end_callback;
   callback_data_ = data;
   task_running_ = true;
+#if !defined(PRODUCT)
+  task_scheduled_micros_ = OS::GetCurrentMonotonicMicros();
+#endif
   bool result = pool_->Run<MessageHandlerTask>(this);
   if (!result) {
     pool_ = nullptr;
@@ -122,6 +126,7 @@ bool MessageHandler::Run(ThreadPool* pool,
 void MessageHandler::PostMessage(std::unique_ptr<Message> message,
                                  bool before_events) {
   Message::Priority saved_priority;
+  ThreadPool* pool_to_run = nullptr;
 
   {
     MonitorLocker ml(&monitor_);
@@ -147,6 +152,9 @@ void MessageHandler::PostMessage(std::unique_ptr<Message> message,
     }
 
     saved_priority = message->priority();
+#if !defined(PRODUCT) || defined(SUPPORT_TIMELINE)
+    message->set_enqueue_micros(OS::GetCurrentMonotonicMicros());
+#endif
     if (message->IsOOB()) {
       oob_queue_->Enqueue(std::move(message), before_events);
     } else {
@@ -157,12 +165,27 @@ void MessageHandler::PostMessage(std::unique_ptr<Message> message,
     }
 
     if (pool_ != nullptr && !task_running_) {
+      // Claim the task now so that concurrent senders do not start another
+      // one, but schedule it after releasing the monitor: waking up a pool
+      // worker (or spawning a new one) must not stall the other senders and
+      // the handler itself, which all contend on [monitor_].
       task_running_ = true;
-      const bool launched_successfully = pool_->Run<MessageHandlerTask>(this);
-      ASSERT(launched_successfully);
+      pool_to_run = pool_;
+#if !defined(PRODUCT)
+      task_scheduled_micros_ = OS::GetCurrentMonotonicMicros();
+#endif
     }
   }
 
+  if (pool_to_run != nullptr) {
+    // The caller ([PortMap::PostMessage]) holds the lock of the port's shard,
+    // so the handler cannot have had its ports closed and been deleted
+    // meanwhile.
+    const bool launched_successfully =
+        pool_to_run->Run<MessageHandlerTask>(this);
+    ASSERT(launched_successfully);
+  }
+
   // Invoke any custom message notification.
   MessageNotify(saved_priority);
 }
@@ -392,6 +415,19 @@ void MessageHandler::TaskCallback() {
     // [task_running_] to false.
     ASSERT(task_running_);
 
+#if !defined(PRODUCT)
+    if (task_scheduled_micros_ != -1) {
+      // Time this handler waited for a pool worker to pick up its task.
+      const int64_t latency =
+          OS::GetCurrentMonotonicMicros() - task_scheduled_micros_;
+      task_scheduled_micros_ = -1;
+      if (Isolate* isolate = this->isolate()) {
+        isolate->GetScheduleLatencyMetric()->set_value(latency);
+        isolate->GetScheduleLatencyMaxMetric()->SetValue(latency);
+      }
+    }
+#endif  // !defined(PRODUCT)
+
 #if !defined(PRODUCT)
     if (ShouldPauseOnStart(kOK)) {
       if (!is_paused_on_start()) {
@@ -254,6 +254,8 @@ class MessageHandler : public PortHandler {
   // processed so that we can resume correctly(into potentially not-OK status).
   MessageStatus remembered_paused_on_exit_status_;
   int64_t paused_timestamp_;
+  // When the pending task was handed to the thread pool, or -1.
+  int64_t task_scheduled_micros_;
 #endif
   bool task_running_;
   ThreadPool* pool_;
@@ -15,8 +15,10 @@
 #include "vm/dart_entry.h"
 #include "vm/flags.h"
 #include "vm/growable_array.h"
+#include "vm/hash.h"
 #include "vm/heap/heap.h"
 #include "vm/heap/weak_table.h"
+#include "vm/lockers.h"
 #include "vm/longjump.h"
 #include "vm/object.h"
 #include "vm/object_graph_copy.h"
@@ -523,9 +525,10 @@ class ClassMessageSerializationCluster : public MessageSerializationCluster {
         s->WriteUnsigned(0);
         lib = cls->library();
         str = lib.url();
-        s->WriteAscii(str);
+        const char* library_uri = str.ToCString();
         str = cls->Name();
-        s->WriteAscii(str);
+        s->WriteUnsigned(
+            MessageClassRegistry::IdOf(library_uri, str.ToCString()));
       }
     }
   }
@@ -543,32 +546,18 @@ class ClassMessageDeserializationCluster
 
   void ReadNodes(MessageDeserializer* d) {
     auto* class_table = d->isolate_group()->class_table();
-    String& uri = String::Handle(d->zone());
-    Library& lib = Library::Handle(d->zone());
-    String& name = String::Handle(d->zone());
     Class& cls = Class::Handle(d->zone());
     intptr_t count = d->ReadUnsigned();
     for (intptr_t i = 0; i < count; i++) {
       intptr_t cid = d->ReadUnsigned();
-      if (cid != 0) {
-        cls = class_table->At(cid);
-      } else {
-        uri = String::New(d->ReadAscii());   // Library URI.
-        name = String::New(d->ReadAscii());  // Class name.
-        lib = Library::LookupLibrary(d->thread(), uri);
-        if (UNLIKELY(lib.IsNull())) {
-          FATAL("Not found: %s %s\n", uri.ToCString(), name.ToCString());
-        }
-        if (name.Equals(Symbols::TopLevel())) {
-          cls = lib.toplevel_class();
-        } else {
-          cls = lib.LookupClass(name);
-        }
-        if (UNLIKELY(cls.IsNull())) {
-          FATAL("Not found: %s %s\n", uri.ToCString(), name.ToCString());
+      if (cid == 0) {
+        const intptr_t id = d->ReadUnsigned();  // Registered class id.
+        cid = LookupClassId(d, id);
+        if (cid == kIllegalCid) {
+          cid = ResolveClass(d, id);
         }
-        cls.EnsureIsFinalized(d->thread());
       }
+      cls = class_table->At(cid);
       d->AssignRef(cls.ptr());
     }
   }
@@ -578,12 +567,61 @@ class ClassMessageDeserializationCluster
     for (intptr_t i = 0; i < count; i++) {
       intptr_t cid = d->ReadUnsigned();
       if (cid == 0) {
-        d->ReadAscii();  // Library URI.
-        d->ReadAscii();  // Class name.
+        d->ReadUnsigned();  // Registered class id.
       }
       d->AssignRef(nullptr);
     }
   }
+
+ private:
+  // Returns the class id this isolate group resolved for the registered
+  // class [id] before, or kIllegalCid.
+  static intptr_t LookupClassId(MessageDeserializer* d, intptr_t id) {
+    SafepointReadRwLocker ml(d->thread(),
+                             d->isolate_group()->program_lock());
+    ArrayPtr cids = d->isolate_group()->object_store()->message_class_cids();
+    if (cids == Array::null() || id >= Smi::Value(cids->untag()->length())) {
+      return kIllegalCid;
+    }
+    ObjectPtr cid = cids->untag()->element(id);
+    return cid == Object::null() ? kIllegalCid : Smi::Value(Smi::RawCast(cid));
+  }
+
+  static intptr_t ResolveClass(MessageDeserializer* d, intptr_t id) {
+    const char* library_uri;
+    const char* class_name;
+    MessageClassRegistry::NamesOf(id, &library_uri, &class_name);
+    const auto& uri = String::Handle(d->zone(), String::New(library_uri));
+    const auto& name = String::Handle(d->zone(), String::New(class_name));
+    const auto& lib =
+        Library::Handle(d->zone(), Library::LookupLibrary(d->thread(), uri));
+    if (UNLIKELY(lib.IsNull())) {
+      FATAL("Not found: %s %s\n", library_uri, class_name);
+    }
+    auto& cls = Class::Handle(d->zone());
+    if (name.Equals(Symbols::TopLevel())) {
+      cls = lib.toplevel_class();
+    } else {
+      cls = lib.LookupClass(name);
+    }
+    if (UNLIKELY(cls.IsNull())) {
+      FATAL("Not found: %s %s\n", library_uri, class_name);
+    }
+    cls.EnsureIsFinalized(d->thread());
+
+    SafepointWriteRwLocker ml(d->thread(),
+                              d->isolate_group()->program_lock());
+    ObjectStore* object_store = d->isolate_group()->object_store();
+    auto& cids = Array::Handle(d->zone(), object_store->message_class_cids());
+    if (cids.IsNull() || id >= cids.Length()) {
+      const intptr_t new_length = Utils::RoundUpToPowerOfTwo(id + 1);
+      cids = cids.IsNull() ? Array::New(new_length, Heap::kOld)
+                           : Array::Grow(cids, new_length, Heap::kOld);
+      object_store->set_message_class_cids(cids);
+    }
+    cids.SetAt(id, Smi::Handle(d->zone(), Smi::New(cls.id())));
+    return cls.id();
+  }
 };
 
 class TypeArgumentsMessageSerializationCluster
@@ -3407,6 +3445,74 @@ Dart_CObject* ApiMessageDeserializer::Deserialize() {
   return ReadRef();
 }
 
+Mutex* MessageClassRegistry::mutex_ = nullptr;
+SimpleHashMap* MessageClassRegistry::ids_ = nullptr;
+MallocGrowableArray<MessageClassRegistry::Names*>*
+    MessageClassRegistry::names_ = nullptr;
+
+void MessageClassRegistry::Init() {
+  ASSERT(mutex_ == nullptr);
+  mutex_ = new Mutex();
+  ids_ = new SimpleHashMap(&SameNames, 16);
+  names_ = new MallocGrowableArray<Names*>();
+}
+
+void MessageClassRegistry::Cleanup() {
+  ASSERT(mutex_ != nullptr);
+  for (intptr_t i = 0; i < names_->length(); i++) {
+    free(names_->At(i)->library_uri);
+    free(names_->At(i)->class_name);
+    delete names_->At(i);
+  }
+  delete names_;
+  names_ = nullptr;
+  delete ids_;
+  ids_ = nullptr;
+  delete mutex_;
+  mutex_ = nullptr;
+}
+
+bool MessageClassRegistry::SameNames(void* a, void* b) {
+  const Names* names_a = reinterpret_cast<Names*>(a);
+  const Names* names_b = reinterpret_cast<Names*>(b);
+  return strcmp(names_a->class_name, names_b->class_name) == 0 &&
+         strcmp(names_a->library_uri, names_b->library_uri) == 0;
+}
+
+uint32_t MessageClassRegistry::Hash(const char* library_uri,
+                                    const char* class_name) {
+  return CombineHashes(SimpleHashMap::StringHash(library_uri),
+                       SimpleHashMap::StringHash(class_name));
+}
+
+intptr_t MessageClassRegistry::IdOf(const char* library_uri,
+                                    const char* class_name) {
+  Names key = {const_cast<char*>(library_uri), const_cast<char*>(class_name)};
+  const uint32_t hash = Hash(library_uri, class_name);
+  MutexLocker ml(mutex_);
+  SimpleHashMap::Entry* entry = ids_->Lookup(&key, hash, /*insert=*/true);
+  if (entry->value == nullptr) {
+    // The entry must not point to the stack allocated key, so it points to
+    // a heap allocated copy of the names instead.
+    Names* names = new Names{Utils::StrDup(library_uri),
+                             Utils::StrDup(class_name)};
+    entry->key = names;
+    names_->Add(names);
+    // Ids are stored off by one as a null value marks a new entry.
+    entry->value = reinterpret_cast<void*>(names_->length());
+  }
+  return reinterpret_cast<intptr_t>(entry->value) - 1;
+}
+
+void MessageClassRegistry::NamesOf(intptr_t id,
+                                   const char** library_uri,
+                                   const char** class_name) {
+  MutexLocker ml(mutex_);
+  const Names* names = names_->At(id);
+  *library_uri = names->library_uri;
+  *class_name = names->class_name;
+}
+
 std::unique_ptr<Message> WriteMessage(bool same_group,
                                       const Object& obj,
                                       Dart_Port dest_port,
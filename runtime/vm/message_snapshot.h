@@ -8,6 +8,8 @@
 #include <memory>
 
 #include "include/dart_native_api.h"
+#include "platform/hashmap.h"
+#include "vm/growable_array.h"
 #include "vm/message.h"
 #include "vm/object.h"
 
@@ -29,6 +31,39 @@ ObjectPtr ReadMessage(Thread* thread, Message* message);
 
 Dart_CObject* ReadApiMessage(Zone* zone, Message* message);
 
+// Process-wide registry of the classes named in messages sent between isolate
+// groups. Messages refer to such a class by its id in the registry instead of
+// spelling out its library URI and name, and each receiving isolate group
+// remembers which class it resolved for an id (see
+// ObjectStore::message_class_cids).
+class MessageClassRegistry : public AllStatic {
+ public:
+  static void Init();
+  static void Cleanup();
+
+  // Returns the id of class [class_name] in the library at [library_uri],
+  // registering it if needed.
+  static intptr_t IdOf(const char* library_uri, const char* class_name);
+
+  // Returns the library URI and name of the class registered as [id].
+  static void NamesOf(intptr_t id,
+                      const char** library_uri,
+                      const char** class_name);
+
+ private:
+  struct Names {
+    char* library_uri;
+    char* class_name;
+  };
+
+  static bool SameNames(void* a, void* b);
+  static uint32_t Hash(const char* library_uri, const char* class_name);
+
+  static Mutex* mutex_;
+  static SimpleHashMap* ids_;
+  static MallocGrowableArray<Names*>* names_;
+};
+
 }  // namespace dart
 
 #endif  // RUNTIME_VM_MESSAGE_SNAPSHOT_H_
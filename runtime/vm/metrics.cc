@@ -10,6 +10,7 @@
 #include "vm/native_entry.h"
 #include "vm/object.h"
 #include "vm/runtime_entry.h"
+#include "vm/zone_text_buffer.h"
 
 namespace dart {
 
@@ -88,6 +89,47 @@ void Metric::PrintJSON(JSONStream* stream) {
   double value_as_double = static_cast<double>(Value());
   obj.AddProperty("value", value_as_double);
 }
+
+void Metric::PrintOpenMetrics(BaseTextBuffer* buffer, const char* labels) {
+  if ((value() == kMinInt64) || (value() == kMaxInt64)) {
+    return;  // A MaxMetric or MinMetric without observations.
+  }
+  const int64_t value = Value();
+  // OpenMetrics names can't contain '.' and carry their unit as a suffix.
+  Thread* thread = Thread::Current();
+  ZoneTextBuffer family(thread->zone());
+  family.AddString("dart_");
+  for (const char* c = name_; *c != '\0'; c++) {
+    family.AddChar((*c == '.') ? '_' : *c);
+  }
+  const char* unit = nullptr;
+  switch (unit_) {
+    case kCounter:
+      break;
+    case kByte:
+      unit = "bytes";
+      break;
+    case kMicrosecond:
+      unit = "seconds";
+      break;
+  }
+  if (unit != nullptr) {
+    family.Printf("_%s", unit);
+  }
+  buffer->Printf("# TYPE %s gauge\n", family.buffer());
+  if (unit != nullptr) {
+    buffer->Printf("# UNIT %s %s\n", family.buffer(), unit);
+  }
+  if (description_ != nullptr) {
+    buffer->Printf("# HELP %s %s\n", family.buffer(), description_);
+  }
+  if (unit_ == kMicrosecond) {
+    buffer->Printf("%s{%s} %.6f\n", family.buffer(), labels,
+                   static_cast<double>(value) / kMicrosecondsPerSecond);
+  } else {
+    buffer->Printf("%s{%s} %" Pd64 "\n", family.buffer(), labels, value);
+  }
+}
 #endif  // !defined(PRODUCT)
 
 char* Metric::ValueToString(int64_t value, Unit unit) {
@@ -180,6 +222,10 @@ int64_t MetricHeapUsed::Value() const {
          isolate_group()->heap()->UsedInWords(Heap::kOld) * kWordSize;
 }
 
+int64_t MetricNativeFinalizerBacklog::Value() const {
+  return isolate_group()->heap()->native_finalizer_backlog();
+}
+
 #if !defined(PRODUCT)
 int64_t MetricIsolateCount::Value() const {
   return Isolate::IsolateListLength();
@@ -198,6 +244,10 @@ MaxMetric::MaxMetric() : Metric() {
   set_value(kMinInt64);
 }
 
+int64_t MaxMetric::Value() const {
+  return value() == kMinInt64 ? 0 : value();
+}
+
 void MaxMetric::SetValue(int64_t new_value) {
   if (new_value > value()) {
     set_value(new_value);
@@ -208,6 +258,10 @@ MinMetric::MinMetric() : Metric() {
   set_value(kMaxInt64);
 }
 
+int64_t MinMetric::Value() const {
+  return value() == kMaxInt64 ? kUnset : value();
+}
+
 void MinMetric::SetValue(int64_t new_value) {
   if (new_value < value()) {
     set_value(new_value);
@@ -9,6 +9,7 @@
 
 namespace dart {
 
+class BaseTextBuffer;
 class Isolate;
 class IsolateGroup;
 class JSONStream;
@@ -24,6 +25,11 @@ class JSONStream;
 //
 //   Dart_Heap{Old,New}{Used,Capacity,External}
 //
+// The pause metrics are the longest pause of each kind of GC and the longest
+// time it took the other threads to reach a safepoint. The mutator
+// utilization is the lowest percentage of a 10ms window ending at a GC pause
+// that was not spent in GC pauses.
+//
 // All metrics are exposed via vm-service protocol.
 //
 #define DART_API_ISOLATE_GROUP_METRIC_LIST(V)                                  \
@@ -32,7 +38,14 @@ class JSONStream;
   V(MetricHeapOldExternal, HeapOldExternal, "heap.old.external", kByte)        \
   V(MetricHeapNewUsed, HeapNewUsed, "heap.new.used", kByte)                    \
   V(MetricHeapNewCapacity, HeapNewCapacity, "heap.new.capacity", kByte)        \
-  V(MetricHeapNewExternal, HeapNewExternal, "heap.new.external", kByte)
+  V(MetricHeapNewExternal, HeapNewExternal, "heap.new.external", kByte)        \
+  V(MaxMetric, HeapNewPauseMax, "heap.new.pause.max", kMicrosecond)            \
+  V(MaxMetric, HeapOldPauseMax, "heap.old.pause.max", kMicrosecond)            \
+  V(MaxMetric, HeapCompactPauseMax, "heap.compact.pause.max", kMicrosecond)    \
+  V(MaxMetric, HeapSafepointLatencyMax, "heap.safepoint.latency.max",          \
+    kMicrosecond)                                                              \
+  V(MinMetric, HeapMutatorUtilizationMin, "heap.mutator.utilization.min",      \
+    kCounter)
 
 #define ISOLATE_GROUP_METRIC_LIST(V)                                           \
   DART_API_ISOLATE_GROUP_METRIC_LIST(V)                                        \
@@ -41,14 +54,30 @@ class JSONStream;
   V(MaxMetric, HeapNewUsedMax, "heap.new.used.max", kByte)                     \
   V(MaxMetric, HeapNewCapacityMax, "heap.new.capacity.max", kByte)             \
   V(MetricHeapUsed, HeapGlobalUsed, "heap.global.used", kByte)                 \
-  V(MaxMetric, HeapGlobalUsedMax, "heap.global.used.max", kByte)
+  V(MaxMetric, HeapGlobalUsedMax, "heap.global.used.max", kByte)               \
+  V(MetricNativeFinalizerBacklog, NativeFinalizerBacklog,                      \
+    "heap.native_finalizers.backlog", kCounter)                                \
+  V(MaxMetric, NativeFinalizerBacklogMax,                                      \
+    "heap.native_finalizers.backlog.max", kCounter)
 
 // Metrics for each isolate.
 //
 // All metrics are exposed via vm-service protocol.
+//
+// The schedule latency is the time between handing the message handler task
+// of an idle isolate to the thread pool and a worker starting to run it. The
+// message queue latency is the time between posting a message and the isolate
+// starting to handle it.
 #define ISOLATE_METRIC_LIST(V)                                                 \
   V(Metric, RunnableLatency, "isolate.runnable.latency", kMicrosecond)         \
-  V(Metric, RunnableHeapSize, "isolate.runnable.heap", kByte)
+  V(Metric, RunnableHeapSize, "isolate.runnable.heap", kByte)                  \
+  V(Metric, ScheduleLatency, "isolate.schedule.latency", kMicrosecond)         \
+  V(MaxMetric, ScheduleLatencyMax, "isolate.schedule.latency.max",             \
+    kMicrosecond)                                                              \
+  V(Metric, MessageQueueLatency, "isolate.message.queue.latency",              \
+    kMicrosecond)                                                              \
+  V(MaxMetric, MessageQueueLatencyMax, "isolate.message.queue.latency.max",    \
+    kMicrosecond)
 
 class Metric {
  public:
@@ -84,6 +113,11 @@ class Metric {
 
 #ifndef PRODUCT
   void PrintJSON(JSONStream* stream);
+
+  // Prints the metric as a gauge in the OpenMetrics text format, with the
+  // given labels (e.g. 'isolate="isolates/123"'). Metrics that have not
+  // observed a value yet are omitted.
+  void PrintOpenMetrics(BaseTextBuffer* buffer, const char* labels);
 #endif  // !PRODUCT
 
   // Returns a zone allocated string.
@@ -126,20 +160,28 @@ class Metric {
 };
 
 // A Metric class that reports the maximum value observed.
-// Initial maximum is kMinInt64.
+// Initial maximum is kMinInt64, which is reported as 0.
 class MaxMetric : public Metric {
  public:
   MaxMetric();
 
+  virtual int64_t Value() const;
+
   void SetValue(int64_t new_value);
 };
 
 // A Metric class that reports the minimum value observed.
-// Initial minimum is kMaxInt64.
+// Initial minimum is kMaxInt64, which is reported as kUnset. 0 cannot stand
+// for "nothing observed" here, since it is a meaningful minimum (e.g. a
+// mutator utilization of 0%).
 class MinMetric : public Metric {
  public:
+  static constexpr int64_t kUnset = -1;
+
   MinMetric();
 
+  virtual int64_t Value() const;
+
   void SetValue(int64_t new_value);
 };
 
@@ -195,6 +237,11 @@ class MetricHeapUsed : public Metric {
   virtual int64_t Value() const;
 };
 
+class MetricNativeFinalizerBacklog : public Metric {
+ public:
+  virtual int64_t Value() const;
+};
+
 }  // namespace dart
 
 #endif  // RUNTIME_VM_METRICS_H_
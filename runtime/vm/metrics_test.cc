@@ -35,6 +35,29 @@ VM_UNIT_TEST_CASE(Metric_Simple) {
   Dart_ShutdownIsolate();
 }
 
+VM_UNIT_TEST_CASE(Metric_MaxMin) {
+  TestCase::CreateTestIsolate();
+  {
+    MaxMetric max;
+    MinMetric min;
+    max.InitInstance(Isolate::Current(), "a.max", "foobar", Metric::kCounter);
+    min.InitInstance(Isolate::Current(), "a.min", "foobar", Metric::kCounter);
+    // Nothing observed yet.
+    EXPECT_EQ(0, max.Value());
+    EXPECT_EQ(MinMetric::kUnset, min.Value());
+    max.SetValue(7);
+    max.SetValue(3);
+    min.SetValue(7);
+    min.SetValue(3);
+    EXPECT_EQ(7, max.Value());
+    EXPECT_EQ(3, min.Value());
+    // 0 is an observed minimum, not the absence of one.
+    min.SetValue(0);
+    EXPECT_EQ(0, min.Value());
+  }
+  Dart_ShutdownIsolate();
+}
+
 class MyMetric : public Metric {
  protected:
   int64_t Value() const {
@@ -111,6 +134,13 @@ ISOLATE_UNIT_TEST_CASE(Metric_EmbedderAPI) {
     EXPECT(Dart_IsolateGroupHeapOldCapacityMetric(isolate_group) > 0);
     EXPECT(Dart_IsolateGroupHeapNewUsedMetric(isolate_group) > 0);
     EXPECT(Dart_IsolateGroupHeapNewCapacityMetric(isolate_group) > 0);
+    EXPECT(Dart_IsolateGroupHeapNewPauseMaxMetric(isolate_group) >= 0);
+    EXPECT(Dart_IsolateGroupHeapCompactPauseMaxMetric(isolate_group) >= 0);
+    EXPECT(Dart_IsolateGroupHeapSafepointLatencyMaxMetric(isolate_group) >= 0);
+    const int64_t utilization =
+        Dart_IsolateGroupHeapMutatorUtilizationMinMetric(isolate_group);
+    EXPECT(utilization == MinMetric::kUnset ||
+           (utilization >= 0 && utilization <= 100));
   }
 }
 
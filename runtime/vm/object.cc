@@ -113,6 +113,7 @@ DECLARE_FLAG(bool, trace_reload);
 DECLARE_FLAG(bool, write_protect_code);
 DECLARE_FLAG(bool, precompiled_mode);
 DECLARE_FLAG(int, max_polymorphic_checks);
+DECLARE_FLAG(bool, profile_heap_samples);
 
 static const char* const kGetterPrefix = "get:";
 static const intptr_t kGetterPrefixLength = strlen(kGetterPrefix);
@@ -2901,6 +2902,11 @@ ObjectPtr Object::Allocate(intptr_t cls_id,
     heap->old_space()->AllocateBlack(size);
   }
 
+#if !defined(PRODUCT)
+  auto class_table = thread->isolate_group()->class_table();
+  bool sample_allocation = class_table->ShouldTraceAllocationFor(cls_id);
+#endif  // !defined(PRODUCT)
+
 #if !defined(PRODUCT) || defined(FORCE_INCLUDE_SAMPLING_HEAP_PROFILER)
   HeapProfileSampler& heap_sampler = thread->heap_sampler();
   if (heap_sampler.HasOutstandingSample()) {
@@ -2908,12 +2914,14 @@ ObjectPtr Object::Allocate(intptr_t cls_id,
     void* data = heap_sampler.InvokeCallbackForLastSample(cls_id);
     heap->SetHeapSamplingData(raw_obj, data);
     thread->DecrementNoCallbackScopeDepth();
+#if !defined(PRODUCT)
+    sample_allocation = sample_allocation || FLAG_profile_heap_samples;
+#endif  // !defined(PRODUCT)
   }
 #endif  // !defined(PRODUCT) || defined(FORCE_INCLUDE_SAMPLING_HEAP_PROFILER)
 
 #if !defined(PRODUCT)
-  auto class_table = thread->isolate_group()->class_table();
-  if (class_table->ShouldTraceAllocationFor(cls_id)) {
+  if (sample_allocation) {
     uint32_t hash =
         HeapSnapshotWriter::GetHeapSnapshotIdentityHash(thread, raw_obj);
     Profiler::SampleAllocation(thread, cls_id, hash);
@@ -7906,11 +7914,12 @@ TypeArgumentsPtr TypeArguments::Canonicalize(Thread* thread) const {
   ObjectStore* object_store = isolate_group->object_store();
   TypeArguments& result = TypeArguments::Handle(zone);
   {
-    SafepointMutexLocker ml(isolate_group->type_canonicalization_mutex());
+    // Lookups are lock-free: both the table in the ObjectStore and its
+    // elements are accessed via store-release/load-acquire barriers.
     CanonicalTypeArgumentsSet table(zone,
                                     object_store->canonical_type_arguments());
     result ^= table.GetOrNull(CanonicalTypeArgumentsKey(*this));
-    object_store->set_canonical_type_arguments(table.Release());
+    table.Release();
   }
   if (result.IsNull()) {
     // Canonicalize each type argument.
@@ -15884,21 +15893,26 @@ intptr_t InstructionsTable::FindEntry(InstructionsTablePtr table,
 
   const auto rodata = table.untag()->rodata_;
   const auto entries = rodata->entries();
+  intptr_t count = rodata->length - start_index;
+  if (count <= 0 || pc_offset < entries[start_index].pc_offset) return -1;
+
+  // Find the last entry starting at or before |pc_offset|. Every step loads
+  // a single entry and has no early exit, so the compiler can turn it into a
+  // conditional move. Large AOT snapshots have hundreds of thousands of
+  // entries, and this lookup runs for every stack frame walked and every
+  // profiler sample.
   intptr_t lo = start_index;
-  intptr_t hi = rodata->length - 1;
-  while (lo <= hi) {
-    intptr_t mid = (hi - lo + 1) / 2 + lo;
-    ASSERT(mid >= lo);
-    ASSERT(mid <= hi);
-    if (pc_offset < entries[mid].pc_offset) {
-      hi = mid - 1;
-    } else if ((mid != hi) && (pc_offset >= entries[mid + 1].pc_offset)) {
-      lo = mid + 1;
-    } else {
-      return mid;
+  while (count > 1) {
+    const intptr_t half = count / 2;
+    if (entries[lo + half].pc_offset <= pc_offset) {
+      lo += half;
     }
+    count -= half;
   }
-  return -1;
+  ASSERT(entries[lo].pc_offset <= pc_offset);
+  ASSERT(lo + 1 == static_cast<intptr_t>(rodata->length) ||
+         pc_offset < entries[lo + 1].pc_offset);
+  return lo;
 }
 
 const UntaggedCompressedStackMaps::Payload*
@@ -20553,9 +20567,9 @@ ObjectPtr Instance::InvokeGetter(const String& getter_name,
   const String& internal_getter_name =
       String::Handle(zone, Field::GetterName(getter_name));
   Function& function = Function::Handle(
-      zone,
-      Resolver::ResolveDynamicAnyArgs(zone, klass, internal_getter_name,
-                                      /*allow_add=*/!FLAG_precompiled_mode));
+      zone, Resolver::ResolveDynamicAnyArgsCached(
+                zone, klass, internal_getter_name,
+                /*allow_add=*/!FLAG_precompiled_mode));
 
   if (!function.IsNull() && check_is_entrypoint) {
     // The getter must correspond to either an entry-point field or a getter
@@ -20573,8 +20587,8 @@ ObjectPtr Instance::InvokeGetter(const String& getter_name,
 
   // Check for method extraction when method extractors are not lazily created.
   if (function.IsNull() && FLAG_precompiled_mode) {
-    function = Resolver::ResolveDynamicAnyArgs(zone, klass, getter_name,
-                                               /*allow_add=*/false);
+    function = Resolver::ResolveDynamicAnyArgsCached(zone, klass, getter_name,
+                                                     /*allow_add=*/false);
 
     if (!function.IsNull() && check_is_entrypoint) {
       CHECK_ERROR(function.VerifyClosurizedEntryPoint());
@@ -20617,9 +20631,9 @@ ObjectPtr Instance::InvokeSetter(const String& setter_name,
   const String& internal_setter_name =
       String::Handle(zone, Field::SetterName(setter_name));
   const Function& setter = Function::Handle(
-      zone,
-      Resolver::ResolveDynamicAnyArgs(zone, klass, internal_setter_name,
-                                      /*allow_add=*/!FLAG_precompiled_mode));
+      zone, Resolver::ResolveDynamicAnyArgsCached(
+                zone, klass, internal_setter_name,
+                /*allow_add=*/!FLAG_precompiled_mode));
 
   if (check_is_entrypoint) {
     // The setter must correspond to either an entry-point field or a setter
@@ -20661,8 +20675,8 @@ ObjectPtr Instance::Invoke(const String& function_name,
 
   Function& function = Function::Handle(
       zone,
-      Resolver::ResolveDynamicAnyArgs(zone, klass, function_name,
-                                      /*allow_add=*/!FLAG_precompiled_mode));
+      Resolver::ResolveDynamicAnyArgsCached(
+          zone, klass, function_name, /*allow_add=*/!FLAG_precompiled_mode));
 
   if (!function.IsNull() && check_is_entrypoint) {
     CHECK_ERROR(function.VerifyCallEntryPoint());
@@ -20685,8 +20699,8 @@ ObjectPtr Instance::Invoke(const String& function_name,
     const String& getter_name =
         String::Handle(zone, Field::GetterName(function_name));
     function =
-        Resolver::ResolveDynamicAnyArgs(zone, klass, getter_name,
-                                        /*allow_add=*/!FLAG_precompiled_mode);
+        Resolver::ResolveDynamicAnyArgsCached(
+            zone, klass, getter_name, /*allow_add=*/!FLAG_precompiled_mode);
     if (!function.IsNull()) {
       if (check_is_entrypoint) {
         CHECK_ERROR(EntryPointFieldInvocationError(function_name));
@@ -20760,7 +20774,11 @@ IntegerPtr Instance::IdentityHashCode(Thread* thread) const {
     }
 
 #if defined(HASH_IN_OBJECT_HEADER)
-    hash = Object::SetCachedHashIfNotSet(ptr(), hash);
+    // A double hash can be zero in the header, then there is nothing to cache.
+    // Skipping the write matters for read-only doubles in snapshots.
+    hash = static_cast<uint32_t>(hash) == 0
+               ? 0
+               : Object::SetCachedHashIfNotSet(ptr(), hash);
 #else
     hash = thread->heap()->SetHashIfNotSet(ptr(), hash);
 #endif
@@ -22800,10 +22818,10 @@ AbstractTypePtr Type::Canonicalize(Thread* thread) const {
   Type& type = Type::Handle(zone);
   ObjectStore* object_store = isolate_group->object_store();
   {
-    SafepointMutexLocker ml(isolate_group->type_canonicalization_mutex());
+    // Lookups are lock-free, see TypeArguments::Canonicalize.
     CanonicalTypeSet table(zone, object_store->canonical_types());
     type ^= table.GetOrNull(CanonicalTypeKey(*this));
-    ASSERT(object_store->canonical_types() == table.Release().ptr());
+    table.Release();
   }
   if (type.IsNull()) {
     // The type was not found in the table. It is not canonical yet.
@@ -23977,6 +23995,19 @@ bool String::Equals(const Instance& other) const {
   return Equals(other_string);
 }
 
+// Compares one-byte with two-byte code units. Same width code units are
+// compared with memcmp.
+static bool CodeUnitsEqual(const uint8_t* one_byte,
+                           const uint16_t* two_byte,
+                           intptr_t len) {
+  for (intptr_t i = 0; i < len; i++) {
+    if (one_byte[i] != two_byte[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool String::Equals(const String& str,
                     intptr_t begin_index,
                     intptr_t len) const {
@@ -23987,14 +24018,26 @@ bool String::Equals(const String& str,
   if (len != this->Length()) {
     return false;  // Lengths don't match.
   }
+  if (len == 0) {
+    return true;
+  }
 
-  for (intptr_t i = 0; i < len; i++) {
-    if (CharAt(i) != str.CharAt(begin_index + i)) {
-      return false;
+  NoSafepointScope no_safepoint;
+  if (IsOneByteString()) {
+    const uint8_t* chars = OneByteString::DataStart(*this);
+    if (str.IsOneByteString()) {
+      return memcmp(chars, OneByteString::CharAddr(str, begin_index), len) ==
+             0;
     }
+    return CodeUnitsEqual(chars, TwoByteString::CharAddr(str, begin_index),
+                          len);
   }
-
-  return true;
+  const uint16_t* chars = TwoByteString::DataStart(*this);
+  if (str.IsTwoByteString()) {
+    return memcmp(chars, TwoByteString::CharAddr(str, begin_index),
+                  len * sizeof(uint16_t)) == 0;
+  }
+  return CodeUnitsEqual(OneByteString::CharAddr(str, begin_index), chars, len);
 }
 
 bool String::Equals(const char* cstr) const {
@@ -24023,13 +24066,15 @@ bool String::Equals(const uint8_t* latin1_array, intptr_t len) const {
     // Lengths don't match.
     return false;
   }
+  if (len == 0) {
+    return true;
+  }
 
-  for (intptr_t i = 0; i < len; i++) {
-    if (this->CharAt(i) != latin1_array[i]) {
-      return false;
-    }
+  NoSafepointScope no_safepoint;
+  if (IsOneByteString()) {
+    return memcmp(OneByteString::DataStart(*this), latin1_array, len) == 0;
   }
-  return true;
+  return CodeUnitsEqual(latin1_array, TwoByteString::DataStart(*this), len);
 }
 
 bool String::Equals(const uint16_t* utf16_array, intptr_t len) const {
@@ -24037,9 +24082,19 @@ bool String::Equals(const uint16_t* utf16_array, intptr_t len) const {
     // Lengths don't match.
     return false;
   }
+  if (len == 0) {
+    return true;
+  }
 
+  NoSafepointScope no_safepoint;
+  if (IsTwoByteString()) {
+    // The array may be unaligned, memcmp does not care.
+    return memcmp(TwoByteString::DataStart(*this), utf16_array,
+                  len * sizeof(uint16_t)) == 0;
+  }
+  const uint8_t* chars = OneByteString::DataStart(*this);
   for (intptr_t i = 0; i < len; i++) {
-    if (this->CharAt(i) != LoadUnaligned(&utf16_array[i])) {
+    if (chars[i] != LoadUnaligned(&utf16_array[i])) {
       return false;
     }
   }
@@ -24540,11 +24595,18 @@ StringPtr String::SubString(Thread* thread,
   bool is_one_byte_string = true;
   intptr_t char_size = str.CharSize();
   if (char_size == kTwoByteChar) {
-    for (intptr_t i = begin_index; i < begin_index + length; ++i) {
-      if (!Utf::IsLatin1(str.CharAt(i))) {
-        is_one_byte_string = false;
-        break;
+    // Or together blocks of code units, which compilers vectorize, and stop
+    // at the first block with a code unit outside Latin-1.
+    constexpr intptr_t kBlockSize = 32;
+    NoSafepointScope no_safepoint;
+    const uint16_t* chars = TwoByteString::CharAddr(str, begin_index);
+    for (intptr_t i = 0; is_one_byte_string && i < length; i += kBlockSize) {
+      const intptr_t block_end = Utils::Minimum(i + kBlockSize, length);
+      uint16_t bits = 0;
+      for (intptr_t j = i; j < block_end; j++) {
+        bits |= chars[j];
       }
+      is_one_byte_string = Utf::IsLatin1(bits);
     }
   }
   REUSABLE_STRING_HANDLESCOPE(thread);
@@ -24629,13 +24691,65 @@ StringPtr String::Transform(int32_t (*mapping)(int32_t ch),
   return TwoByteString::Transform(mapping, str, space);
 }
 
+StringPtr String::TransformAsciiCase(const String& str,
+                                     uint8_t from,
+                                     uint8_t to,
+                                     Heap::Space space) {
+  ASSERT(str.IsOneByteString());
+  const intptr_t len = str.Length();
+  intptr_t first = len;
+  {
+    NoSafepointScope no_safepoint;
+    const uint8_t* chars = OneByteString::DataStart(str);
+    uint8_t bits = 0;
+    for (intptr_t i = 0; i < len; i++) {
+      bits |= chars[i];
+    }
+    if (bits > Utf8::kMaxOneByteChar) {
+      return String::null();
+    }
+    for (intptr_t i = 0; i < len; i++) {
+      if (static_cast<uint8_t>(chars[i] - from) <= (to - from)) {
+        first = i;
+        break;
+      }
+    }
+  }
+  if (first == len) {
+    return str.ptr();
+  }
+  const String& result = String::Handle(OneByteString::New(len, space));
+  NoSafepointScope no_safepoint;
+  const uint8_t* src = OneByteString::DataStart(str);
+  uint8_t* dst = OneByteString::DataStart(result);
+  memmove(dst, src, first);
+  for (intptr_t i = first; i < len; i++) {
+    const uint8_t ch = src[i];
+    const bool flip = static_cast<uint8_t>(ch - from) <= (to - from);
+    dst[i] = flip ? (ch ^ 0x20) : ch;
+  }
+  return result.ptr();
+}
+
 StringPtr String::ToUpperCase(const String& str, Heap::Space space) {
-  // TODO(cshapiro): create a fast-path for OneByteString instances.
+  if (str.IsOneByteString()) {
+    const String& result =
+        String::Handle(TransformAsciiCase(str, 'a', 'z', space));
+    if (!result.IsNull()) {
+      return result.ptr();
+    }
+  }
   return Transform(CaseMapping::ToUpper, str, space);
 }
 
 StringPtr String::ToLowerCase(const String& str, Heap::Space space) {
-  // TODO(cshapiro): create a fast-path for OneByteString instances.
+  if (str.IsOneByteString()) {
+    const String& result =
+        String::Handle(TransformAsciiCase(str, 'A', 'Z', space));
+    if (!result.IsNull()) {
+      return result.ptr();
+    }
+  }
   return Transform(CaseMapping::ToLower, str, space);
 }
 
@@ -27294,7 +27408,8 @@ void NativeFinalizer::RunCallback(const FinalizerEntry& entry,
         THR_Print("%s: Clearing external size %" Pd " bytes in %s space\n",
                   trace_context, external_size, space == 0 ? "new" : "old");
       }
-      group->heap()->FreedExternal(external_size, space);
+      group->heap()->FreedExternal(external_size, space,
+                                   Heap::ExternalKind::kFfi);
       entry.set_external_size(0);
     }
   }
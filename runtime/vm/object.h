@@ -4098,12 +4098,15 @@ class Function : public Object {
 // before on a generalized bounds check.
 // IsDynamicallyOverridden: This function can be overridden in a dynamically
 //                          loaded class.
+// 'WasReportedHot' is true if --print_hot_bytecode_functions printed this
+// function.
 #define STATE_BITS_LIST(V)                                                     \
   V(WasCompiled)                                                               \
   V(WasExecutedBit)                                                            \
   V(ProhibitsInstructionHoisting)                                              \
   V(ProhibitsBoundsCheckGeneralization)                                        \
-  V(IsDynamicallyOverridden)
+  V(IsDynamicallyOverridden)                                                   \
+  V(WasReportedHot)
 
   enum StateBits {
 #define DECLARE_FLAG_POS(Name) k##Name##Pos,
@@ -10538,6 +10541,14 @@ class String : public Instance {
     ASSERT(hash_set == value);
   }
 
+  // Flips the case of the ASCII letters between 'from' and 'to' in a one-byte
+  // string. Returns null if the string has non-ASCII characters, which are
+  // left to Transform.
+  static StringPtr TransformAsciiCase(const String& str,
+                                      uint8_t from,
+                                      uint8_t to,
+                                      Heap::Space space);
+
   FINAL_HEAP_OBJECT_IMPLEMENTATION(String, Instance);
 
   friend class Class;
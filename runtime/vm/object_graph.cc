@@ -8,6 +8,7 @@
 #include "vm/dart_api_state.h"
 #include "vm/growable_array.h"
 #include "vm/isolate.h"
+#include "vm/lockers.h"
 #include "vm/native_symbol.h"
 #include "vm/object.h"
 #include "vm/object_store.h"
@@ -15,6 +16,7 @@
 #include "vm/raw_object.h"
 #include "vm/raw_object_fields.h"
 #include "vm/reusable_handles.h"
+#include "vm/thread_pool.h"
 #include "vm/visitor.h"
 
 namespace dart {
@@ -640,6 +642,263 @@ ObjectGraph::RetainingPathResult ObjectGraph::RetainingPath(Object* obj,
   return {visitor.length(), visitor.gc_root_type};
 }
 
+// Computes immediate dominators of the object graph with the Lengauer-Tarjan
+// algorithm (the simple version, with path compression only). Node 0 is a
+// synthetic root pointing to all roots of the isolate group, and the other
+// nodes are numbered in the pre-order of a depth first traversal, which does
+// not follow weak references, like ObjectGraph::Stack.
+class ObjectGraph::DominatorTree : public ObjectPointerVisitor {
+ public:
+  explicit DominatorTree(IsolateGroup* isolate_group)
+      : ObjectPointerVisitor(isolate_group), object_ids_(new WeakTable()) {}
+  ~DominatorTree() { delete object_ids_; }
+
+  bool trace_values_through_fields() const override { return true; }
+
+  void VisitPointers(ObjectPtr* first, ObjectPtr* last) override {
+    for (ObjectPtr* current = first; current <= last; ++current) {
+      Visit(*current);
+    }
+  }
+
+#if defined(DART_COMPRESSED_POINTERS)
+  void VisitCompressedPointers(uword heap_base,
+                               CompressedObjectPtr* first,
+                               CompressedObjectPtr* last) override {
+    for (CompressedObjectPtr* current = first; current <= last; ++current) {
+      Visit(current->Decompress(heap_base));
+    }
+  }
+#endif
+
+  void Build() {
+    Traverse();
+    ComputeDominators();
+    ComputeRetainedSizes();
+  }
+
+  intptr_t length() const { return objects_.length(); }
+  ObjectPtr ObjectAt(intptr_t node) const { return objects_[node]; }
+  intptr_t RetainedSizeAt(intptr_t node) const { return retained_sizes_[node]; }
+
+ private:
+  static constexpr intptr_t kRoot = 0;
+  static constexpr intptr_t kNone = -1;
+
+  struct Edge {
+    intptr_t from;
+    ObjectPtr to;
+  };
+
+  void Visit(ObjectPtr obj) {
+    if (!obj->IsHeapObject() || obj->untag()->InVMIsolateHeap()) return;
+    edges_.Add({current_, obj});
+    if (object_ids_->GetValueExclusive(obj) == 0) {
+      pending_.Add({current_, obj});
+    }
+  }
+
+  // Numbers the nodes in depth first pre-order. A node is numbered when it is
+  // popped rather than when it is pushed, so that the parents form a depth
+  // first spanning tree.
+  void Traverse() {
+    objects_.Add(Object::null());
+    parents_.Add(kRoot);
+    current_ = kRoot;
+    isolate_group()->VisitObjectPointers(this,
+                                         ValidationPolicy::kDontValidateFrames);
+    while (!pending_.is_empty()) {
+      const Edge pending = pending_.RemoveLast();
+      ObjectPtr obj = pending.to;
+      if (object_ids_->GetValueExclusive(obj) != 0) continue;
+      current_ = objects_.length();
+      object_ids_->SetValueExclusive(obj, current_);
+      objects_.Add(obj);
+      parents_.Add(pending.from);
+      switch (obj->GetClassIdOfHeapObject()) {
+        case kWeakArrayCid:
+          break;
+        case kWeakReferenceCid: {
+          auto ref = static_cast<WeakReferencePtr>(obj);
+#if !defined(DART_COMPRESSED_POINTERS)
+          VisitPointers(&ref->untag()->type_arguments_,
+                        &ref->untag()->type_arguments_);
+#else
+          VisitCompressedPointers(ref->heap_base(),
+                                  &ref->untag()->type_arguments_,
+                                  &ref->untag()->type_arguments_);
+#endif
+          break;
+        }
+        case kFinalizerEntryCid: {
+          auto entry = static_cast<FinalizerEntryPtr>(obj);
+#if !defined(DART_COMPRESSED_POINTERS)
+          VisitPointers(&entry->untag()->token_, &entry->untag()->token_);
+          VisitPointers(&entry->untag()->next_, &entry->untag()->next_);
+#else
+          VisitCompressedPointers(entry->heap_base(), &entry->untag()->token_,
+                                  &entry->untag()->token_);
+          VisitCompressedPointers(entry->heap_base(), &entry->untag()->next_,
+                                  &entry->untag()->next_);
+#endif
+          break;
+        }
+        default:
+          obj->untag()->VisitPointers(this);
+          break;
+      }
+    }
+  }
+
+  void ComputeDominators() {
+    const intptr_t n = objects_.length();
+
+    // Predecessors of each node, as ranges of 'predecessors'.
+    MallocGrowableArray<intptr_t> predecessors_start;
+    predecessors_start.FillWith(0, 0, n + 1);
+    for (intptr_t i = 0; i < edges_.length(); i++) {
+      predecessors_start[object_ids_->GetValueExclusive(edges_[i].to)]++;
+    }
+    for (intptr_t i = 1; i <= n; i++) {
+      predecessors_start[i] += predecessors_start[i - 1];
+    }
+    MallocGrowableArray<intptr_t> predecessors;
+    predecessors.FillWith(0, 0, edges_.length());
+    for (intptr_t i = 0; i < edges_.length(); i++) {
+      const intptr_t to = object_ids_->GetValueExclusive(edges_[i].to);
+      predecessors[--predecessors_start[to]] = edges_[i].from;
+    }
+    edges_.Clear();
+
+    semi_.FillWith(0, 0, n);
+    label_.FillWith(0, 0, n);
+    ancestor_.FillWith(kNone, 0, n);
+    dominators_.FillWith(kRoot, 0, n);
+    MallocGrowableArray<intptr_t> bucket_head;
+    bucket_head.FillWith(kNone, 0, n);
+    MallocGrowableArray<intptr_t> bucket_next;
+    bucket_next.FillWith(kNone, 0, n);
+    for (intptr_t i = 0; i < n; i++) {
+      semi_[i] = i;
+      label_[i] = i;
+    }
+
+    for (intptr_t w = n - 1; w > kRoot; w--) {
+      for (intptr_t i = predecessors_start[w]; i < predecessors_start[w + 1];
+           i++) {
+        const intptr_t u = Eval(predecessors[i]);
+        if (semi_[u] < semi_[w]) {
+          semi_[w] = semi_[u];
+        }
+      }
+      bucket_next[w] = bucket_head[semi_[w]];
+      bucket_head[semi_[w]] = w;
+
+      const intptr_t parent = parents_[w];
+      ancestor_[w] = parent;
+      for (intptr_t v = bucket_head[parent]; v != kNone; v = bucket_next[v]) {
+        const intptr_t u = Eval(v);
+        dominators_[v] = semi_[u] < semi_[v] ? u : parent;
+      }
+      bucket_head[parent] = kNone;
+    }
+    for (intptr_t w = kRoot + 1; w < n; w++) {
+      if (dominators_[w] != semi_[w]) {
+        dominators_[w] = dominators_[dominators_[w]];
+      }
+    }
+  }
+
+  intptr_t Eval(intptr_t v) {
+    if (ancestor_[v] == kNone) return v;
+    Compress(v);
+    return label_[v];
+  }
+
+  void Compress(intptr_t v) {
+    // Iterative version of the recursive path compression, to avoid
+    // overflowing the native stack on deep object graphs.
+    ASSERT(path_.is_empty());
+    for (intptr_t u = v; ancestor_[ancestor_[u]] != kNone; u = ancestor_[u]) {
+      path_.Add(u);
+    }
+    while (!path_.is_empty()) {
+      const intptr_t u = path_.RemoveLast();
+      const intptr_t a = ancestor_[u];
+      if (semi_[label_[a]] < semi_[label_[u]]) {
+        label_[u] = label_[a];
+      }
+      ancestor_[u] = ancestor_[a];
+    }
+  }
+
+  void ComputeRetainedSizes() {
+    const intptr_t n = objects_.length();
+    retained_sizes_.FillWith(0, 0, n);
+    for (intptr_t i = kRoot + 1; i < n; i++) {
+      retained_sizes_[i] = objects_[i]->untag()->HeapSize();
+    }
+    // Dominators precede the nodes they dominate in pre-order.
+    for (intptr_t i = n - 1; i > kRoot; i--) {
+      retained_sizes_[dominators_[i]] += retained_sizes_[i];
+    }
+  }
+
+  // During the iteration of the heap we are already at a safepoint, so there is
+  // no need to let the GC know about [object_ids_].
+  WeakTable* object_ids_;
+  intptr_t current_ = kRoot;
+  MallocGrowableArray<Edge> edges_;
+  MallocGrowableArray<Edge> pending_;
+  MallocGrowableArray<ObjectPtr> objects_;
+  MallocGrowableArray<intptr_t> parents_;
+  MallocGrowableArray<intptr_t> semi_;
+  MallocGrowableArray<intptr_t> label_;
+  MallocGrowableArray<intptr_t> ancestor_;
+  MallocGrowableArray<intptr_t> dominators_;
+  MallocGrowableArray<intptr_t> retained_sizes_;
+  MallocGrowableArray<intptr_t> path_;
+
+  DISALLOW_COPY_AND_ASSIGN(DominatorTree);
+};
+
+intptr_t ObjectGraph::TopRetainers(const Array& retainers,
+                                   intptr_t* total_size) {
+  HeapIterationScope iteration_scope(Thread::Current(), true);
+  DominatorTree tree(isolate_group());
+  tree.Build();
+  *total_size = tree.RetainedSizeAt(0);
+
+  // Selects the largest user objects by insertion into a sorted list.
+  const intptr_t limit = retainers.IsNull() ? 0 : retainers.Length() / 2;
+  GrowableArray<intptr_t> top(limit);
+  for (intptr_t i = 1; i < tree.length() && limit > 0; i++) {
+    if (!IsUserClass(tree.ObjectAt(i)->GetClassIdOfHeapObject())) continue;
+    const intptr_t size = tree.RetainedSizeAt(i);
+    if (top.length() == limit && tree.RetainedSizeAt(top.Last()) >= size) {
+      continue;
+    }
+    if (top.length() == limit) top.RemoveLast();
+    intptr_t j = top.length();
+    top.Add(i);
+    for (; j > 0 && tree.RetainedSizeAt(top[j - 1]) < size; j--) {
+      top[j] = top[j - 1];
+    }
+    top[j] = i;
+  }
+
+  HANDLESCOPE(thread());
+  Object& object = Object::Handle();
+  Smi& size = Smi::Handle();
+  for (intptr_t i = 0; i < top.length(); i++) {
+    object = tree.ObjectAt(top[i]);
+    size = Smi::New(tree.RetainedSizeAt(top[i]));
+    retainers.SetAt(2 * i, object);
+    retainers.SetAt(2 * i + 1, size);
+  }
+  return top.length();
+}
+
 class InboundReferencesVisitor : public ObjectVisitor,
                                  public ObjectPointerVisitor {
  public:
@@ -1455,18 +1714,68 @@ FileHeapSnapshotWriter::FileHeapSnapshotWriter(Thread* thread,
 }
 
 FileHeapSnapshotWriter::~FileHeapSnapshotWriter() {
+  {
+    MonitorLocker ml(&monitor_);
+    while (writer_running_) {
+      ml.Wait();
+    }
+  }
   if (file_ != nullptr) {
     Dart::file_close_callback()(file_);
   }
 }
 
+class FileHeapSnapshotWriter::WriterTask : public ThreadPool::Task {
+ public:
+  explicit WriterTask(FileHeapSnapshotWriter* writer) : writer_(writer) {}
+
+  void Run() override { writer_->DrainChunks(); }
+
+ private:
+  FileHeapSnapshotWriter* writer_;
+
+  DISALLOW_COPY_AND_ASSIGN(WriterTask);
+};
+
 void FileHeapSnapshotWriter::WriteChunk(uint8_t* buffer,
                                         intptr_t size,
                                         bool last) {
-  if (file_ != nullptr) {
-    Dart::file_write_callback()(buffer, size, file_);
+  if (file_ == nullptr) {
+    free(buffer);
+    return;
+  }
+  MonitorLocker ml(&monitor_);
+  while (pending_bytes_ > 0 && pending_bytes_ + size > kMaxPendingBytes) {
+    ml.Wait();
+  }
+  pending_.Add({buffer, size});
+  pending_bytes_ += size;
+  if (!writer_running_) {
+    writer_running_ = Dart::thread_pool()->Run<WriterTask>(this);
+    if (!writer_running_) {
+      // Shutting down; write on this thread instead.
+      ml.Exit();
+      DrainChunks();
+      ml.Enter();
+    }
   }
-  free(buffer);
+}
+
+void FileHeapSnapshotWriter::DrainChunks() {
+  MonitorLocker ml(&monitor_);
+  while (next_pending_ < pending_.length()) {
+    Chunk chunk = pending_[next_pending_++];
+    ml.Exit();
+    Dart::file_write_callback()(chunk.buffer, chunk.size, file_);
+    free(chunk.buffer);
+    ml.Enter();
+    pending_bytes_ -= chunk.size;
+    ml.NotifyAll();
+  }
+  pending_.Clear();
+  next_pending_ = 0;
+  writer_running_ = false;
+  ml.NotifyAll();
 }
 
 CallbackHeapSnapshotWriter::CallbackHeapSnapshotWriter(
@@ -9,6 +9,8 @@
 
 #include "vm/allocation.h"
 #include "vm/dart_api_state.h"
+#include "vm/growable_array.h"
+#include "vm/os_thread.h"
 #include "vm/thread_stack_resource.h"
 
 namespace dart {
@@ -26,6 +28,7 @@ class CountingPage;
 class ObjectGraph : public ThreadStackResource {
  public:
   class Stack;
+  class DominatorTree;
 
   // Allows climbing the search tree all the way to the root.
   class StackIterator {
@@ -113,6 +116,13 @@ class ObjectGraph : public ThreadStackResource {
   // be live due to references from the stack or embedder handles.
   intptr_t InboundReferences(Object* obj, const Array& references);
 
+  // Computes the dominator tree of all strongly reachable objects. Populates
+  // the provided array with pairs of (object, retained size in bytes) for the
+  // user objects which retain the most memory, largest first, as far as there
+  // is room. Returns the number of pairs and sets 'total_size' to the size of
+  // all reachable objects.
+  intptr_t TopRetainers(const Array& retainers, intptr_t* total_size);
+
  private:
   DISALLOW_IMPLICIT_CONSTRUCTORS(ObjectGraph);
 };
@@ -127,6 +137,9 @@ class ChunkedWriter : public ThreadStackResource {
   virtual void WriteChunk(uint8_t* buffer, intptr_t size, bool last) = 0;
 };
 
+// Writes chunks to the file on a helper thread, so the disk does not extend
+// the safepoint in which the snapshot is taken. At most
+// kMaxPendingBytes are queued; the destructor waits for the rest.
 class FileHeapSnapshotWriter : public ChunkedWriter {
  public:
   FileHeapSnapshotWriter(Thread* thread,
@@ -137,8 +150,26 @@ class FileHeapSnapshotWriter : public ChunkedWriter {
   virtual void WriteChunk(uint8_t* buffer, intptr_t size, bool last);
 
  private:
+  static constexpr intptr_t kMaxPendingBytes = 64 * MB;
+
+  struct Chunk {
+    uint8_t* buffer;
+    intptr_t size;
+  };
+
+  class WriterTask;
+
+  // Runs on the helper thread until the queue is empty.
+  void DrainChunks();
+
   void* file_ = nullptr;
   bool* success_;
+
+  Monitor monitor_;
+  MallocGrowableArray<Chunk> pending_;
+  intptr_t next_pending_ = 0;
+  intptr_t pending_bytes_ = 0;
+  bool writer_running_ = false;
 };
 
 class CallbackHeapSnapshotWriter : public ChunkedWriter {
@@ -146,8 +146,10 @@ static ObjectPtr Marker() {
   return Object::unknown_constant().ptr();
 }
 
+// Whether [obj] can be shared, without looking into the elements of
+// unmodifiable lists. See IsDeeplyImmutableArray for those.
 DART_FORCE_INLINE
-static bool CanShareObject(ObjectPtr obj, uword tags) {
+static bool CanShareObjectShallow(ObjectPtr obj, uword tags) {
   if ((tags & UntaggedObject::CanonicalBit::mask_in_place()) != 0) {
     return true;
   }
@@ -176,6 +178,40 @@ static bool CanShareObject(ObjectPtr obj, uword tags) {
   return false;
 }
 
+// Whether [array] is an unmodifiable list (e.g. created by `List.unmodifiable`)
+// whose elements are all deeply immutable. Such a list can be shared, as no
+// isolate can observe whether it was copied.
+//
+// Nested unmodifiable lists are not looked into, which keeps the check linear
+// in the length of the list. The copier records the result in its forwarding
+// map, so each list is only scanned once per message.
+static bool IsDeeplyImmutableArray(ArrayPtr array) {
+  auto raw = array.untag();
+  ObjectPtr type_arguments = raw->type_arguments();
+  if (type_arguments != Object::null() &&
+      !type_arguments.untag()->IsCanonical()) {
+    return false;
+  }
+  const intptr_t length = Smi::Value(raw->length());
+  for (intptr_t i = 0; i < length; i++) {
+    ObjectPtr element = raw->element(i);
+    if (!element->IsHeapObject()) continue;
+    const uword tags = TagsFromUntaggedObject(element.untag());
+    if ((tags & UntaggedObject::CanonicalBit::mask_in_place()) != 0) continue;
+    if (UntaggedObject::ClassIdTag::decode(tags) == kImmutableArrayCid ||
+        !CanShareObjectShallow(element, tags)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool CanShareObject(ObjectPtr obj, uword tags) {
+  if (CanShareObjectShallow(obj, tags)) return true;
+  return (UntaggedObject::ClassIdTag::decode(tags) == kImmutableArrayCid) &&
+         IsDeeplyImmutableArray(Array::RawCast(obj));
+}
+
 bool CanShareObjectAcrossIsolates(ObjectPtr obj) {
   if (!obj->IsHeapObject()) return true;
   const uword tags = TagsFromUntaggedObject(obj.untag());
@@ -1363,7 +1399,7 @@ class FastObjectCopyBase : public ObjectCopyBase {
     }
     auto value_decompressed = value.Decompress(heap_base_);
     const uword tags = TagsFromUntaggedObject(value_decompressed.untag());
-    if (CanShareObject(value_decompressed, tags)) {
+    if (CanShareObjectShallow(value_decompressed, tags)) {
       StoreCompressedPointerNoBarrier(dst, offset, value);
       return;
     }
@@ -1388,6 +1424,13 @@ class FastObjectCopyBase : public ObjectCopyBase {
   ObjectPtr Forward(uword tags, ObjectPtr from) {
     const intptr_t header_size = UntaggedObject::SizeTag::decode(tags);
     const auto cid = UntaggedObject::ClassIdTag::decode(tags);
+    if (cid == kImmutableArrayCid &&
+        IsDeeplyImmutableArray(Array::RawCast(from))) {
+      // Forward the list to itself, so later references to it are not
+      // scanned again.
+      fast_forward_map_.Insert(from, from, 0);
+      return from;
+    }
     const uword size =
         header_size != 0 ? header_size : from.untag()->HeapSize();
     if (IsAllocatableInNewSpace(size)) {
@@ -1536,7 +1579,7 @@ class SlowObjectCopyBase : public ObjectCopyBase {
 
     auto value_decompressed = value.Decompress(heap_base_);
     const uword tags = TagsFromUntaggedObject(value_decompressed.untag());
-    if (CanShareObject(value_decompressed, tags)) {
+    if (CanShareObjectShallow(value_decompressed, tags)) {
       StoreCompressedLargeArrayPointerBarrier(dst.ptr(), offset,
                                               value_decompressed);
       return;
@@ -1571,7 +1614,7 @@ class SlowObjectCopyBase : public ObjectCopyBase {
     }
     auto value_decompressed = value.Decompress(heap_base_);
     const uword tags = TagsFromUntaggedObject(value_decompressed.untag());
-    if (CanShareObject(value_decompressed, tags)) {
+    if (CanShareObjectShallow(value_decompressed, tags)) {
       StoreCompressedPointerBarrier(dst.ptr(), offset, value_decompressed);
       return;
     }
@@ -1596,6 +1639,13 @@ class SlowObjectCopyBase : public ObjectCopyBase {
 
   ObjectPtr Forward(uword tags, const Object& from) {
     const intptr_t cid = UntaggedObject::ClassIdTag::decode(tags);
+    if (cid == kImmutableArrayCid &&
+        IsDeeplyImmutableArray(Array::RawCast(from.ptr()))) {
+      // Forward the list to itself, so later references to it are not
+      // scanned again.
+      slow_forward_map_.Insert(from, from, 0);
+      return from.ptr();
+    }
     intptr_t size = UntaggedObject::SizeTag::decode(tags);
     if (size == 0) {
       size = from.ptr().untag()->HeapSize();
@@ -2147,9 +2197,12 @@ class FastObjectCopy : public ObjectCopy<FastObjectCopyBase> {
         const intptr_t index = fast_forward_map_.fill_cursor_;
         ObjectPtr from = fast_forward_map_.raw_from_to_[index];
         ObjectPtr to = fast_forward_map_.raw_from_to_[index + 1];
-        FastCopyObject(from, to);
-        if (exception_msg_ != nullptr) {
-          return root_copy;
+        // Shared lists are forwarded to themselves and have nothing to copy.
+        if (from != to) {
+          FastCopyObject(from, to);
+          if (exception_msg_ != nullptr) {
+            return root_copy;
+          }
         }
         fast_forward_map_.fill_cursor_ += 2;
 
@@ -2319,7 +2372,10 @@ class SlowObjectCopy : public ObjectCopy<SlowObjectCopyBase> {
         const intptr_t index = slow_forward_map_.fill_cursor_;
         from = slow_forward_map_.from_to_.At(index);
         to = slow_forward_map_.from_to_.At(index + 1);
-        CopyObject(from, to);
+        // Shared lists are forwarded to themselves and have nothing to copy.
+        if (from.ptr() != to.ptr()) {
+          CopyObject(from, to);
+        }
         slow_forward_map_.fill_cursor_ += 2;
         if (exception_msg_ != nullptr) {
           return Marker();
@@ -2487,6 +2543,9 @@ class ObjectGraphCopier : public StackResource {
 
   intptr_t copied_objects() { return copied_objects_; }
 
+  // Whether the fast new-space copy had to be abandoned.
+  bool used_slow_path() { return used_slow_path_; }
+
  private:
   ObjectPtr CopyObjectGraphInternal(const Object& root,
                                     const char* volatile* exception_msg) {
@@ -2564,6 +2623,7 @@ class ObjectGraphCopier : public StackResource {
     }
 
     // Use the slow copy approach.
+    used_slow_path_ = true;
     result = slow_object_copy_.ContinueCopyGraphSlow(root, result);
     ASSERT((result.ptr() == Marker()) ==
            (slow_object_copy_.exception_msg_ != nullptr));
@@ -2606,6 +2666,8 @@ class ObjectGraphCopier : public StackResource {
     for (intptr_t i = cursor; i < length; i += 2) {
       auto from = fast_forward_map.raw_from_to_[i];
       auto to = fast_forward_map.raw_from_to_[i + 1];
+      // Shared lists are forwarded to themselves and are already initialized.
+      if (from == to) continue;
       const uword tags = TagsFromUntaggedObject(from.untag());
       const intptr_t cid = UntaggedObject::ClassIdTag::decode(tags);
       // External typed data is already initialized.
@@ -2718,18 +2780,33 @@ class ObjectGraphCopier : public StackResource {
   SlowObjectCopy slow_object_copy_;
   intptr_t copied_objects_ = 0;
   intptr_t allocated_bytes_ = 0;
+  bool used_slow_path_ = false;
 };
 
 ObjectPtr CopyMutableObjectGraph(const Object& object) {
   auto thread = Thread::Current();
   TIMELINE_DURATION(thread, Isolate, "CopyMutableObjectGraph");
+#if defined(SUPPORT_TIMELINE)
+  const int64_t start_micros =
+      tbes.enabled() ? OS::GetCurrentMonotonicMicros() : 0;
+#endif
   ObjectGraphCopier copier(thread);
   ObjectPtr result = copier.CopyObjectGraph(object);
 #if defined(SUPPORT_TIMELINE)
   if (tbes.enabled()) {
-    tbes.SetNumArguments(2);
+    const int64_t elapsed_micros =
+        OS::GetCurrentMonotonicMicros() - start_micros;
+    // Bytes per microsecond is MB/s.
+    const double throughput =
+        elapsed_micros > 0
+            ? static_cast<double>(copier.allocated_bytes()) / elapsed_micros
+            : 0.0;
+    tbes.SetNumArguments(4);
     tbes.FormatArgument(0, "CopiedObjects", "%" Pd, copier.copied_objects());
     tbes.FormatArgument(1, "AllocatedBytes", "%" Pd, copier.allocated_bytes());
+    tbes.FormatArgument(2, "Throughput (MB/s)", "%.1f", throughput);
+    tbes.CopyArgument(3, "SlowPath",
+                      copier.used_slow_path() ? "true" : "false");
   }
 #endif
   return result;
@@ -136,11 +136,11 @@ class ObjectPointerVisitor;
   RW(Class, dart_mutex_class)                                                  \
   ARW_AR(WeakArray, symbol_table)                                              \
   ARW_AR(WeakArray, regexp_table)                                              \
-  RW(Array, canonical_types)                                                   \
+  ARW_AR(Array, canonical_types)                                               \
   RW(Array, canonical_function_types)                                          \
   RW(Array, canonical_record_types)                                            \
   RW(Array, canonical_type_parameters)                                         \
-  RW(Array, canonical_type_arguments)                                          \
+  ARW_AR(Array, canonical_type_arguments)                                      \
   RW(Library, async_library)                                                   \
   RW(Library, core_library)                                                    \
   RW(Library, _compact_hash_library)                                           \
@@ -166,7 +166,7 @@ class ObjectPointerVisitor;
   RW(Smi, last_libraries_count)                                                \
   RW(Array, loading_units)                                                     \
   RW(GrowableObjectArray, closure_functions)                                   \
-  RW(Array, closure_functions_table)                                           \
+  ARW_AR(Array, closure_functions_table)                                       \
   RW(GrowableObjectArray, pending_classes)                                     \
   RW(Array, record_field_names_map)                                            \
   ARW_RELAXED(Array, record_field_names)                                       \
@@ -199,7 +199,10 @@ class ObjectPointerVisitor;
   RW(CompressedStackMaps, canonicalized_stack_map_entries)                     \
   RW(ObjectPool, global_object_pool)                                           \
   RW(Array, unique_dynamic_targets)                                            \
+  RW(Array, polymorphic_dynamic_targets)                                       \
   RW(GrowableObjectArray, megamorphic_cache_table)                             \
+  RW(Array, megamorphic_cache_index)                                           \
+  RW(Array, resolution_cache)                                                  \
   RW(GrowableObjectArray, ffi_callback_code)                                   \
   RW(Code, dispatch_table_null_error_stub)                                     \
   RW(Code, late_initialization_error_stub_with_fpu_regs_stub)                  \
@@ -294,6 +297,7 @@ class ObjectPointerVisitor;
   RW(GrowableObjectArray, instructions_tables)                                 \
   RW(Array, obfuscation_map)                                                   \
   RW(Array, loading_unit_uris)                                                 \
+  RW(Array, message_class_cids)                                                \
   RW(Class, ffi_pointer_class)                                                 \
   RW(Class, ffi_native_type_class)                                             \
   // Please remember the last entry must be referred in the 'to' function below.
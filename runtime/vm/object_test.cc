@@ -25,6 +25,7 @@
 #include "vm/debugger_api_impl_test.h"
 #include "vm/flags.h"
 #include "vm/isolate.h"
+#include "vm/lockers.h"
 #include "vm/message_handler.h"
 #include "vm/object.h"
 #include "vm/object_store.h"
@@ -39,6 +40,7 @@ namespace dart {
 
 #define Z (thread->zone())
 
+DECLARE_FLAG(bool, defer_native_finalizers);
 DECLARE_FLAG(bool, write_protect_code);
 
 static ClassPtr CreateDummyClass(const String& class_name,
@@ -1644,6 +1646,54 @@ ISOLATE_UNIT_TEST_CASE(StringEqualsUtf8) {
                       "\xF0\x90\x8E\xA2\xF0\x90\x8E\xA3"));
 }
 
+ISOLATE_UNIT_TEST_CASE(StringCaseConversion) {
+  const String& mixed = String::Handle(String::New("Content-Type: 42"));
+  EXPECT_STREQ("content-type: 42",
+               String::Handle(String::ToLowerCase(mixed)).ToCString());
+  EXPECT_STREQ("CONTENT-TYPE: 42",
+               String::Handle(String::ToUpperCase(mixed)).ToCString());
+
+  // Unchanged strings are returned as is.
+  const String& lower = String::Handle(String::New("x-request-id"));
+  EXPECT(String::ToLowerCase(lower) == lower.ptr());
+  const String& upper = String::Handle(String::New("@[`{"));
+  EXPECT(String::ToUpperCase(upper) == upper.ptr());
+  EXPECT(String::ToLowerCase(upper) == upper.ptr());
+
+  // Latin-1 letters use the full case mapping.
+  const String& latin1 = String::Handle(String::New("\xC3\x80b\xC3\xA0"));
+  EXPECT_STREQ("\xC3\xA0" "b\xC3\xA0",
+               String::Handle(String::ToLowerCase(latin1)).ToCString());
+  EXPECT_STREQ("\xC3\x80" "B\xC3\x80",
+               String::Handle(String::ToUpperCase(latin1)).ToCString());
+}
+
+ISOLATE_UNIT_TEST_CASE(StringEqualsDifferentWidth) {
+  const uint8_t latin1[] = {'a', 'b', 0xE6, 'd'};
+  const uint16_t utf16[] = {'a', 'b', 0xE6, 'd'};
+  const String& one =
+      String::Handle(OneByteString::New(latin1, 4, Heap::kNew));
+  // Latin-1 contents in a two-byte string.
+  const String& two = String::Handle(TwoByteString::New(utf16, 4, Heap::kNew));
+  EXPECT(one.IsOneByteString());
+  EXPECT(two.IsTwoByteString());
+  EXPECT(one.Equals(two));
+  EXPECT(two.Equals(one));
+  EXPECT(one.EqualsLatin1(latin1, 4));
+  EXPECT(two.EqualsLatin1(latin1, 4));
+  EXPECT(one.Equals(utf16, 4));
+  EXPECT(two.Equals(utf16, 4));
+
+  const String& abcd = String::Handle(String::New("xabcd"));
+  const String& bcd = String::Handle(String::New("bcd"));
+  EXPECT(bcd.Equals(abcd, 2, 3));
+  EXPECT(!bcd.Equals(abcd, 1, 3));
+  const uint16_t other[] = {'a', 'b', 0xE7, 'd'};
+  EXPECT(!one.Equals(other, 4));
+  EXPECT(!two.Equals(other, 4));
+  EXPECT(!two.Equals(String::Handle(String::New("ab\xC3\xA7d"))));
+}
+
 ISOLATE_UNIT_TEST_CASE(StringEqualsUTF32) {
   const String& empty = String::Handle(String::New(""));
   const String& t_str = String::Handle(String::New("t"));
@@ -5016,8 +5066,10 @@ static void NativeFinalizer_TwoEntriesCrossGen(
   const intptr_t external_size2 = 2048;
   entry1.set_external_size(external_size1);
   entry2.set_external_size(external_size2);
-  IsolateGroup::Current()->heap()->AllocatedExternal(external_size1, spaces[5]);
-  IsolateGroup::Current()->heap()->AllocatedExternal(external_size2, spaces[7]);
+  IsolateGroup::Current()->heap()->AllocatedExternal(
+      external_size1, spaces[5], Heap::ExternalKind::kFfi);
+  IsolateGroup::Current()->heap()->AllocatedExternal(
+      external_size2, spaces[7], Heap::ExternalKind::kFfi);
 
   auto& value1 = String::Handle();
   auto& detach1 = String::Handle();
@@ -5141,6 +5193,69 @@ REPEAT_512(FINALIZER_NATIVE_CROSS_GEN_TEST_CASE)
 
 #undef REPEAT_512
 
+static Monitor* deferred_native_finalizer_monitor = nullptr;
+static intptr_t deferred_native_finalizer_calls = 0;
+
+static void NativeFinalizer_Deferred_Finalizer(void* peer) {
+  MonitorLocker ml(deferred_native_finalizer_monitor);
+  (*reinterpret_cast<intptr_t*>(peer))++;
+  ml.Notify();
+}
+
+ISOLATE_UNIT_TEST_CASE(NativeFinalizer_Deferred) {
+  SetFlagScope<bool> sfs(&FLAG_defer_native_finalizers, true);
+  Monitor monitor;
+  deferred_native_finalizer_monitor = &monitor;
+  deferred_native_finalizer_calls = 0;
+
+  const auto& callback = Pointer::Handle(Pointer::New(
+      reinterpret_cast<uword>(&NativeFinalizer_Deferred_Finalizer)));
+  const auto& finalizer = NativeFinalizer::Handle(NativeFinalizer::New());
+  finalizer.set_callback(callback);
+  finalizer.set_isolate(thread->isolate());
+
+  const auto& isolate_finalizers =
+      GrowableObjectArray::Handle(GrowableObjectArray::New());
+  const auto& weak = WeakReference::Handle(WeakReference::New());
+  weak.set_target(finalizer);
+  isolate_finalizers.Add(weak);
+  thread->isolate()->set_finalizers(isolate_finalizers);
+
+  const auto& all_entries = Set::Handle(Set::NewDefault());
+  finalizer.set_all_entries(all_entries);
+  const auto& entry = FinalizerEntry::Handle(FinalizerEntry::New(finalizer));
+  Array::Handle(all_entries.data()).SetAt(0, entry);
+  all_entries.set_used_data(1);  // Don't bother setting the index.
+  const auto& token = Pointer::Handle(
+      Pointer::New(reinterpret_cast<uword>(&deferred_native_finalizer_calls)));
+  entry.set_token(token);
+  {
+    HANDLESCOPE(thread);
+    entry.set_value(String::Handle(OneByteString::New("value")));
+  }
+
+  GCTestHelper::CollectAllGarbage();
+  EXPECT_EQ(Object::null(), entry.value());
+
+  // The callback runs on a thread pool task after the GC.
+  {
+    MonitorLocker ml(&monitor);
+    while (deferred_native_finalizer_calls == 0) {
+      ml.Wait();
+    }
+  }
+  EXPECT_EQ(1, deferred_native_finalizer_calls);
+  deferred_native_finalizer_monitor = nullptr;
+  EXPECT_LE(1, thread->isolate_group()
+                   ->GetNativeFinalizerBacklogMaxMetric()
+                   ->Value());
+
+  // Simulate detachment.
+  entry.set_token(entry);
+  Array::Handle(all_entries.data()).SetAt(0, Object::Handle(Object::null()));
+  all_entries.set_used_data(0);
+}
+
 TEST_CASE(IsIsolateUnsendable) {
   Zone* const zone = Thread::Current()->zone();
 
@@ -5632,6 +5747,63 @@ TEST_CASE(FunctionWithBreakpointNotInlined) {
   }
 }
 
+TEST_CASE(SettingBreakpointKeepsUnrelatedCodeOptimized) {
+  const char* kScriptChars =
+      "class A {\n"
+      "  a() {\n"
+      "    return 1;\n"  // This is line 3.
+      "  }\n"
+      "}\n"
+      "c() => 2;\n"
+      "test() {\n"
+      "  new A().a();\n"
+      "  c();\n"
+      "}";
+  const int kBreakpointLine = 3;
+  Dart_Handle lib = TestCase::LoadTestScript(kScriptChars, nullptr);
+  EXPECT_VALID(lib);
+
+  // Get unoptimized code for the functions so they can be optimized.
+  Dart_Handle result = Dart_Invoke(lib, NewString("test"), 0, nullptr);
+  EXPECT_VALID(result);
+
+  {
+    TransitionNativeToVM transition(thread);
+    const String& name = String::Handle(String::New(TestCase::url()));
+    const Library& vmlib =
+        Library::Handle(Library::LookupLibrary(thread, name));
+    EXPECT(!vmlib.IsNull());
+    const Class& class_a = Class::Handle(
+        vmlib.LookupClass(String::Handle(Symbols::New(thread, "A"))));
+    const Function& func_a = Function::Handle(GetFunction(class_a, "a"));
+    const Function& func_c = Function::Handle(GetFunction(vmlib, "c"));
+    Compiler::EnsureUnoptimizedCode(thread, func_a);
+    Compiler::CompileOptimizedFunction(thread, func_a);
+    Compiler::EnsureUnoptimizedCode(thread, func_c);
+    Compiler::CompileOptimizedFunction(thread, func_c);
+    EXPECT(func_a.HasOptimizedCode());
+    EXPECT(func_c.HasOptimizedCode());
+  }
+
+  result = Dart_SetBreakpoint(NewString(TestCase::url()), kBreakpointLine);
+  EXPECT_VALID(result);
+
+  // Only the function with the breakpoint is deoptimized.
+  {
+    TransitionNativeToVM transition(thread);
+    const String& name = String::Handle(String::New(TestCase::url()));
+    const Library& vmlib =
+        Library::Handle(Library::LookupLibrary(thread, name));
+    EXPECT(!vmlib.IsNull());
+    const Class& class_a = Class::Handle(
+        vmlib.LookupClass(String::Handle(Symbols::New(thread, "A"))));
+    const Function& func_a = Function::Handle(GetFunction(class_a, "a"));
+    const Function& func_c = Function::Handle(GetFunction(vmlib, "c"));
+    EXPECT(!func_a.HasOptimizedCode());
+    EXPECT(func_c.HasOptimizedCode());
+  }
+}
+
 void SetBreakpoint(Dart_NativeArguments args) {
   // Refers to the DeoptimizeFramesWhenSettingBreakpoint function below.
   const int kBreakpointLine = 8;
@@ -422,20 +422,120 @@ static bool LocalTime(int64_t seconds_since_epoch, tm* tm_result) {
   return error_code != nullptr;
 }
 
+// Caches the time zone offset and name of the last interval of time queried,
+// since formatting local times calls localtime_r for nearly the same time
+// over and over. On a miss, the time one probe interval later is looked up as
+// well, and if it has the same offset and name, the whole interval is
+// assumed to lie between two time zone transitions. Transitions are much
+// further apart than the probe interval in all time zones in use.
+//
+// The cache is dropped when the TZ environment variable changes.
+class TimeZoneCache : public AllStatic {
+ public:
+  static void Init() {
+    ASSERT(mutex_ == nullptr);
+    mutex_ = new Mutex();
+  }
+
+  static void Cleanup() {
+    delete mutex_;
+    mutex_ = nullptr;
+    free(tz_);
+    tz_ = nullptr;
+  }
+
+  // Returns false if the local time of 'seconds_since_epoch' is unknown.
+  static bool Lookup(int64_t seconds_since_epoch,
+                     int* offset,
+                     const char** name) {
+    if (mutex_ == nullptr) {
+      return LookupUncached(seconds_since_epoch, offset, name);
+    }
+    MutexLocker ml(mutex_);
+    if (!TzChanged() && (start_ <= seconds_since_epoch) &&
+        (seconds_since_epoch <= end_)) {
+      *offset = offset_;
+      *name = name_;
+      return true;
+    }
+    if (!LookupUncached(seconds_since_epoch, offset, name)) {
+      return false;
+    }
+    int probe_offset;
+    const char* probe_name;
+    const int64_t probe = seconds_since_epoch + kProbeSeconds;
+    start_ = end_ = seconds_since_epoch;
+    if (LookupUncached(probe, &probe_offset, &probe_name) &&
+        (probe_offset == *offset) && (strcmp(probe_name, *name) == 0)) {
+      end_ = probe;
+    }
+    offset_ = *offset;
+    name_ = *name;
+    return true;
+  }
+
+ private:
+  static constexpr int64_t kProbeSeconds = 60 * 60;
+
+  static bool LookupUncached(int64_t seconds_since_epoch,
+                             int* offset,
+                             const char** name) {
+    tm decomposed;
+    if (!LocalTime(seconds_since_epoch, &decomposed)) {
+      return false;
+    }
+    // Even if the offset was 24 hours it would still easily fit into 32 bits.
+    *offset = static_cast<int>(decomposed.tm_gmtoff);
+    // The zone names are kept alive by the C library until the time zone
+    // changes, which also drops the cache.
+    *name = decomposed.tm_zone != nullptr ? decomposed.tm_zone : "";
+    return true;
+  }
+
+  // Returns true and empties the cache if the TZ environment variable is not
+  // the one the cache was filled for.
+  static bool TzChanged() {
+    const char* tz = getenv("TZ");
+    if ((tz == nullptr && tz_ == nullptr) ||
+        (tz != nullptr && tz_ != nullptr && strcmp(tz, tz_) == 0)) {
+      return false;
+    }
+    free(tz_);
+    tz_ = tz != nullptr ? Utils::StrDup(tz) : nullptr;
+    start_ = 1;
+    end_ = 0;
+    return true;
+  }
+
+  static Mutex* mutex_;
+  static char* tz_;
+  static int64_t start_;
+  static int64_t end_;
+  static int offset_;
+  static const char* name_;
+};
+
+Mutex* TimeZoneCache::mutex_ = nullptr;
+char* TimeZoneCache::tz_ = nullptr;
+int64_t TimeZoneCache::start_ = 1;
+int64_t TimeZoneCache::end_ = 0;
+int TimeZoneCache::offset_ = 0;
+const char* TimeZoneCache::name_ = "";
+
 const char* OS::GetTimeZoneName(int64_t seconds_since_epoch) {
-  tm decomposed;
-  bool succeeded = LocalTime(seconds_since_epoch, &decomposed);
+  int offset;
+  const char* name;
   // If unsuccessful, return an empty string like V8 does.
-  return (succeeded && (decomposed.tm_zone != nullptr)) ? decomposed.tm_zone
-                                                        : "";
+  return TimeZoneCache::Lookup(seconds_since_epoch, &offset, &name) ? name
+                                                                     : "";
 }
 
 int OS::GetTimeZoneOffsetInSeconds(int64_t seconds_since_epoch) {
-  tm decomposed;
-  bool succeeded = LocalTime(seconds_since_epoch, &decomposed);
-  // Even if the offset was 24 hours it would still easily fit into 32 bits.
+  int offset;
+  const char* name;
   // If unsuccessful, return zero like V8 does.
-  return succeeded ? static_cast<int>(decomposed.tm_gmtoff) : 0;
+  return TimeZoneCache::Lookup(seconds_since_epoch, &offset, &name) ? offset
+                                                                     : 0;
 }
 
 int64_t OS::GetCurrentTimeMillis() {
@@ -643,9 +743,13 @@ void OS::PrintErr(const char* format, ...) {
   va_end(args);
 }
 
-void OS::Init() {}
+void OS::Init() {
+  TimeZoneCache::Init();
+}
 
-void OS::Cleanup() {}
+void OS::Cleanup() {
+  TimeZoneCache::Cleanup();
+}
 
 void OS::PrepareToAbort() {}
 
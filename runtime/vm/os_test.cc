@@ -32,4 +32,37 @@ VM_UNIT_TEST_CASE(OsFuncs) {
   EXPECT_LE(1, procs);
 }
 
+#if defined(DART_HOST_OS_LINUX)
+VM_UNIT_TEST_CASE(OsTimeZoneCache) {
+  const char* old_tz = getenv("TZ");
+  char* saved_tz = old_tz != nullptr ? Utils::StrDup(old_tz) : nullptr;
+  setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
+  tzset();
+
+  // Summer time starts at 2024-03-31 01:00 UTC.
+  const int64_t transition = 1711846800;
+  EXPECT_EQ(3600, OS::GetTimeZoneOffsetInSeconds(transition - 1800));
+  EXPECT_EQ(3600, OS::GetTimeZoneOffsetInSeconds(transition - 1));
+  EXPECT_EQ(7200, OS::GetTimeZoneOffsetInSeconds(transition));
+  EXPECT_EQ(7200, OS::GetTimeZoneOffsetInSeconds(transition + 1800));
+  EXPECT_EQ(3600, OS::GetTimeZoneOffsetInSeconds(transition - 1));
+  EXPECT_STREQ("CET", OS::GetTimeZoneName(transition - 1));
+  EXPECT_STREQ("CEST", OS::GetTimeZoneName(transition + 1));
+
+  // Changing the time zone drops the cached interval.
+  setenv("TZ", "UTC0", 1);
+  tzset();
+  EXPECT_EQ(0, OS::GetTimeZoneOffsetInSeconds(transition + 1800));
+  EXPECT_STREQ("UTC", OS::GetTimeZoneName(transition + 1800));
+
+  if (saved_tz != nullptr) {
+    setenv("TZ", saved_tz, 1);
+    free(saved_tz);
+  } else {
+    unsetenv("TZ");
+  }
+  tzset();
+}
+#endif  // defined(DART_HOST_OS_LINUX)
+
 }  // namespace dart
@@ -122,6 +122,20 @@ class OSThread : public BaseThread {
   // alignment checks.
   static uword GetCurrentStackPointer();
 
+  // Scheduling priority hints for the current thread.
+  enum Priority {
+    // The default priority of threads created by the VM.
+    kNormalPriority,
+    // CPU bound work that should yield to threads running at normal priority
+    // when the CPU is saturated.
+    kBackgroundPriority,
+  };
+
+  // Asks the OS scheduler to run the current thread at [priority]. Returns
+  // false if the platform does not support the hint or it could not be
+  // applied.
+  static bool SetCurrentThreadPriority(Priority priority);
+
 #if defined(USING_SAFE_STACK)
   static uword GetCurrentSafestackPointer();
   static void SetCurrentSafestackPointer(uword ssp);
@@ -314,6 +328,7 @@ class OSThread : public BaseThread {
   friend class Thread;  // to access set_thread(Thread*).
   friend class OSThreadIterator;
   friend class ThreadInterrupterFuchsia;
+  friend class ThreadInterrupterLinux;
   friend class ThreadInterrupterMacOS;
   friend class ThreadInterrupterWin;
   friend class ThreadPool;  // to access owning_thread_pool_worker_
@@ -7,6 +7,7 @@
 #if defined(DART_USE_ABSL)
 
 #include <errno.h>  // NOLINT
+#include <sched.h>  // NOLINT
 #include <stdio.h>
 #include <sys/resource.h>  // NOLINT
 #include <sys/syscall.h>   // NOLINT
@@ -14,6 +15,9 @@
 #if defined(DART_HOST_OS_ANDROID)
 #include <sys/prctl.h>
 #endif  // defined(DART_HOST_OS_ANDROID)
+#if defined(DART_HOST_OS_MACOS)
+#include <pthread/qos.h>  // NOLINT
+#endif  // defined(DART_HOST_OS_MACOS)
 
 #include "platform/address_sanitizer.h"
 #include "platform/assert.h"
@@ -264,6 +268,35 @@ bool OSThread::GetCurrentStackBounds(uword* lower, uword* upper) {
 #endif
 }
 
+bool OSThread::SetCurrentThreadPriority(Priority priority) {
+#if defined(DART_HOST_OS_ANDROID) || defined(DART_HOST_OS_LINUX)
+  // See os_thread_linux.cc.
+  const pthread_t thread = pthread_self();
+  int policy;
+  struct sched_param param;
+  if (pthread_getschedparam(thread, &policy, &param) != 0) {
+    return false;
+  }
+  if (policy != SCHED_OTHER && policy != SCHED_BATCH) {
+    return false;
+  }
+  const int new_policy =
+      priority == kBackgroundPriority ? SCHED_BATCH : SCHED_OTHER;
+  if (policy == new_policy) {
+    return true;
+  }
+  param.sched_priority = 0;
+  return pthread_setschedparam(thread, new_policy, &param) == 0;
+#elif defined(DART_HOST_OS_MACOS)
+  // See os_thread_macos.cc.
+  const qos_class_t qos_class =
+      priority == kBackgroundPriority ? QOS_CLASS_UTILITY : QOS_CLASS_DEFAULT;
+  return pthread_set_qos_class_self_np(qos_class, 0) == 0;
+#else
+  return false;
+#endif
+}
+
 #if defined(USING_SAFE_STACK)
 NO_SANITIZE_ADDRESS
 NO_SANITIZE_SAFE_STACK
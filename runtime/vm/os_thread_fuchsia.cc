@@ -185,6 +185,12 @@ bool OSThread::GetCurrentStackBounds(uword* lower, uword* upper) {
   return true;
 }
 
+bool OSThread::SetCurrentThreadPriority(Priority priority) {
+  // Thread priorities on Fuchsia are set through scheduler profiles, which
+  // the VM does not have access to.
+  return false;
+}
+
 #if defined(USING_SAFE_STACK)
 #define STRINGIFY(s) #s
 NO_SANITIZE_ADDRESS
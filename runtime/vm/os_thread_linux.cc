@@ -9,6 +9,7 @@
 #include "vm/os_thread.h"
 
 #include <errno.h>  // NOLINT
+#include <sched.h>  // NOLINT
 #include <stdio.h>
 #include <sys/resource.h>  // NOLINT
 #include <sys/syscall.h>   // NOLINT
@@ -215,6 +216,30 @@ bool OSThread::GetCurrentStackBounds(uword* lower, uword* upper) {
   return true;
 }
 
+bool OSThread::SetCurrentThreadPriority(Priority priority) {
+  // SCHED_BATCH keeps the nice value but tells the scheduler that the thread
+  // is CPU bound, so it does not preempt other threads when it wakes up.
+  // Unlike raising the nice value or SCHED_IDLE, an unprivileged thread can
+  // switch back to SCHED_OTHER afterwards. Real-time policies set by the
+  // embedder are left alone.
+  const pthread_t thread = pthread_self();
+  int policy;
+  struct sched_param param;
+  if (pthread_getschedparam(thread, &policy, &param) != 0) {
+    return false;
+  }
+  if (policy != SCHED_OTHER && policy != SCHED_BATCH) {
+    return false;
+  }
+  const int new_policy =
+      priority == kBackgroundPriority ? SCHED_BATCH : SCHED_OTHER;
+  if (policy == new_policy) {
+    return true;
+  }
+  param.sched_priority = 0;
+  return pthread_setschedparam(thread, new_policy, &param) == 0;
+}
+
 #if defined(USING_SAFE_STACK)
 NO_SANITIZE_ADDRESS
 NO_SANITIZE_SAFE_STACK
@@ -14,6 +14,7 @@
 #include <mach/task_info.h>    // NOLINT
 #include <mach/thread_act.h>   // NOLINT
 #include <mach/thread_info.h>  // NOLINT
+#include <pthread/qos.h>       // NOLINT
 #include <signal.h>            // NOLINT
 #include <sys/errno.h>         // NOLINT
 #include <sys/sysctl.h>        // NOLINT
@@ -198,6 +199,15 @@ bool OSThread::GetCurrentStackBounds(uword* lower, uword* upper) {
   return true;
 }
 
+bool OSThread::SetCurrentThreadPriority(Priority priority) {
+  // Background work runs at utility QoS: it still makes progress promptly but
+  // yields to threads at the default QoS and may be scheduled on efficiency
+  // cores.
+  const qos_class_t qos_class =
+      priority == kBackgroundPriority ? QOS_CLASS_UTILITY : QOS_CLASS_DEFAULT;
+  return pthread_set_qos_class_self_np(qos_class, 0) == 0;
+}
+
 #if defined(USING_SAFE_STACK)
 NO_SANITIZE_ADDRESS
 NO_SANITIZE_SAFE_STACK
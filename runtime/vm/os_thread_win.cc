@@ -201,6 +201,13 @@ bool OSThread::GetCurrentStackBounds(uword* lower, uword* upper) {
   return true;
 }
 
+bool OSThread::SetCurrentThreadPriority(Priority priority) {
+  const int thread_priority = priority == kBackgroundPriority
+                                  ? THREAD_PRIORITY_BELOW_NORMAL
+                                  : THREAD_PRIORITY_NORMAL;
+  return SetThreadPriority(GetCurrentThread(), thread_priority) != 0;
+}
+
 #if defined(USING_SAFE_STACK)
 NO_SANITIZE_ADDRESS
 NO_SANITIZE_SAFE_STACK
@@ -96,7 +96,17 @@ enum {
 #if !defined(DART_COMPRESSED_POINTERS)
 static constexpr uintptr_t kHeapBaseMask = 0;
 #else
-static constexpr uintptr_t kHeapBaseMask = ~(4LL * GB - 1);
+// A compressed pointer is the low 32 bits of the tagged address, unshifted,
+// so the heap of an isolate group is a single region of this size aligned to
+// its size, and the heap base is recovered by masking any address in it.
+//
+// Compressed Smis are the same 32 bits, so shifting heap pointers by the
+// object alignment to reach a larger region would make decompression depend
+// on the tag. Every LoadCompressed* sequence in the assemblers, the write
+// barrier stubs and the snapshot format assume the unshifted encoding.
+static constexpr intptr_t kCompressedHeapSizeLog2 = 32;
+static constexpr uintptr_t kHeapBaseMask =
+    ~((static_cast<uintptr_t>(1) << kCompressedHeapSizeLog2) - 1);
 #endif
 
 }  // namespace dart
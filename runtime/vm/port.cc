@@ -18,7 +18,7 @@
 namespace dart {
 
 Mutex* PortMap::mutex_ = nullptr;
-PortSet<PortMap::Entry>* PortMap::ports_ = nullptr;
+PortMap::Shard PortMap::shards_[PortMap::kNumShards] = {};
 Random* PortMap::prng_ = nullptr;
 
 Dart_Port PortMap::AllocatePort() {
@@ -45,17 +45,19 @@ Dart_Port PortMap::AllocatePort() {
     }
 
     ASSERT(!static_cast<ObjectPtr>(static_cast<uword>(result))->IsWellFormed());
-  } while (ports_->Contains(result));
+
+    // Shards are only modified while holding [mutex_], so they can be read
+    // here without taking the shard lock.
+  } while (ShardFor(result)->ports->Contains(result));
 
   ASSERT(result != 0);
-  ASSERT(!ports_->Contains(result));
   return result;
 }
 
 Dart_Port PortMap::CreatePort(PortHandler* handler) {
   ASSERT(handler != nullptr);
   PortMap::Locker ml;
-  if (ports_ == nullptr) {
+  if (shards_[0].ports == nullptr) {
     return ILLEGAL_PORT;
   }
 
@@ -67,7 +69,11 @@ Dart_Port PortMap::CreatePort(PortHandler* handler) {
   if (auto ports = handler->ports(ml)) {
     ports->Insert(PortHandler::PortSetEntry{port});
   }
-  ports_->Insert(Entry{port, handler});
+  {
+    Shard* shard = ShardFor(port);
+    MutexLocker sl(shard->mutex);
+    shard->ports->Insert(Entry{port, handler});
+  }
 
   if (FLAG_trace_isolates) {
     OS::PrintErr(
@@ -86,23 +92,27 @@ bool PortMap::ClosePort(Dart_Port port, PortHandler** port_handler) {
   PortHandler* handler = nullptr;
   {
     PortMap::Locker ml;
-    if (ports_ == nullptr) {
+    Shard* shard = ShardFor(port);
+    if (shard->ports == nullptr) {
       return false;
     }
-    auto it = ports_->TryLookup(port);
-    if (it == ports_->end()) {
-      return false;
-    }
-    Entry entry = *it;
-    handler = entry.handler;
-    ASSERT(handler != nullptr);
+    {
+      MutexLocker sl(shard->mutex);
+      auto it = shard->ports->TryLookup(port);
+      if (it == shard->ports->end()) {
+        return false;
+      }
+      Entry entry = *it;
+      handler = entry.handler;
+      ASSERT(handler != nullptr);
 
 #if defined(DEBUG)
-    handler->CheckAccess();
+      handler->CheckAccess();
 #endif
 
-    it.Delete();
-    ports_->Rebalance();
+      it.Delete();
+      shard->ports->Rebalance();
+    }
 
     if (auto ports = handler->ports(ml)) {
       auto isolate_it = ports->TryLookup(port);
@@ -119,7 +129,7 @@ bool PortMap::ClosePort(Dart_Port port, PortHandler** port_handler) {
 void PortMap::ClosePorts(MessageHandler* handler) {
   {
     PortMap::Locker ml;
-    if (ports_ == nullptr) {
+    if (shards_[0].ports == nullptr) {
       return;
     }
 
@@ -128,28 +138,33 @@ void PortMap::ClosePorts(MessageHandler* handler) {
 
     for (auto isolate_it = ports->begin(); isolate_it != ports->end();
          ++isolate_it) {
-      auto it = ports_->TryLookup((*isolate_it).port);
-      ASSERT(it != ports_->end());
+      Shard* shard = ShardFor((*isolate_it).port);
+      MutexLocker sl(shard->mutex);
+      auto it = shard->ports->TryLookup((*isolate_it).port);
+      ASSERT(it != shard->ports->end());
       Entry entry = *it;
       ASSERT(entry.port == (*isolate_it).port);
       ASSERT(entry.handler == handler);
       it.Delete();
+      shard->ports->Rebalance();
       isolate_it.Delete();
     }
     ASSERT(ports->IsEmpty());
-    ports_->Rebalance();
   }
   handler->OnAllPortsClosed();
 }
 
 bool PortMap::PostMessage(std::unique_ptr<Message> message,
                           bool before_events) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  // Holding the shard lock keeps the handler alive, as closing its ports
+  // needs the same lock.
+  Shard* shard = ShardFor(message->dest_port());
+  MutexLocker ml(shard->mutex);
+  if (shard->ports == nullptr) {
     return false;
   }
-  auto it = ports_->TryLookup(message->dest_port());
-  if (it == ports_->end()) {
+  auto it = shard->ports->TryLookup(message->dest_port());
+  if (it == shard->ports->end()) {
     // Ownership of external data remains with the poster.
     message->DropFinalizers();
     return false;
@@ -162,22 +177,24 @@ bool PortMap::PostMessage(std::unique_ptr<Message> message,
 
 #if defined(TESTING)
 bool PortMap::PortExists(Dart_Port id) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(id);
+  MutexLocker ml(shard->mutex);
+  if (shard->ports == nullptr) {
     return false;
   }
-  auto it = ports_->TryLookup(id);
-  return it != ports_->end();
+  auto it = shard->ports->TryLookup(id);
+  return it != shard->ports->end();
 }
 #endif  // defined(TESTING)
 
 Isolate* PortMap::GetIsolate(Dart_Port id) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(id);
+  MutexLocker ml(shard->mutex);
+  if (shard->ports == nullptr) {
     return nullptr;
   }
-  auto it = ports_->TryLookup(id);
-  if (it == ports_->end()) {
+  auto it = shard->ports->TryLookup(id);
+  if (it == shard->ports->end()) {
     // Port does not exist.
     return nullptr;
   }
@@ -187,12 +204,13 @@ Isolate* PortMap::GetIsolate(Dart_Port id) {
 }
 
 Dart_Port PortMap::GetOriginId(Dart_Port id) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(id);
+  MutexLocker ml(shard->mutex);
+  if (shard->ports == nullptr) {
     return ILLEGAL_PORT;
   }
-  auto it = ports_->TryLookup(id);
-  if (it == ports_->end()) {
+  auto it = shard->ports->TryLookup(id);
+  if (it == shard->ports->end()) {
     // Port does not exist.
     return ILLEGAL_PORT;
   }
@@ -209,7 +227,7 @@ Dart_Port PortMap::GetOriginId(Dart_Port id) {
 #if defined(TESTING)
 bool PortMap::HasPorts(MessageHandler* handler) {
   MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  if (shards_[0].ports == nullptr) {
     return false;
   }
   // The MessageHandler::ports_ is only accessed by [PortMap], it is guarded
@@ -220,13 +238,14 @@ bool PortMap::HasPorts(MessageHandler* handler) {
 
 bool PortMap::IsReceiverInThisIsolateGroupOrClosed(Dart_Port receiver,
                                                    IsolateGroup* group) {
-  MutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  Shard* shard = ShardFor(receiver);
+  MutexLocker ml(shard->mutex);
+  if (shard->ports == nullptr) {
     // Port was closed.
     return true;
   }
-  auto it = ports_->TryLookup(receiver);
-  if (it == ports_->end()) {
+  auto it = shard->ports->TryLookup(receiver);
+  if (it == shard->ports->end()) {
     // Port was closed.
     return true;
   }
@@ -246,35 +265,52 @@ void PortMap::Init() {
   if (prng_ == nullptr) {
     prng_ = new Random();
   }
-  if (ports_ == nullptr) {
-    ports_ = new PortSet<Entry>();
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    Shard* shard = &shards_[i];
+    // Like [mutex_], the shard locks are never freed, so that lookups racing
+    // with [Cleanup] can still take them.
+    if (shard->mutex == nullptr) {
+      shard->mutex = new Mutex();
+    }
+    if (shard->ports == nullptr) {
+      shard->ports = new PortSet<Entry>();
+    }
   }
 }
 
 void PortMap::Shutdown() {
   // Tell all handlers which are running their own thread pools to shutdown.
-  for (auto& entry : *ports_) {
-    entry.handler->Shutdown();
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    for (auto& entry : *shards_[i].ports) {
+      entry.handler->Shutdown();
+    }
   }
 }
 
 void PortMap::Cleanup() {
-  ASSERT(ports_ != nullptr);
   ASSERT(prng_ != nullptr);
-  for (auto it = ports_->begin(); it != ports_->end(); ++it) {
-    const auto& entry = *it;
-    ASSERT(entry.handler != nullptr);
-    delete entry.handler;
-    it.Delete();
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    PortSet<Entry>* ports = shards_[i].ports;
+    ASSERT(ports != nullptr);
+    for (auto it = ports->begin(); it != ports->end(); ++it) {
+      const auto& entry = *it;
+      ASSERT(entry.handler != nullptr);
+      delete entry.handler;
+      it.Delete();
+    }
+    ports->Rebalance();
   }
-  ports_->Rebalance();
 
-  // Grab the mutex and delete the port set.
+  // Grab the mutexes and delete the port sets.
   MutexLocker ml(mutex_);
   delete prng_;
   prng_ = nullptr;
-  delete ports_;
-  ports_ = nullptr;
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    Shard* shard = &shards_[i];
+    MutexLocker sl(shard->mutex);
+    delete shard->ports;
+    shard->ports = nullptr;
+  }
 }
 
 void PortMap::PrintPortsForMessageHandler(MessageHandler* handler,
@@ -285,17 +321,20 @@ void PortMap::PrintPortsForMessageHandler(MessageHandler* handler,
   Object& msg_handler = Object::Handle();
   {
     JSONArray ports(&jsobj, "ports");
+    // Holding [mutex_] prevents the shards from being modified.
     SafepointMutexLocker ml(mutex_);
-    if (ports_ == nullptr) {
+    if (shards_[0].ports == nullptr) {
       return;
     }
-    for (auto& entry : *ports_) {
-      if (entry.handler == handler) {
-        JSONObject port(&ports);
-        port.AddProperty("type", "_Port");
-        port.AddPropertyF("name", "Isolate Port (%" Pd64 ")", entry.port);
-        msg_handler = DartLibraryCalls::LookupHandler(entry.port);
-        port.AddProperty("handler", msg_handler);
+    for (intptr_t i = 0; i < kNumShards; i++) {
+      for (auto& entry : *shards_[i].ports) {
+        if (entry.handler == handler) {
+          JSONObject port(&ports);
+          port.AddProperty("type", "_Port");
+          port.AddPropertyF("name", "Isolate Port (%" Pd64 ")", entry.port);
+          msg_handler = DartLibraryCalls::LookupHandler(entry.port);
+          port.AddProperty("handler", msg_handler);
+        }
       }
     }
   }
@@ -304,15 +343,17 @@ void PortMap::PrintPortsForMessageHandler(MessageHandler* handler,
 
 void PortMap::DebugDumpForMessageHandler(MessageHandler* handler) {
   SafepointMutexLocker ml(mutex_);
-  if (ports_ == nullptr) {
+  if (shards_[0].ports == nullptr) {
     return;
   }
   Object& msg_handler = Object::Handle();
-  for (auto& entry : *ports_) {
-    if (entry.handler == handler) {
-      OS::PrintErr("Port = %" Pd64 "\n", entry.port);
-      msg_handler = DartLibraryCalls::LookupHandler(entry.port);
-      OS::PrintErr("Handler = %s\n", msg_handler.ToCString());
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    for (auto& entry : *shards_[i].ports) {
+      if (entry.handler == handler) {
+        OS::PrintErr("Port = %" Pd64 "\n", entry.port);
+        msg_handler = DartLibraryCalls::LookupHandler(entry.port);
+        OS::PrintErr("Handler = %s\n", msg_handler.ToCString());
+      }
     }
   }
 }
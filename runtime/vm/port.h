@@ -81,13 +81,32 @@ class PortMap : public AllStatic {
     PortHandler* handler;
   };
 
+  // The map is split into shards selected by random bits of the port id (which
+  // has 53 bits, see [AllocatePort]), so that posting to or looking up an
+  // existing port only locks its shard. Creating and closing ports also holds
+  // [mutex_], which is always acquired before any shard lock.
+  static constexpr intptr_t kNumShards = 16;
+  static constexpr intptr_t kShardShift = 45;
+
+  struct Shard {
+    // Lock protecting access to [ports].
+    Mutex* mutex;
+    PortSet<Entry>* ports;
+  };
+
+  static Shard* ShardFor(Dart_Port port) {
+    return &shards_[(static_cast<uint64_t>(port) >> kShardShift) &
+                    (kNumShards - 1)];
+  }
+
   // Allocate a new unique port.
   static Dart_Port AllocatePort();
 
-  // Lock protecting access to the port map.
+  // Lock serializing the creation and closing of ports. It also guards the
+  // per-handler port sets and the [prng_].
   static Mutex* mutex_;
 
-  static PortSet<Entry>* ports_;
+  static Shard shards_[kNumShards];
 
   static Random* prng_;
 };
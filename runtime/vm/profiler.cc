@@ -49,10 +49,21 @@ DEFINE_FLAG(bool, profile_vm, true, "Always collect native stack traces.");
 #else
 DEFINE_FLAG(bool, profile_vm, false, "Always collect native stack traces.");
 #endif
+DEFINE_FLAG(bool,
+            profile_native_frames,
+            false,
+            "When sampling a thread that has exited Dart code, e.g. into an "
+            "FFI call, also collect the native frames above the exit frame. "
+            "Native frames are walked using frame pointers.");
 DEFINE_FLAG(bool,
             profile_vm_allocation,
             false,
             "Collect native stack traces when tracing Dart allocations.");
+DEFINE_FLAG(bool,
+            profile_heap_samples,
+            false,
+            "Record the stack of every allocation sampled by the heap sampling "
+            "profiler as an allocation sample (see getAllocationTraces).");
 
 DEFINE_FLAG(
     int,
@@ -128,6 +139,7 @@ class ProfilerStackWalker : public ValueObject {
                       SampleBuffer* sample_buffer,
                       intptr_t skip_count = 0)
       : port_id_(port_id),
+        head_sample_(head_sample),
         sample_(head_sample),
         sample_buffer_(sample_buffer),
         skip_count_(skip_count),
@@ -176,8 +188,20 @@ class ProfilerStackWalker : public ValueObject {
     return true;
   }
 
+  // Continues appending frames where [other] stopped.
+  void ContinueAfter(const ProfilerStackWalker& other) {
+    ASSERT(sample_buffer_ == other.sample_buffer_);
+    ASSERT(head_sample_ == other.head_sample_);
+    sample_ = other.sample_;
+    frames_skipped_ = other.frames_skipped_;
+    frame_index_ = other.frame_index_;
+    total_frames_ = other.total_frames_;
+  }
+
  protected:
   Dart_Port port_id_;
+  // The sample holding the state bits, [sample_] may be a continuation.
+  Sample* head_sample_;
   Sample* sample_;
   SampleBuffer* sample_buffer_;
   intptr_t skip_count_;
@@ -234,7 +258,11 @@ class ProfilerNativeStackWalker : public ProfilerStackWalker {
         original_sp_(sp),
         lower_bound_(stack_lower) {}
 
-  void walk() {
+  void walk() { WalkUntil(0); }
+
+  // Walks native frames up to, but not including, the frame at [stop_fp] and
+  // its callers. A [stop_fp] of 0 walks the whole stack.
+  void WalkUntil(uword stop_fp) {
     Append(original_pc_, original_fp_);
 
     uword* pc = reinterpret_cast<uword*>(original_pc_);
@@ -255,6 +283,10 @@ class ProfilerNativeStackWalker : public ProfilerStackWalker {
         return;
       }
 
+      if (stop_fp != 0 && reinterpret_cast<uword>(fp) >= stop_fp) {
+        return;
+      }
+
       if (fp <= previous_fp) {
         // Frame pointer did not move to a higher address.
         counters_->incomplete_sample_fp_step.fetch_add(1);
@@ -1024,10 +1056,12 @@ class ProfilerDartStackWalker : public ProfilerStackWalker {
         sp_(reinterpret_cast<uword*>(sp)),
         lr_(reinterpret_cast<uword*>(lr)) {}
 
+  uword exit_fp() const { return thread_->top_exit_frame_info(); }
+
   void walk() {
     RELEASE_ASSERT(StubCode::HasBeenInitialized());
     if (thread_->isolate()->IsDeoptimizing()) {
-      sample_->set_ignore_sample(true);
+      head_sample_->set_ignore_sample(true);
       return;
     }
 
@@ -1065,12 +1099,14 @@ class ProfilerDartStackWalker : public ProfilerStackWalker {
         // to identify the entry frame and lead the stack walk into the weeds.
         // Do not continue the stalk walk since this might be a false positive
         // from a Smi or unboxed value.
-        sample_->set_ignore_sample(true);
+        head_sample_->set_ignore_sample(true);
         return;
       }
     }
 
-    sample_->set_exit_frame_sample(has_exit_frame);
+    // Native frames collected above the exit frame start with the frame that
+    // is actually executing.
+    head_sample_->set_exit_frame_sample(has_exit_frame && total_frames_ == 0);
 
     for (;;) {
       // Skip entry frame.
@@ -1203,6 +1239,15 @@ static void CollectSample(Isolate* isolate,
       native_stack_walker->walk();
     } else if (StubCode::HasBeenInitialized() && exited_dart_code) {
       counters->stack_walker_dart_exit.fetch_add(1);
+#if !defined(USING_SIMULATOR)
+      if (FLAG_profile_native_frames) {
+        // Collect the native frames between the interrupted pc and the exit
+        // frame. If they lack frame pointers the Dart frames below are still
+        // collected.
+        native_stack_walker->WalkUntil(dart_stack_walker->exit_fp());
+        dart_stack_walker->ContinueAfter(*native_stack_walker);
+      }
+#endif
       // We have a valid exit frame info, use the Dart stack walker.
       dart_stack_walker->walk();
     } else if (StubCode::HasBeenInitialized() && in_dart_code) {
@@ -19,6 +19,8 @@ namespace dart {
 
 DECLARE_FLAG(bool, profile_vm);
 DECLARE_FLAG(bool, profile_vm_allocation);
+DECLARE_FLAG(bool, profile_heap_samples);
+DECLARE_FLAG(bool, profile_native_frames);
 DECLARE_FLAG(int, max_profile_depth);
 DECLARE_FLAG(int, optimization_counter_threshold);
 
@@ -207,11 +209,12 @@ TEST_CASE(Profiler_AllocationSampleTest) {
   delete sample_buffer;
 }
 
-static LibraryPtr LoadTestScript(const char* script) {
+static LibraryPtr LoadTestScript(const char* script,
+                                 Dart_NativeEntryResolver resolver = nullptr) {
   Dart_Handle api_lib;
   {
     TransitionVMToNative transition(Thread::Current());
-    api_lib = TestCase::LoadTestScript(script, nullptr);
+    api_lib = TestCase::LoadTestScript(script, resolver);
     EXPECT_VALID(api_lib);
   }
   Library& lib = Library::Handle();
@@ -621,6 +624,62 @@ ISOLATE_UNIT_TEST_CASE(Profiler_ToggleRecordAllocation) {
   }
 }
 
+ISOLATE_UNIT_TEST_CASE(Profiler_HeapSampledAllocation) {
+  EnableProfiler();
+  DisableNativeProfileScope dnps;
+  DisableBackgroundCompilationScope dbcs;
+  SetFlagScope<bool> sfs(&FLAG_profile_heap_samples, true);
+  const char* kScript =
+      "class A {\n"
+      "  var a;\n"
+      "  var b;\n"
+      "}\n"
+      "final list = [];\n"
+      "main() {\n"
+      "  for (int i = 0; i < 1000; i++) {\n"
+      "    list.add(new A());\n"
+      "  }\n"
+      "}\n";
+
+  const Library& root_library = Library::Handle(LoadTestScript(kScript));
+  const Class& class_a = Class::Handle(GetClass(root_library, "A"));
+  EXPECT(!class_a.IsNull());
+
+  static int sample_data = 0;
+  HeapProfileSampler::SetSamplingCallback(
+      [](Dart_Isolate isolate, Dart_IsolateGroup isolate_group,
+         const char* cls_name, intptr_t allocation_size) -> void* {
+        return &sample_data;
+      },
+      [](void* data) {});
+  HeapProfileSampler::Enable(true);
+  HeapProfileSampler::SetSamplingInterval(1);
+  thread->HandleInterrupts();
+
+  Invoke(root_library, "main");
+
+  HeapProfileSampler::Enable(false);
+  thread->HandleInterrupts();
+
+  {
+    StackZone zone(thread);
+    Isolate* isolate = thread->isolate();
+    Profile profile;
+    AllocationFilter filter(isolate->main_port(), class_a.id());
+    profile.Build(thread, isolate, &filter, Profiler::sample_block_buffer());
+    // A is not traced, its allocation samples come from the heap sampler.
+    EXPECT(profile.sample_count() > 0);
+    ProfileStackWalker walker(&profile, true);
+    bool found_main = false;
+    do {
+      if (strcmp(walker.CurrentName(), "main") == 0) {
+        found_main = true;
+      }
+    } while (walker.Down());
+    EXPECT(found_main);
+  }
+}
+
 ISOLATE_UNIT_TEST_CASE(Profiler_CodeTicks) {
   EnableProfiler();
   DisableNativeProfileScope dnps;
@@ -2430,6 +2489,79 @@ ISOLATE_UNIT_TEST_CASE(Profiler_ProfileCodeTableTest) {
   EXPECT_EQ(table->FindCodeForPC(50), code1);
 }
 
+#if !defined(USING_SIMULATOR)
+static uword native_leaf_pc = 0;
+
+// Takes a sample as if the thread had been interrupted here.
+DART_NOINLINE static void NativeLeaf(Dart_NativeArguments args) {
+  InterruptedThreadState state = {};
+  state.pc = OS::GetProgramCounter();
+  state.csp = OSThread::GetCurrentStackPointer();
+  COPY_FP_REGISTER(state.fp);
+  native_leaf_pc = state.pc;
+  Profiler::SampleThread(Thread::Current(), state);
+}
+
+static Dart_NativeFunction NativeLeafResolver(Dart_Handle name,
+                                              int arg_count,
+                                              bool* auto_setup_scope) {
+  ASSERT(auto_setup_scope != nullptr);
+  *auto_setup_scope = false;
+  return NativeLeaf;
+}
+
+// Accepts only the sample taken in NativeLeaf.
+class NativeLeafFilter : public SampleFilter {
+ public:
+  explicit NativeLeafFilter(Dart_Port port)
+      : SampleFilter(port, Thread::kMutatorTask, -1, -1) {}
+
+  bool FilterSample(Sample* sample) {
+    return !sample->is_allocation_sample() &&
+           sample->At(0) == native_leaf_pc;
+  }
+};
+
+ISOLATE_UNIT_TEST_CASE(Profiler_NativeLeafFrames) {
+  EnableProfiler();
+  DisableNativeProfileScope dnps;
+  SetFlagScope<bool> sfs(&FLAG_profile_native_frames, true);
+  const char* kScript =
+      "@pragma('vm:external-name', 'NativeLeaf')\n"
+      "external void nativeLeaf();\n"
+      "main() {\n"
+      "  nativeLeaf();\n"
+      "}\n";
+
+  const Library& root_library =
+      Library::Handle(LoadTestScript(kScript, NativeLeafResolver));
+  Invoke(root_library, "main");
+
+  {
+    Thread* thread = Thread::Current();
+    Isolate* isolate = thread->isolate();
+    StackZone zone(thread);
+    Profile profile;
+    NativeLeafFilter filter(isolate->main_port());
+    profile.Build(thread, isolate, &filter, Profiler::sample_block_buffer());
+    EXPECT_EQ(1, profile.sample_count());
+    // The native leaf is the executing frame, so it gets the exclusive tick.
+    EXPECT(profile.SampleAt(0)->first_frame_executing());
+    ProfileStackWalker walker(&profile);
+    EXPECT_EQ(1, walker.CurrentExclusiveTicks());
+    // The Dart frames below the native frames are collected too.
+    bool found_main = false;
+    while (walker.Down()) {
+      if (strcmp("[Unoptimized] main", walker.CurrentName()) == 0) {
+        found_main = true;
+        EXPECT_EQ(0, walker.CurrentExclusiveTicks());
+      }
+    }
+    EXPECT(found_main);
+  }
+}
+#endif  // !defined(USING_SIMULATOR)
+
 // Try to hit any races in related to setting TLS and Isolate::mutator_thread_.
 // https://github.com/flutter/flutter/issues/134548
 ISOLATE_UNIT_TEST_CASE(Profiler_EnterExitIsolate) {
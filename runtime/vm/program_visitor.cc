@@ -8,9 +8,11 @@
 
 #include "vm/canonical_tables.h"
 #include "vm/closure_functions_cache.h"
+#include "vm/code_descriptors.h"
 #include "vm/code_patcher.h"
 #include "vm/deopt_instructions.h"
 #include "vm/hash_map.h"
+#include "vm/json_writer.h"
 #include "vm/object.h"
 #include "vm/object_store.h"
 #include "vm/symbols.h"
@@ -1436,6 +1438,7 @@ class AssignLoadingUnitsCodeVisitor : public ObjectVisitor {
         cls_(Class::Handle(zone)),
         lib_(Library::Handle(zone)),
         unit_(LoadingUnit::Handle(zone)),
+        pool_(ObjectPool::Handle(zone)),
         obj_(Object::Handle(zone)) {}
 
   void VisitObject(ObjectPtr obj) override {
@@ -1476,6 +1479,20 @@ class AssignLoadingUnitsCodeVisitor : public ObjectVisitor {
     MergeAssignment(obj_, id);
     obj_ = code.compressed_stackmaps();
     MergeAssignment(obj_, id);
+
+    // Strings and canonical type arguments used by code of several loading
+    // units are written into the root unit instead of into each of them,
+    // see Serializer::IsSharedLiteral.
+    pool_ = code.object_pool();
+    if (pool_.IsNull()) return;
+    for (intptr_t i = 0; i < pool_.Length(); i++) {
+      if (pool_.TypeAt(i) != ObjectPool::EntryType::kTaggedObject) continue;
+      obj_ = pool_.ObjectAt(i);
+      if (obj_.IsString() ||
+          (obj_.IsTypeArguments() && obj_.IsCanonical())) {
+        MergeAssignment(obj_, id);
+      }
+    }
   }
 
   void MergeAssignment(const Object& obj, intptr_t id) {
@@ -1500,6 +1517,7 @@ class AssignLoadingUnitsCodeVisitor : public ObjectVisitor {
   Class& cls_;
   Library& lib_;
   LoadingUnit& unit_;
+  ObjectPool& pool_;
   Object& obj_;
 };
 
@@ -1582,6 +1600,236 @@ uint32_t ProgramVisitor::Hash(Thread* thread) {
   return visitor.hash();
 }
 
+class CodeDuplicationVisitor : public CodeVisitor {
+ public:
+  struct InlinedEntry {
+    const char* name;
+    intptr_t inlinings;
+    intptr_t callers;
+    intptr_t size;
+    intptr_t last_caller;
+  };
+
+  explicit CodeDuplicationVisitor(Zone* zone)
+      : zone_(zone),
+        codes_(zone, 0),
+        inlined_(zone, 0),
+        inlined_index_(zone),
+        code_source_map_(CodeSourceMap::Handle(zone)),
+        functions_(Array::Handle(zone)),
+        root_(Function::Handle(zone)),
+        function_(Function::Handle(zone)) {}
+
+  void VisitCode(const Code& code) override {
+    codes_.Add(&Code::ZoneHandle(zone_, code.ptr()));
+    if (!code.IsFunctionCode()) return;
+    code_source_map_ = code.code_source_map();
+    functions_ = code.inlined_id_to_function();
+    if (code_source_map_.IsNull() || functions_.IsNull()) return;
+    const intptr_t num_ids = functions_.Length();
+    if (num_ids <= 1) return;
+
+    GrowableArray<intptr_t> sizes(num_ids);
+    GrowableArray<intptr_t> counts(num_ids);
+    for (intptr_t i = 0; i < num_ids; i++) {
+      sizes.Add(0);
+      counts.Add(0);
+    }
+    root_ = code.function();
+    CodeSourceMapReader reader(code_source_map_, functions_, root_);
+    reader.GetInlinedSizes(&sizes, &counts);
+
+    for (intptr_t i = 1; i < num_ids; i++) {
+      if (counts[i] == 0) continue;
+      function_ ^= functions_.At(i);
+      const char* name = function_.ToFullyQualifiedCString();
+      intptr_t index = inlined_index_.LookupValue(name);
+      if (index == CStringIntMapKeyValueTrait::kNoValue) {
+        index = inlined_.length();
+        inlined_.Add({name, 0, 0, 0, -1});
+        inlined_index_.Insert({name, index});
+      }
+      InlinedEntry& entry = inlined_[index];
+      entry.inlinings += counts[i];
+      entry.size += sizes[i];
+      if (entry.last_caller != codes_.length()) {
+        entry.last_caller = codes_.length();
+        entry.callers++;
+      }
+    }
+  }
+
+  const GrowableArray<const Code*>& codes() const { return codes_; }
+  GrowableArray<InlinedEntry>& inlined() { return inlined_; }
+
+ private:
+  Zone* const zone_;
+  GrowableArray<const Code*> codes_;
+  GrowableArray<InlinedEntry> inlined_;
+  CStringIntMap inlined_index_;
+  CodeSourceMap& code_source_map_;
+  Array& functions_;
+  Function& root_;
+  Function& function_;
+};
+
+static int CompareInlinedEntries(
+    const CodeDuplicationVisitor::InlinedEntry* a,
+    const CodeDuplicationVisitor::InlinedEntry* b) {
+  if (a->size != b->size) return a->size > b->size ? -1 : 1;
+  return strcmp(a->name, b->name);
+}
+
+static int CompareCodeInstructions(const Code* const* a, const Code* const* b) {
+  const InstructionsPtr a_instr = (*a)->instructions();
+  const InstructionsPtr b_instr = (*b)->instructions();
+  const uint32_t a_hash = Instructions::Hash(a_instr);
+  const uint32_t b_hash = Instructions::Hash(b_instr);
+  if (a_hash != b_hash) return a_hash < b_hash ? -1 : 1;
+  const uword a_addr = static_cast<uword>(a_instr);
+  const uword b_addr = static_cast<uword>(b_instr);
+  if (a_addr != b_addr) return a_addr < b_addr ? -1 : 1;
+  return 0;
+}
+
+struct IdenticalCodeGroup {
+  ZoneGrowableArray<const Code*>* codes;
+  intptr_t size;
+  uint32_t hash;
+  // The smallest name of the codes, to order groups deterministically.
+  const char* name;
+};
+
+static const char* CodeName(const Code* code) {
+  return code->QualifiedName(
+      NameFormattingParams::DisambiguatedWithoutClassName(
+          Object::kInternalName));
+}
+
+static int CompareCodeNames(const Code* const* a, const Code* const* b) {
+  return strcmp(CodeName(*a), CodeName(*b));
+}
+
+static int CompareIdenticalCodeGroups(const IdenticalCodeGroup* a,
+                                      const IdenticalCodeGroup* b) {
+  const intptr_t a_duplicated = a->size * (a->codes->length() - 1);
+  const intptr_t b_duplicated = b->size * (b->codes->length() - 1);
+  if (a_duplicated != b_duplicated) {
+    return a_duplicated > b_duplicated ? -1 : 1;
+  }
+  if (a->hash != b->hash) return a->hash < b->hash ? -1 : 1;
+  return strcmp(a->name, b->name);
+}
+
+void ProgramVisitor::PrintCodeDuplication(Thread* thread,
+                                          const char* filename) {
+  auto file_open = Dart::file_open_callback();
+  auto file_write = Dart::file_write_callback();
+  auto file_close = Dart::file_close_callback();
+  if ((file_open == nullptr) || (file_write == nullptr) ||
+      (file_close == nullptr)) {
+    OS::PrintErr("warning: Could not access file callbacks.");
+    return;
+  }
+
+  StackZone stack_zone(thread);
+  Zone* zone = thread->zone();
+  CodeDuplicationVisitor visitor(zone);
+  WalkProgram(zone, thread->isolate_group(), &visitor);
+
+  // Group the code objects with identical instructions. Sorting by hash
+  // brings candidates together, Instructions::Equals splits hash collisions.
+  GrowableArray<const Code*> codes(zone, visitor.codes().length());
+  for (const Code* code : visitor.codes()) {
+    codes.Add(code);
+  }
+  codes.Sort(CompareCodeInstructions);
+  GrowableArray<IdenticalCodeGroup> groups(zone, 0);
+  intptr_t i = 0;
+  while (i < codes.length()) {
+    const uint32_t hash = Instructions::Hash(codes[i]->instructions());
+    intptr_t end = i + 1;
+    while (end < codes.length() &&
+           Instructions::Hash(codes[end]->instructions()) == hash) {
+      end++;
+    }
+    const intptr_t first_group = groups.length();
+    for (intptr_t j = i; j < end; j++) {
+      bool added = false;
+      for (intptr_t k = first_group; k < groups.length(); k++) {
+        if (Instructions::Equals(groups[k].codes->At(0)->instructions(),
+                                 codes[j]->instructions())) {
+          groups[k].codes->Add(codes[j]);
+          added = true;
+          break;
+        }
+      }
+      if (!added) {
+        auto group_codes = new (zone) ZoneGrowableArray<const Code*>(zone, 1);
+        group_codes->Add(codes[j]);
+        groups.Add({group_codes, Instructions::Size(codes[j]->instructions()),
+                    hash, nullptr});
+      }
+    }
+    i = end;
+  }
+  for (auto& group : groups) {
+    group.codes->Sort(CompareCodeNames);
+    group.name = CodeName(group.codes->At(0));
+  }
+  groups.Sort(CompareIdenticalCodeGroups);
+
+  auto& inlined = visitor.inlined();
+  inlined.Sort(CompareInlinedEntries);
+
+  JSONWriter js;
+  js.OpenObject();
+  js.OpenArray("inlined");
+  for (const auto& entry : inlined) {
+    // Functions inlined once are not duplicated.
+    if (entry.inlinings < 2) continue;
+    js.OpenObject();
+    js.PrintProperty("n", entry.name);
+    js.PrintProperty("inlinings", entry.inlinings);
+    js.PrintProperty("callers", entry.callers);
+    js.PrintProperty("s", entry.size);
+    js.CloseObject();
+  }
+  js.CloseArray();
+  js.OpenArray("identical");
+  for (const auto& group : groups) {
+    if (group.codes->length() < 2) continue;
+    bool shared = true;
+    for (const Code* code : *group.codes) {
+      shared = shared && code->instructions() ==
+                             group.codes->At(0)->instructions();
+    }
+    js.OpenObject();
+    js.PrintProperty("s", group.size);
+    js.PrintPropertyBool("shared", shared);
+    js.OpenArray("codes");
+    for (const Code* code : *group.codes) {
+      js.PrintValue(CodeName(code));
+    }
+    js.CloseArray();
+    js.CloseObject();
+  }
+  js.CloseArray();
+  js.CloseObject();
+
+  void* file = file_open(filename, /*write=*/true);
+  if (file == nullptr) {
+    OS::PrintErr("warning: Failed to write code duplication: %s\n", filename);
+    return;
+  }
+  char* output = nullptr;
+  intptr_t output_length = 0;
+  js.Steal(&output, &output_length);
+  file_write(output, output_length, file);
+  free(output);
+  file_close(file);
+}
+
 #endif  // defined(DART_PRECOMPILER)
 
 }  // namespace dart
@@ -103,6 +103,11 @@ class ProgramVisitor : public AllStatic {
 #if defined(DART_PRECOMPILER)
   static void AssignUnits(Thread* thread);
   static uint32_t Hash(Thread* thread);
+
+  // Writes a JSON report to 'filename' of the functions inlined more than
+  // once, with the instruction bytes of all their inlined copies, and of the
+  // groups of code objects with identical instructions.
+  static void PrintCodeDuplication(Thread* thread, const char* filename);
 #endif
 
  private:
@@ -2979,17 +2979,11 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   }
 
   if (found_single_character) {
-    BlockLabel cont, again;
-    masm->BindBlock(&again);
-    masm->LoadCurrentCharacter(max_lookahead, &cont, true);
-    if (max_char_ > kSize) {
-      masm->CheckCharacterAfterAnd(single_character,
-                                   RegExpMacroAssembler::kTableMask, &cont);
-    } else {
-      masm->CheckCharacter(single_character, &cont);
-    }
-    masm->AdvanceCurrentPosition(lookahead_width);
-    masm->GoTo(&again);
+    BlockLabel cont;
+    masm->SkipUntilCharacterAfterAnd(
+        max_lookahead, lookahead_width, single_character,
+        max_char_ > kSize ? RegExpMacroAssembler::kTableMask : kMaxUint32,
+        &cont);
     masm->BindBlock(&cont);
     return;
   }
@@ -3001,14 +2995,9 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
       GetSkipTable(min_lookahead, max_lookahead, boolean_skip_table);
   ASSERT(skip_distance != 0);
 
-  BlockLabel cont, again;
-
-  masm->BindBlock(&again);
-  masm->CheckPreemption(/*is_backtrack=*/false);
-  masm->LoadCurrentCharacter(max_lookahead, &cont, true);
-  masm->CheckBitInTable(boolean_skip_table, &cont);
-  masm->AdvanceCurrentPosition(skip_distance);
-  masm->GoTo(&again);
+  BlockLabel cont;
+  masm->SkipUntilBitInTable(max_lookahead, skip_distance, boolean_skip_table,
+                            &cont);
   masm->BindBlock(&cont);
 
   return;
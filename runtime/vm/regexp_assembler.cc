@@ -112,6 +112,36 @@ RegExpMacroAssembler::RegExpMacroAssembler(Zone* zone)
 
 RegExpMacroAssembler::~RegExpMacroAssembler() {}
 
+void RegExpMacroAssembler::SkipUntilCharacterAfterAnd(intptr_t cp_offset,
+                                                      intptr_t advance_by,
+                                                      unsigned c,
+                                                      unsigned mask,
+                                                      BlockLabel* on_found) {
+  BlockLabel again;
+  BindBlock(&again);
+  LoadCurrentCharacter(cp_offset, on_found, true);
+  if (mask == kMaxUint32) {
+    CheckCharacter(c, on_found);
+  } else {
+    CheckCharacterAfterAnd(c, mask, on_found);
+  }
+  AdvanceCurrentPosition(advance_by);
+  GoTo(&again);
+}
+
+void RegExpMacroAssembler::SkipUntilBitInTable(intptr_t cp_offset,
+                                               intptr_t advance_by,
+                                               const TypedData& table,
+                                               BlockLabel* on_found) {
+  BlockLabel again;
+  BindBlock(&again);
+  CheckPreemption(/*is_backtrack=*/false);
+  LoadCurrentCharacter(cp_offset, on_found, true);
+  CheckBitInTable(table, on_found);
+  AdvanceCurrentPosition(advance_by);
+  GoTo(&again);
+}
+
 void RegExpMacroAssembler::CheckNotInSurrogatePair(intptr_t cp_offset,
                                                    BlockLabel* on_failure) {
   BlockLabel ok;
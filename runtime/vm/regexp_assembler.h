@@ -173,6 +173,22 @@ class RegExpMacroAssembler : public ZoneAllocated {
   virtual void CheckBitInTable(const TypedData& table,
                                BlockLabel* on_bit_set) = 0;
 
+  // Advances the current position by 'advance_by' until the character at
+  // 'cp_offset' from it, and-ed with 'mask', is 'c', or until that character
+  // is outside the input, then jumps to 'on_found'. The character is loaded
+  // if one was found.
+  virtual void SkipUntilCharacterAfterAnd(intptr_t cp_offset,
+                                          intptr_t advance_by,
+                                          unsigned c,
+                                          unsigned mask,
+                                          BlockLabel* on_found);
+  // Like SkipUntilCharacterAfterAnd, but until the character (modulus the
+  // kTableSize) is set in the byte array.
+  virtual void SkipUntilBitInTable(intptr_t cp_offset,
+                                   intptr_t advance_by,
+                                   const TypedData& table,
+                                   BlockLabel* on_found);
+
   // Checks for preemption and serves as an OSR entry.
   virtual void CheckPreemption(bool is_backtrack) {}
 
@@ -11,11 +11,14 @@
 #include "vm/regexp_assembler_bytecode_inl.h"
 #include "vm/regexp_bytecodes.h"
 #include "vm/regexp_interpreter.h"
+#include "vm/regexp_linear.h"
 #include "vm/regexp_parser.h"
 #include "vm/timeline.h"
 
 namespace dart {
 
+DECLARE_FLAG(int, regexp_backtrack_limit);
+
 BytecodeRegExpMacroAssembler::BytecodeRegExpMacroAssembler(
     ZoneGrowableArray<uint8_t>* buffer,
     Zone* zone)
@@ -335,6 +338,41 @@ void BytecodeRegExpMacroAssembler::CheckBitInTable(const TypedData& table,
   }
 }
 
+void BytecodeRegExpMacroAssembler::SkipUntilCharacterAfterAnd(
+    intptr_t cp_offset,
+    intptr_t advance_by,
+    unsigned c,
+    unsigned mask,
+    BlockLabel* on_found) {
+  ASSERT(cp_offset >= kMinCPOffset);
+  ASSERT(cp_offset <= kMaxCPOffset);
+  ASSERT(advance_by > 0);
+  Emit(BC_SKIP_UNTIL_CHAR, cp_offset);
+  Emit32(advance_by);
+  Emit32(c);
+  Emit32(mask);
+  EmitOrLink(on_found);
+}
+
+void BytecodeRegExpMacroAssembler::SkipUntilBitInTable(intptr_t cp_offset,
+                                                       intptr_t advance_by,
+                                                       const TypedData& table,
+                                                       BlockLabel* on_found) {
+  ASSERT(cp_offset >= kMinCPOffset);
+  ASSERT(cp_offset <= kMaxCPOffset);
+  ASSERT(advance_by > 0);
+  Emit(BC_SKIP_UNTIL_BIT_IN_TABLE, cp_offset);
+  Emit32(advance_by);
+  EmitOrLink(on_found);
+  for (int i = 0; i < kTableSize; i += kBitsPerByte) {
+    int byte = 0;
+    for (int j = 0; j < kBitsPerByte; j++) {
+      if (table.GetUint8(i + j) != 0) byte |= 1 << j;
+    }
+    Emit8(byte);
+  }
+}
+
 void BytecodeRegExpMacroAssembler::CheckNotBackReference(
     intptr_t start_reg,
     bool read_backward,
@@ -491,8 +529,34 @@ static ObjectPtr ExecRaw(const RegExp& regexp,
   const TypedData& bytecode =
       TypedData::Handle(zone, regexp.bytecode(is_one_byte, sticky));
   ASSERT(!bytecode.IsNull());
-  const Object& result = Object::Handle(
-      zone, IrregexpInterpreter::Match(bytecode, subject, raw_output, index));
+  Object& result = Object::Handle(
+      zone, IrregexpInterpreter::Match(bytecode, subject, raw_output, index,
+                                       FLAG_regexp_backtrack_limit));
+
+  if (result.ptr() == Object::sentinel().ptr()) {
+    // Backtracking took too long, e.g. on nested quantifiers like (a+)+b.
+    Error& error = Error::Handle(zone);
+    switch (LinearRegExp::Match(regexp, subject, index, sticky, raw_output,
+                                &error, zone)) {
+      case LinearRegExp::kMatch:
+        result = Bool::True().ptr();
+        break;
+      case LinearRegExp::kNoMatch:
+        result = Bool::False().ptr();
+        break;
+      case LinearRegExp::kUnsupported:
+        for (int i = number_of_capture_registers - 1; i >= 0; i--) {
+          raw_output[i] = -1;
+        }
+        result = IrregexpInterpreter::Match(bytecode, subject, raw_output,
+                                            index);
+        break;
+      case LinearRegExp::kError:
+        // Propagated by the caller like errors from the interpreter.
+        result = error.ptr();
+        break;
+    }
+  }
 
   if (result.ptr() == Bool::True().ptr()) {
     // Copy capture results to the start of the registers array.
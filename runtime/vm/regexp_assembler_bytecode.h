@@ -78,6 +78,15 @@ class BytecodeRegExpMacroAssembler : public RegExpMacroAssembler {
                                         uint16_t to,
                                         BlockLabel* on_not_in_range);
   virtual void CheckBitInTable(const TypedData& table, BlockLabel* on_bit_set);
+  virtual void SkipUntilCharacterAfterAnd(intptr_t cp_offset,
+                                          intptr_t advance_by,
+                                          unsigned c,
+                                          unsigned mask,
+                                          BlockLabel* on_found);
+  virtual void SkipUntilBitInTable(intptr_t cp_offset,
+                                   intptr_t advance_by,
+                                   const TypedData& table,
+                                   BlockLabel* on_found);
   virtual void CheckNotBackReference(intptr_t start_reg,
                                      bool read_backward,
                                      BlockLabel* on_no_match);
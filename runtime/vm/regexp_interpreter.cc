@@ -24,6 +24,12 @@ DEFINE_FLAG(int,
             regexp_backtrack_stack_size_kb,
             256,
             "Size of backtracking stack");
+DEFINE_FLAG(int,
+            regexp_backtrack_limit,
+            0,
+            "Number of backtracks after which matching a RegExp is retried "
+            "with the linear time engine, if it supports the pattern. "
+            "0 means no limit.");
 
 typedef unibrow::Mapping<unibrow::Ecma262Canonicalize> Canonicalize;
 
@@ -176,6 +182,20 @@ class BacktrackStack {
   DISALLOW_COPY_AND_ASSIGN(BacktrackStack);
 };
 
+// Avoids dispatching on the class of the subject in String::CharAt.
+template <typename Char>
+static uint16_t SubjectCharAt(const String& subject, intptr_t index);
+
+template <>
+uint16_t SubjectCharAt<uint8_t>(const String& subject, intptr_t index) {
+  return OneByteString::CharAt(subject, index);
+}
+
+template <>
+uint16_t SubjectCharAt<uint16_t>(const String& subject, intptr_t index) {
+  return TwoByteString::CharAt(subject, index);
+}
+
 // Returns True if success, False if failure, Null if internal exception,
 // Error if VM error needs to be propagated up the callchain.
 template <typename Char>
@@ -183,7 +203,8 @@ static ObjectPtr RawMatch(const TypedData& bytecode,
                           const String& subject,
                           int32_t* registers,
                           int32_t current,
-                          uint32_t current_char) {
+                          uint32_t current_char,
+                          intptr_t backtrack_limit) {
   // BacktrackStack ensures that the memory allocated for the backtracking stack
   // is returned to the system or cached if there is no stack being cached at
   // the moment.
@@ -195,6 +216,7 @@ static ObjectPtr RawMatch(const TypedData& bytecode,
   int32_t* backtrack_stack_base = backtrack_stack.data();
   int32_t* backtrack_sp = backtrack_stack_base;
   intptr_t backtrack_stack_space = backtrack_stack.max_size();
+  intptr_t backtracks = 0;
 
   // TODO(zerny): Optimize as single instance. V8 has this as an
   // isolate member.
@@ -295,6 +317,9 @@ static ObjectPtr RawMatch(const TypedData& bytecode,
         backtrack_stack_space++;
         --backtrack_sp;
         pc = code_base + *backtrack_sp;
+        if (backtrack_limit > 0 && ++backtracks > backtrack_limit) {
+          return Object::sentinel().ptr();
+        }
         // This should match check cadence in JIT irregexp implementation.
         check_for_safepoint_now = true;
         break;
@@ -504,6 +529,47 @@ static ObjectPtr RawMatch(const TypedData& bytecode,
           }
           break;
         }
+        BYTECODE(SKIP_UNTIL_CHAR) {
+          // Replaces a loop of LOAD_CURRENT_CHAR, AND_CHECK_CHAR and
+          // ADVANCE_CP_AND_GOTO, see BoyerMooreLookahead.
+          const int32_t load_offset = insn >> BYTECODE_SHIFT;
+          const int32_t advance_by = Load32Aligned(pc + 4);
+          const uint32_t c = Load32Aligned(pc + 8);
+          const uint32_t mask = Load32Aligned(pc + 12);
+          int32_t pos = current + load_offset;
+          while (pos >= 0 && pos < subject_length) {
+            const uint32_t ch = SubjectCharAt<Char>(subject, pos);
+            if ((ch & mask) == c) {
+              current_char = ch;
+              break;
+            }
+            pos += advance_by;
+          }
+          current = pos - load_offset;
+          pc = code_base + Load32Aligned(pc + 16);
+          break;
+        }
+        BYTECODE(SKIP_UNTIL_BIT_IN_TABLE) {
+          // Replaces a loop of LOAD_CURRENT_CHAR, CHECK_BIT_IN_TABLE and
+          // ADVANCE_CP_AND_GOTO, see BoyerMooreLookahead.
+          const int32_t load_offset = insn >> BYTECODE_SHIFT;
+          const int32_t advance_by = Load32Aligned(pc + 4);
+          const uint8_t* table = pc + 12;
+          int32_t pos = current + load_offset;
+          while (pos >= 0 && pos < subject_length) {
+            const uint32_t ch = SubjectCharAt<Char>(subject, pos);
+            const uint32_t masked = ch & RegExpMacroAssembler::kTableMask;
+            if ((table[masked >> kBitsPerByteLog2] &
+                 (1 << (masked & (kBitsPerByte - 1)))) != 0) {
+              current_char = ch;
+              break;
+            }
+            pos += advance_by;
+          }
+          current = pos - load_offset;
+          pc = code_base + Load32Aligned(pc + 8);
+          break;
+        }
         BYTECODE(CHECK_LT) {
           uint32_t limit = (insn >> BYTECODE_SHIFT);
           if (current_char < limit) {
@@ -688,11 +754,13 @@ static ObjectPtr RawMatch(const TypedData& bytecode,
 }
 
 // Returns True if success, False if failure, Null if internal exception,
-// Error if VM error needs to be propagated up the callchain.
+// Error if VM error needs to be propagated up the callchain, and the sentinel
+// if the backtrack limit was exceeded.
 ObjectPtr IrregexpInterpreter::Match(const TypedData& bytecode,
                                      const String& subject,
                                      int32_t* registers,
-                                     int32_t start_position) {
+                                     int32_t start_position,
+                                     intptr_t backtrack_limit) {
   uint16_t previous_char = '\n';
   if (start_position != 0) {
     previous_char = subject.CharAt(start_position - 1);
@@ -700,10 +768,10 @@ ObjectPtr IrregexpInterpreter::Match(const TypedData& bytecode,
 
   if (subject.IsOneByteString()) {
     return RawMatch<uint8_t>(bytecode, subject, registers, start_position,
-                             previous_char);
+                             previous_char, backtrack_limit);
   } else if (subject.IsTwoByteString()) {
     return RawMatch<uint16_t>(bytecode, subject, registers, start_position,
-                              previous_char);
+                              previous_char, backtrack_limit);
   } else {
     UNREACHABLE();
     return Bool::False().ptr();
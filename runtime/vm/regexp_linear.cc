@@ -0,0 +1,472 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include "vm/regexp_linear.h"
+
+#include "platform/unicode.h"
+#include "vm/growable_array.h"
+#include "vm/regexp.h"
+#include "vm/regexp_ast.h"
+#include "vm/regexp_parser.h"
+#include "vm/thread.h"
+
+namespace dart {
+
+// Patterns compiling to more instructions than this, e.g. because of large
+// bounded quantifiers, are left to the backtracking interpreter.
+static constexpr intptr_t kMaxProgramLength = 10000;
+
+// Bound on the memory used for the registers of all threads.
+static constexpr intptr_t kMaxRegisterSlots = 1 * MB;
+
+namespace {
+
+enum Opcode {
+  kChar,            // Consumes the character 'arg'.
+  kClass,           // Consumes a character in 'ranges'.
+  kAssertion,       // Checks the RegExpAssertion::AssertionType 'arg'.
+  kFork,            // Continues at the next instruction, then at 'arg'.
+  kJmp,             // Continues at 'arg'.
+  kSetRegister,     // Stores the position in register 'arg'.
+  kClearRegisters,  // Stores -1 in the registers 'arg' to 'arg2'.
+  kAccept,
+};
+
+struct Instruction {
+  Opcode opcode;
+  int32_t arg;
+  int32_t arg2;
+  ZoneGrowableArray<CharacterRange>* ranges;
+};
+
+// Translates a RegExpTree to a program where alternatives are tried in the
+// order of the instructions, so the first thread to reach kAccept has the
+// priority a backtracking engine gives its match.
+class ProgramBuilder : public ValueObject {
+ public:
+  explicit ProgramBuilder(Zone* zone) : zone_(zone), code_(zone, 16) {}
+
+  bool Build(RegExpTree* tree) {
+    Emit(kSetRegister, RegExpCapture::StartRegister(0));
+    if (!Visit(tree)) return false;
+    Emit(kSetRegister, RegExpCapture::EndRegister(0));
+    Emit(kAccept);
+    return code_.length() <= kMaxProgramLength;
+  }
+
+  const GrowableArray<Instruction>& code() const { return code_; }
+
+ private:
+  intptr_t Emit(Opcode opcode,
+                int32_t arg = 0,
+                int32_t arg2 = 0,
+                ZoneGrowableArray<CharacterRange>* ranges = nullptr) {
+    Instruction instr = {opcode, arg, arg2, ranges};
+    code_.Add(instr);
+    return code_.length() - 1;
+  }
+
+  int32_t pc() const { return static_cast<int32_t>(code_.length()); }
+
+  void Patch(intptr_t at) { code_[at].arg = pc(); }
+
+  bool Visit(RegExpTree* tree) {
+    if (code_.length() > kMaxProgramLength) return false;
+    if (auto disjunction = tree->AsDisjunction()) {
+      return VisitDisjunction(disjunction);
+    }
+    if (auto alternative = tree->AsAlternative()) {
+      ZoneGrowableArray<RegExpTree*>* nodes = alternative->nodes();
+      for (intptr_t i = 0; i < nodes->length(); i++) {
+        if (!Visit(nodes->At(i))) return false;
+      }
+      return true;
+    }
+    if (auto assertion = tree->AsAssertion()) {
+      Emit(kAssertion, assertion->assertion_type());
+      return true;
+    }
+    if (auto char_class = tree->AsCharacterClass()) {
+      EmitClass(char_class);
+      return true;
+    }
+    if (auto atom = tree->AsAtom()) {
+      EmitAtom(atom);
+      return true;
+    }
+    if (auto text = tree->AsText()) {
+      GrowableArray<TextElement>* elements = text->elements();
+      for (intptr_t i = 0; i < elements->length(); i++) {
+        const TextElement& element = elements->At(i);
+        if (element.text_type() == TextElement::ATOM) {
+          EmitAtom(element.atom());
+        } else {
+          EmitClass(element.char_class());
+        }
+      }
+      return true;
+    }
+    if (auto quantifier = tree->AsQuantifier()) {
+      return VisitQuantifier(quantifier);
+    }
+    if (auto capture = tree->AsCapture()) {
+      Emit(kSetRegister, RegExpCapture::StartRegister(capture->index()));
+      if (!Visit(capture->body())) return false;
+      Emit(kSetRegister, RegExpCapture::EndRegister(capture->index()));
+      return true;
+    }
+    if (tree->IsEmpty()) {
+      return true;
+    }
+    // Lookarounds and back references.
+    return false;
+  }
+
+  bool VisitDisjunction(RegExpDisjunction* disjunction) {
+    ZoneGrowableArray<RegExpTree*>* alternatives = disjunction->alternatives();
+    GrowableArray<intptr_t> jumps_to_end;
+    for (intptr_t i = 0; i < alternatives->length(); i++) {
+      const bool is_last = i == alternatives->length() - 1;
+      const intptr_t fork = is_last ? -1 : Emit(kFork);
+      if (!Visit(alternatives->At(i))) return false;
+      if (!is_last) {
+        jumps_to_end.Add(Emit(kJmp));
+        Patch(fork);
+      }
+    }
+    for (intptr_t jump : jumps_to_end) {
+      Patch(jump);
+    }
+    return true;
+  }
+
+  bool VisitQuantifier(RegExpQuantifier* quantifier) {
+    if (quantifier->is_possessive()) return false;
+    RegExpTree* body = quantifier->body();
+    const Interval captures = body->CaptureRegisters();
+    for (intptr_t i = 0; i < quantifier->min(); i++) {
+      if (!VisitIteration(body, captures)) return false;
+    }
+    if (quantifier->max() == RegExpTree::kInfinity) {
+      // Greedy:              Non-greedy:
+      //   L: FORK end          L: FORK body
+      //      body                 JMP end
+      //      JMP L          body: body
+      //                           JMP L
+      const int32_t loop = pc();
+      const intptr_t fork = Emit(kFork);
+      intptr_t exit = fork;
+      if (!quantifier->is_greedy()) {
+        exit = Emit(kJmp);
+        Patch(fork);
+      }
+      if (!VisitIteration(body, captures)) return false;
+      Emit(kJmp, loop);
+      Patch(exit);
+      return true;
+    }
+    // Optional iterations are nested, skipping one skips all that follow.
+    GrowableArray<intptr_t> exits;
+    for (intptr_t i = quantifier->min(); i < quantifier->max(); i++) {
+      const intptr_t fork = Emit(kFork);
+      if (quantifier->is_greedy()) {
+        exits.Add(fork);
+      } else {
+        exits.Add(Emit(kJmp));
+        Patch(fork);
+      }
+      if (!VisitIteration(body, captures)) return false;
+    }
+    for (intptr_t exit : exits) {
+      Patch(exit);
+    }
+    return true;
+  }
+
+  // Captures in the body of a quantifier are reset for each iteration.
+  bool VisitIteration(RegExpTree* body, const Interval& captures) {
+    if (code_.length() > kMaxProgramLength) return false;
+    if (!captures.is_empty()) {
+      Emit(kClearRegisters, captures.from(), captures.to());
+    }
+    return Visit(body);
+  }
+
+  void EmitAtom(RegExpAtom* atom) {
+    ZoneGrowableArray<uint16_t>* data = atom->data();
+    for (intptr_t i = 0; i < data->length(); i++) {
+      Emit(kChar, data->At(i));
+    }
+  }
+
+  void EmitClass(RegExpCharacterClass* char_class) {
+    ZoneGrowableArray<CharacterRange>* ranges = char_class->ranges();
+    if (!CharacterRange::IsCanonical(ranges)) {
+      CharacterRange::Canonicalize(ranges);
+    }
+    if (char_class->is_negated()) {
+      auto negated = new (zone_) ZoneGrowableArray<CharacterRange>(
+          ranges->length() + 1);
+      CharacterRange::Negate(ranges, negated);
+      ranges = negated;
+    }
+    Emit(kClass, 0, 0, ranges);
+  }
+
+  Zone* zone_;
+  GrowableArray<Instruction> code_;
+};
+
+// Runs all threads of a program in lock step over the subject. The threads
+// of a list are ordered by priority, and a thread reaching an instruction
+// another thread has already reached at the same position is dropped, as the
+// other thread has higher priority and the same future.
+class PikeVM : public ValueObject {
+ public:
+  PikeVM(const GrowableArray<Instruction>& code,
+         const String& subject,
+         intptr_t num_registers,
+         Zone* zone)
+      : code_(code),
+        subject_(subject),
+        length_(subject.Length()),
+        num_registers_(num_registers),
+        visited_(zone->Alloc<int32_t>(code.length())),
+        working_(zone->Alloc<int32_t>(num_registers)),
+        stack_(zone, 16) {
+    for (intptr_t i = 0; i < 2; i++) {
+      lists_[i].pcs = zone->Alloc<int32_t>(code.length());
+      lists_[i].registers = zone->Alloc<int32_t>(code.length() * num_registers);
+      lists_[i].length = 0;
+    }
+    for (intptr_t i = 0; i < code.length(); i++) {
+      visited_[i] = 0;
+    }
+  }
+
+  LinearRegExp::Result Run(intptr_t start,
+                           bool sticky,
+                           int32_t* captures,
+                           Error* error) {
+    Thread* thread = Thread::Current();
+    ThreadList* current = &lists_[0];
+    ThreadList* next = &lists_[1];
+    captures_ = captures;
+    matched_ = false;
+    for (intptr_t cp = start;; cp++) {
+      // Like the backtracking interpreter, let long matches be interrupted so
+      // they do not block GC or isolate shutdown.
+      if (UNLIKELY(thread->HasScheduledInterrupts())) {
+        *error = thread->HandleInterrupts();
+        if (!error->IsNull()) {
+          return LinearRegExp::kError;
+        }
+      }
+      if (!matched_ && (cp == start || !sticky)) {
+        // A new attempt at 'cp' has lower priority than those started before.
+        for (intptr_t i = 0; i < num_registers_; i++) {
+          working_[i] = -1;
+        }
+        AddThread(current, 0, cp);
+      }
+      if (current->length == 0 || cp >= length_) {
+        if (current->length == 0 && !matched_ && !sticky && cp < length_) {
+          continue;
+        }
+        break;
+      }
+      const uint16_t c = subject_.CharAt(cp);
+      next->length = 0;
+      for (intptr_t i = 0; i < current->length; i++) {
+        const Instruction& instr = code_[current->pcs[i]];
+        if (!Consumes(instr, c)) continue;
+        memmove(working_, current->RegistersOf(i, num_registers_),
+                num_registers_ * sizeof(int32_t));
+        if (AddThread(next, current->pcs[i] + 1, cp + 1)) {
+          // Threads after this one have lower priority than its match.
+          break;
+        }
+      }
+      ThreadList* tmp = current;
+      current = next;
+      next = tmp;
+    }
+    return matched_ ? LinearRegExp::kMatch : LinearRegExp::kNoMatch;
+  }
+
+ private:
+  struct ThreadList {
+    int32_t* pcs;
+    int32_t* registers;
+    intptr_t length;
+
+    int32_t* RegistersOf(intptr_t i, intptr_t num_registers) {
+      return &registers[i * num_registers];
+    }
+  };
+
+  // Entries of the closure stack: either a pc to visit, or a register value to
+  // restore once the alternatives after a kSetRegister have been visited.
+  struct StackEntry {
+    int32_t pc;
+    int32_t reg;
+    int32_t value;
+  };
+
+  static constexpr int32_t kRestore = -1;
+
+  // Adds the threads reachable from 'pc' at position 'cp' without consuming a
+  // character, using the registers in 'working_'. Returns true if one of them
+  // matched, in which case the lower priority threads are dropped.
+  bool AddThread(ThreadList* list, int32_t pc, intptr_t cp) {
+    const int32_t generation = static_cast<int32_t>(cp + 1);
+    stack_.Clear();
+    stack_.Add({pc, 0, 0});
+    while (!stack_.is_empty()) {
+      StackEntry entry = stack_.RemoveLast();
+      if (entry.pc == kRestore) {
+        working_[entry.reg] = entry.value;
+        continue;
+      }
+      pc = entry.pc;
+      while (true) {
+        if (visited_[pc] == generation) break;
+        visited_[pc] = generation;
+        const Instruction& instr = code_[pc];
+        switch (instr.opcode) {
+          case kChar:
+          case kClass:
+            list->pcs[list->length] = pc;
+            memmove(list->RegistersOf(list->length, num_registers_), working_,
+                    num_registers_ * sizeof(int32_t));
+            list->length++;
+            break;
+          case kAssertion:
+            if (!AssertionHolds(instr.arg, cp)) break;
+            pc++;
+            continue;
+          case kFork:
+            stack_.Add({instr.arg, 0, 0});
+            pc++;
+            continue;
+          case kJmp:
+            pc = instr.arg;
+            continue;
+          case kSetRegister:
+            stack_.Add({kRestore, instr.arg, working_[instr.arg]});
+            working_[instr.arg] = static_cast<int32_t>(cp);
+            pc++;
+            continue;
+          case kClearRegisters:
+            for (int32_t reg = instr.arg; reg <= instr.arg2; reg++) {
+              stack_.Add({kRestore, reg, working_[reg]});
+              working_[reg] = -1;
+            }
+            pc++;
+            continue;
+          case kAccept:
+            memmove(captures_, working_, num_registers_ * sizeof(int32_t));
+            matched_ = true;
+            return true;
+        }
+        break;
+      }
+    }
+    return false;
+  }
+
+  static bool Consumes(const Instruction& instr, uint16_t c) {
+    if (instr.opcode == kChar) {
+      return c == instr.arg;
+    }
+    ASSERT(instr.opcode == kClass);
+    ZoneGrowableArray<CharacterRange>* ranges = instr.ranges;
+    intptr_t low = 0;
+    intptr_t high = ranges->length();
+    while (low < high) {
+      const intptr_t mid = low + (high - low) / 2;
+      const CharacterRange& range = ranges->At(mid);
+      if (c < range.from()) {
+        high = mid;
+      } else if (c > range.to()) {
+        low = mid + 1;
+      } else {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static bool IsLineTerminator(uint16_t c) {
+    return c == '\n' || c == '\r' || c == 0x2028 || c == 0x2029;
+  }
+
+  bool IsWordAt(intptr_t cp) const {
+    if (cp < 0 || cp >= length_) return false;
+    const uint16_t c = subject_.CharAt(cp);
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           (c >= '0' && c <= '9') || c == '_';
+  }
+
+  bool AssertionHolds(int32_t type, intptr_t cp) const {
+    switch (type) {
+      case RegExpAssertion::START_OF_INPUT:
+        return cp == 0;
+      case RegExpAssertion::END_OF_INPUT:
+        return cp == length_;
+      case RegExpAssertion::START_OF_LINE:
+        return cp == 0 || IsLineTerminator(subject_.CharAt(cp - 1));
+      case RegExpAssertion::END_OF_LINE:
+        return cp == length_ || IsLineTerminator(subject_.CharAt(cp));
+      case RegExpAssertion::BOUNDARY:
+        return IsWordAt(cp - 1) != IsWordAt(cp);
+      case RegExpAssertion::NON_BOUNDARY:
+        return IsWordAt(cp - 1) == IsWordAt(cp);
+    }
+    UNREACHABLE();
+    return false;
+  }
+
+  const GrowableArray<Instruction>& code_;
+  const String& subject_;
+  const intptr_t length_;
+  const intptr_t num_registers_;
+  int32_t* visited_;
+  int32_t* working_;
+  GrowableArray<StackEntry> stack_;
+  ThreadList lists_[2];
+  int32_t* captures_ = nullptr;
+  bool matched_ = false;
+};
+
+}  // namespace
+
+LinearRegExp::Result LinearRegExp::Match(const RegExp& regexp,
+                                         const String& subject,
+                                         intptr_t start_index,
+                                         bool sticky,
+                                         int32_t* captures,
+                                         Error* error,
+                                         Zone* zone) {
+  const RegExpFlags flags = regexp.flags();
+  if (flags.IgnoreCase() || flags.IsUnicode()) {
+    return kUnsupported;
+  }
+  const String& pattern = String::Handle(zone, regexp.pattern());
+  RegExpCompileData* data = new (zone) RegExpCompileData();
+  RegExpParser::ParseRegExp(pattern, flags, data);
+
+  ProgramBuilder builder(zone);
+  if (!builder.Build(data->tree)) {
+    return kUnsupported;
+  }
+  const intptr_t num_registers = (data->capture_count + 1) * 2;
+  if (builder.code().length() * num_registers > kMaxRegisterSlots) {
+    return kUnsupported;
+  }
+  PikeVM vm(builder.code(), subject, num_registers, zone);
+  return vm.Run(start_index, sticky, captures, error);
+}
+
+}  // namespace dart
@@ -0,0 +1,49 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// A regular expression engine that runs in time linear in the length of the
+// subject, used when the backtracking interpreter takes too long.
+
+#ifndef RUNTIME_VM_REGEXP_LINEAR_H_
+#define RUNTIME_VM_REGEXP_LINEAR_H_
+
+#include "vm/allocation.h"
+#include "vm/object.h"
+#include "vm/zone.h"
+
+namespace dart {
+
+// Compiles the RegExpTree of a pattern to a program for a Pike VM, which
+// simulates all paths through the pattern in lock step and keeps the one
+// a backtracking engine would have found first. This takes
+// O(subject length * program length) time and O(program length) space.
+//
+// Backreferences and lookarounds cannot be simulated this way, and case
+// insensitive and unicode patterns are not supported yet.
+class LinearRegExp : public AllStatic {
+ public:
+  enum Result {
+    kMatch,
+    kNoMatch,
+    kUnsupported,
+    kError,
+  };
+
+  // Matches 'regexp' against 'subject' starting at 'start_index'. On a match,
+  // stores the start and end of each capture (including capture 0) in
+  // 'captures', or -1 for captures that did not participate. If handling an
+  // interrupt during the match fails, returns kError with the error in
+  // 'error'.
+  static Result Match(const RegExp& regexp,
+                      const String& subject,
+                      intptr_t start_index,
+                      bool sticky,
+                      int32_t* captures,
+                      Error* error,
+                      Zone* zone);
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_VM_REGEXP_LINEAR_H_
@@ -6,6 +6,7 @@
 
 #include "vm/dart_entry.h"
 #include "vm/flags.h"
+#include "vm/hash_table.h"
 #include "vm/isolate.h"
 #include "vm/log.h"
 #include "vm/object.h"
@@ -191,4 +192,73 @@ FunctionPtr Resolver::ResolveDynamicAnyArgs(Zone* zone,
       std::mem_fn(&Class::LookupDynamicFunctionUnsafe));
 }
 
+class ResolutionCacheTraits {
+ public:
+  static const char* Name() { return "ResolutionCacheTraits"; }
+  static bool ReportStats() { return false; }
+  static bool IsMatch(const Object& a, const Object& b) {
+    return String::Cast(a).Equals(String::Cast(b));
+  }
+  static uword Hash(const Object& key) { return String::Cast(key).Hash(); }
+};
+
+// Map<Name, Map<ClassId, Function>>, cleared on reload.
+using ResolutionCacheMap = UnorderedHashMap<ResolutionCacheTraits>;
+
+FunctionPtr Resolver::ResolveDynamicAnyArgsCached(Zone* zone,
+                                                  const Class& receiver_class,
+                                                  const String& function_name,
+                                                  bool allow_add) {
+  // Closures and records share a class across signatures and shapes, so what
+  // resolves for one instance need not resolve for another.
+  if (receiver_class.IsClosureClass() || receiver_class.IsRecordClass()) {
+    return ResolveDynamicAnyArgs(zone, receiver_class, function_name,
+                                 allow_add);
+  }
+
+  Thread* thread = Thread::Current();
+  auto object_store = thread->isolate_group()->object_store();
+  const auto& cid = Smi::Handle(zone, Smi::New(receiver_class.id()));
+  auto& map_array = Array::Handle(zone);
+  auto& function = Function::Handle(zone);
+  {
+    SafepointReadRwLocker ml(thread, thread->isolate_group()->program_lock());
+    map_array = object_store->resolution_cache();
+    if (!map_array.IsNull()) {
+      ResolutionCacheMap map(zone, map_array.ptr());
+      map_array ^= map.GetOrNull(function_name);
+      map.Release();
+      if (!map_array.IsNull()) {
+        IntHashMap map2(zone, map_array.ptr());
+        function ^= map2.GetOrNull(cid);
+        map2.Release();
+      }
+    }
+  }
+  if (!function.IsNull()) return function.ptr();
+
+  // Only found functions are remembered: a member that is missing now may be
+  // added lazily later.
+  function =
+      ResolveDynamicAnyArgs(zone, receiver_class, function_name, allow_add);
+  if (function.IsNull()) return Function::null();
+
+  const auto& name = String::Handle(zone, Symbols::New(thread, function_name));
+  SafepointWriteRwLocker ml(thread, thread->isolate_group()->program_lock());
+  map_array = object_store->resolution_cache();
+  if (map_array.IsNull()) {
+    map_array = HashTables::New<ResolutionCacheMap>(16, Heap::kOld);
+  }
+  ResolutionCacheMap map(zone, map_array.ptr());
+  map_array ^= map.GetOrNull(name);
+  if (map_array.IsNull()) {
+    map_array = HashTables::New<IntHashMap>(4, Heap::kOld);
+  }
+  IntHashMap map2(zone, map_array.ptr());
+  map2.UpdateOrInsert(cid, function);
+  map.UpdateOrInsert(name, map2.Release());
+  object_store->set_resolution_cache(map.Release());
+  return function.ptr();
+}
+
 }  // namespace dart
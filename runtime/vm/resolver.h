@@ -40,6 +40,14 @@ class Resolver : public AllStatic {
                                            const String& function_name,
                                            bool allow_add);
 
+  // Like [ResolveDynamicAnyArgs], but remembers the functions it finds per
+  // receiver class and name. Used by reflective invocations, which tend to
+  // resolve the same members over and over.
+  static FunctionPtr ResolveDynamicAnyArgsCached(Zone* zone,
+                                                 const Class& receiver_class,
+                                                 const String& function_name,
+                                                 bool allow_add);
+
   // Resolve instance function [function_name] with any args, it doesn't
   // allow adding methods during resolution: [allow_add] is [false].
   static FunctionPtr ResolveDynamicFunction(Zone* zone,
@@ -370,6 +370,14 @@ static Heap::Space SpaceForRuntimeAllocation() {
   return UNLIKELY(FLAG_runtime_allocate_old) ? Heap::kOld : Heap::kNew;
 }
 
+// As above, but also honors pretenuring decisions for 'cid'.
+static Heap::Space SpaceForRuntimeAllocation(Thread* thread, intptr_t cid) {
+  if (UNLIKELY(FLAG_runtime_allocate_old)) {
+    return Heap::kOld;
+  }
+  return thread->heap()->SpaceForAllocation(cid);
+}
+
 static void RuntimeAllocationEpilogue(Thread* thread) {
   if (UNLIKELY(FLAG_runtime_allocate_spill_tlab)) {
     static RelaxedAtomic<uword> count = 0;
@@ -407,7 +415,8 @@ DEFINE_RUNTIME_ENTRY(AllocateArray, 2) {
 
   const Array& array = Array::Handle(
       zone,
-      Array::New(static_cast<intptr_t>(len), SpaceForRuntimeAllocation()));
+      Array::New(static_cast<intptr_t>(len),
+                 SpaceForRuntimeAllocation(thread, kArrayCid)));
   TypeArguments& element_type =
       TypeArguments::CheckedHandle(zone, arguments.ArgAt(1));
   // An Array is raw or takes one type argument. However, its type argument
@@ -505,9 +514,9 @@ DEFINE_RUNTIME_ENTRY(AllocateTypedData, 2) {
   } else if (len > max) {
     Exceptions::ThrowOOM();
   }
-  const auto& typed_data =
-      TypedData::Handle(zone, TypedData::New(cid, static_cast<intptr_t>(len),
-                                             SpaceForRuntimeAllocation()));
+  const auto& typed_data = TypedData::Handle(
+      zone, TypedData::New(cid, static_cast<intptr_t>(len),
+                           SpaceForRuntimeAllocation(thread, cid)));
   arguments.SetReturn(typed_data);
   RuntimeAllocationEpilogue(thread);
 }
@@ -537,7 +546,8 @@ DEFINE_RUNTIME_ENTRY(AllocateObject, 2) {
   const Class& cls = Class::CheckedHandle(zone, arguments.ArgAt(0));
   ASSERT(cls.is_allocate_finalized());
   const Instance& instance = Instance::Handle(
-      zone, Instance::NewAlreadyFinalized(cls, SpaceForRuntimeAllocation()));
+      zone, Instance::NewAlreadyFinalized(
+                cls, SpaceForRuntimeAllocation(thread, cls.id())));
   if (cls.NumTypeArguments() == 0) {
     // No type arguments required for a non-parameterized type.
     ASSERT(Instance::CheckedHandle(zone, arguments.ArgAt(1)).IsNull());
@@ -734,7 +744,7 @@ DEFINE_RUNTIME_ENTRY(AllocateClosure, 4) {
   const Closure& closure = Closure::Handle(
       zone, Closure::New(instantiator_type_args, Object::null_type_arguments(),
                          delayed_type_args, function, context,
-                         SpaceForRuntimeAllocation()));
+                         SpaceForRuntimeAllocation(thread, kClosureCid)));
   arguments.SetReturn(closure);
   RuntimeAllocationEpilogue(thread);
 }
@@ -745,7 +755,8 @@ DEFINE_RUNTIME_ENTRY(AllocateClosure, 4) {
 DEFINE_RUNTIME_ENTRY(AllocateContext, 1) {
   const Smi& num_variables = Smi::CheckedHandle(zone, arguments.ArgAt(0));
   const Context& context = Context::Handle(
-      zone, Context::New(num_variables.Value(), SpaceForRuntimeAllocation()));
+      zone, Context::New(num_variables.Value(),
+                         SpaceForRuntimeAllocation(thread, kContextCid)));
   arguments.SetReturn(context);
   RuntimeAllocationEpilogue(thread);
 }
@@ -757,7 +768,8 @@ DEFINE_RUNTIME_ENTRY(AllocateContext, 1) {
 DEFINE_RUNTIME_ENTRY(CloneContext, 1) {
   const Context& ctx = Context::CheckedHandle(zone, arguments.ArgAt(0));
   Context& cloned_ctx = Context::Handle(
-      zone, Context::New(ctx.num_variables(), SpaceForRuntimeAllocation()));
+      zone, Context::New(ctx.num_variables(),
+                         SpaceForRuntimeAllocation(thread, kContextCid)));
   cloned_ctx.set_parent(Context::Handle(zone, ctx.parent()));
   Object& inst = Object::Handle(zone);
   for (int i = 0; i < ctx.num_variables(); i++) {
@@ -773,8 +785,8 @@ DEFINE_RUNTIME_ENTRY(CloneContext, 1) {
 // Return value: newly allocated record.
 DEFINE_RUNTIME_ENTRY(AllocateRecord, 1) {
   const RecordShape shape(Smi::RawCast(arguments.ArgAt(0)));
-  const Record& record =
-      Record::Handle(zone, Record::New(shape, SpaceForRuntimeAllocation()));
+  const Record& record = Record::Handle(
+      zone, Record::New(shape, SpaceForRuntimeAllocation(thread, kRecordCid)));
   arguments.SetReturn(record);
   RuntimeAllocationEpilogue(thread);
 }
@@ -788,8 +800,8 @@ DEFINE_RUNTIME_ENTRY(AllocateSmallRecord, 4) {
   const auto& value0 = Instance::CheckedHandle(zone, arguments.ArgAt(1));
   const auto& value1 = Instance::CheckedHandle(zone, arguments.ArgAt(2));
   const auto& value2 = Instance::CheckedHandle(zone, arguments.ArgAt(3));
-  const Record& record =
-      Record::Handle(zone, Record::New(shape, SpaceForRuntimeAllocation()));
+  const Record& record = Record::Handle(
+      zone, Record::New(shape, SpaceForRuntimeAllocation(thread, kRecordCid)));
   const intptr_t num_fields = shape.num_fields();
   ASSERT(num_fields == 2 || num_fields == 3);
   record.SetFieldAt(0, value0);
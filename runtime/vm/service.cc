@@ -24,6 +24,7 @@
 #include "vm/dart_api_state.h"
 #include "vm/dart_entry.h"
 #include "vm/debugger.h"
+#include "vm/heap/live_heap_profile.h"
 #include "vm/heap/safepoint.h"
 #include "vm/isolate.h"
 #include "vm/json_stream.h"
@@ -54,6 +55,7 @@
 #include "vm/timeline.h"
 #include "vm/version.h"
 #include "vm/visitor.h"
+#include "vm/zone_text_buffer.h"
 
 #if defined(SUPPORT_PERFETTO)
 #include "vm/perfetto_utils.h"
@@ -2695,6 +2697,85 @@ static void GetReachableSize(Thread* thread, JSONStream* js) {
   result.PrintJSON(js, true);
 }
 
+static const MethodParameter* const get_top_retainers_params[] = {
+    RUNNABLE_ISOLATE_PARAMETER,
+    new UIntParameter("limit", false),
+    nullptr,
+};
+
+// Larger limits are clamped, so that the result array stays small.
+static constexpr uintptr_t kMaxTopRetainersLimit = 1000;
+
+// Reports the user objects retaining the most memory, according to the
+// dominator tree of the heap.
+static void GetTopRetainers(Thread* thread, JSONStream* js) {
+  intptr_t limit = 10;
+  if (js->HasParam("limit")) {
+    const uintptr_t value = UIntParameter::Parse(js->LookupParam("limit"));
+    if (value == 0) {
+      PrintInvalidParamError(js, "limit");
+      return;
+    }
+    limit = Utils::Minimum(value, kMaxTopRetainersLimit);
+  }
+  ObjectGraph graph(thread);
+  Array& retainers = Array::Handle(Array::New(limit * 2));
+  intptr_t total_size = 0;
+  const intptr_t length = graph.TopRetainers(retainers, &total_size);
+  JSONObject jsobj(js);
+  jsobj.AddProperty("type", "_TopRetainers");
+  jsobj.AddProperty64("totalSize", total_size);
+  JSONArray elements(&jsobj, "retainers");
+  Object& element = Object::Handle();
+  Smi& retained_size = Smi::Handle();
+  for (intptr_t i = 0; i < length; i++) {
+    JSONObject jselement(&elements);
+    element = retainers.At(i * 2);
+    retained_size ^= retainers.At(i * 2 + 1);
+    jselement.AddProperty("value", element);
+    jselement.AddProperty64("retainedSize", retained_size.Value());
+  }
+  // Don't keep the retainers alive through this array, so that they are not
+  // reported as inbound references.
+  for (intptr_t i = 0; i < retainers.Length(); i++) {
+    retainers.SetAt(i, Object::null_object());
+  }
+}
+
+static const MethodParameter* const get_open_metrics_params[] = {
+    RUNNABLE_ISOLATE_PARAMETER,
+    nullptr,
+};
+
+// Reports the metrics of the isolate and its group in the OpenMetrics text
+// format. The service server also serves the text on its /metrics path as
+// text/plain, so that it can be scraped with a plain HTTP request.
+static void GetOpenMetrics(Thread* thread, JSONStream* js) {
+  Isolate* isolate = thread->isolate();
+  IsolateGroup* isolate_group = thread->isolate_group();
+  Zone* zone = thread->zone();
+  ZoneTextBuffer text(zone);
+  const char* group_labels = OS::SCreate(
+      zone, "isolate_group=\"" ISOLATE_GROUP_SERVICE_ID_FORMAT_STRING "\"",
+      isolate_group->id());
+#define PRINT_METRIC(type, variable, name, unit)                               \
+  isolate_group->Get##variable##Metric()->PrintOpenMetrics(&text, group_labels);
+  ISOLATE_GROUP_METRIC_LIST(PRINT_METRIC)
+#undef PRINT_METRIC
+  const char* isolate_labels =
+      OS::SCreate(zone, "%s,isolate=\"" ISOLATE_SERVICE_ID_FORMAT_STRING "\"",
+                  group_labels, static_cast<int64_t>(isolate->main_port()));
+#define PRINT_METRIC(type, variable, name, unit)                               \
+  isolate->Get##variable##Metric()->PrintOpenMetrics(&text, isolate_labels);
+  ISOLATE_METRIC_LIST(PRINT_METRIC)
+#undef PRINT_METRIC
+  text.AddString("# EOF\n");
+
+  JSONObject jsobj(js);
+  jsobj.AddProperty("type", "_OpenMetrics");
+  jsobj.AddProperty("text", text.buffer());
+}
+
 static const MethodParameter* const invalidate_id_zone_params[] = {
     RUNNABLE_ISOLATE_PARAMETER,
     nullptr,
@@ -3669,6 +3750,76 @@ static void GetInstances(Thread* thread, JSONStream* js) {
   }
 }
 
+#if !defined(DART_PRECOMPILED_RUNTIME)
+class DeoptimizedFunctionsVisitor : public ObjectVisitor {
+ public:
+  explicit DeoptimizedFunctionsVisitor(GrowableArray<const Function*>* storage)
+      : storage_(storage), function_(Function::Handle()) {}
+
+  void VisitObject(ObjectPtr obj) override {
+    if (obj->IsPseudoObject() || !obj->IsFunction()) {
+      return;
+    }
+    function_ ^= obj;
+    if (function_.deoptimization_counter() > 0) {
+      storage_->Add(&Function::Handle(function_.ptr()));
+    }
+  }
+
+ private:
+  GrowableArray<const Function*>* storage_;
+  Function& function_;
+};
+
+static int CompareDeoptimizations(const Function* const* a,
+                                  const Function* const* b) {
+  return (*b)->deoptimization_counter() - (*a)->deoptimization_counter();
+}
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+
+static const MethodParameter* const get_deoptimized_functions_params[] = {
+    RUNNABLE_ISOLATE_PARAMETER,
+    new UIntParameter("limit", /*required=*/false),
+    nullptr,
+};
+
+// Lists the functions that were deoptimized, most often deoptimized first,
+// to find the functions that make the JIT recompile code.
+static void GetDeoptimizedFunctions(Thread* thread, JSONStream* js) {
+  const intptr_t limit = js->HasParam("limit")
+                             ? UIntParameter::Parse(js->LookupParam("limit"))
+                             : kIntptrMax;
+  // Ensure the handles created below are promptly destroyed.
+  StackZone zone(thread);
+  GrowableArray<const Function*> functions;
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  {
+    HeapIterationScope iteration_scope(thread);
+    DeoptimizedFunctionsVisitor visitor(&functions);
+    iteration_scope.IterateObjects(&visitor);
+  }
+  functions.Sort(CompareDeoptimizations);
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+  JSONObject jsobj(js);
+  jsobj.AddProperty("type", "_DeoptimizedFunctions");
+  jsobj.AddProperty("totalCount", functions.length());
+  JSONArray entries(&jsobj, "functions");
+  Code& code = Code::Handle(thread->zone());
+  for (intptr_t i = 0; (i < limit) && (i < functions.length()); i++) {
+    const Function& function = *functions[i];
+    JSONObject entry(&entries);
+    entry.AddProperty("function", function);
+    entry.AddProperty("deoptimizations",
+                      static_cast<intptr_t>(function.deoptimization_counter()));
+    entry.AddProperty("usageCounter",
+                      static_cast<intptr_t>(function.usage_counter()));
+    entry.AddProperty("optimized", function.HasOptimizedCode());
+    code = function.CurrentCode();
+    entry.AddProperty("codeSize",
+                      code.IsNull() ? 0 : static_cast<intptr_t>(code.Size()));
+  }
+}
+
 static const MethodParameter* const get_instances_as_list_params[] = {
     RUNNABLE_ISOLATE_PARAMETER,
     new IdParameter("objectId", /*required=*/true),
@@ -4537,6 +4688,31 @@ static void EnableProfiler(Thread* thread, JSONStream* js) {
   PrintSuccess(js);
 }
 
+static const MethodParameter* const enable_live_heap_profile_params[] = {
+    NO_ISOLATE_PARAMETER,
+    new BoolParameter("enable", false),
+    nullptr,
+};
+
+static void EnableLiveHeapProfile(Thread* thread, JSONStream* js) {
+  const bool enable = BoolParameter::Parse(js->LookupParam("enable"), true);
+  if (!LiveHeapProfile::Enable(enable)) {
+    js->PrintError(kFeatureDisabled,
+                   "The embedder has registered heap sampling callbacks.");
+    return;
+  }
+  PrintSuccess(js);
+}
+
+static const MethodParameter* const get_live_heap_profile_params[] = {
+    NO_ISOLATE_PARAMETER,
+    nullptr,
+};
+
+static void GetLiveHeapProfile(Thread* thread, JSONStream* js) {
+  LiveHeapProfile::PrintJSON(js);
+}
+
 static const MethodParameter* const get_tag_profile_params[] = {
     RUNNABLE_ISOLATE_PARAMETER,
     nullptr,
@@ -5337,6 +5513,55 @@ static void GetIsolateObjectStore(Thread* thread, JSONStream* js) {
   thread->isolate()->isolate_object_store()->PrintToJSONObject(&jsobj);
 }
 
+static const MethodParameter* const get_isolate_overhead_params[] = {
+    ISOLATE_PARAMETER,
+    nullptr,
+};
+
+// Reports the native memory owned by a single isolate, as opposed to the heap
+// and program structure which are shared by all isolates in its group.
+static void GetIsolateOverhead(Thread* thread, JSONStream* js) {
+  Isolate* isolate = thread->isolate();
+  IsolateGroup* isolate_group = thread->isolate_group();
+  JSONObject jsobj(js);
+  jsobj.AddProperty("type", "_IsolateOverhead");
+  jsobj.AddProperty64("isolate", sizeof(Isolate));
+  jsobj.AddProperty64("isolateObjectStore", sizeof(IsolateObjectStore));
+  jsobj.AddProperty64("fieldTable",
+                      isolate->field_table()->Capacity() * kWordSize);
+  {
+    intptr_t messages = 0;
+    intptr_t message_bytes = 0;
+    MessageHandler::AcquiredQueues aq(isolate->message_handler());
+    for (MessageQueue* queue : {aq.queue(), aq.oob_queue()}) {
+      MessageQueue::Iterator it(queue);
+      while (it.HasNext()) {
+        messages++;
+        message_bytes += it.Next()->Size();
+      }
+    }
+    jsobj.AddProperty64("messageHandler", sizeof(MessageHandler));
+    jsobj.AddProperty("pendingMessages", messages);
+    jsobj.AddProperty("pendingMessageBytes", message_bytes);
+  }
+  OSThread* os_thread = thread->os_thread();
+  jsobj.AddProperty64("mutatorStack",
+                      os_thread->stack_base() - os_thread->stack_limit());
+  intptr_t zone_capacity = 0;
+  for (Zone* zone = thread->zone(); zone != nullptr; zone = zone->previous()) {
+    zone_capacity += zone->CapacityInBytes();
+  }
+  jsobj.AddProperty64("mutatorZones", zone_capacity);
+  // The new-space is shared by all isolates in the group, which each allocate
+  // from their own TLAB within it.
+  jsobj.AddProperty64(
+      "groupNewSpaceCapacity",
+      isolate_group->heap()->new_space()->CapacityInWords() * kWordSize);
+  intptr_t isolate_count = 0;
+  isolate_group->ForEachIsolate([&](Isolate*) { isolate_count++; });
+  jsobj.AddProperty("groupIsolateCount", isolate_count);
+}
+
 static const MethodParameter* const get_class_list_params[] = {
     RUNNABLE_ISOLATE_PARAMETER,
     nullptr,
@@ -6058,6 +6283,8 @@ static const ServiceMethodDescriptor service_methods_[] = {
     create_id_zone_params },
   { "_deleteIdZone", DeleteIdZone,
     delete_id_zone_params },
+  { "_enableLiveHeapProfile", EnableLiveHeapProfile,
+    enable_live_heap_profile_params, },
   { "_enableProfiler", EnableProfiler,
     enable_profiler_params, },
   { "evaluate", Evaluate,
@@ -6076,6 +6303,8 @@ static const ServiceMethodDescriptor service_methods_[] = {
     get_cpu_samples_params },
   { "getFlagList", GetFlagList,
     get_flag_list_params },
+  { "_getDeoptimizedFunctions", GetDeoptimizedFunctions,
+    get_deoptimized_functions_params },
   { "_getHeapMap", GetHeapMap,
     get_heap_map_params },
   { "_getImplementationFields", GetImplementationFields,
@@ -6098,6 +6327,8 @@ static const ServiceMethodDescriptor service_methods_[] = {
     get_isolate_params },
   { "_getIsolateObjectStore", GetIsolateObjectStore,
     get_isolate_object_store_params },
+  { "_getIsolateOverhead", GetIsolateOverhead,
+    get_isolate_overhead_params },
   { "getIsolateGroup", GetIsolateGroup,
     get_isolate_group_params },
   { "getMemoryUsage", GetMemoryUsage,
@@ -6110,10 +6341,14 @@ static const ServiceMethodDescriptor service_methods_[] = {
     get_isolate_metric_list_params },
   { "getIsolatePauseEvent", GetIsolatePauseEvent,
     get_isolate_pause_event_params },
+  { "_getLiveHeapProfile", GetLiveHeapProfile,
+    get_live_heap_profile_params },
   { "getObject", GetObject,
     get_object_params },
   { "_getObjectStore", GetObjectStore,
     get_object_store_params },
+  { "_getOpenMetrics", GetOpenMetrics,
+    get_open_metrics_params },
   { "_getPersistentHandles", GetPersistentHandles,
       get_persistent_handles_params, },
   { "_getPorts", GetPortsPrivate,
@@ -6124,6 +6359,8 @@ static const ServiceMethodDescriptor service_methods_[] = {
     get_reachable_size_params },
   { "_getRetainedSize", GetRetainedSize,
     get_retained_size_params },
+  { "_getTopRetainers", GetTopRetainers,
+    get_top_retainers_params },
   { "lookupResolvedPackageUris", LookupResolvedPackageUris,
     lookup_resolved_package_uris_params },
   { "lookupPackageUris", LookupPackageUris,
@@ -797,6 +797,10 @@ Simulator::Simulator() : exclusive_access_addr_(0), exclusive_access_value_(0) {
 
   pc_modified_ = false;
   icount_ = 0;
+  for (auto& entry : decode_cache_) {
+    entry.instr_bits = 0;
+    entry.handler = nullptr;
+  }
   break_pc_ = nullptr;
   break_instr_ = 0;
   last_setjmp_buffer_ = nullptr;
@@ -1541,22 +1545,6 @@ void Simulator::DecodePCRel(Instr* instr) {
   }
 }
 
-void Simulator::DecodeDPImmediate(Instr* instr) {
-  if (instr->IsMoveWideOp()) {
-    DecodeMoveWide(instr);
-  } else if (instr->IsAddSubImmOp()) {
-    DecodeAddSubImm(instr);
-  } else if (instr->IsBitfieldOp()) {
-    DecodeBitfield(instr);
-  } else if (instr->IsLogicalImmOp()) {
-    DecodeLogicalImm(instr);
-  } else if (instr->IsPCRelOp()) {
-    DecodePCRel(instr);
-  } else {
-    UnimplementedInstruction(instr);
-  }
-}
-
 void Simulator::DecodeCompareAndBranch(Instr* instr) {
   const int op = instr->Bit(24);
   const Register rt = instr->RtField();
@@ -1901,27 +1889,6 @@ void Simulator::DecodeUnconditionalBranchReg(Instr* instr) {
   }
 }
 
-DART_FORCE_INLINE
-void Simulator::DecodeCompareBranch(Instr* instr) {
-  if (instr->IsCompareAndBranchOp()) {
-    DecodeCompareAndBranch(instr);
-  } else if (instr->IsConditionalBranchOp()) {
-    DecodeConditionalBranch(instr);
-  } else if (instr->IsExceptionGenOp()) {
-    DecodeExceptionGen(instr);
-  } else if (instr->IsSystemOp()) {
-    DecodeSystem(instr);
-  } else if (instr->IsTestAndBranchOp()) {
-    DecodeTestAndBranch(instr);
-  } else if (instr->IsUnconditionalBranchOp()) {
-    DecodeUnconditionalBranch(instr);
-  } else if (instr->IsUnconditionalBranchRegOp()) {
-    DecodeUnconditionalBranchReg(instr);
-  } else {
-    UnimplementedInstruction(instr);
-  }
-}
-
 void Simulator::DecodeLoadStoreReg(Instr* instr) {
   // Calculate the address.
   const Register rn = instr->RnField();
@@ -2408,23 +2375,6 @@ void Simulator::DecodeAtomicMemory(Instr* instr) {
   }
 }
 
-DART_FORCE_INLINE
-void Simulator::DecodeLoadStore(Instr* instr) {
-  if (instr->IsAtomicMemoryOp()) {
-    DecodeAtomicMemory(instr);
-  } else if (instr->IsLoadStoreRegOp()) {
-    DecodeLoadStoreReg(instr);
-  } else if (instr->IsLoadStoreRegPairOp()) {
-    DecodeLoadStoreRegPair(instr);
-  } else if (instr->IsLoadRegLiteralOp()) {
-    DecodeLoadRegLiteral(instr);
-  } else if (instr->IsLoadStoreExclusiveOp()) {
-    DecodeLoadStoreExclusive(instr);
-  } else {
-    UnimplementedInstruction(instr);
-  }
-}
-
 int64_t Simulator::ShiftOperand(uint8_t reg_size,
                                 int64_t value,
                                 Shift shift_type,
@@ -2946,26 +2896,6 @@ void Simulator::DecodeConditionalSelect(Instr* instr) {
   }
 }
 
-void Simulator::DecodeDPRegister(Instr* instr) {
-  if (instr->IsAddSubShiftExtOp()) {
-    DecodeAddSubShiftExt(instr);
-  } else if (instr->IsAddSubWithCarryOp()) {
-    DecodeAddSubWithCarry(instr);
-  } else if (instr->IsLogicalShiftOp()) {
-    DecodeLogicalShift(instr);
-  } else if (instr->IsMiscDP1SourceOp()) {
-    DecodeMiscDP1Source(instr);
-  } else if (instr->IsMiscDP2SourceOp()) {
-    DecodeMiscDP2Source(instr);
-  } else if (instr->IsMiscDP3SourceOp()) {
-    DecodeMiscDP3Source(instr);
-  } else if (instr->IsConditionalSelectOp()) {
-    DecodeConditionalSelect(instr);
-  } else {
-    UnimplementedInstruction(instr);
-  }
-}
-
 void Simulator::DecodeSIMDCopy(Instr* instr) {
   const int32_t Q = instr->Bit(30);
   const int32_t op = instr->Bit(29);
@@ -3439,18 +3369,6 @@ void Simulator::DecodeSIMDTwoReg(Instr* instr) {
   }
 }
 
-void Simulator::DecodeDPSimd1(Instr* instr) {
-  if (instr->IsSIMDCopyOp()) {
-    DecodeSIMDCopy(instr);
-  } else if (instr->IsSIMDThreeSameOp()) {
-    DecodeSIMDThreeSame(instr);
-  } else if (instr->IsSIMDTwoRegOp()) {
-    DecodeSIMDTwoReg(instr);
-  } else {
-    UnimplementedInstruction(instr);
-  }
-}
-
 void Simulator::DecodeFPImm(Instr* instr) {
   if ((instr->Bit(31) != 0) || (instr->Bit(29) != 0) || (instr->Bit(23) != 0) ||
       (instr->Bits(5, 5) != 0)) {
@@ -3687,28 +3605,63 @@ void Simulator::DecodeFPCompare(Instr* instr) {
   }
 }
 
-void Simulator::DecodeFP(Instr* instr) {
-  if (instr->IsFPImmOp()) {
-    DecodeFPImm(instr);
-  } else if (instr->IsFPIntCvtOp()) {
-    DecodeFPIntCvt(instr);
-  } else if (instr->IsFPOneSourceOp()) {
-    DecodeFPOneSource(instr);
-  } else if (instr->IsFPTwoSourceOp()) {
-    DecodeFPTwoSource(instr);
-  } else if (instr->IsFPCompareOp()) {
-    DecodeFPCompare(instr);
-  } else {
-    UnimplementedInstruction(instr);
-  }
-}
-
-void Simulator::DecodeDPSimd2(Instr* instr) {
-  if (instr->IsFPOp()) {
-    DecodeFP(instr);
-  } else {
-    UnimplementedInstruction(instr);
+Simulator::DecodeHandler Simulator::ClassifyInstruction(Instr* instr) {
+  if (instr->IsLoadStoreOp()) {
+    if (instr->IsAtomicMemoryOp()) return &Simulator::DecodeAtomicMemory;
+    if (instr->IsLoadStoreRegOp()) return &Simulator::DecodeLoadStoreReg;
+    if (instr->IsLoadStoreRegPairOp()) {
+      return &Simulator::DecodeLoadStoreRegPair;
+    }
+    if (instr->IsLoadRegLiteralOp()) return &Simulator::DecodeLoadRegLiteral;
+    if (instr->IsLoadStoreExclusiveOp()) {
+      return &Simulator::DecodeLoadStoreExclusive;
+    }
+  } else if (instr->IsDPImmediateOp()) {
+    if (instr->IsMoveWideOp()) return &Simulator::DecodeMoveWide;
+    if (instr->IsAddSubImmOp()) return &Simulator::DecodeAddSubImm;
+    if (instr->IsBitfieldOp()) return &Simulator::DecodeBitfield;
+    if (instr->IsLogicalImmOp()) return &Simulator::DecodeLogicalImm;
+    if (instr->IsPCRelOp()) return &Simulator::DecodePCRel;
+  } else if (instr->IsCompareBranchOp()) {
+    if (instr->IsCompareAndBranchOp()) {
+      return &Simulator::DecodeCompareAndBranch;
+    }
+    if (instr->IsConditionalBranchOp()) {
+      return &Simulator::DecodeConditionalBranch;
+    }
+    if (instr->IsExceptionGenOp()) return &Simulator::DecodeExceptionGen;
+    if (instr->IsSystemOp()) return &Simulator::DecodeSystem;
+    if (instr->IsTestAndBranchOp()) return &Simulator::DecodeTestAndBranch;
+    if (instr->IsUnconditionalBranchOp()) {
+      return &Simulator::DecodeUnconditionalBranch;
+    }
+    if (instr->IsUnconditionalBranchRegOp()) {
+      return &Simulator::DecodeUnconditionalBranchReg;
+    }
+  } else if (instr->IsDPRegisterOp()) {
+    if (instr->IsAddSubShiftExtOp()) return &Simulator::DecodeAddSubShiftExt;
+    if (instr->IsAddSubWithCarryOp()) return &Simulator::DecodeAddSubWithCarry;
+    if (instr->IsLogicalShiftOp()) return &Simulator::DecodeLogicalShift;
+    if (instr->IsMiscDP1SourceOp()) return &Simulator::DecodeMiscDP1Source;
+    if (instr->IsMiscDP2SourceOp()) return &Simulator::DecodeMiscDP2Source;
+    if (instr->IsMiscDP3SourceOp()) return &Simulator::DecodeMiscDP3Source;
+    if (instr->IsConditionalSelectOp()) {
+      return &Simulator::DecodeConditionalSelect;
+    }
+  } else if (instr->IsDPSimd1Op()) {
+    if (instr->IsSIMDCopyOp()) return &Simulator::DecodeSIMDCopy;
+    if (instr->IsSIMDThreeSameOp()) return &Simulator::DecodeSIMDThreeSame;
+    if (instr->IsSIMDTwoRegOp()) return &Simulator::DecodeSIMDTwoReg;
+  } else if (instr->IsDPSimd2Op()) {
+    if (instr->IsFPOp()) {
+      if (instr->IsFPImmOp()) return &Simulator::DecodeFPImm;
+      if (instr->IsFPIntCvtOp()) return &Simulator::DecodeFPIntCvt;
+      if (instr->IsFPOneSourceOp()) return &Simulator::DecodeFPOneSource;
+      if (instr->IsFPTwoSourceOp()) return &Simulator::DecodeFPTwoSource;
+      if (instr->IsFPCompareOp()) return &Simulator::DecodeFPCompare;
+    }
   }
+  return &Simulator::UnimplementedInstruction;
 }
 
 // Executes the current instruction.
@@ -3716,21 +3669,16 @@ DART_FORCE_INLINE
 void Simulator::InstructionDecodeImpl(Instr* instr) {
   pc_modified_ = false;
 
-  if (instr->IsLoadStoreOp()) {
-    DecodeLoadStore(instr);
-  } else if (instr->IsDPImmediateOp()) {
-    DecodeDPImmediate(instr);
-  } else if (instr->IsCompareBranchOp()) {
-    DecodeCompareBranch(instr);
-  } else if (instr->IsDPRegisterOp()) {
-    DecodeDPRegister(instr);
-  } else if (instr->IsDPSimd1Op()) {
-    DecodeDPSimd1(instr);
-  } else if (instr->IsDPSimd2Op()) {
-    DecodeDPSimd2(instr);
-  } else {
-    UnimplementedInstruction(instr);
+  const int32_t instr_bits = instr->InstructionBits();
+  const uint32_t index = (static_cast<uint32_t>(instr_bits) * 0x9E3779B1u) >>
+                         (32 - kDecodeCacheBits);
+  DecodeCacheEntry* entry = &decode_cache_[index];
+  if (UNLIKELY((entry->handler == nullptr) ||
+               (entry->instr_bits != instr_bits))) {
+    entry->instr_bits = instr_bits;
+    entry->handler = ClassifyInstruction(instr);
   }
+  (this->*(entry->handler))(instr);
 
   if (!pc_modified_) {
     set_pc(reinterpret_cast<int64_t>(instr) + Instr::kInstrSize);
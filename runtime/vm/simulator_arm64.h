@@ -237,9 +237,23 @@ class Simulator {
   void InstructionDecode(Instr* instr);
   void InstructionDecodeImpl(Instr* instr);
 #define DECODE_OP(op) void Decode##op(Instr* instr);
-  APPLY_OP_LIST(DECODE_OP)
+  APPLY_OP_LEAF_LIST(DECODE_OP)
 #undef DECODE_OP
 
+  // Returns the decoder for the instruction class of [instr].
+  typedef void (Simulator::*DecodeHandler)(Instr* instr);
+  DecodeHandler ClassifyInstruction(Instr* instr);
+
+  // Direct-mapped cache from instruction encodings to their decoders. The
+  // decoder only depends on the encoding, so entries need no invalidation
+  // when code is patched or freed.
+  struct DecodeCacheEntry {
+    int32_t instr_bits;
+    DecodeHandler handler;
+  };
+  static constexpr intptr_t kDecodeCacheBits = 12;
+  DecodeCacheEntry decode_cache_[1 << kDecodeCacheBits];
+
   // Executes ARM64 instructions until the PC reaches kEndSimulatingPC.
   void Execute();
   void ExecuteNoTrace();
@@ -479,7 +479,10 @@ bool StackFrame::FindExceptionHandler(Thread* thread,
   }
 
   intptr_t try_index = -1;
-  if (handlers.num_entries() != 0) {
+  NotInTryBlockCache* not_in_try_block_cache =
+      thread->isolate()->not_in_try_block_cache();
+  if ((handlers.num_entries() != 0) &&
+      (not_in_try_block_cache->Lookup(pc()) == nullptr)) {
     if (is_interpreted()) {
       try_index = bytecode.GetTryIndexAtPc(pc());
     } else {
@@ -494,6 +497,13 @@ bool StackFrame::FindExceptionHandler(Thread* thread,
         }
       }
     }
+    if (try_index == -1) {
+      // Remember that this pc is outside of all try blocks, so that further
+      // exceptions unwinding through this frame don't search the descriptors.
+      // These are kept apart from the handlers found, so that the many frames
+      // a throw unwinds through don't evict them.
+      not_in_try_block_cache->Insert(pc(), true);
+    }
   }
   if (try_index == -1) {
     if (handlers.has_async_handler()) {
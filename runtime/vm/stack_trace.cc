@@ -308,7 +308,7 @@ void AsyncAwareStackUnwinder::Unwind(
               {sync_frame_, null_code_, bytecode_, pc_offset, null_closure_});
         }
       } else {
-        code_ = sync_frame_->LookupDartCode();
+        // HandleSynchronousFrame has already looked up the code of the frame.
         const uword pc_offset = sync_frame_->pc() - code_.PayloadStart();
         handle_frame(
             {sync_frame_, code_, null_bytecode_, pc_offset, null_closure_});
@@ -387,7 +387,16 @@ ObjectPtr AsyncAwareStackUnwinder::GetReceiver() const {
 }
 
 bool AsyncAwareStackUnwinder::HandleSynchronousFrame() {
-  function_ = sync_frame_->LookupDartFunction();
+  if (sync_frame_->is_interpreted()) {
+    function_ = sync_frame_->LookupDartFunction();
+  } else {
+    // Finding the code of a frame is a binary search in AOT, so look it up
+    // once and keep it in |code_| for Unwind.
+    code_ = sync_frame_->LookupDartCode();
+    object_ = code_.IsNull() ? Object::null() : code_.owner();
+    function_ = object_.IsFunction() ? Function::Cast(object_).ptr()
+                                     : Function::null();
+  }
   if (function_.IsNull()) {
     return false;
   }
@@ -7,6 +7,7 @@
 #include "vm/cpu.h"
 #include "vm/dart_api_state.h"
 #include "vm/growable_array.h"
+#include "vm/heap/freelist.h"
 #include "vm/heap/safepoint.h"
 #include "vm/isolate.h"
 #include "vm/json_stream.h"
@@ -45,6 +46,8 @@ Thread::~Thread() {
   delete interpreter_;
   interpreter_ = nullptr;
 #endif
+  delete old_space_cache_;
+  old_space_cache_ = nullptr;
   // There should be no top api scopes at this point.
   ASSERT(api_top_scope() == nullptr);
   // Delete the reusable api scope if there is one.
@@ -581,6 +584,7 @@ void Thread::ResumeThreadInternal(Thread* thread) {
 
 void Thread::SuspendThreadInternal(Thread* thread, VMTag::VMTagId tag) {
   thread->heap()->new_space()->AbandonRemainingTLAB(thread);
+  thread->heap()->old_space()->FlushThreadCache(thread);
 
 #if !defined(PRODUCT) || defined(FORCE_INCLUDE_SAMPLING_HEAP_PROFILER)
   thread->heap_sampler().Cleanup();
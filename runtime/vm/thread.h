@@ -44,6 +44,7 @@ class Error;
 class ExceptionHandlers;
 class Field;
 class FieldTable;
+class FreeListCache;
 class Function;
 class GrowableObjectArray;
 class HandleScope;
@@ -1155,6 +1156,10 @@ class Thread : public ThreadState {
   HeapProfileSampler& heap_sampler() { return heap_sampler_; }
 #endif
 
+  // Created on first use; see PageSpace::TryAllocateCached.
+  FreeListCache* old_space_cache() const { return old_space_cache_; }
+  void set_old_space_cache(FreeListCache* cache) { old_space_cache_ = cache; }
+
   PendingDeopts& pending_deopts() { return pending_deopts_; }
 
   SafepointLevel current_safepoint_level() const {
@@ -1422,6 +1427,8 @@ class Thread : public ThreadState {
   HeapProfileSampler heap_sampler_;
 #endif
 
+  FreeListCache* old_space_cache_ = nullptr;
+
 #if defined(DART_DYNAMIC_MODULES)
   Interpreter* interpreter_ = nullptr;
   bytecode::BytecodeLoader* bytecode_loader_ = nullptr;
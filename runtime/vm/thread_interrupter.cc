@@ -21,15 +21,16 @@ namespace dart {
 // rely on being executed on the interrupted thread.
 //
 // There are two mechanisms used to interrupt a thread. The first, used on Linux
-// and Android, is SIGPROF. The second, used on Windows, Fuchsia, Mac and iOS,
-// is explicit suspend and resume thread system calls. (Although Mac supports
-// SIGPROF, when the process is attached to lldb, it becomes unusably slow, and
-// signal masking is unreliable across fork-exec.) Signal delivery forbids
-// taking locks and allocating memory (which takes a lock). Explicit suspend and
-// resume means that the interrupt callback will not be executing on the
-// interrupted thread, making it meaningless to access TLS from within the
-// thread interrupt callback. Combining these limitations, thread interrupt
-// callbacks are forbidden from:
+// and Android, is SIGPROF. On Linux the SIGPROF can instead be sent by a perf
+// event of the thread itself (see --profiler_sample_event). The second, used
+// on Windows, Fuchsia, Mac and iOS, is explicit suspend and resume thread
+// system calls. (Although Mac supports SIGPROF, when the process is attached
+// to lldb, it becomes unusably slow, and signal masking is unreliable across
+// fork-exec.) Signal delivery forbids taking locks and allocating memory
+// (which takes a lock). Explicit suspend and resume means that the interrupt
+// callback will not be executing on the interrupted thread, making it
+// meaningless to access TLS from within the thread interrupt callback.
+// Combining these limitations, thread interrupt callbacks are forbidden from:
 //
 //   * Accessing TLS.
 //   * Allocating memory.
@@ -230,7 +231,7 @@ void ThreadInterrupter::ThreadMain(uword parameters) {
   }
 }
 
-#if !defined(DART_HOST_OS_ANDROID)
+#if !defined(DART_HOST_OS_ANDROID) && !defined(DART_HOST_OS_LINUX)
 void* ThreadInterrupter::PrepareCurrentThread() {
   return nullptr;
 }
@@ -5,8 +5,14 @@
 #include "platform/globals.h"
 #if defined(DART_HOST_OS_LINUX)
 
-#include <errno.h>  // NOLINT
+#include <errno.h>             // NOLINT
+#include <fcntl.h>             // NOLINT
+#include <linux/perf_event.h>  // NOLINT
+#include <sys/ioctl.h>         // NOLINT
+#include <sys/syscall.h>       // NOLINT
+#include <unistd.h>            // NOLINT
 
+#include "platform/utils.h"
 #include "vm/flags.h"
 #include "vm/os.h"
 #include "vm/profiler.h"
@@ -19,6 +25,20 @@ namespace dart {
 
 DECLARE_FLAG(bool, trace_thread_interrupter);
 
+DEFINE_FLAG(charp,
+            profiler_sample_event,
+            nullptr,
+            "Take profiler samples every --profiler_sample_event_period "
+            "occurrences of a perf event instead of on a timer: cycles, "
+            "instructions, cache-misses or task-clock (CPU time of the "
+            "thread in nanoseconds).");
+DEFINE_FLAG(int,
+            profiler_sample_event_period,
+            0,
+            "Number of perf events between profiler samples. The default is "
+            "1000000 for cycles, instructions and task-clock and 10000 for "
+            "cache-misses.");
+
 class ThreadInterrupterLinux : public AllStatic {
  public:
   static void ThreadInterruptSignalHandler(int signal,
@@ -31,6 +51,12 @@ class ThreadInterrupterLinux : public AllStatic {
     if (thread == nullptr) {
       return;
     }
+    if (info->si_code == POLL_IN &&
+        !thread->os_thread()->ThreadInterruptsEnabled()) {
+      // Unlike the interrupter thread, a perf event does not check whether
+      // the thread can be sampled.
+      return;
+    }
     ThreadInterruptScope signal_handler_scope;
     // Extract thread state.
     ucontext_t* context = reinterpret_cast<ucontext_t*>(context_);
@@ -43,9 +69,80 @@ class ThreadInterrupterLinux : public AllStatic {
     its.lr = SignalHandler::GetLinkRegister(mcontext);
     Profiler::SampleThread(thread, its);
   }
+
+  // Returns true if 'thread' is sampled on a perf event, rather than by the
+  // interrupter thread.
+  static bool SamplesOnPerfEvent(OSThread* thread) {
+    return thread->thread_interrupter_state_ != nullptr;
+  }
+
+  // Opens a sampling perf event for the current thread which delivers
+  // SIGPROF to it every 'period' events. Returns -1 if the event is unknown
+  // or perf events are not available, e.g. because of
+  // /proc/sys/kernel/perf_event_paranoid or seccomp.
+  static int OpenSampleEvent(const char* name, intptr_t period) {
+    struct perf_event_attr attr = {};
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    if (strcmp(name, "cycles") == 0) {
+      attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    } else if (strcmp(name, "instructions") == 0) {
+      attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    } else if (strcmp(name, "cache-misses") == 0) {
+      attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    } else if (strcmp(name, "task-clock") == 0) {
+      attr.type = PERF_TYPE_SOFTWARE;
+      attr.config = PERF_COUNT_SW_TASK_CLOCK;
+    } else {
+      OS::PrintErr("Unknown --profiler_sample_event: %s\n", name);
+      return -1;
+    }
+    if (period <= 0) {
+      period = (attr.type == PERF_TYPE_HARDWARE &&
+                attr.config == PERF_COUNT_HW_CACHE_MISSES)
+                   ? 10000
+                   : 1000000;
+    }
+    attr.sample_period = period;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    const pid_t tid = syscall(__NR_gettid);
+    const int fd = syscall(__NR_perf_event_open, &attr, tid, /*cpu=*/-1,
+                           /*group_fd=*/-1, PERF_FLAG_FD_CLOEXEC);
+    if (fd < 0) {
+      if (FLAG_trace_thread_interrupter) {
+        const int kBufferSize = 1024;
+        char error_buf[kBufferSize];
+        OS::PrintErr("ThreadInterrupter perf_event_open failed: %s\n",
+                     Utils::StrError(errno, error_buf, kBufferSize));
+      }
+      return -1;
+    }
+    // Every overflow notifies the owner of the descriptor. Make that the
+    // current thread, with SIGPROF instead of SIGIO.
+    struct f_owner_ex owner = {F_OWNER_TID, tid};
+    if (fcntl(fd, F_SETFL, O_ASYNC) != 0 || fcntl(fd, F_SETSIG, SIGPROF) != 0 ||
+        fcntl(fd, F_SETOWN_EX, &owner) != 0 ||
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0) != 0) {
+      CloseSampleEvent(fd);
+      return -1;
+    }
+    return fd;
+  }
+
+  // Stops the perf event before closing it, so that no more SIGPROFs are
+  // sent for it.
+  static void CloseSampleEvent(int fd) {
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    close(fd);
+  }
 };
 
 void ThreadInterrupter::InterruptThread(OSThread* thread) {
+  if (ThreadInterrupterLinux::SamplesOnPerfEvent(thread)) {
+    return;
+  }
   if (FLAG_trace_thread_interrupter) {
     OS::PrintErr("ThreadInterrupter interrupting %p\n",
                  reinterpret_cast<void*>(thread->id()));
@@ -62,6 +159,28 @@ void ThreadInterrupter::RemoveSignalHandler() {
   SignalHandler::Remove();
 }
 
+// With --profiler_sample_event the state is the perf event descriptor plus
+// one, so that nullptr means the thread is sampled on the timer.
+void* ThreadInterrupter::PrepareCurrentThread() {
+  if (FLAG_profiler_sample_event == nullptr || !thread_running_) {
+    // Without the signal handler, SIGPROF would terminate the process.
+    return nullptr;
+  }
+  const int fd = ThreadInterrupterLinux::OpenSampleEvent(
+      FLAG_profiler_sample_event, FLAG_profiler_sample_event_period);
+  if (fd < 0) {
+    return nullptr;
+  }
+  return reinterpret_cast<void*>(static_cast<intptr_t>(fd) + 1);
+}
+
+void ThreadInterrupter::CleanupCurrentThreadState(void* state) {
+  if (state != nullptr) {
+    ThreadInterrupterLinux::CloseSampleEvent(
+        static_cast<int>(reinterpret_cast<intptr_t>(state) - 1));
+  }
+}
+
 #endif  // !PRODUCT
 
 }  // namespace dart
@@ -14,6 +14,16 @@ DEFINE_FLAG(int,
             worker_timeout_millis,
             5000,
             "Free workers when they have been idle for this amount of time.");
+DEFINE_FLAG(bool,
+            background_gc_tasks,
+            false,
+            "Run concurrent marking and sweeping at background OS scheduling "
+            "priority, so they yield to isolates when the CPU is saturated.");
+DEFINE_FLAG(bool,
+            background_compiler_tasks,
+            false,
+            "Run background compilation at background OS scheduling priority, "
+            "so it yields to isolates when the CPU is saturated.");
 
 static int64_t ComputeTimeout(int64_t idle_start) {
   int64_t worker_timeout_micros =
@@ -34,6 +44,20 @@ static int64_t ComputeTimeout(int64_t idle_start) {
   }
 }
 
+static OSThread::Priority PriorityForTask(const ThreadPool::Task& task) {
+  switch (task.kind()) {
+    case ThreadPool::Task::kGC:
+      return FLAG_background_gc_tasks ? OSThread::kBackgroundPriority
+                                      : OSThread::kNormalPriority;
+    case ThreadPool::Task::kCompiler:
+      return FLAG_background_compiler_tasks ? OSThread::kBackgroundPriority
+                                            : OSThread::kNormalPriority;
+    case ThreadPool::Task::kDefault:
+      break;
+  }
+  return OSThread::kNormalPriority;
+}
+
 ThreadPool::ThreadPool(uintptr_t max_pool_size)
     : all_workers_dead_(false), max_pool_size_(max_pool_size) {}
 
@@ -200,6 +224,7 @@ void ThreadPool::WorkerLoop(Worker* worker) {
       while (!tasks_.IsEmpty()) {
         auto task = TakeNextAvailableTaskLocked();
         MutexUnlocker mls(&ml);
+        worker->SetPriority(PriorityForTask(*task));
         task->Run();
         ASSERT(Isolate::Current() == nullptr);
         task.reset();  // Delete the task while unlocked.
@@ -329,6 +354,14 @@ ThreadPool::Worker* ThreadPool::ScheduleTaskLocked(std::unique_ptr<Task> task) {
 ThreadPool::Worker::Worker(ThreadPool* pool)
     : pool_(pool), join_id_(OSThread::kInvalidThreadJoinId) {}
 
+void ThreadPool::Worker::SetPriority(OSThread::Priority priority) {
+  // If the hint cannot be applied the thread keeps running at its current
+  // priority, and we retry on the next change.
+  if (priority != priority_ && OSThread::SetCurrentThreadPriority(priority)) {
+    priority_ = priority;
+  }
+}
+
 void ThreadPool::Worker::StartThread() {
   int result = OSThread::Start("DartWorker", &Worker::Main,
                                reinterpret_cast<uword>(this));
@@ -26,11 +26,22 @@ class ThreadPool {
     Task() {}
 
    public:
+    // What kind of work a task does. Tasks which do GC or compilation work
+    // concurrently with the mutator can be run at background priority (see
+    // --background_gc_tasks and --background_compiler_tasks).
+    enum Kind {
+      kDefault,
+      kGC,
+      kCompiler,
+    };
+
     virtual ~Task() {}
 
     // Override this to provide task-specific behavior.
     virtual void Run() = 0;
 
+    virtual Kind kind() const { return kDefault; }
+
    private:
     DISALLOW_COPY_AND_ASSIGN(Task);
   };
@@ -98,6 +109,10 @@ class ThreadPool {
 
     void Wakeup() { wakeup_cv_.Notify(); }
 
+    // Changes the scheduling priority of the worker's thread. Must be called
+    // on that thread.
+    void SetPriority(OSThread::Priority priority);
+
     // The main entry point for new worker threads.
     static void Main(uword args);
 
@@ -107,6 +122,7 @@ class ThreadPool {
     ThreadJoinId join_id_;
     OSThread* os_thread_ = nullptr;
     bool is_blocked_ = false;
+    OSThread::Priority priority_ = OSThread::kNormalPriority;
     ConditionVariable wakeup_cv_;
 
     DISALLOW_COPY_AND_ASSIGN(Worker);
@@ -3,12 +3,19 @@
 // BSD-style license that can be found in the LICENSE file.
 
 #include "vm/thread_pool.h"
+
+#if defined(DART_HOST_OS_LINUX)
+#include <sched.h>  // NOLINT
+#endif
+
 #include "vm/lockers.h"
 #include "vm/os.h"
 #include "vm/unit_test.h"
 
 namespace dart {
 
+DECLARE_FLAG(bool, background_compiler_tasks);
+DECLARE_FLAG(bool, background_gc_tasks);
 DECLARE_FLAG(int, worker_timeout_millis);
 
 // Some of these tests change VM flags, so they should run without a full VM
@@ -207,6 +214,63 @@ THREAD_POOL_UNIT_TEST_CASE(ThreadPool_WorkerTimeout) {
   FLAG_worker_timeout_millis = saved_timeout;
 }
 
+class KindTestTask : public TestTask {
+ public:
+  KindTestTask(Kind kind, Monitor* sync, bool* done, int* policy)
+      : TestTask(sync, done), kind_(kind), policy_(policy) {}
+
+  virtual Kind kind() const { return kind_; }
+
+  virtual void Run() {
+#if defined(DART_HOST_OS_LINUX)
+    *policy_ = sched_getscheduler(0);
+#endif
+    TestTask::Run();
+  }
+
+ private:
+  Kind kind_;
+  int* policy_;
+};
+
+THREAD_POOL_UNIT_TEST_CASE(ThreadPool_BackgroundPriority) {
+  SetFlagScope<bool> sfs_gc(&FLAG_background_gc_tasks, true);
+  SetFlagScope<bool> sfs_compiler(&FLAG_background_compiler_tasks, true);
+
+#if defined(DART_HOST_OS_LINUX)
+  // Workers inherit the policy of this thread. Other policies are left alone.
+  const bool check_policy = sched_getscheduler(0) == SCHED_OTHER;
+#endif
+
+  // Tasks of different kinds reuse the same worker, which switches its
+  // priority back and forth.
+  ThreadPool thread_pool;
+  const ThreadPool::Task::Kind kinds[] = {
+      ThreadPool::Task::kGC, ThreadPool::Task::kDefault,
+      ThreadPool::Task::kCompiler, ThreadPool::Task::kDefault};
+  for (auto kind : kinds) {
+    Monitor sync;
+    bool done = true;
+    int policy = -1;
+    thread_pool.Run<KindTestTask>(kind, &sync, &done, &policy);
+    {
+      MonitorLocker ml(&sync);
+      done = false;
+      ml.Notify();
+      while (!done) {
+        ml.Wait();
+      }
+    }
+    EXPECT(done);
+#if defined(DART_HOST_OS_LINUX)
+    if (check_policy) {
+      EXPECT_EQ(kind == ThreadPool::Task::kDefault ? SCHED_OTHER : SCHED_BATCH,
+                policy);
+    }
+#endif
+  }
+}
+
 class SpawnTask : public ThreadPool::Task {
  public:
   SpawnTask(ThreadPool* pool, Monitor* sync, int todo, int total, int* done)
@@ -82,6 +82,12 @@ DEFINE_FLAG(charp,
             DEFAULT_TIMELINE_RECORDER,
             "Select the timeline recorder used. "
             "Valid values: none, " SUPPORTED_TIMELINE_RECORDERS)
+DEFINE_FLAG(int,
+            timeline_file_max_pending_events,
+            0,
+            "Maximum number of events the file and perfetto recorders queue "
+            "while their output, e.g. a pipe, is not keeping up. Further "
+            "events are dropped. 0 means unlimited.");
 
 // Implementation notes:
 //
@@ -1353,59 +1359,60 @@ TimelineEvent* TimelineEventRecorder::ThreadBlockStartEvent() {
   // Grab the current thread.
   OSThread* thread = OSThread::Current();
   ASSERT(thread != nullptr);
-  // Acquire the recorder lock in case we need to call |GetNewBlockLocked|. We
-  // acquire the lock here and not directly before calls to |GetNewBlockLocked|
-  // due to locking order restrictions.
-  Mutex& recorder_lock = lock_;
-  recorder_lock.Lock();
   Mutex* thread_block_lock = thread->timeline_block_lock();
   ASSERT(thread_block_lock != nullptr);
   // We are accessing the thread's timeline block- so take the lock here.
   // This lock will be held until the call to |CompleteEvent| is made.
+  // Taking a block away from a thread (|GetNewBlockLocked| of the ring
+  // recorder, |Timeline::ReclaimCachedBlocksFromThreads|) also requires this
+  // lock, so it is enough to start an event in a block that is not full.
   thread_block_lock->Lock();
-#if defined(DEBUG)
-  Thread* T = Thread::Current();
-  if (T != nullptr) {
-    T->IncrementNoSafepointScopeDepth();
-  }
-#endif  // defined(DEBUG)
-
   TimelineEventBlock* thread_block = thread->TimelineBlockLocked();
-
-  if ((thread_block != nullptr) && thread_block->IsFull()) {
-    // Thread has a block and it is full:
-    // 1) Mark it as finished.
-    thread->SetTimelineBlockLocked(nullptr);
-    FinishBlock(thread_block);
-    // 2) Allocate a new block.
-    // We release |thread_block_lock| before calling |GetNewBlockLocked| to
-    // avoid TSAN warnings about lock order inversion.
-    thread_block_lock->Unlock();
-    thread_block = GetNewBlockLocked();
-    thread_block_lock->Lock();
-    thread->SetTimelineBlockLocked(thread_block);
-  } else if (thread_block == nullptr) {
-    // Thread has no block. Attempt to allocate one.
-    // We release |thread_block_lock| before calling |GetNewBlockLocked| to
-    // avoid TSAN warnings about lock order inversion.
+  if ((thread_block == nullptr) || thread_block->IsFull()) {
+    // Acquire the recorder lock in case we need to call |GetNewBlockLocked|.
+    // Locking order requires it to be acquired before the thread's block
+    // lock, and the block may have changed while neither lock was held.
     thread_block_lock->Unlock();
-    thread_block = GetNewBlockLocked();
+    Mutex& recorder_lock = lock_;
+    recorder_lock.Lock();
     thread_block_lock->Lock();
-    thread->SetTimelineBlockLocked(thread_block);
+    thread_block = thread->TimelineBlockLocked();
+    if ((thread_block != nullptr) && thread_block->IsFull()) {
+      // Thread has a block and it is full:
+      // 1) Mark it as finished.
+      thread->SetTimelineBlockLocked(nullptr);
+      FinishBlock(thread_block);
+      // 2) Allocate a new block.
+      // We release |thread_block_lock| before calling |GetNewBlockLocked| to
+      // avoid TSAN warnings about lock order inversion.
+      thread_block_lock->Unlock();
+      thread_block = GetNewBlockLocked();
+      thread_block_lock->Lock();
+      thread->SetTimelineBlockLocked(thread_block);
+    } else if (thread_block == nullptr) {
+      // Thread has no block. Attempt to allocate one.
+      // We release |thread_block_lock| before calling |GetNewBlockLocked| to
+      // avoid TSAN warnings about lock order inversion.
+      thread_block_lock->Unlock();
+      thread_block = GetNewBlockLocked();
+      thread_block_lock->Lock();
+      thread->SetTimelineBlockLocked(thread_block);
+    }
+    recorder_lock.Unlock();
   }
-  recorder_lock.Unlock();
   if (thread_block != nullptr) {
+#if defined(DEBUG)
+    Thread* T = Thread::Current();
+    if (T != nullptr) {
+      T->IncrementNoSafepointScopeDepth();
+    }
+#endif  // defined(DEBUG)
     // NOTE: We are exiting this function with the thread's block lock held.
     ASSERT(!thread_block->IsFull());
     TimelineEvent* event = thread_block->StartEventLocked();
     return event;
   }
-// Drop lock here as no event is being handed out.
-#if defined(DEBUG)
-  if (T != nullptr) {
-    T->DecrementNoSafepointScopeDepth();
-  }
-#endif  // defined(DEBUG)
+  // Drop lock here as no event is being handed out.
   thread_block_lock->Unlock();
   return nullptr;
 }
@@ -1983,6 +1990,8 @@ TimelineEventFileRecorderBase::TimelineEventFileRecorderBase(const char* path)
       monitor_(),
       head_(nullptr),
       tail_(nullptr),
+      pending_(0),
+      dropped_(0),
       file_(nullptr),
       shutting_down_(false),
       drained_(false),
@@ -2019,6 +2028,12 @@ TimelineEventFileRecorderBase::~TimelineEventFileRecorderBase() {
 
   ASSERT(head_ == nullptr);
   ASSERT(tail_ == nullptr);
+  if (dropped_ > 0) {
+    OS::PrintErr("warning: Dropped %" Pd
+                 " timeline events, see "
+                 "--timeline_file_max_pending_events.\n",
+                 dropped_);
+  }
 
   Dart_FileCloseCallback file_close = Dart::file_close_callback();
   (*file_close)(file_);
@@ -2042,6 +2057,7 @@ void TimelineEventFileRecorderBase::Drain() {
     if (next == nullptr) {
       tail_ = nullptr;
     }
+    pending_--;
     ml.Exit();
     {
       DrainImpl(*event);
@@ -2070,6 +2086,15 @@ void TimelineEventFileRecorderBase::CompleteEvent(TimelineEvent* event) {
 
   MonitorLocker ml(&monitor_);
   ASSERT(!shutting_down_);
+  if ((FLAG_timeline_file_max_pending_events > 0) &&
+      (pending_ >= FLAG_timeline_file_max_pending_events) &&
+      (event->event_type() != TimelineEvent::kMetadata)) {
+    // Keep thread names, which are needed to make sense of the trace.
+    dropped_++;
+    delete event;
+    return;
+  }
+  pending_++;
   event->set_next(nullptr);
   if (tail_ == nullptr) {
     head_ = tail_ = event;
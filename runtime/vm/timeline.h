@@ -1262,6 +1262,11 @@ class TimelineEventFileRecorderBase : public TimelineEventPlatformRecorder {
   Monitor monitor_;
   TimelineEvent* head_;
   TimelineEvent* tail_;
+  // The number of events between |head_| and |tail_|.
+  intptr_t pending_;
+  // The number of events dropped because |pending_| reached
+  // --timeline_file_max_pending_events.
+  intptr_t dropped_;
   void* file_;
   bool shutting_down_;
   bool drained_;
@@ -673,12 +673,17 @@ void TypeTestingStubGenerator::
 
       type_arg = ta.TypeAt(i);
       ASSERT(type_arg.IsTypeParameter() ||
-             hi->CanUseSubtypeRangeCheckFor(type_arg));
+             hi->CanUseSubtypeRangeCheckFor(type_arg) ||
+             hi->CanUseTypeArgumentIdentityCheckFor(type_arg));
 
       if (type_arg.IsTypeParameter()) {
         BuildOptimizedTypeParameterArgumentValueCheck(
             assembler, hi, TypeParameter::Cast(type_arg),
             type_param_value_offset_i, &pop_saved_registers_on_failure);
+      } else if (!hi->CanUseSubtypeRangeCheckFor(type_arg)) {
+        BuildOptimizedTypeArgumentIdentityCheck(
+            assembler, type_arg, type_param_value_offset_i,
+            &pop_saved_registers_on_failure);
       } else {
         BuildOptimizedTypeArgumentValueCheck(
             assembler, hi, Type::Cast(type_arg), type_param_value_offset_i,
@@ -1257,6 +1262,29 @@ void TypeTestingStubGenerator::BuildOptimizedTypeArgumentValueCheck(
   __ Bind(&is_subtype);
 }
 
+void TypeTestingStubGenerator::BuildOptimizedTypeArgumentIdentityCheck(
+    compiler::Assembler* assembler,
+    const AbstractType& type,
+    intptr_t type_param_value_offset_i,
+    compiler::Label* check_failed) {
+  ASSERT(type.IsInstantiated() && type.IsCanonical());
+  if (assembler->EmittingComments()) {
+    TextBuffer buffer(128);
+    buffer.Printf("Generating identity check for type argument %" Pd ": ",
+                  type_param_value_offset_i);
+    type.PrintName(Object::kScrubbedName, &buffer);
+    __ Comment("%s", buffer.buffer());
+  }
+  __ LoadCompressedFieldFromOffset(
+      TTSInternalRegs::kSubTypeArgumentReg,
+      TTSInternalRegs::kInstanceTypeArgumentsReg,
+      compiler::target::TypeArguments::type_at_offset(
+          type_param_value_offset_i));
+  // Other type arguments may be subtypes too, the STC/runtime handles them.
+  __ CompareObject(TTSInternalRegs::kSubTypeArgumentReg, type);
+  __ BranchIf(NOT_EQUAL, check_failed);
+}
+
 void RegisterTypeArgumentsUse(const Function& function,
                               TypeUsageInfo* type_usage_info,
                               const Class& klass,
@@ -124,6 +124,12 @@ class TypeTestingStubGenerator {
       intptr_t type_param_value_offset_i,
       compiler::Label* check_failed);
 
+  static void BuildOptimizedTypeArgumentIdentityCheck(
+      compiler::Assembler* assembler,
+      const AbstractType& type,
+      intptr_t type_param_value_offset_i,
+      compiler::Label* check_failed);
+
 #endif  // !defined(DART_PRECOMPILED_RUNTIME)
 #endif  // !defined(TARGET_ARCH_IA32)
 
@@ -1118,6 +1118,8 @@ ISOLATE_UNIT_TEST_CASE(TTS_GenericSubtypeRangeCheck) {
   //                                     // equality for instantiator type arg T
   //   obj as Base<B>                    // Subclass ranges for Base, type
   //                                     // equality for function type arg B.
+  //   obj as Base<A2<A1>>               // Subclass ranges for Base, pointer
+  //                                     // equality for canonical A2<A1>.
   //
 
   // <...> as Base<I<Object, dynamic>>
@@ -1157,6 +1159,20 @@ ISOLATE_UNIT_TEST_CASE(TTS_GenericSubtypeRangeCheck) {
   RunTTSTest(type_base_b, {obj_base_int, tav_null, tav_null});
   RunTTSTest(type_base_b, Failure({obj_i2, tav_null, tav_null}));
 
+  //   <...> as Base<A2<A1>>
+  const auto& tav_a1 = TypeArguments::Handle(TypeArguments::New(1));
+  tav_a1.SetTypeAt(0, type_a1);
+  auto& type_a2_a1 = Type::Handle(Type::New(class_a2, tav_a1));
+  FinalizeAndCanonicalize(&type_a2_a1);
+  const auto& tav_a2_a1 = TypeArguments::Handle(TypeArguments::New(1));
+  tav_a2_a1.SetTypeAt(0, type_a2_a1);
+  auto& type_base_a2_a1 = Type::Handle(Type::New(class_base, tav_a2_a1));
+  type_base_a2_a1 =
+      type_base_a2_a1.ToNullability(Nullability::kNonNullable, Heap::kNew);
+  FinalizeAndCanonicalize(&type_base_a2_a1);
+  RunTTSTest(type_base_a2_a1, {obj_basea2a1, tav_null, tav_null});
+  RunTTSTest(type_base_a2_a1, Failure({obj_basea2int, tav_null, tav_null}));
+
   // We generate TTS for implemented classes and uninstantiated types, but
   // any class that implements the type class but does not match in both
   // instance TAV offset and type argument indices is guaranteed to be a
@@ -1164,7 +1180,6 @@ ISOLATE_UNIT_TEST_CASE(TTS_GenericSubtypeRangeCheck) {
   //
   //   obj as I<dynamic, String>       // I is generic & implemented.
   //   obj as Base<A2<T>>              // A2<T> is not instantiated.
-  //   obj as Base<A2<A1>>             // A2<A1> is not a rare type.
   //
 
   //   <...> as I<dynamic, String>
@@ -1193,21 +1208,6 @@ ISOLATE_UNIT_TEST_CASE(TTS_GenericSubtypeRangeCheck) {
   RunTTSTest(type_base_a2_t,
              FalseNegative({obj_basea2int, tav_null, tav_null}));
   RunTTSTest(type_base_a2_t, Failure({obj_base_int, tav_null, tav_null}));
-
-  //   <...> as Base<A2<A1>>
-  const auto& tav_a1 = TypeArguments::Handle(TypeArguments::New(1));
-  tav_a1.SetTypeAt(0, type_a1);
-  auto& type_a2_a1 = Type::Handle(Type::New(class_a2, tav_a1));
-  FinalizeAndCanonicalize(&type_a2_a1);
-  const auto& tav_a2_a1 = TypeArguments::Handle(TypeArguments::New(1));
-  tav_a2_a1.SetTypeAt(0, type_a2_a1);
-  auto& type_base_a2_a1 = Type::Handle(Type::New(class_base, tav_a2_a1));
-  type_base_a2_a1 =
-      type_base_a2_a1.ToNullability(Nullability::kNonNullable, Heap::kNew);
-  FinalizeAndCanonicalize(&type_base_a2_a1);
-  RunTTSTest(type_base_a2_a1,
-             FalseNegative({obj_basea2a1, tav_null, tav_null}));
-  RunTTSTest(type_base_a2_a1, Failure({obj_basea2int, tav_null, tav_null}));
 }
 
 const char* kRecordSubtypeRangeCheckScript =
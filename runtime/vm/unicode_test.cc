@@ -1090,4 +1090,47 @@ ISOLATE_UNIT_TEST_CASE(Utf8Decode) {
   }
 }
 
+ISOLATE_UNIT_TEST_CASE(Utf8DecodeAsciiRuns) {
+  // ASCII runs of different lengths and alignments around multi-byte
+  // sequences, which are skipped a word at a time.
+  for (intptr_t prefix = 0; prefix < 20; prefix++) {
+    char src[64];
+    memset(src, 'a', prefix);
+    // U+00E6, 'b', U+2603, then a run of 17 ASCII characters.
+    const char* suffix = "\xC3\xA6" "b" "\xE2\x98\x83" "cdefghijklmnopqrs";
+    strncpy(&src[prefix], suffix, sizeof(src) - prefix);
+    const uint8_t* utf8 = reinterpret_cast<const uint8_t*>(src);
+    const intptr_t utf8_len = strlen(src);
+    EXPECT(Utf8::IsValid(utf8, utf8_len));
+
+    Utf8::Type type;
+    const intptr_t len = Utf8::CodeUnitCount(utf8, utf8_len, &type);
+    EXPECT_EQ(prefix + 20, len);
+    EXPECT_EQ(Utf8::kBMP, type);
+
+    uint16_t dst[64];
+    EXPECT(Utf8::DecodeToUTF16(utf8, utf8_len, dst, len));
+    for (intptr_t i = 0; i < prefix; i++) {
+      EXPECT_EQ('a', dst[i]);
+    }
+    EXPECT_EQ(0xE6, dst[prefix]);
+    EXPECT_EQ('b', dst[prefix + 1]);
+    EXPECT_EQ(0x2603, dst[prefix + 2]);
+    EXPECT_EQ('s', dst[len - 1]);
+    EXPECT(!Utf8::DecodeToUTF16(utf8, utf8_len, dst, len - 1));
+
+    // A trail byte without a lead byte after the ASCII prefix.
+    src[prefix] = '\xA6';
+    EXPECT(!Utf8::IsValid(utf8, utf8_len));
+
+    // Latin-1 only.
+    src[prefix] = 'x';
+    src[prefix + 1] = 'y';
+    uint8_t latin1[64];
+    EXPECT(Utf8::DecodeToLatin1(utf8, prefix + 3, latin1, prefix + 3));
+    EXPECT_EQ('y', latin1[prefix + 1]);
+    EXPECT(!Utf8::DecodeToLatin1(utf8, prefix + 3, latin1, prefix + 2));
+  }
+}
+
 }  // namespace dart
@@ -31,6 +31,25 @@ void VirtualMemory::Truncate(intptr_t new_size) {
   region_.Subregion(region_, 0, new_size);
 }
 
+bool VirtualMemory::supports_huge_pages_ = false;
+
+void VirtualMemory::Split(VirtualMemory* memory,
+                          intptr_t piece_size,
+                          VirtualMemory** pieces) {
+  ASSERT(SupportsHugePages());
+  ASSERT(memory->vm_owns_region());
+  ASSERT(memory->reserved_.size() == memory->region_.size());
+  ASSERT(Utils::IsAligned(memory->size(), piece_size));
+  for (intptr_t i = 0, n = memory->size() / piece_size; i < n; i++) {
+    MemoryRegion piece(reinterpret_cast<void*>(memory->start() + i * piece_size),
+                       piece_size);
+    pieces[i] = new VirtualMemory(piece, piece);
+  }
+  // The pieces now own the mapping.
+  memory->reserved_ = MemoryRegion();
+  delete memory;
+}
+
 VirtualMemory* VirtualMemory::ForImagePage(void* pointer, uword size) {
   // Memory for precompilated instructions was allocated by the embedder, so
   // create a VirtualMemory without allocating.
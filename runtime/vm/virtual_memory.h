@@ -49,6 +49,21 @@ class VirtualMemory {
 
   static void DontNeed(void* address, intptr_t size);
 
+  // Whether AdviseHugePages can succeed on this host. False if the OS has no
+  // transparent huge page support or it has been disabled by the system.
+  static bool SupportsHugePages() { return supports_huge_pages_; }
+
+  // Asks the OS to back [address, address + size) with huge pages. Returns
+  // false if the request was refused; the memory remains usable either way.
+  static bool AdviseHugePages(void* address, intptr_t size);
+
+  // Divides 'memory' into 'memory->size() / piece_size' pieces that each own
+  // and release their part of the mapping independently. 'memory' is
+  // consumed. Only valid if SupportsHugePages().
+  static void Split(VirtualMemory* memory,
+                    intptr_t piece_size,
+                    VirtualMemory** pieces);
+
   // Reserves and commits a virtual memory segment with size. If a segment of
   // the requested size cannot be allocated, nullptr is returned.
   static VirtualMemory* Allocate(intptr_t size,
@@ -117,6 +132,7 @@ class VirtualMemory {
   MemoryRegion reserved_;
 
   static uword page_size_;
+  static bool supports_huge_pages_;
   static VirtualMemory* compressed_heap_;
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(VirtualMemory);
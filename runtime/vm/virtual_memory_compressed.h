@@ -12,8 +12,11 @@
 namespace dart {
 
 #if defined(DART_COMPRESSED_POINTERS)
-static constexpr intptr_t kCompressedHeapSize = 4 * GB;
-static constexpr intptr_t kCompressedHeapAlignment = 4 * GB;
+static constexpr intptr_t kCompressedHeapSize =
+    static_cast<intptr_t>(1) << kCompressedHeapSizeLog2;
+static constexpr intptr_t kCompressedHeapAlignment = kCompressedHeapSize;
+static_assert(kCompressedHeapSize == 4 * GB,
+              "Compressed pointers are unshifted 32-bit offsets");
 static constexpr intptr_t kCompressedPageSize = kPageSize;
 static constexpr intptr_t kCompressedHeapNumPages =
     kCompressedHeapSize / kPageSize;
@@ -189,6 +189,17 @@ void VirtualMemory::Init() {
 #endif  // defined(DART_COMPRESSED_POINTERS)
 
 #if defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)
+  // Transparent huge pages are available unless the kernel was built without
+  // them or they are disabled ("[never]").
+  FILE* thp = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+  if (thp != nullptr) {
+    char mode[128];
+    if (fgets(mode, sizeof(mode), thp) != nullptr) {
+      supports_huge_pages_ = strstr(mode, "[never]") == nullptr;
+    }
+    fclose(thp);
+  }
+
   FILE* fp = fopen("/proc/sys/vm/max_map_count", "r");
   if (fp != nullptr) {
     size_t max_map_count = 0;
@@ -431,6 +442,22 @@ void VirtualMemory::Protect(void* address, intptr_t size, Protection mode) {
            end_address - page_address, prot);
 }
 
+bool VirtualMemory::AdviseHugePages(void* address, intptr_t size) {
+#if (defined(DART_HOST_OS_LINUX) || defined(DART_HOST_OS_ANDROID)) &&           \
+    defined(MADV_HUGEPAGE)
+  if (!supports_huge_pages_) {
+    return false;
+  }
+  if (madvise(address, size, MADV_HUGEPAGE) != 0) {
+    LOG_INFO("madvise(%p, 0x%" Px ", MADV_HUGEPAGE) failed\n", address, size);
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
 void VirtualMemory::DontNeed(void* address, intptr_t size) {
   uword start_address = reinterpret_cast<uword>(address);
   uword end_address = start_address + size;
@@ -136,4 +136,36 @@ VM_UNIT_TEST_CASE(DuplicateRXVirtualMemory) {
 
 #endif  // !defined(DART_TARGET_OS_FUCHSIA)
 
+VM_UNIT_TEST_CASE(SplitHugePageVirtualMemory) {
+  if (!VirtualMemory::SupportsHugePages()) {
+    return;
+  }
+  const intptr_t kHugePageSize = 2 * MB;
+  const intptr_t kPieces = kHugePageSize / kPageSize;
+  VirtualMemory* vm = VirtualMemory::AllocateAligned(
+      kHugePageSize, kHugePageSize, false, false, "test");
+  EXPECT(vm != nullptr);
+  EXPECT(Utils::IsAligned(vm->start(), kHugePageSize));
+  // The advice may be refused; the memory must be usable either way.
+  VirtualMemory::AdviseHugePages(vm->address(), vm->size());
+  const uword start = vm->start();
+
+  VirtualMemory* pieces[kPieces];
+  VirtualMemory::Split(vm, kPageSize, pieces);
+  for (intptr_t i = 0; i < kPieces; i++) {
+    EXPECT_EQ(start + i * kPageSize, pieces[i]->start());
+    EXPECT_EQ(kPageSize, pieces[i]->size());
+    EXPECT(pieces[i]->vm_owns_region());
+    reinterpret_cast<char*>(pieces[i]->address())[0] = 'a';
+  }
+  // Pieces are released independently and out of order.
+  for (intptr_t i = kPieces - 1; i >= 0; i -= 2) {
+    delete pieces[i];
+  }
+  for (intptr_t i = kPieces - 2; i >= 0; i -= 2) {
+    EXPECT_EQ('a', reinterpret_cast<char*>(pieces[i]->address())[0]);
+    delete pieces[i];
+  }
+}
+
 }  // namespace dart
@@ -243,6 +243,12 @@ void VirtualMemory::Protect(void* address, intptr_t size, Protection mode) {
 
 void VirtualMemory::DontNeed(void* address, intptr_t size) {}
 
+bool VirtualMemory::AdviseHugePages(void* address, intptr_t size) {
+  // Large pages on Windows require SeLockMemoryPrivilege and must be
+  // requested at reservation time.
+  return false;
+}
+
 }  // namespace dart
 
 #endif  // defined(DART_HOST_OS_WINDOWS)
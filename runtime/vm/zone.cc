@@ -55,6 +55,14 @@ static Mutex* segment_cache_mutex = nullptr;
 static VirtualMemory* segment_cache[kSegmentCacheCapacity] = {nullptr};
 static intptr_t segment_cache_size = 0;
 
+// Large zones, such as those of big compilations, grow by super page sized
+// segments. Cache a few of them as well, so that compiling one large function
+// after another does not map, fault in and unmap the same memory each time.
+static constexpr intptr_t kSuperPageSize = 2 * MB;
+static constexpr intptr_t kSuperPageCacheCapacity = 2;  // 4 MB of Segments
+static VirtualMemory* super_page_cache[kSuperPageCacheCapacity] = {nullptr};
+static intptr_t super_page_cache_size = 0;
+
 void Zone::Init() {
   ASSERT(segment_cache_mutex == nullptr);
   segment_cache_mutex = new Mutex();
@@ -71,8 +79,15 @@ void Zone::ClearCache() {
   ASSERT(segment_cache_size >= 0);
   ASSERT(segment_cache_size <= kSegmentCacheCapacity);
   while (segment_cache_size > 0) {
+    total_size_.fetch_sub(kSegmentSize);
     delete segment_cache[--segment_cache_size];
   }
+  ASSERT(super_page_cache_size >= 0);
+  ASSERT(super_page_cache_size <= kSuperPageCacheCapacity);
+  while (super_page_cache_size > 0) {
+    total_size_.fetch_sub(kSuperPageSize);
+    delete super_page_cache[--super_page_cache_size];
+  }
 }
 
 Zone::Segment* Zone::Segment::New(intptr_t size, Zone::Segment* next) {
@@ -85,6 +100,13 @@ Zone::Segment* Zone::Segment::New(intptr_t size, Zone::Segment* next) {
     if (segment_cache_size > 0) {
       memory = segment_cache[--segment_cache_size];
     }
+  } else if (size == kSuperPageSize) {
+    MutexLocker ml(segment_cache_mutex);
+    ASSERT(super_page_cache_size >= 0);
+    ASSERT(super_page_cache_size <= kSuperPageCacheCapacity);
+    if (super_page_cache_size > 0) {
+      memory = super_page_cache[--super_page_cache_size];
+    }
   }
   if (memory == nullptr) {
     bool executable = false;
@@ -132,6 +154,14 @@ void Zone::Segment::DeleteSegmentList(Segment* head) {
         segment_cache[segment_cache_size++] = memory;
         memory = nullptr;
       }
+    } else if (size == kSuperPageSize) {
+      MutexLocker ml(segment_cache_mutex);
+      ASSERT(super_page_cache_size >= 0);
+      ASSERT(super_page_cache_size <= kSuperPageCacheCapacity);
+      if (super_page_cache_size < kSuperPageCacheCapacity) {
+        super_page_cache[super_page_cache_size++] = memory;
+        memory = nullptr;
+      }
     }
     if (memory != nullptr) {
       total_size_.fetch_sub(size);
@@ -223,7 +253,6 @@ uword Zone::AllocateExpand(intptr_t size) {
     return AllocateLargeSegment(size);
   }
 
-  const intptr_t kSuperPageSize = 2 * MB;
   intptr_t next_size;
   if (small_segment_capacity_ < kSuperPageSize) {
     // When the Zone is small, grow linearly to reduce size and use the segment
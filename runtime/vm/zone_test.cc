@@ -255,6 +255,28 @@ ISOLATE_UNIT_TEST_CASE(StressMallocThroughZones) {
 #endif
 }
 
+ISOLATE_UNIT_TEST_CASE(ZoneSegmentCache) {
+  // Grows a zone just past 2MB, so it ends with one super page sized
+  // segment, and returns the address of its last allocation, which is in
+  // that segment.
+  auto fill_zone = [&]() {
+    StackZone stack_zone(thread);
+    Zone* zone = stack_zone.GetZone();
+    uword last = 0;
+    for (intptr_t i = 0; i < (3 * MB) / KB; i++) {
+      last = zone->AllocUnsafe(KB);
+    }
+    EXPECT(zone->SizeInBytes() > static_cast<uintptr_t>(2 * MB));
+    return last;
+  };
+  Zone::ClearCache();
+  const uword first = fill_zone();
+  // The second zone allocates the same way and reuses the cached segment of
+  // the first one, so its last allocation has the same address.
+  EXPECT_EQ(first, fill_zone());
+  Zone::ClearCache();
+}
+
 #if defined(DART_COMPRESSED_POINTERS)
 ISOLATE_UNIT_TEST_CASE(ZonesNotLimitedByCompressedHeap) {
   StackZone stack_zone(Thread::Current());
@@ -111,6 +111,8 @@ base class _RandomAccessFileOpsImpl extends NativeFieldWrapperClass1
   external flush();
   @pragma("vm:external-name", "File_Lock")
   external lock(int lock, int start, int end);
+  @pragma("vm:external-name", "File_Map")
+  external map(int start, int length);
 }
 
 class _WatcherPath {
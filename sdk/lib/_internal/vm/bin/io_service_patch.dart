@@ -25,6 +25,7 @@ class _IOService {
     final Completer completer = new Completer();
     try {
       _ensureInitialize();
+      if (_messageMap.isEmpty) _receivePort!.keepIsolateAlive = true;
       _messageMap[id] = completer;
       _port.send(<dynamic>[id, _replyToPort, request, data]);
     } catch (error) {
@@ -50,10 +51,12 @@ class _IOService {
     }
   }
 
+  // The reply port is kept open between requests, so that a sequence of
+  // awaited requests does not allocate and close a port for each of them.
+  // It only keeps the isolate alive while there are pending requests.
   static void _finalize() {
     _id = 0;
-    _receivePort!.close();
-    _receivePort = null;
+    _receivePort!.keepIsolateAlive = false;
   }
 
   static int _getNextId() {
@@ -63,12 +63,14 @@ class _SecureSocket extends _Socket implements SecureSocket {
 base class _SecureFilterImpl extends NativeFieldWrapperClass1
     implements _SecureFilter {
   // Performance is improved if a full buffer of plaintext fits
-  // in the encrypted buffer, when encrypted.
+  // in the encrypted buffer, when encrypted. SIZE is the maximum plaintext
+  // of a TLS record, and ENCRYPTED_SIZE leaves room for the record header,
+  // padding and MAC, so a full record is processed in a single pass.
   // SIZE and ENCRYPTED_SIZE are referenced from C++.
   @pragma("vm:entry-point")
-  static final int SIZE = 8 * 1024;
+  static final int SIZE = 16 * 1024;
   @pragma("vm:entry-point")
-  static final int ENCRYPTED_SIZE = 10 * 1024;
+  static final int ENCRYPTED_SIZE = 18 * 1024;
 
   _SecureFilterImpl._() {
     buffers = <_ExternalBuffer>[
@@ -512,8 +512,44 @@ base class _NativeSocket extends _NativeSocketNativeWrapper
   // a HttpServer, a WebSocket connection, a process pipe, etc.
   Object? owner;
 
+  // Lookups of the same host and type which are in progress at the same time
+  // share one request to the IOService. Results are not kept after the
+  // lookup completes, since getaddrinfo does not report the TTL of records.
+  static final _pendingLookups =
+      <(String, int), List<Completer<List<InternetAddress>>>>{};
+
   static Future<List<InternetAddress>> lookup(String host,
       {InternetAddressType type = InternetAddressType.any}) {
+    final key = (host, type._value);
+    // Every caller gets its own completer, so results and errors are
+    // delivered in the caller's zone.
+    final completer = Completer<List<InternetAddress>>();
+    final waiting = _pendingLookups[key];
+    if (waiting != null) {
+      waiting.add(completer);
+      return completer.future;
+    }
+    final completers = _pendingLookups[key] = [completer];
+    // The shared request belongs to none of the callers' zones.
+    Zone.root.run(() {
+      _lookup(host, type).then((addresses) {
+        _pendingLookups.remove(key);
+        for (final completer in completers) {
+          // Every caller gets its own list.
+          completer.complete(addresses.toList());
+        }
+      }, onError: (Object error, StackTrace stackTrace) {
+        _pendingLookups.remove(key);
+        for (final completer in completers) {
+          completer.completeError(error, stackTrace);
+        }
+      });
+    });
+    return completer.future;
+  }
+
+  static Future<List<InternetAddress>> _lookup(
+      String host, InternetAddressType type) {
     return _IOService._dispatch(_IOService.socketLookup, [host, type._value])
         .then((response) {
       if (isErrorResponse(response)) {
@@ -136,6 +136,43 @@ class HttpRequestClient extends Client {
   }
 }
 
+/// Serves the result of `_getOpenMetrics` as a plain text exposition, so that
+/// metrics scrapers can read it without a JSON-RPC client.
+class OpenMetricsRequestClient extends HttpRequestClient {
+  static final openMetricsContentType =
+      ContentType('text', 'plain', parameters: {'version': '0.0.4'});
+
+  OpenMetricsRequestClient(HttpRequest request, VMService service)
+      : super(request, service);
+
+  void post(Response? result) {
+    if (result == null) {
+      close();
+      return;
+    }
+    final payload = switch (result.kind) {
+      ResponsePayloadKind.String => result.payload as String,
+      ResponsePayloadKind.Utf8String => utf8.decode(result.payload),
+      ResponsePayloadKind.Binary => throw 'Can not handle binary responses',
+    };
+    final decoded = json.decode(payload);
+    final response = request.response;
+    response.headers.add('Access-Control-Allow-Origin', '*');
+    final metrics = decoded is Map ? decoded['result'] : null;
+    if (metrics is Map && metrics['type'] == '_OpenMetrics') {
+      response.headers.contentType = openMetricsContentType;
+      response.write(metrics['text']);
+    } else {
+      // Pass errors, e.g. a missing or unknown isolateId, through as JSON.
+      response.statusCode = HttpStatus.badRequest;
+      response.headers.contentType = HttpRequestClient.jsonContentType;
+      response.write(payload);
+    }
+    response.close();
+    close();
+  }
+}
+
 /// Responsible for launching a DevTools instance when the service is started
 /// via SIGQUIT.
 class _DebuggingSession {
@@ -223,6 +260,7 @@ class _DebuggingSession {
 
 class Server {
   static const WEBSOCKET_PATH = '/ws';
+  static const METRICS_PATH = '/metrics';
   static const ROOT_REDIRECT_PATH = '/index.html';
 
   final VMService _service;
@@ -627,6 +665,20 @@ class Server {
       _handleWebSocketRequest(request);
       return;
     }
+    if (path == METRICS_PATH) {
+      // GET /metrics?isolateId=isolates/... returns the metrics of that
+      // isolate and its group as text/plain; version=0.0.4.
+      final client = OpenMetricsRequestClient(request, _service);
+      final message = Message.fromUri(
+        client,
+        Uri(
+          path: '/_getOpenMetrics',
+          queryParameters: request.uri.queryParameters,
+        ),
+      );
+      client.onRequest(message); // exception free, no need to try catch
+      return;
+    }
     // Don't redirect HTTP VM service requests, just requests for Observatory
     // assets.
     if (!_serveObservatory && path == ROOT_REDIRECT_PATH) {
@@ -64,4 +64,8 @@ base class _ConditionVariableImpl extends NativeFieldWrapperClass1
   @patch
   @Native<Void Function(Handle)>(symbol: "ConditionVariable_Notify")
   external void notify();
+
+  @patch
+  @Native<Void Function(Handle)>(symbol: "ConditionVariable_NotifyAll")
+  external void notifyAll();
 }
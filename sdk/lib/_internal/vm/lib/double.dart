@@ -263,10 +263,17 @@ final class _Double implements double {
         return _cache[i + 1];
       }
     }
-    // TODO(koda): Consider optimizing all small integral values.
     if (identical(0.0, this)) {
       return "0.0";
     }
+    // Integral values below 2^53 are exact, so their shortest representation
+    // is the integer itself. -0.0 is excluded by the bounds.
+    final double magnitude = abs();
+    if (magnitude >= 1.0 &&
+        magnitude < 9007199254740992.0 &&
+        this == truncateToDouble()) {
+      return toInt().toString() + ".0";
+    }
     String result = _toString();
     // Replace the least recently inserted entry.
     _cache[_cacheEvictIndex] = this;
@@ -155,10 +155,9 @@ class _GrowableList<T> extends ListBase<T> {
   factory _GrowableList._ofArray(_Array<T> elements) {
     final int length = elements.length;
     if (length > 0) {
-      final data = _List(_adjustedCapacity(length));
-      for (int i = 0; i < length; i++) {
-        data[i] = elements[i];
-      }
+      // The backing store does not carry type arguments, so large arrays can
+      // be copied in bulk by the VM.
+      final data = elements._slice(0, length, false);
       final list = _GrowableList<T>._withData(data);
       list._setLength(length);
       return list;
@@ -297,6 +297,11 @@ class _RegExp implements RegExp {
   @pragma("vm:external-name", "RegExp_ExecuteMatchSticky")
   external List<int>? _ExecuteMatchSticky(String str, int start_index);
 
+  // The start and end of all matches from [start_index] on, as found by
+  // [allMatches], or null if there are none.
+  @pragma("vm:external-name", "RegExp_ExecuteMatchAll")
+  external Int32List? _ExecuteMatchAll(String str, int start_index);
+
   static Int32List _getRegisters(int registers_count) {
     var registers = _registers;
     if (registers == null || registers.length < registers_count) {
@@ -369,9 +369,13 @@ abstract final class _StringBase implements String {
     if (pattern is String) {
       String other = pattern;
       int maxIndex = this.length - other.length;
+      if (other.isEmpty) return start;
       // TODO: Use an efficient string search (e.g. BMH).
+      // Only compare the rest where the first code unit matches.
+      final first = other.codeUnitAt(0);
       for (int index = start; index <= maxIndex; index++) {
-        if (_substringMatches(index, other)) {
+        if (this.codeUnitAt(index) == first &&
+            _substringMatches(index, other)) {
           return index;
         }
       }
@@ -659,7 +663,20 @@ abstract final class _StringBase implements String {
     int length = 0; // Length of all fragments.
     int replacementLength = replacement.length;
 
-    if (replacementLength == 0) {
+    if (pattern is _RegExp) {
+      // Finds all matches in one call, without allocating a Match for each.
+      final offsets = pattern._ExecuteMatchAll(this, 0);
+      if (offsets != null) {
+        for (int i = 0; i < offsets.length; i += 2) {
+          length += _addReplaceSlice(matches, startIndex, offsets[i]);
+          if (replacementLength != 0) {
+            matches.add(replacement);
+            length += replacementLength;
+          }
+          startIndex = offsets[i + 1];
+        }
+      }
+    } else if (replacementLength == 0) {
       for (Match match in pattern.allMatches(this)) {
         length += _addReplaceSlice(matches, startIndex, match.start);
         startIndex = match.end;
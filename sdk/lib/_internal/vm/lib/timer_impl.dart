@@ -228,7 +228,9 @@ class _Timer implements Timer {
     if (!_isInHeap) return;
     bool update = _heap.isFirst(this);
     _heap.remove(this);
-    if (update) {
+    // The scheduled wakeup is left in place unless no timers are left, see
+    // _notifyEventHandler.
+    if (update && _heap.isEmpty) {
       _notifyEventHandler();
     }
   }
@@ -318,10 +320,13 @@ class _Timer implements Timer {
       _cancelWakeup();
       return;
     }
-    // Only send a message if the requested wakeup time differs from the
-    // already scheduled wakeup time.
+    // Only send a message if the requested wakeup time is earlier than the
+    // already scheduled wakeup time. Waking up early is harmless, no timers
+    // are run and the next wakeup is scheduled. This avoids a message to the
+    // event handler for every cancelled or rescheduled first timer, e.g. for
+    // idle timeouts which are reset on activity.
     var wakeupTime = _heap.first._wakeupTime;
-    if ((_scheduledWakeupTime == 0) || (wakeupTime != _scheduledWakeupTime)) {
+    if ((_scheduledWakeupTime == 0) || (wakeupTime < _scheduledWakeupTime)) {
       _scheduleWakeup(wakeupTime);
     }
   }
@@ -139,6 +139,22 @@ abstract final class _TypedListBase {
   void _fastSetRange(int start, int count, _TypedListBase from, int skipCount);
   void _slowSetRange(int start, int end, Iterable from, int skipCount);
 
+  // Ranges at least this long are filled by [_fillByCopying].
+  static const int _fillByCopyingThreshold = 32;
+
+  // Fills the elements from [start] to [end] with a copy of the element at
+  // [start], which is already set. The copied chunks double in size, so this
+  // takes a logarithmic number of memory moves.
+  void _fillByCopying(int start, int end) {
+    final count = end - start;
+    int filled = 1;
+    while (filled < count) {
+      final chunk = filled <= count - filled ? filled : count - filled;
+      _fastSetRange(start + filled, chunk, this, start);
+      filled += chunk;
+    }
+  }
+
   @pragma("vm:prefer-inline")
   bool get _containsUnsignedBytes => false;
 
@@ -472,6 +488,11 @@ base mixin _IntListMixin on _TypedListBase implements TypedDataList<int> {
     if (fillValue == null) {
       throw ArgumentError.notNull("fillValue");
     }
+    if (end - start >= _TypedListBase._fillByCopyingThreshold) {
+      this[start] = fillValue;
+      _fillByCopying(start, end);
+      return;
+    }
     for (var i = start; i < end; ++i) {
       this[i] = fillValue;
     }
@@ -809,6 +830,11 @@ base mixin _DoubleListMixin on _TypedListBase implements TypedDataList<double> {
     if (fillValue == null) {
       throw ArgumentError.notNull("fillValue");
     }
+    if (end - start >= _TypedListBase._fillByCopyingThreshold) {
+      this[start] = fillValue;
+      _fillByCopying(start, end);
+      return;
+    }
     for (var i = start; i < end; ++i) {
       this[i] = fillValue;
     }
@@ -1206,6 +1232,11 @@ base mixin _Float32x4ListMixin on _TypedListBase
     if (fillValue == null) {
       throw ArgumentError.notNull("fillValue");
     }
+    if (end - start >= _TypedListBase._fillByCopyingThreshold) {
+      this[start] = fillValue;
+      _fillByCopying(start, end);
+      return;
+    }
     for (var i = start; i < end; ++i) {
       this[i] = fillValue;
     }
@@ -1544,6 +1575,11 @@ base mixin _Int32x4ListMixin on _TypedListBase
     if (fillValue == null) {
       throw ArgumentError.notNull("fillValue");
     }
+    if (end - start >= _TypedListBase._fillByCopyingThreshold) {
+      this[start] = fillValue;
+      _fillByCopying(start, end);
+      return;
+    }
     for (var i = start; i < end; ++i) {
       this[i] = fillValue;
     }
@@ -1883,6 +1919,11 @@ base mixin _Float64x2ListMixin on _TypedListBase
     if (fillValue == null) {
       throw ArgumentError.notNull("fillValue");
     }
+    if (end - start >= _TypedListBase._fillByCopyingThreshold) {
+      this[start] = fillValue;
+      _fillByCopying(start, end);
+      return;
+    }
     for (var i = start; i < end; ++i) {
       this[i] = fillValue;
     }
@@ -1223,9 +1223,16 @@ class _BigIntImpl implements BigInt {
     if (used == 0 || otherUsed == 0) {
       return zero;
     }
-    var resultUsed = used + otherUsed;
     var digits = _digits;
     var otherDigits = other._digits;
+    if (used >= _karatsubaThreshold &&
+        otherUsed >= _karatsubaThreshold &&
+        used <= 2 * otherUsed &&
+        otherUsed <= 2 * used) {
+      var result = _karatsuba(abs(), other.abs());
+      return _isNegative != other._isNegative ? -result : result;
+    }
+    var resultUsed = used + otherUsed;
     var resultDigits = _newDigits(resultUsed);
     var i = 0;
     while (i < otherUsed) {
@@ -1235,6 +1242,40 @@ class _BigIntImpl implements BigInt {
         _isNegative != other._isNegative, resultUsed, resultDigits);
   }
 
+  /// Minimum number of digits of both operands for which [operator *] uses
+  /// Karatsuba multiplication instead of the quadratic schoolbook method.
+  static const int _karatsubaThreshold = 64;
+
+  /// Returns the non-negative big integer formed by the low [n] digits of
+  /// this non-negative big integer.
+  _BigIntImpl _lowDigits(int n) {
+    assert(!_isNegative);
+    if (_used <= n) return this;
+    return new _BigIntImpl._(false, n, _cloneDigits(_digits, 0, n, n));
+  }
+
+  /// Multiplies the non-negative big integers [x] and [y] of similar size by
+  /// splitting them in halves and computing three half-sized products:
+  ///
+  ///     x*y = z2*B^(2*half) + z1*B^half + z0, where
+  ///     z0 = x0*y0, z2 = x1*y1, z1 = (x0 + x1)*(y0 + y1) - z0 - z2.
+  ///
+  /// Products of operands below [_karatsubaThreshold] digits fall back to the
+  /// schoolbook method in [operator *].
+  static _BigIntImpl _karatsuba(_BigIntImpl x, _BigIntImpl y) {
+    assert(!x._isNegative && !y._isNegative);
+    var used = x._used > y._used ? x._used : y._used;
+    var half = (used + 1) >> 1;
+    var x0 = x._lowDigits(half);
+    var x1 = x._drShift(half);
+    var y0 = y._lowDigits(half);
+    var y1 = y._drShift(half);
+    var z0 = x0 * y0;
+    var z2 = x1 * y1;
+    var z1 = (x0 + x1) * (y0 + y1) - z0 - z2;
+    return z2._dlShift(2 * half) + z1._dlShift(half) + z0;
+  }
+
   // resultDigits[0..resultUsed-1] =
   //     xDigits[0..xUsed-1]*otherDigits[0..otherUsed-1].
   // Returns resultUsed = xUsed + otherUsed.
@@ -576,8 +576,16 @@ mixin _LinkedHashMapMixin<K, V> on _HashBase, _EqualsAndHashCode {
 
   // If key is present, returns the index of the value in _data, else returns
   // the negated insertion point in index.
+  //
+  // Probes are masked by size - 1, where size is index.length, and an entry
+  // below maxEntries only comes from a pair with a matching hash pattern,
+  // which refers to used data. Both arrays are read once, so _equals
+  // modifying the map cannot make these accesses go out of bounds.
+  @pragma('vm:unsafe:no-bounds-checks')
   int _findValueOrInsertPoint(
       K key, int fullHash, int hashPattern, int size, Uint32List index) {
+    assert(size == index.length);
+    final data = _data;
     final int sizeMask = size - 1;
     final int maxEntries = size >> 1;
     int i = _HashBase._firstProbe(fullHash, sizeMask);
@@ -592,7 +600,7 @@ mixin _LinkedHashMapMixin<K, V> on _HashBase, _EqualsAndHashCode {
         final int entry = hashPattern ^ pair;
         if (entry < maxEntries) {
           final int d = entry << 1;
-          if (_equals(key, _data[d])) {
+          if (_equals(key, data[d])) {
             return d + 1;
           }
         }
@@ -622,8 +630,9 @@ mixin _LinkedHashMapMixin<K, V> on _HashBase, _EqualsAndHashCode {
   }
 
   V putIfAbsent(K key, V ifAbsent()) {
-    final int size = _index.length;
+    // Compute the hash first, as it may modify the map.
     final int fullHash = _hashCode(key);
+    final int size = _index.length;
     final int hashPattern = _HashBase._hashPattern(fullHash, _hashMask, size);
     final int d =
         _findValueOrInsertPoint(key, fullHash, hashPattern, size, _index);
@@ -673,26 +682,31 @@ mixin _LinkedHashMapMixin<K, V> on _HashBase, _EqualsAndHashCode {
   }
 
   // If key is absent, return _data (which is never a value).
+  //
+  // See _findValueOrInsertPoint for why the accesses are in bounds.
+  @pragma('vm:unsafe:no-bounds-checks')
   Object? _getValueOrData(Object? key) {
-    final int size = _index.length;
+    final int fullHash = _hashCode(key);
+    final index = _index;
+    final data = _data;
+    final int size = index.length;
     final int sizeMask = size - 1;
     final int maxEntries = size >> 1;
-    final int fullHash = _hashCode(key);
     final int hashPattern = _HashBase._hashPattern(fullHash, _hashMask, size);
     int i = _HashBase._firstProbe(fullHash, sizeMask);
-    int pair = _index[i];
+    int pair = index[i];
     while (pair != _HashBase._UNUSED_PAIR) {
       if (pair != _HashBase._DELETED_PAIR) {
         final int entry = hashPattern ^ pair;
         if (entry < maxEntries) {
           final int d = entry << 1;
-          if (_equals(key, _data[d])) {
-            return _data[d + 1];
+          if (_equals(key, data[d])) {
+            return data[d + 1];
           }
         }
       }
       i = _HashBase._nextProbe(i, sizeMask);
-      pair = _index[i];
+      pair = index[i];
     }
     return _data;
   }
@@ -975,23 +989,31 @@ mixin _LinkedHashSetMixin<E> on _HashBase, _EqualsAndHashCode {
   }
 
   // If key is absent, return _data (which is never a value).
+  //
+  // Probes are masked by size - 1, where size is index.length, and an entry
+  // below maxEntries only comes from a pair with a matching hash pattern,
+  // which refers to used data. Both arrays are read once, so _equals
+  // modifying the set cannot make these accesses go out of bounds.
+  @pragma('vm:unsafe:no-bounds-checks')
   Object? _getKeyOrData(Object? key) {
-    final int size = _index.length;
+    final int fullHash = _hashCode(key);
+    final index = _index;
+    final data = _data;
+    final int size = index.length;
     final int sizeMask = size - 1;
     final int maxEntries = size >> 1;
-    final int fullHash = _hashCode(key);
     final int hashPattern = _HashBase._hashPattern(fullHash, _hashMask, size);
     int i = _HashBase._firstProbe(fullHash, sizeMask);
-    int pair = _index[i];
+    int pair = index[i];
     while (pair != _HashBase._UNUSED_PAIR) {
       if (pair != _HashBase._DELETED_PAIR) {
         final int d = hashPattern ^ pair;
-        if (d < maxEntries && _equals(key, _data[d])) {
-          return _data[d]; // Note: Must return the existing key.
+        if (d < maxEntries && _equals(key, data[d])) {
+          return data[d]; // Note: Must return the existing key.
         }
       }
       i = _HashBase._nextProbe(i, sizeMask);
-      pair = _index[i];
+      pair = index[i];
     }
     return _data;
   }
@@ -64,4 +64,7 @@ abstract interface class ConditionVariable {
 
   /// Wake up at least one thread waiting on this condition variable.
   external void notify();
+
+  /// Wake up all threads waiting on this condition variable.
+  external void notifyAll();
 }
@@ -792,6 +792,21 @@ abstract interface class RandomAccessFile {
   /// Throws a [FileSystemException] if the operation fails.
   int readIntoSync(List<int> buffer, [int start = 0, int? end]);
 
+  /// Synchronously maps [length] bytes of the file, starting at [start], into
+  /// memory.
+  ///
+  /// Returns an unmodifiable [Uint8List] that reads directly from the mapped
+  /// pages of the file, without copying them. The mapping is removed when the
+  /// returned list is garbage collected, and it stays valid after this file is
+  /// closed. The range from [start] to `start + length` must lie within the
+  /// current length of the file.
+  ///
+  /// On platforms which do not support memory mapping files, the range is
+  /// read into memory instead.
+  ///
+  /// Throws a [FileSystemException] if the operation fails.
+  Uint8List mapSync(int start, int length);
+
   /// Writes a single byte to the file.
   ///
   /// Returns a `Future<RandomAccessFile>` that completes with this
@@ -700,6 +700,7 @@ abstract class _RandomAccessFileOps {
   length();
   flush();
   lock(int lock, int start, int end);
+  map(int start, int length);
 }
 
 @pragma("vm:entry-point")
@@ -838,6 +839,20 @@ class _RandomAccessFile implements RandomAccessFile {
     return result;
   }
 
+  Uint8List mapSync(int start, int length) {
+    _checkAvailable();
+    RangeError.checkNotNegative(start, "start");
+    RangeError.checkNotNegative(length, "length");
+    if (length == 0) {
+      return new Uint8List(0).asUnmodifiableView();
+    }
+    var result = _ops.map(start, length);
+    if (result is! Uint8List) {
+      throw new FileSystemException("mapSync failed", path, result as OSError);
+    }
+    return result;
+  }
+
   Future<RandomAccessFile> writeByte(int value) {
     // TODO(40614): Remove once non-nullability is sound.
     ArgumentError.checkNotNull(value, "value");
@@ -382,6 +382,18 @@ enum _RawSocketOptions {
 /// It allows for fine grained control of the socket options, and its values
 /// will be passed to the underlying platform's implementation of setsockopt and
 /// getsockopt.
+///
+/// Options which return a structure can be read with a [value] large enough
+/// to hold it. For example, on Linux the `TCP_INFO` option (11) returns the
+/// kernel's view of a TCP connection, including the smoothed round trip time
+/// in microseconds at offset 68 and the congestion window at offset 80:
+/// ```dart
+/// final info = socket.getRawOption(
+///     RawSocketOption(RawSocketOption.levelTcp, 11, Uint8List(104)));
+/// final data = ByteData.sublistView(info);
+/// final rtt = data.getUint32(68, Endian.host);
+/// final cwnd = data.getUint32(80, Endian.host);
+/// ```
 @Since("2.2")
 final class RawSocketOption {
   /// Creates a [RawSocketOption] for [RawSocket.getRawOption]
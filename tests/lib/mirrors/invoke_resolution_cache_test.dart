@@ -0,0 +1,60 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Tests that repeated reflective invocations of the same names on different
+// receivers resolve to each receiver's own members.
+
+library test.invoke_resolution_cache_test;
+
+import 'dart:mirrors';
+
+import 'package:expect/expect.dart';
+
+class A {
+  var field = 'A.field';
+  method(x) => 'A.method($x)';
+  get getter => 'A.getter';
+}
+
+class B extends A {
+  method(x) => 'B.method($x)';
+}
+
+class C {
+  var field = 'C.field';
+  method(x, {y = 'y'}) => 'C.method($x, $y)';
+  noSuchMethod(invocation) => 'C.noSuchMethod';
+}
+
+void main() {
+  for (int i = 0; i < 3; i++) {
+    final a = reflect(A());
+    final b = reflect(B());
+    final c = reflect(C());
+
+    Expect.equals('A.method(1)', a.invoke(#method, [1]).reflectee);
+    Expect.equals('B.method(2)', b.invoke(#method, [2]).reflectee);
+    Expect.equals('C.method(3, y)', c.invoke(#method, [3]).reflectee);
+    Expect.equals(
+        'C.method(3, z)', c.invoke(#method, [3], {#y: 'z'}).reflectee);
+
+    Expect.equals('A.field', a.getField(#field).reflectee);
+    Expect.equals('A.field', b.getField(#field).reflectee);
+    Expect.equals('C.field', c.getField(#field).reflectee);
+    Expect.equals('A.getter', b.getField(#getter).reflectee);
+    Expect.equals('C.noSuchMethod', c.getField(#getter).reflectee);
+
+    b.setField(#field, 'B.field');
+    Expect.equals('B.field', b.getField(#field).reflectee);
+    Expect.equals('A.field', a.getField(#field).reflectee);
+
+    Expect.equals('B.method(4)', b.getField(#method).reflectee(4));
+
+    // Closures and records share a class.
+    Expect.equals(5, reflect((x) => x).invoke(#call, [5]).reflectee);
+    Expect.equals(6, reflect((x, y) => y).invoke(#call, [0, 6]).reflectee);
+    Expect.equals(7, reflect((7, 8)).getField(#$1).reflectee);
+    Expect.equals(9, reflect((a: 9)).getField(#a).reflectee);
+  }
+}
@@ -0,0 +1,50 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Tests RandomAccessFile.mapSync.
+
+import 'dart:io';
+import 'dart:typed_data';
+
+import 'package:expect/expect.dart';
+import 'package:path/path.dart' as path;
+
+main() {
+  final tempDir = Directory.systemTemp.createTempSync('file_map');
+  try {
+    final file = File(path.join(tempDir.path, 'data'));
+    final bytes = Uint8List(200 * 1024);
+    for (int i = 0; i < bytes.length; i++) {
+      bytes[i] = i % 251;
+    }
+    file.writeAsBytesSync(bytes);
+
+    final raf = file.openSync();
+    raf.setPositionSync(17);
+
+    final all = raf.mapSync(0, bytes.length);
+    Expect.listEquals(bytes, all);
+
+    // Unaligned start in the second 64KB block of the file.
+    final start = 64 * 1024 + 123;
+    final part = raf.mapSync(start, 1000);
+    Expect.listEquals(bytes.sublist(start, start + 1000), part);
+
+    // The mapping is read-only and does not move the file position.
+    Expect.throwsUnsupportedError(() => part[0] = 0);
+    Expect.equals(17, raf.positionSync());
+
+    Expect.equals(0, raf.mapSync(10, 0).length);
+    Expect.throws<FileSystemException>(
+        () => raf.mapSync(bytes.length - 10, 11));
+    Expect.throwsRangeError(() => raf.mapSync(-1, 10));
+
+    // Mappings outlive the file.
+    raf.closeSync();
+    Expect.equals(bytes[start + 999], part[999]);
+    Expect.throws<FileSystemException>(() => raf.mapSync(0, 1));
+  } finally {
+    tempDir.deleteSync(recursive: true);
+  }
+}
@@ -3,6 +3,10 @@
 // BSD-style license that can be found in the LICENSE file.
 
 // Test creating a large number of socket connections.
+//
+// VMOptions=
+// VMOptions=--event-handler-threads=4
+
 library ServerTest;
 
 import "package:expect/expect.dart";
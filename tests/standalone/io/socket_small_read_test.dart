@@ -0,0 +1,48 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Reads of up to 16KB are copied out of a per-thread buffer. Checks that they
+// return the bytes that were sent.
+
+import "dart:io";
+import "dart:typed_data";
+
+import "package:async_helper/async_helper.dart";
+import "package:expect/expect.dart";
+
+Future<void> testSmallRead(int length) async {
+  final data = new Uint8List(length);
+  for (int i = 0; i < length; i++) {
+    data[i] = i & 0xff;
+  }
+
+  final server = await ServerSocket.bind(InternetAddress.loopbackIPv4, 0);
+  server.listen((Socket client) {
+    client.add(data);
+    client.close();
+  });
+
+  final socket = await RawSocket.connect(server.address, server.port);
+  final received = <int>[];
+  await for (RawSocketEvent event in socket) {
+    if (event == RawSocketEvent.read) {
+      final Uint8List? bytes = socket.read();
+      if (bytes != null) {
+        received.addAll(bytes);
+      }
+    } else if (event == RawSocketEvent.readClosed) {
+      socket.close();
+    }
+  }
+  Expect.listEquals(data, received);
+  await server.close();
+}
+
+Future<void> main() async {
+  asyncStart();
+  await testSmallRead(1);
+  await testSmallRead(100);
+  await testSmallRead(16 * 1024);
+  asyncEnd();
+}
@@ -0,0 +1,35 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Reads the Linux TCP_INFO structure of a connected socket through
+// RawSocketOption.
+
+import "dart:io";
+import "dart:typed_data";
+
+import "package:expect/expect.dart";
+
+const int tcpInfo = 11;
+const int tcpEstablished = 1;
+
+Future<void> main() async {
+  if (!Platform.isLinux && !Platform.isAndroid) return;
+  final server = await ServerSocket.bind(InternetAddress.loopbackIPv4, 0);
+  server.listen((client) {
+    client.listen(client.add, onDone: client.close);
+  });
+  final socket = await Socket.connect(server.address, server.port);
+  socket.add([1, 2, 3]);
+  await socket.first;
+
+  final info = socket.getRawOption(
+      RawSocketOption(RawSocketOption.levelTcp, tcpInfo, Uint8List(104)));
+  final data = ByteData.sublistView(info);
+  Expect.equals(tcpEstablished, data.getUint8(0));
+  // tcpi_snd_cwnd is at least one segment on an established connection.
+  Expect.isTrue(data.getUint32(80, Endian.host) > 0);
+
+  socket.destroy();
+  await server.close();
+}
@@ -250,6 +250,18 @@ void testRoundTripLarge() {
   }
 }
 
+// Chunks of up to 16KB are copied into the Dart heap instead of being
+// returned in an external buffer.
+void testRoundTripSmall() {
+  for (var gzip in [true, false]) {
+    final uncompressedData = List.generate(100, (i) => i % 7);
+    final compressedData = ZLibEncoder(gzip: gzip).convert(uncompressedData);
+    Expect.isTrue(compressedData.length < 16 * 1024);
+    final decodedData = new ZLibDecoder().convert(compressedData);
+    Expect.listEquals(uncompressedData, decodedData);
+  }
+}
+
 void testZlibWithDictionary() {
   var dict = [102, 111, 111, 98, 97, 114];
   var data = [98, 97, 114, 102, 111, 111];
@@ -353,6 +365,7 @@ void main() {
   testZlibInflateThrowsWithSmallerWindow();
   testZlibInflateWithLargerWindow();
   testRoundTripLarge();
+  testRoundTripSmall();
   testZlibWithDictionary();
   testConcatenatedBlocksGZip();
   testConcatenatedBlocksZLib();
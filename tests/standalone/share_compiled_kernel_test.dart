@@ -0,0 +1,65 @@
+// Copyright (c) 2024, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Checks that with --share-compiled-kernel a script spawned with
+// Isolate.spawnUri is compiled again after one of its imports changes.
+
+import "dart:io";
+
+import "package:expect/expect.dart";
+
+const String mainSource = r'''
+import 'dart:io';
+import 'dart:isolate';
+
+Future<int> spawnChild() async {
+  final port = ReceivePort();
+  await Isolate.spawnUri(Uri.file('child.dart'), const <String>[],
+      port.sendPort);
+  final int value = await port.first;
+  return value;
+}
+
+Future<void> main(List<String> args) async {
+  print(await spawnChild());
+  print(await spawnChild());
+  File('dep.dart').writeAsStringSync('const int value = 2;\n');
+  print(await spawnChild());
+}
+''';
+
+const String childSource = r'''
+import 'dart:isolate';
+
+import 'dep.dart';
+
+void main(List<String> args, SendPort port) {
+  port.send(value);
+}
+''';
+
+void main() {
+  final dir = Directory.systemTemp.createTempSync('share_compiled_kernel');
+  try {
+    File('${dir.path}/main.dart').writeAsStringSync(mainSource);
+    File('${dir.path}/child.dart').writeAsStringSync(childSource);
+    File('${dir.path}/dep.dart').writeAsStringSync('const int value = 1;\n');
+
+    final result = Process.runSync(
+        Platform.executable,
+        [
+          ...Platform.executableArguments,
+          '--share-compiled-kernel',
+          'main.dart',
+        ],
+        workingDirectory: dir.path);
+    print(result.stdout);
+    print(result.stderr);
+    Expect.equals(0, result.exitCode);
+    Expect.listEquals(
+        ['1', '1', '2'], (result.stdout as String).trim().split('\n'));
+  } finally {
+    dir.deleteSync(recursive: true);
+  }
+}